@@ -9,7 +9,7 @@ if (-not (Test-Path "bin")) {
 }
 
 # Parâmetros de compilação
-$CFLAGS = "-Wall -Wextra -pedantic -std=c++17 -Iheader -Ilib"
+$CFLAGS = "-Wall -Wextra -pedantic -std=c++17 -pthread -Iheader -Ilib"
 
 # Arquivos fonte
 $SOURCES = @(
@@ -18,8 +18,31 @@ $SOURCES = @(
     "src/item.cpp",
     "src/estoque.cpp",
     "src/camarim.cpp",
+    "src/consumo.cpp",
+    "src/metricas.cpp",
+    "src/idempotencia.cpp",
+    "src/arquivo.cpp",
     "src/pedido.cpp",
     "src/listacompras.cpp",
+    "src/listaautomatica.cpp",
+    "src/orcamento.cpp",
+    "src/fornecedor.cpp",
+    "src/consolidacao.cpp",
+    "src/recebimento.cpp",
+    "src/snapshot.cpp",
+    "src/checksum.cpp",
+    "src/alteracoes.cpp",
+    "src/pontocontrole.cpp",
+    "src/exportacao.cpp",
+    "src/arvoreb.cpp",
+    "src/copia.cpp",
+    "src/rider.cpp",
+    "src/reposicao.cpp",
+    "src/atribuicao.cpp",
+    "src/agenda.cpp",
+    "src/equipe.cpp",
+    "src/evento.cpp",
+    "src/separacao.cpp",
     "src/main.cpp"
 )
 
@@ -0,0 +1,205 @@
+/**
+ * @file agenda.h
+ * @brief Definição da classe AgendaCamarins
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Em um festival o mesmo camarim recebe vários artistas ao longo do dia.
+ * A agenda guarda reservas por horário e impede dois artistas no mesmo
+ * camarim (ou um artista em dois camarins) ao mesmo tempo.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef AGENDA_H  // Se AGENDA_H não foi definido
+#define AGENDA_H  // Define AGENDA_H
+
+// Bibliotecas necessárias
+#include <string>    // Para exibição de horários
+#include <vector>    // Para resultados de consultas
+#include <map>       // Árvore ordenada por início (uma por camarim)
+#include <iostream>  // Para operator<<
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @struct Reserva
+ * @brief Ocupação de um camarim por um artista no intervalo [inicio, fim)
+ *
+ * Horários em MINUTOS desde o início do festival (dia 1, 00:00)
+ */
+struct Reserva {
+    int id;          // ID único da reserva
+    int camarimId;   // Camarim ocupado
+    int artistaId;   // Artista que ocupa
+    int inicio;      // Minuto de entrada (incluído)
+    int fim;         // Minuto de saída (não incluído)
+
+    /**
+     * @brief Construtor padrão - inicializa vazio
+     */
+    Reserva() : id(0), camarimId(0), artistaId(0), inicio(0), fim(0) {}
+
+    /**
+     * @brief Construtor parametrizado
+     */
+    Reserva(int id, int camarimId, int artistaId, int inicio, int fim)
+        : id(id), camarimId(camarimId), artistaId(artistaId), inicio(inicio), fim(fim) {}
+
+    /**
+     * @brief Exibe reserva em uma linha (ex: "#3 Camarim 2, Artista 5: Dia 1 14:00 - Dia 1 16:30")
+     */
+    string exibir() const;
+
+    /**
+     * @brief Sobrecarga do operador << para cout
+     */
+    friend ostream& operator<<(ostream& os, const Reserva& reserva);
+};  // Fim da struct Reserva
+
+/**
+ * @class AgendaCamarins
+ * @brief Reservas de camarins por horário com detecção de conflitos
+ *
+ * ESTRUTURA: para cada camarim (e para cada artista), um map ordenado
+ * por horário de início. Como as reservas de um camarim nunca se
+ * sobrepõem, os fins também ficam ordenados, e o map funciona como
+ * uma árvore de intervalos:
+ * - Conflitos de [t1, t2): O(log n + k) (k = reservas encontradas)
+ * - Camarim livre?: O(log n)
+ */
+class AgendaCamarins {
+private:  // Atributos privados
+    map<int, map<int, Reserva>> porCamarim;  // camarimId → (inicio → reserva)
+    map<int, map<int, Reserva>> porArtista;  // artistaId → (inicio → reserva)
+    map<int, Reserva> porId;                 // reservaId → reserva (para cancelar)
+    int proximoId;                           // Contador para gerar IDs únicos
+    vector<int>* alterados;                  // Reservas alteradas desde a última confirmação (nullptr = sem log)
+    friend class ArquivoSnapshot;            // Recoloca reservas com os IDs salvos
+    friend class LogAlteracoes;              // Reaplica reservas gravadas no log
+
+    /**
+     * @brief Reservas de uma árvore que se sobrepõem a [inicio, fim)
+     */
+    static vector<Reserva> sobrepostas(const map<int, Reserva>& arvore, int inicio, int fim);
+
+    /**
+     * @brief true se alguma reserva da árvore se sobrepõe a [inicio, fim) - O(log n)
+     */
+    static bool ocupado(const map<int, Reserva>& arvore, int inicio, int fim);
+
+    /**
+     * @brief Valida intervalo
+     * @throws ValidacaoException se inicio < 0 ou fim <= inicio
+     */
+    static void validarIntervalo(int inicio, int fim);
+
+    /**
+     * @brief Anota a reserva no log de alterações (se ligado)
+     */
+    void anotar(int reservaId);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - agenda vazia
+     */
+    AgendaCamarins();
+
+    /**
+     * @brief Reserva camarim para um artista
+     * @param camarimId ID do camarim
+     * @param artistaId ID do artista
+     * @param inicio Minuto de entrada
+     * @param fim Minuto de saída (não incluído)
+     * @return ID da reserva
+     * @throws ValidacaoException se o intervalo é inválido
+     * @throws CamarimException se o camarim já está ocupado no intervalo
+     * @throws ArtistaException se o artista já está em outro camarim no intervalo
+     */
+    int reservar(int camarimId, int artistaId, int inicio, int fim);
+
+    /**
+     * @brief Reserva um lote inteiro (ex: programação de 3 dias) - tudo ou nada
+     * @param lote Reservas (IDs são ignorados e gerados aqui)
+     * @return IDs gerados, na ordem do lote
+     * @throws mesmas exceções de reservar(); em caso de erro nada é gravado
+     *
+     * Ordena o lote por camarim/artista e início, confere vizinhos
+     * dentro do lote e contra a agenda existente: O(m log m + m log n)
+     */
+    vector<int> reservarLote(const vector<Reserva>& lote);
+
+    /**
+     * @brief Cancela reserva
+     * @return true se existia
+     */
+    bool cancelar(int reservaId);
+
+    /**
+     * @brief Remove todas as reservas de um camarim (camarim excluído)
+     */
+    void removerCamarim(int camarimId);
+
+    /**
+     * @brief Remove todas as reservas de um artista (artista excluído)
+     */
+    void removerArtista(int artistaId);
+
+    /**
+     * @brief Reservas do camarim que se sobrepõem a [inicio, fim) - O(log n + k)
+     */
+    vector<Reserva> conflitos(int camarimId, int inicio, int fim) const;
+
+    /**
+     * @brief Camarim está livre durante [inicio, fim)? - O(log n)
+     */
+    bool livre(int camarimId, int inicio, int fim) const;
+
+    /**
+     * @brief Filtra os camarins livres durante [inicio, fim)
+     * @param camarimIds Camarins candidatos (ex: todos os cadastrados)
+     * @return IDs dos camarins livres, na ordem recebida
+     */
+    vector<int> camarinsLivres(const vector<int>& camarimIds, int inicio, int fim) const;
+
+    /**
+     * @brief Artista que ocupa o camarim em um instante
+     * @return ID do artista (0 = camarim vazio)
+     */
+    int ocupante(int camarimId, int instante) const;
+
+    /**
+     * @brief Agenda completa de um camarim, em ordem de horário
+     */
+    vector<Reserva> agendaDoCamarim(int camarimId) const;
+
+    /**
+     * @brief Agenda completa de um artista, em ordem de horário
+     */
+    vector<Reserva> agendaDoArtista(int artistaId) const;
+
+    /**
+     * @brief Total de reservas
+     */
+    size_t quantidade() const;
+
+    /**
+     * @brief Converte minuto do festival para texto ("Dia 2 14:30")
+     */
+    static string formatarHorario(int minutos);
+
+    /**
+     * @brief Converte dia + hora + minuto em minutos do festival
+     * @throws ValidacaoException se dia < 1, hora fora de 0-24 ou minuto fora de 0-59
+     */
+    static int horario(int dia, int hora, int minuto);
+
+    /**
+     * @brief Passa a anotar as reservas criadas e removidas
+     * @param alterados Lista preenchida a cada alteração (nullptr = desliga)
+     */
+    void ligarAlteracoes(vector<int>* alterados);
+};  // Fim da classe AgendaCamarins
+
+#endif // AGENDA_H
+// Fim do include guard
@@ -0,0 +1,208 @@
+/**
+ * @file alteracoes.h
+ * @brief Definição da classe LogAlteracoes
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Log único, só de acréscimo, das alterações de todos os eventos: itens,
+ * artistas, camarins, estoque (e estoque mínimo), pedidos, listas de
+ * compras, riders, equipe, reservas da agenda e fornecedores com suas
+ * ofertas. Cada registro tem tipo, número de sequência e CRC-32C; na
+ * partida, o estado salvo é carregado e o log é reaplicado por cima dele.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef ALTERACOES_H  // Se ALTERACOES_H não foi definido
+#define ALTERACOES_H  // Define ALTERACOES_H
+
+// Bibliotecas necessárias
+#include <map>       // Para eventos acompanhados
+#include <vector>    // Para IDs alterados
+#include <string>    // Para prefixo dos arquivos e quadros montados
+#include <fstream>   // Para o arquivo da geração aberta
+#include <cstdint>   // Para uint64_t/int64_t
+
+using namespace std;  // Namespace padrão
+
+class Evento;               // Declarações antecipadas (evento.h é pesado)
+class GerenciadorEventos;
+class LeitorCampos;         // Definido em alteracoes.cpp
+
+/**
+ * @struct AlteracoesEvento
+ * @brief IDs alterados de um evento desde a última confirmação
+ *
+ * Os gerenciadores (e os objetos deles) só fazem push_back aqui:
+ * repetições são removidas na confirmação
+ */
+struct AlteracoesEvento {
+    Evento* evento;
+    vector<int> itens;
+    vector<int> artistas;
+    vector<int> camarins;
+    vector<int> estoque;    // itemId
+    vector<int> pedidos;
+    vector<int> listas;
+    vector<int> riders;
+    vector<int> equipe;
+    vector<int> reservas;
+    vector<int> fornecedores;  // Ofertas vão junto com o fornecedor
+    vector<int> minimos;       // itemId (estoque mínimo da lista automática)
+
+    AlteracoesEvento() : evento(nullptr) {}
+};  // Fim da struct AlteracoesEvento
+
+/**
+ * @struct ResumoReproducao
+ * @brief O que foi reaplicado na partida
+ */
+struct ResumoReproducao {
+    size_t arquivos;            // Gerações lidas
+    size_t registros;           // Registros aplicados
+    uint64_t bytesDescartados;  // Final rasgado ou corrompido (não aplicado)
+    uint64_t maiorGeracao;      // Maior geração encontrada (0 = nenhuma)
+
+    ResumoReproducao() : arquivos(0), registros(0), bytesDescartados(0), maiorGeracao(0) {}
+};  // Fim da struct ResumoReproducao
+
+/**
+ * @class LogAlteracoes
+ * @brief Torna duráveis as alterações feitas nos gerenciadores
+ *
+ * REGISTRO DE ESTADO (não de operação): a cada confirmação, cada entidade
+ * alterada é gravada como ficou (ou como removida). Reaplicar é substituir,
+ * então várias alterações da mesma entidade entre duas confirmações viram
+ * um registro só, e reaplicar duas vezes não muda o resultado.
+ *
+ * QUADRO: [tamanho][CRC-32C do corpo][corpo = sequência, tipo, evento, campos].
+ * Um quadro com CRC errado ou incompleto encerra a leitura daquela geração
+ * (queda no meio de uma escrita), sem afetar as gerações seguintes.
+ *
+ * GERAÇÕES: cada ponto de controle fecha a geração atual e abre a próxima
+ * (prefixo + número + ".log"). O estado salvo guarda a última geração que
+ * ele já contém; as anteriores podem ser apagadas.
+ */
+class LogAlteracoes {
+private:  // ENCAPSULAMENTO: atributos privados
+    string prefixo;                          // Arquivos: prefixo + geração + ".log"
+    uint64_t geracao;                        // Geração aberta (0 = não configurado)
+    ofstream saida;                          // Arquivo da geração aberta
+    uint64_t sequencia;                      // Último número de sequência da geração
+    uint64_t bytesGeracao;                   // Tamanho da geração aberta
+    string pendente;                         // Quadros montados e ainda não escritos
+    size_t quadrosPendentes;                 // Quantos quadros há em pendente
+    map<int, AlteracoesEvento> acompanhados; // Chave = ID do evento (endereços estáveis)
+
+    /**
+     * @brief Monta um quadro no fim de pendente
+     */
+    void anexarQuadro(uint32_t tipo, int eventoId, const string& campos);
+
+    /**
+     * @brief Monta os registros das entidades alteradas de um evento
+     * @return Número de registros montados
+     */
+    size_t montarRegistros(AlteracoesEvento& alteracoes, int64_t agoraNs);
+
+    /**
+     * @brief Abre (criando) o arquivo da geração atual
+     * @return false se o arquivo não pôde ser criado
+     */
+    bool abrirGeracao();
+
+    /**
+     * @brief Aplica um registro já validado pelo CRC
+     * @return false se o evento do registro não existe (registro ignorado)
+     */
+    static bool aplicar(uint32_t tipo, int eventoId, LeitorCampos& campos,
+                        GerenciadorEventos& eventos, int64_t agoraNs, map<int, Evento*>& tocados);
+
+    /**
+     * @brief Gerações existentes em disco, em ordem crescente
+     */
+    static vector<uint64_t> listarGeracoes(const string& prefixo);
+
+    static string caminhoGeracao(const string& prefixo, uint64_t geracao);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - log desligado (alterações não são anotadas)
+     */
+    LogAlteracoes();
+
+    // Gerenciadores guardam ponteiros para dentro do log
+    LogAlteracoes(const LogAlteracoes&) = delete;
+    LogAlteracoes& operator=(const LogAlteracoes&) = delete;
+
+    /**
+     * @brief Começa a gravar em uma geração nova
+     * @param prefixo Prefixo dos arquivos
+     * @param geracao Número da geração (maior que todas as existentes)
+     * @throws PersistenciaException se o arquivo não puder ser criado
+     *         (a numeração continua valendo; alterações só ficam em memória)
+     */
+    void abrir(const string& prefixo, uint64_t geracao);
+
+    /**
+     * @brief Passa a acompanhar as alterações de um evento
+     *
+     * Liga os gerenciadores do evento ao log e registra o evento
+     */
+    void acompanhar(Evento& evento);
+
+    /**
+     * @brief Registra a remoção de um evento e deixa de acompanhá-lo
+     * @param eventoId ID do evento (chamar ANTES de destruí-lo)
+     */
+    void esquecer(int eventoId);
+
+    /**
+     * @brief Grava as alterações anotadas desde a última confirmação
+     * @param agoraNs Instante atual (instantes dos pedidos são relativos a ele)
+     * @return Número de registros gravados
+     * @throws PersistenciaException se a escrita falhar
+     *
+     * Uma escrita para todos os registros (confirmação em grupo)
+     */
+    size_t confirmar(int64_t agoraNs);
+
+    /**
+     * @brief Fecha a geração atual e abre a próxima
+     * @return Geração fechada (a que um ponto de controle passa a conter)
+     *
+     * Chamar logo após confirmar: a geração fechada fica completa
+     */
+    uint64_t rotacionar();
+
+    // ==================== GETTERS ====================
+    const string& getPrefixo() const;
+    uint64_t getGeracao() const;
+    uint64_t getBytesGeracao() const;
+    bool isGravando() const;  // false = arquivo não abriu (alterações só em memória)
+
+    /**
+     * @brief Reaplica as gerações posteriores ao estado carregado
+     * @param prefixo Prefixo dos arquivos
+     * @param geracaoEstado Geração já contida no estado carregado
+     * @param eventos Eventos carregados (ainda sem observadores)
+     * @param agoraNs Instante atual
+     * @return Resumo da reprodução
+     */
+    static ResumoReproducao reproduzir(const string& prefixo, uint64_t geracaoEstado,
+                                       GerenciadorEventos& eventos, int64_t agoraNs);
+
+    /**
+     * @brief Maior geração existente em disco (0 = nenhuma)
+     */
+    static uint64_t ultimaGeracao(const string& prefixo);
+
+    /**
+     * @brief Apaga as gerações até a informada (já contidas em um estado salvo)
+     * @return Número de arquivos apagados
+     */
+    static size_t apagarAte(const string& prefixo, uint64_t geracao);
+};  // Fim da classe LogAlteracoes
+
+#endif // ALTERACOES_H
+// Fim do include guard
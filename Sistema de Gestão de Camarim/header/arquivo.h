@@ -0,0 +1,150 @@
+/**
+ * @file arquivo.h
+ * @brief Definição da classe ArquivoPedidos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Arquivo "frio" de pedidos atendidos: pedidos antigos saem da memória
+ * e vão para um arquivo binário compacto, só de acréscimo (append-only).
+ * Um índice ID → posição em disco (árvore B+) permite consultar qualquer
+ * pedido sob demanda sem manter o histórico inteiro na memória.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef ARQUIVO_H  // Se ARQUIVO_H não foi definido
+#define ARQUIVO_H  // Define ARQUIVO_H
+
+// Bibliotecas necessárias
+#include <string>      // Para caminho e buffers de gravação
+#include <fstream>     // Para ifstream (leitura de registros)
+#include <vector>      // Para lote de pedidos a arquivar
+#include <memory>      // Para unique_ptr do índice
+#include <functional>  // Para o visitante da consulta por faixa
+#include <cstdint>     // Para uint64_t (posições e varints)
+
+using namespace std;  // Namespace padrão
+
+class Pedido;       // Declaração antecipada (pedido.h inclui este arquivo)
+class ArvoreBMais;  // Índice em disco (arvoreb.h)
+
+/**
+ * @class ArquivoPedidos
+ * @brief Armazenamento frio, compacto e append-only de pedidos
+ *
+ * FORMATO DO ARQUIVO:
+ * - Cabeçalho: "CMPA" + versão (1 byte)
+ * - Registros: tamanho (varint) + conteúdo do pedido + CRC-32C (4 bytes)
+ *   (arquivos da versão 1 não têm o CRC e continuam sem ele)
+ *
+ * COMPACTAÇÃO:
+ * - Inteiros gravados como VARINT (1 byte para valores < 128)
+ * - Timestamps gravados como diferença em relação à criação
+ *
+ * Registros nunca são reescritos: um pedido arquivado de novo
+ * (mesmo ID) apenas passa a apontar para o registro mais recente
+ *
+ * ÍNDICE (caminho + ".idx"): árvore B+ ID → posição com cache de tamanho
+ * fixo. O cabeçalho do índice guarda até onde o arquivo de dados já foi
+ * indexado; na abertura só o trecho depois disso é lido. Índice ausente,
+ * inválido ou interrompido no meio de uma alteração é refeito a partir
+ * dos dados (que continuam sendo a fonte da verdade).
+ */
+class ArquivoPedidos {
+private:  // Atributos privados
+    string caminho;                 // Caminho do arquivo em disco
+    unique_ptr<ArvoreBMais> indice; // Chave = ID do pedido, valor = posição do registro
+    size_t bytesCacheIndice;        // Memória do cache do índice
+    uint64_t tamanhoBytes;          // Tamanho atual do arquivo (próxima posição de escrita)
+    char versao;                    // Formato do arquivo aberto (define se há CRC)
+    size_t registrosCorrompidos;    // Trechos estragados no meio do arquivo (fora do índice)
+
+    /**
+     * @brief Abre o índice e indexa os registros que ele ainda não cobre
+     *
+     * Só o registro que vai até o fim do arquivo (queda durante gravação)
+     * é cortado. Estragado no meio (tamanho, CRC ou ID) fica sem índice e
+     * o arquivo não muda: a leitura continua no próximo registro com CRC
+     * certo (na versão 1, sem CRC, o resto do arquivo fica sem índice)
+     */
+    void carregarIndice();
+
+    /**
+     * @brief Lê e decodifica o registro em uma posição
+     * @throws PersistenciaException se o registro estiver corrompido
+     */
+    void lerRegistro(ifstream& entrada, uint64_t posicao, int id, Pedido& pedido) const;
+
+    /**
+     * @brief Codifica um pedido no formato compacto
+     */
+    static void codificar(const Pedido& pedido, string& saida);
+
+    /**
+     * @brief Decodifica um registro
+     * @return false se o registro estiver corrompido
+     */
+    static bool decodificar(const char* inicio, const char* fim, Pedido& pedido);
+
+public:  // Interface pública
+    static const size_t CACHE_INDICE_PADRAO = 1 << 20;  // 1 MB = 256 páginas
+
+    /**
+     * @brief Construtor - abre (ou cria) o arquivo e o índice
+     * @param caminho Caminho do arquivo
+     * @param bytesCacheIndice Memória máxima do cache do índice
+     * @throws PersistenciaException se o arquivo não puder ser aberto
+     */
+    explicit ArquivoPedidos(const string& caminho, size_t bytesCacheIndice = CACHE_INDICE_PADRAO);
+
+    /**
+     * @brief Destrutor (ArvoreBMais é completa só no .cpp)
+     */
+    ~ArquivoPedidos();
+
+    ArquivoPedidos(const ArquivoPedidos&) = delete;
+    ArquivoPedidos& operator=(const ArquivoPedidos&) = delete;
+
+    /**
+     * @brief Acrescenta um lote de pedidos ao final do arquivo
+     * @param pedidos Pedidos a arquivar
+     * @throws PersistenciaException se a gravação falhar
+     *
+     * Uma única escrita por lote; o índice só é atualizado
+     * depois que a gravação foi confirmada
+     */
+    void anexar(const vector<const Pedido*>& pedidos);
+
+    /**
+     * @brief Busca pedido arquivado por ID
+     * @param id ID do pedido
+     * @param pedido [saída] Pedido lido do arquivo
+     * @return true se encontrado
+     * @throws PersistenciaException se o registro estiver corrompido
+     *
+     * Descida no índice (páginas de cima quase sempre no cache)
+     * → um seek + uma leitura no arquivo de dados
+     */
+    bool buscar(int id, Pedido& pedido) const;
+
+    /**
+     * @brief Percorre os pedidos arquivados com ID em [idInicio, idFim]
+     * @param visitante Recebe cada pedido em ordem de ID; retorna false para parar
+     * @return Quantidade de pedidos visitados
+     * @throws PersistenciaException se algum registro estiver corrompido
+     *
+     * Um pedido por vez na memória, qualquer que seja o tamanho da faixa
+     */
+    size_t percorrerFaixa(int idInicio, int idFim, const function<bool(const Pedido&)>& visitante) const;
+
+    // ==================== GETTERS ====================
+    bool contem(int id) const;          // true se o ID está no arquivo
+    size_t quantidade() const;          // Pedidos arquivados
+    uint64_t getTamanhoBytes() const;   // Tamanho do arquivo em bytes
+    int getMaiorId() const;             // Maior ID arquivado (0 = vazio)
+    size_t getRegistrosCorrompidos() const;  // Trechos ignorados (tamanho, CRC ou ID estragado)
+    string getCaminho() const;          // Caminho do arquivo
+};  // Fim da classe ArquivoPedidos
+
+#endif // ARQUIVO_H
+// Fim do include guard
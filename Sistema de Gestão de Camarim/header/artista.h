@@ -29,6 +29,11 @@ class Artista : public Pessoa {  // : public Pessoa = HERANÇA pública de Pesso
     
 private:  // Atributos adicionais (específicos de Artista)
     int camarimId;    // ID do camarim associado ao artista (número do camarim)
+    vector<int>* alterados;  // Log de alterações do gerenciador (nullptr = sem log)
+    friend class IndiceAtribuicao;  // Único que troca o camarim (mantém os dois lados iguais)
+    
+    // Setter do camarim: só pelo índice de atribuição
+    void setCamarimId(int camarimId);  // Define novo camarimId
     
 public:  // Métodos públicos
     /**
@@ -53,8 +58,12 @@ public:  // Métodos públicos
     // Getters - Métodos para ler atributos
     int getCamarimId() const;  // Retorna o ID do camarim do artista
     
-    // Setters - Métodos para modificar atributos
-    void setCamarimId(int camarimId);  // Define novo camarimId
+    /**
+     * @brief Liga o artista à lista de alterados do gerenciador
+     * 
+     * A atribuição de camarins altera o artista por fora do gerenciador
+     */
+    void ligarAlteracoes(vector<int>* alterados);
     
     /**
      * @brief Implementação do método virtual exibir (polimorfismo)
@@ -73,6 +82,9 @@ class GerenciadorArtistas {  // Classe gerenciadora para operações com artista
 private:  // Atributos privados (ENCAPSULAMENTO)
     vector<Artista> artistas;  // Vetor que armazena todos os artistas cadastrados
     int proximoId;             // Contador para gerar IDs únicos sequencialmente
+    vector<int>* alterados;    // IDs alterados desde a última confirmação (nullptr = sem log)
+    friend class ArquivoSnapshot;  // Restaura artistas e proximoId
+    friend class LogAlteracoes;    // Reaplica artistas gravados no log
     
 public:  // Métodos públicos (interface CRUD)
     /**
@@ -83,11 +95,10 @@ public:  // Métodos públicos (interface CRUD)
     /**
      * @brief Cadastra novo artista
      * @param nome Nome do artista
-     * @param camarimId ID do camarim
      * @return ID do artista cadastrado
      */
-    int cadastrar(const string& nome, int camarimId);  
-    // CREATE: Cria novo artista e retorna o ID gerado
+    int cadastrar(const string& nome);  
+    // CREATE: Cria novo artista (sem camarim: IndiceAtribuicao define depois) e retorna o ID gerado
     
     /**
      * @brief Busca artista por ID
@@ -120,14 +131,28 @@ public:  // Métodos públicos (interface CRUD)
     vector<Artista> listar() const;  
     // READ: Retorna cópia do vetor com todos os artistas
     
+    /**
+     * @brief Todos os artistas por referência (sem cópia)
+     * 
+     * A referência deixa de valer se artistas forem cadastrados/removidos
+     */
+    const vector<Artista>& getArtistas() const;
+    
     /**
      * @brief Atualiza dados de um artista
      * @param id ID do artista
      * @param nome Novo nome
-     * @param camarimId Novo ID de camarim
      * @return true se atualizado com sucesso
+     * 
+     * O camarim muda pelo IndiceAtribuicao
+     */
+    bool atualizar(int id, const string& nome);  
+    
+    /**
+     * @brief Passa a anotar os IDs alterados (artistas atuais e futuros)
+     * @param alterados Lista preenchida a cada alteração (nullptr = desliga)
      */
-    bool atualizar(int id, const string& nome, int camarimId);  
+    void ligarAlteracoes(vector<int>* alterados);
     // UPDATE: Modifica dados de um artista existente, retorna true se conseguiu
 };  // Fim da classe GerenciadorArtistas
 
@@ -0,0 +1,211 @@
+/**
+ * @file arvoreb.h
+ * @brief Definição da classe ArvoreBMais
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Árvore B+ em disco (chave inteira -> valor inteiro) com páginas de 4 KB
+ * e cache de páginas de tamanho fixo. Só as páginas em uso ficam na
+ * memória: o índice pode ser muito maior que a RAM e continua com busca
+ * O(log n) e percurso em ordem de chave.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef ARVOREB_H  // Se ARVOREB_H não foi definido
+#define ARVOREB_H  // Define ARVOREB_H
+
+// Bibliotecas necessárias
+#include <string>          // Para caminho do arquivo
+#include <vector>          // Para os quadros do cache
+#include <unordered_map>   // Para página -> quadro
+#include <fstream>         // Para o arquivo de páginas
+#include <functional>      // Para o visitante do percurso
+#include <cstdint>         // Para int64_t/uint64_t/uint32_t
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @class ArvoreBMais
+ * @brief Índice ordenado em disco com cache limitado
+ *
+ * PÁGINAS: a página 0 é o cabeçalho (raiz, número de páginas, quantidade,
+ * maior chave). Folhas guardam até 255 pares (chave, valor) e apontam para
+ * a próxima folha (percurso em ordem sem voltar à raiz); páginas internas
+ * guardam até 339 chaves separadoras.
+ *
+ * CACHE (algoritmo do RELÓGIO): cada quadro tem um bit de "usado". Para
+ * liberar um quadro, o ponteiro do relógio avança limpando os bits e
+ * escolhe o primeiro quadro não usado desde a última volta (aproxima o
+ * LRU sem mexer em listas a cada acesso). Página alterada só é gravada
+ * quando sai do cache ou em sincronizar().
+ *
+ * QUEDAS: antes da primeira alteração o cabeçalho é gravado como "em
+ * alteração"; sincronizar() grava as páginas e depois o cabeçalho limpo.
+ * Um arquivo que ficou "em alteração" é recusado na abertura (quem usa o
+ * índice o reconstrói a partir dos dados). Cada página leva um CRC-32C,
+ * conferido quando ela é lida: página rasgada ou corrompida vira exceção
+ * em vez de um ponteiro errado.
+ *
+ * Inserções em ordem crescente (IDs novos) não dividem a folha ao meio:
+ * a página da esquerda fica cheia, como em um arquivo só de acréscimo.
+ */
+class ArvoreBMais {
+private:  // ENCAPSULAMENTO: atributos privados
+    union Pagina;  // Folha, interna ou cabeçalho (definida em arvoreb.cpp)
+
+    /**
+     * @struct Quadro
+     * @brief Espaço do cache para uma página
+     */
+    struct Quadro {
+        uint32_t pagina;    // Página carregada (0 = quadro livre; a 0 nunca entra no cache)
+        bool sujo;          // Alterada desde que foi lida
+        bool usado;         // Bit do relógio
+        int fixacoes;       // > 0 = em uso agora (não pode sair)
+    };
+
+    string caminho;                            // Arquivo de páginas
+    fstream arquivo;                           // Aberto para leitura e escrita
+    vector<Pagina> paginas;                    // Memória do cache (alocada uma vez)
+    vector<Quadro> quadros;                    // Estado de cada quadro
+    unordered_map<uint32_t, size_t> residentes;// Página -> quadro
+    size_t ponteiroRelogio;                    // Próximo quadro a examinar
+
+    uint32_t raiz;             // Página raiz
+    uint32_t numPaginas;       // Páginas no arquivo (incluindo o cabeçalho)
+    uint32_t altura;           // 1 = raiz é folha
+    uint64_t quantidade;       // Chaves distintas
+    int64_t maiorChave;        // Maior chave (0 = vazia)
+    uint64_t marca;            // Valor livre de quem usa o índice (gravado no cabeçalho)
+    bool emAlteracao;          // Cabeçalho no disco está marcado "em alteração"
+
+    uint64_t acertos;          // Páginas achadas no cache
+    uint64_t faltas;           // Páginas lidas do disco
+
+    /**
+     * @brief Grava o cabeçalho (página 0)
+     * @param limpo false = arquivo em alteração
+     */
+    void gravarCabecalho(bool limpo);
+
+    /**
+     * @brief Marca o arquivo "em alteração" (uma vez até o próximo sincronizar)
+     */
+    void iniciarAlteracao();
+
+    void lerPagina(uint32_t numero, Pagina& destino);
+    void gravarPagina(uint32_t numero, Pagina& origem);  // Carimba o CRC antes de gravar
+
+    /**
+     * @brief Quadro livre (o relógio tira uma página não usada do cache)
+     * @throws PersistenciaException se todas estiverem fixadas
+     */
+    size_t liberarQuadro();
+
+    /**
+     * @brief Traz a página para o cache e a fixa
+     * @return Quadro da página (válido até soltar)
+     * @throws PersistenciaException se a página for inválida
+     */
+    size_t fixar(uint32_t numero);
+
+    /**
+     * @brief Cria página nova no fim do arquivo (já fixada e suja)
+     * @param numero [saída] Número da página
+     * @return Quadro da página
+     */
+    size_t criarPagina(uint32_t& numero);
+
+    /**
+     * @brief Solta a página fixada
+     * @param sujo true se a página foi alterada
+     */
+    void soltar(size_t quadro, bool sujo);
+
+    /**
+     * @brief Solta tudo depois de uma falha no meio de uma operação
+     */
+    void soltarTodas();
+
+    /**
+     * @brief Insere abaixo de uma página
+     * @param naBorda true se a página é a mais à direita do seu nível
+     * @param dividiu [saída] true se a página foi dividida
+     * @param separador [saída] Menor chave abaixo da página nova
+     * @param nova [saída] Página nova (à direita)
+     * @return true se a chave é nova (false = valor substituído)
+     */
+    bool inserirEm(uint32_t numero, int64_t chave, uint64_t valor, bool naBorda,
+                   bool& dividiu, int64_t& separador, uint32_t& nova);
+
+    /**
+     * @brief Folha onde a chave está (ou estaria)
+     */
+    uint32_t descerAteFolha(int64_t chave);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - abre (ou cria) o arquivo de páginas
+     * @param caminho Arquivo do índice
+     * @param bytesCache Memória máxima do cache (mínimo de 16 páginas)
+     * @throws PersistenciaException se o arquivo não abrir, for inválido
+     *         ou tiver ficado "em alteração" (queda antes de sincronizar)
+     */
+    ArvoreBMais(const string& caminho, size_t bytesCache);
+
+    /**
+     * @brief Destrutor - fecha o arquivo
+     *
+     * Não grava nada: alterações sem sincronizar() deixam o arquivo
+     * "em alteração" e o índice é reconstruído na próxima abertura
+     */
+    ~ArvoreBMais();
+
+    ArvoreBMais(const ArvoreBMais&) = delete;
+    ArvoreBMais& operator=(const ArvoreBMais&) = delete;
+
+    /**
+     * @brief Insere ou substitui
+     * @return true se a chave é nova
+     * @throws PersistenciaException se o disco falhar
+     */
+    bool inserir(int64_t chave, uint64_t valor);
+
+    /**
+     * @brief Busca uma chave
+     * @param valor [saída] Valor da chave
+     * @return true se encontrada
+     */
+    bool buscar(int64_t chave, uint64_t& valor);
+
+    /**
+     * @brief Percorre as chaves de [inicio, fim] em ordem crescente
+     * @param visitante Recebe (chave, valor); retorna false para parar
+     * @return Quantidade de chaves visitadas
+     *
+     * Segue a lista de folhas: uma descida da raiz e depois uma página por
+     * 255 chaves. O visitante pode buscar, mas não inserir
+     */
+    size_t percorrer(int64_t inicio, int64_t fim, const function<bool(int64_t, uint64_t)>& visitante);
+
+    /**
+     * @brief Grava as páginas alteradas e o cabeçalho limpo
+     * @param marca Valor a guardar no cabeçalho (ex.: até onde os dados foram indexados)
+     * @throws PersistenciaException se o disco falhar
+     */
+    void sincronizar(uint64_t marca);
+
+    // ==================== GETTERS ====================
+    uint64_t getQuantidade() const;
+    int64_t getMaiorChave() const;
+    uint64_t getMarca() const;
+    uint32_t getAltura() const;
+    uint32_t getNumPaginas() const;
+    size_t getCapacidadeCache() const;  // Quadros do cache
+    uint64_t getAcertos() const;
+    uint64_t getFaltas() const;
+};  // Fim da classe ArvoreBMais
+
+#endif // ARVOREB_H
+// Fim do include guard
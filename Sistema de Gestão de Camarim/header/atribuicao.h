@@ -0,0 +1,109 @@
+/**
+ * @file atribuicao.h
+ * @brief Definição da classe IndiceAtribuicao
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Dono ÚNICO da relação artista ↔ camarim. Artista::camarimId e
+ * Camarim::artistaId passam a ser apenas espelhos mantidos por este
+ * índice, então os dois lados nunca se contradizem.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef ATRIBUICAO_H  // Se ATRIBUICAO_H não foi definido
+#define ATRIBUICAO_H  // Define ATRIBUICAO_H
+
+// Bibliotecas necessárias
+#include <string>         // Para mensagens de inconsistência
+#include <vector>         // Para lista de inconsistências
+#include <unordered_map>  // Tabelas hash: busca O(1) nos dois sentidos
+#include "artista.h"      // Artistas (lado 1 da relação)
+#include "camarim.h"      // Camarins (lado 2 da relação)
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @class IndiceAtribuicao
+ * @brief Relação 1:1 artista ↔ camarim com busca O(1) nos dois sentidos
+ *
+ * REGRAS:
+ * - Um artista ocupa no máximo um camarim e vice-versa
+ * - Atribuir A → C libera o camarim anterior de A e o artista anterior de C
+ * - Toda validação acontece ANTES de qualquer alteração (atribuição atômica:
+ *   ou tudo muda, ou nada muda)
+ */
+class IndiceAtribuicao {
+private:  // Atributos privados
+    unordered_map<int, int> camarimPorArtista;  // Chave = artistaId, valor = camarimId
+    unordered_map<int, int> artistaPorCamarim;  // Chave = camarimId, valor = artistaId
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - índice vazio
+     */
+    IndiceAtribuicao();
+
+    /**
+     * @brief Atribui camarim a artista (reatribuição atômica)
+     * @param artistaId ID do artista
+     * @param camarimId ID do camarim
+     * @param artistas Gerenciador de artistas (espelho camarimId)
+     * @param camarins Gerenciador de camarins (espelho artistaId)
+     * @throws ArtistaException se artista não existe
+     * @throws CamarimException se camarim não existe
+     */
+    void atribuir(int artistaId, int camarimId,
+                  GerenciadorArtistas& artistas, GerenciadorCamarins& camarins);
+
+    /**
+     * @brief Libera o camarim de um artista
+     * @return true se o artista tinha camarim
+     */
+    bool liberarArtista(int artistaId, GerenciadorArtistas& artistas, GerenciadorCamarins& camarins);
+
+    /**
+     * @brief Libera o artista de um camarim
+     * @return true se o camarim tinha artista
+     */
+    bool liberarCamarim(int camarimId, GerenciadorArtistas& artistas, GerenciadorCamarins& camarins);
+
+    /**
+     * @brief Camarim do artista - O(1)
+     * @return ID do camarim (0 = sem camarim)
+     */
+    int getCamarimDoArtista(int artistaId) const;
+
+    /**
+     * @brief Artista do camarim - O(1)
+     * @return ID do artista (0 = sem artista)
+     */
+    int getArtistaDoCamarim(int camarimId) const;
+
+    /**
+     * @brief Quantidade de atribuições
+     */
+    size_t tamanho() const;
+
+    /**
+     * @brief Reconstrói o índice a partir dos espelhos gravados nos artistas
+     *
+     * Lado do ARTISTA é a referência; ligações para camarins inexistentes
+     * são descartadas e em conflito (dois artistas, um camarim) vence o
+     * último. Os espelhos são reescritos para ficarem consistentes.
+     */
+    void reconstruir(GerenciadorArtistas& artistas, GerenciadorCamarins& camarins);
+
+    /**
+     * @brief Verifica consistência entre índice e espelhos
+     * @return Descrição de cada inconsistência (vazio = tudo consistente)
+     *
+     * PARALELO: artistas e camarins são divididos em fatias verificadas
+     * em threads separadas (std::async) quando o volume compensa
+     */
+    vector<string> verificar(const GerenciadorArtistas& artistas,
+                             const GerenciadorCamarins& camarins) const;
+};  // Fim da classe IndiceAtribuicao
+
+#endif // ATRIBUICAO_H
+// Fim do include guard
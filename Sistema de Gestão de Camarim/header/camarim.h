@@ -17,6 +17,9 @@
 #include <string>    // Para trabalhar com strings
 #include <vector>    // Para lista dinâmica de camarins
 #include <map>       // Para armazenar itens com chave itemId
+#include <functional>  // Para o observador de conteúdo
+#include "mapapequeno.h"  // Mapa plano para os itens do camarim
+#include "consumo.h"      // Séries de consumo por (camarim, item)
 #include <iostream>  // Para entrada/saída (cout, cin)
 
 using namespace std;  // Namespace padrão da STL
@@ -64,8 +67,28 @@ private:  // Atributos privados - ENCAPSULAMENTO
     int id;                          // ID único do camarim
     string nome;                     // Nome identificador do camarim
     int artistaId;                   // ID do artista associado (0 = sem artista)
-    map<int, ItemCamarim> itens;    // Map: chave = itemId, valor = ItemCamarim
-    // MAP: acesso rápido O(log n) por itemId, não permite chaves duplicadas
+    MapaPequeno<int, ItemCamarim> itens;  // Chave = itemId, valor = ItemCamarim
+    // MAPA PLANO: busca O(log n) por itemId, itens contíguos (uma alocação)
+    vector<int>* alterados;          // Log de alterações do gerenciador (nullptr = sem log)
+    const function<void(int, int)>* observador;  // Observador do gerenciador (nullptr = nenhum)
+    friend class ExportadorDados;    // Exporta sem copiar o nome
+    friend class IndiceAtribuicao;   // Único que troca o artista (mantém os dois lados iguais)
+    
+    /**
+     * @brief Anota o ID no log de alterações (se ligado)
+     */
+    void marcarAlterado();
+    
+    /**
+     * @brief Define o artista associado (só pelo índice de atribuição)
+     */
+    void setArtistaId(int artistaId);
+    
+    /**
+     * @brief Avisa o observador ligado (se houver)
+     * @param itemId Item alterado (0 = camarim inteiro, ex.: troca de artista)
+     */
+    void avisarObservador(int itemId);
     
 public:  // Métodos públicos
     /**
@@ -81,6 +104,28 @@ public:  // Métodos públicos
      */
     Camarim(int id, const string& nome, int artistaId);
     
+    /**
+     * @brief Construtor de cópia - a cópia é avulsa (sem log nem observador)
+     * 
+     * Cópias de listar() não alteram o log nem a lista automática
+     */
+    Camarim(const Camarim& outro);
+    
+    /**
+     * @brief Construtor de movimento - leva a ligação (log e observador)
+     */
+    Camarim(Camarim&& outro) noexcept;
+    
+    /**
+     * @brief Atribuição por cópia - mantém a ligação deste camarim
+     */
+    Camarim& operator=(const Camarim& outro);
+    
+    /**
+     * @brief Atribuição por movimento - assume a ligação do outro
+     */
+    Camarim& operator=(Camarim&& outro) noexcept;
+    
     /**
      * @brief Destrutor - limpa recursos (map é limpo automaticamente)
      */
@@ -90,11 +135,11 @@ public:  // Métodos públicos
     int getId() const;          // Retorna ID do camarim
     string getNome() const;     // Retorna nome do camarim
     int getArtistaId() const;   // Retorna ID do artista associado
+    const MapaPequeno<int, ItemCamarim>& getItens() const;  // Itens (referência, sem cópia)
     
     // SETTERS: métodos que permitem modificar atributos privados
     void setId(int id);                      // Define ID do camarim
     void setNome(const string& nome);        // Define nome do camarim
-    void setArtistaId(int artistaId);        // Define artista associado
     
     /**
      * @brief Adiciona ou atualiza item no camarim
@@ -118,6 +163,19 @@ public:  // Métodos públicos
      */
     bool removerItem(int itemId, int quantidade);
     
+    /**
+     * @brief Liga o camarim à lista de alterados do gerenciador
+     * 
+     * Pedidos, riders e a atribuição alteram o camarim por fora do gerenciador
+     */
+    void ligarAlteracoes(vector<int>* alterados);
+    
+    /**
+     * @brief Liga o camarim ao observador de conteúdo do gerenciador
+     * @param observador Recebe (camarimId, itemId); deve sobreviver ao camarim
+     */
+    void ligarObservador(const function<void(int, int)>* observador);
+    
     /**
      * @brief Exibe informações completas do camarim
      * @return String formatada com ID, nome, artista e lista de itens
@@ -147,6 +205,11 @@ class GerenciadorCamarins {
 private:  // Atributos privados
     vector<Camarim> camarins;  // Vector dinâmico de camarins
     int proximoId;             // Contador para gerar IDs únicos
+    MedidorConsumo consumo;    // Velocidade de consumo de cada item em cada camarim
+    vector<int>* alterados;    // IDs alterados desde a última confirmação (nullptr = sem log)
+    function<void(int, int)> observadorConteudo;  // Itens ou artista de um camarim mudaram
+    friend class ArquivoSnapshot;  // Restaura camarins e proximoId
+    friend class LogAlteracoes;    // Substitui camarins pelo estado gravado no log
     
 public:  // Métodos públicos (interface CRUD)
     /**
@@ -154,15 +217,19 @@ public:  // Métodos públicos (interface CRUD)
      */
     GerenciadorCamarins();
     
+    // Camarins guardam ponteiro para o observador: gerenciador não pode ser copiado
+    GerenciadorCamarins(const GerenciadorCamarins&) = delete;
+    GerenciadorCamarins& operator=(const GerenciadorCamarins&) = delete;
+    
     /**
      * @brief Cadastra novo camarim (CREATE)
      * @param nome Nome do camarim
-     * @param artistaId ID do artista (0 = sem artista)
      * @return ID do camarim cadastrado
      * 
-     * Gera ID automático, cria Camarim, adiciona ao vector
+     * Gera ID automático, cria Camarim (sem artista), adiciona ao vector.
+     * O artista é definido depois pelo IndiceAtribuicao
      */
-    int cadastrar(const string& nome, int artistaId);
+    int cadastrar(const string& nome);
     
     /**
      * @brief Busca camarim por ID (READ)
@@ -192,22 +259,63 @@ public:  // Métodos públicos (interface CRUD)
      */
     bool remover(int id);
     
+    /**
+     * @brief Consumo de item no camarim (retira e registra a retirada)
+     * @param camarimId ID do camarim
+     * @param itemId ID do item
+     * @param quantidade Quantidade consumida
+     * @param agoraNs Instante da retirada (relógio monotônico)
+     * @throws CamarimException se camarim/item não existe ou quantidade insuficiente
+     * 
+     * Use este método (e não Camarim::removerItem) para que a retirada
+     * entre nas taxas de consumo
+     */
+    void consumirItem(int camarimId, int itemId, int quantidade, int64_t agoraNs);
+    
+    /**
+     * @brief Séries de consumo (taxas e maiores consumidores)
+     */
+    MedidorConsumo& getConsumo();
+    
     /**
      * @brief Lista todos os camarins (READ ALL)
      * @return Vector com cópias de todos os camarins
      */
     vector<Camarim> listar() const;
     
+    /**
+     * @brief Todos os camarins por referência (sem cópia)
+     * 
+     * Para percursos de leitura em massa (ex: planejamento de reposição).
+     * A referência deixa de valer se camarins forem cadastrados/removidos
+     */
+    const vector<Camarim>& getCamarins() const;
+    
     /**
      * @brief Atualiza dados de um camarim (UPDATE)
      * @param id ID do camarim a atualizar
      * @param nome Novo nome
-     * @param artistaId Novo ID de artista
      * @return true se atualizado, false se não encontrado
      * 
-     * Busca por ID e atualiza os campos
+     * Busca por ID e atualiza o nome (o artista muda pelo IndiceAtribuicao)
+     */
+    bool atualizar(int id, const string& nome);
+    
+    /**
+     * @brief Passa a anotar os IDs alterados (camarins atuais e futuros)
+     * @param alterados Lista preenchida a cada alteração (nullptr = desliga)
+     */
+    void ligarAlteracoes(vector<int>* alterados);
+    
+    /**
+     * @brief Define função chamada quando itens ou artista de um camarim mudam
+     * @param observador Recebe (camarimId, itemId); itemId 0 = camarim inteiro
+     *        (cadastro com artista, troca de artista ou remoção)
+     * 
+     * Vale para os camarins atuais e futuros, inclusive alterações feitas
+     * direto no camarim (pedidos, riders, atribuição)
      */
-    bool atualizar(int id, const string& nome, int artistaId);
+    void definirObservadorConteudo(function<void(int camarimId, int itemId)> observador);
 };  // Fim da classe GerenciadorCamarins
 
 #endif // CAMARIM_H
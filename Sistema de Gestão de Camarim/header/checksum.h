@@ -0,0 +1,50 @@
+/**
+ * @file checksum.h
+ * @brief Soma de verificação CRC-32C dos arquivos gravados pelo sistema
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * CRC-32C (polinômio de Castagnoli) detecta registros rasgados ou
+ * corrompidos no disco: se o CRC gravado não bate com o dos bytes lidos,
+ * o registro não é usado.
+ *
+ * Usa a instrução do processador quando existe (SSE4.2 / ARMv8 CRC,
+ * verificado uma vez na execução) e tabelas quando não existe: o
+ * resultado é o mesmo nas duas.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef CHECKSUM_H  // Se CHECKSUM_H não foi definido
+#define CHECKSUM_H  // Define CHECKSUM_H
+
+// Bibliotecas necessárias
+#include <cstdint>   // Para uint32_t
+#include <cstddef>   // Para size_t
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @brief Calcula (ou continua) o CRC-32C de um bloco de bytes
+ * @param dados Início do bloco
+ * @param tamanho Número de bytes
+ * @param crc CRC do trecho anterior (0 = começo)
+ * @return CRC dos bytes anteriores + este bloco
+ *
+ * Continuar é o mesmo que calcular de uma vez:
+ * crc32c(b, nb, crc32c(a, na)) == crc32c(a + b, na + nb)
+ */
+uint32_t crc32c(const void* dados, size_t tamanho, uint32_t crc = 0);
+
+/**
+ * @brief Mesmo CRC-32C, sempre por tabelas (referência para conferir o hardware)
+ */
+uint32_t crc32cSoftware(const void* dados, size_t tamanho, uint32_t crc = 0);
+
+/**
+ * @brief Indica se crc32c() está usando a instrução do processador
+ */
+bool crc32cPorHardware();
+
+#endif // CHECKSUM_H
+// Fim do include guard
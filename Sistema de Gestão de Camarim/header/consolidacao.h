@@ -0,0 +1,105 @@
+/**
+ * @file consolidacao.h
+ * @brief Definição da classe CompraConsolidada
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Cada responsável de palco mantém sua própria lista de compras. A
+ * consolidação junta N listas em um único pedido de compra, somando as
+ * quantidades por item e guardando de qual lista veio cada parcela.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef CONSOLIDACAO_H  // Se CONSOLIDACAO_H não foi definido
+#define CONSOLIDACAO_H  // Define CONSOLIDACAO_H
+
+// Bibliotecas necessárias
+#include <map>            // Para linhas por item
+#include <vector>         // Para origens e listas de entrada
+#include <string>         // Para exibição
+#include <iostream>       // Para operator<<
+#include "listacompras.h" // Listas de origem e lista gerada
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @struct LinhaConsolidada
+ * @brief Total de um item e as listas que o pediram
+ */
+struct LinhaConsolidada {
+    int itemId;
+    string nomeItem;
+    int quantidade;                      // Soma de todas as listas
+    long long precoCentavos;             // Preço da primeira lista que pediu o item
+    long long subtotalCentavos;          // Soma dos subtotais de origem (cada um no seu preço)
+    bool precosDivergentes;              // true se alguma lista usou outro preço
+    vector<pair<int, int>> origens;      // (listaId, quantidade), na ordem das listas
+
+    LinhaConsolidada()
+        : itemId(0), quantidade(0), precoCentavos(0), subtotalCentavos(0), precosDivergentes(false) {}
+};  // Fim da struct LinhaConsolidada
+
+/**
+ * @class CompraConsolidada
+ * @brief Pedido de compra único a partir de várias listas
+ */
+class CompraConsolidada {
+private:  // ENCAPSULAMENTO: atributos privados
+    vector<int> listaIds;               // Listas consolidadas, na ordem recebida
+    map<int, LinhaConsolidada> linhas;  // Chave = itemId
+    long long totalCentavos;            // Soma de todos os subtotais
+
+    /**
+     * @brief Soma uma lista a esta consolidação
+     */
+    void acumular(const ListaCompras& lista);
+
+    /**
+     * @brief Funde consolidação parcial nesta (etapa de REDUÇÃO)
+     *
+     * A outra deve cobrir listas POSTERIORES: as origens continuam em ordem
+     */
+    void mesclar(CompraConsolidada& outra);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - consolidação vazia
+     */
+    CompraConsolidada();
+
+    /**
+     * @brief Consolida as listas informadas
+     * @param listas Listas a juntar (ponteiros, sem cópia)
+     * @param limiteThreads Máximo de threads (0 = uma por núcleo; 1 = só a atual)
+     *
+     * REDUÇÃO PARALELA: com muitas linhas, cada thread consolida uma
+     * fatia contígua de listas (fatias com número parecido de linhas)
+     * e as parciais são fundidas em ordem
+     */
+    static CompraConsolidada consolidar(const vector<const ListaCompras*>& listas, unsigned limiteThreads = 0);
+
+    // ==================== GETTERS ====================
+    const vector<int>& getListaIds() const;
+    const map<int, LinhaConsolidada>& getLinhas() const;
+    long long getTotalCentavos() const;
+    bool vazia() const;
+
+    /**
+     * @brief Copia as linhas para uma lista de compras (preço da primeira origem)
+     */
+    void preencherLista(ListaCompras& lista) const;
+
+    /**
+     * @brief Exibe as linhas com a origem de cada parcela
+     */
+    string exibir() const;
+
+    /**
+     * @brief Sobrecarga do operador << para cout
+     */
+    friend ostream& operator<<(ostream& os, const CompraConsolidada& compra);
+};  // Fim da classe CompraConsolidada
+
+#endif // CONSOLIDACAO_H
+// Fim do include guard
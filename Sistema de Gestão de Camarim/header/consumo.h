@@ -0,0 +1,169 @@
+/**
+ * @file consumo.h
+ * @brief Definição das classes SerieConsumo e MedidorConsumo
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Mede a velocidade com que cada camarim consome cada item.
+ * Toda retirada de item do camarim vira uma amostra em uma série
+ * temporal em anel por (camarim, item), com taxas móveis de
+ * 15 minutos, 1 hora e 1 dia.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef CONSUMO_H  // Se CONSUMO_H não foi definido
+#define CONSUMO_H  // Define CONSUMO_H
+
+// Bibliotecas necessárias
+#include <cstdint>        // Para int64_t, uint64_t
+#include <string>         // Para nome das janelas
+#include <vector>         // Para ranking de consumo
+#include <unordered_map>  // Série por par (camarim, item)
+#include <map>            // Taxa total por item
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @enum JanelaConsumo
+ * @brief Janelas móveis disponíveis
+ */
+enum class JanelaConsumo {
+    QUINZE_MINUTOS,  // Últimos 15 minutos
+    UMA_HORA,        // Últimos 60 minutos
+    UM_DIA           // Últimas 24 horas (resolução de 15 minutos)
+};
+
+/**
+ * @class SerieConsumo
+ * @brief Consumo de um item em um camarim, em dois anéis de tamanho fixo
+ *
+ * ESTRUTURA (memória fixa, ~650 bytes por série):
+ * - 60 baldes de 1 minuto  → janelas de 15 min e 1 hora
+ * - 96 baldes de 15 minutos → janela de 1 dia
+ * - Uma soma corrente por janela: consulta O(1)
+ *
+ * Avançar o relógio zera os baldes que saíram da janela e desconta
+ * seus valores das somas (no máximo um giro completo de cada anel).
+ */
+class SerieConsumo {
+public:  // Constantes públicas (tamanho dos anéis)
+    static const int BALDES_MINUTO = 60;    // 1 hora em baldes de 1 minuto
+    static const int BALDES_QUARTO = 96;    // 24 horas em baldes de 15 minutos
+    static const int MINUTOS_POR_QUARTO = 15;
+
+private:  // Atributos privados
+    int porMinuto[BALDES_MINUTO];   // Consumo de cada minuto (anel)
+    int porQuarto[BALDES_QUARTO];   // Consumo de cada 15 minutos (anel)
+    int64_t minutoAtual;            // Minuto absoluto do balde mais recente
+    int64_t soma15;                 // Soma dos últimos 15 baldes de minuto
+    int64_t soma60;                 // Soma dos 60 baldes de minuto
+    int64_t somaDia;                // Soma dos 96 baldes de quarto
+
+    /**
+     * @brief Avança o relógio da série até o minuto informado
+     *
+     * Minutos anteriores ao atual não voltam o relógio (a amostra
+     * atrasada é contada no balde atual)
+     */
+    void avancar(int64_t minuto);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - série zerada
+     */
+    SerieConsumo();
+
+    /**
+     * @brief Registra consumo no minuto informado - O(1) amortizado
+     */
+    void registrar(int quantidade, int64_t minuto);
+
+    /**
+     * @brief Total consumido na janela terminada no minuto informado - O(1) amortizado
+     */
+    int64_t total(JanelaConsumo janela, int64_t minuto);
+};  // Fim da classe SerieConsumo
+
+/**
+ * @struct ConsumoItem
+ * @brief Linha do ranking de consumo
+ */
+struct ConsumoItem {
+    int camarimId;       // Camarim
+    int itemId;          // Item
+    int64_t quantidade;  // Total consumido na janela
+    double porHora;      // Taxa média na janela (unidades/hora)
+
+    ConsumoItem() : camarimId(0), itemId(0), quantidade(0), porHora(0.0) {}
+};  // Fim da struct ConsumoItem
+
+/**
+ * @class MedidorConsumo
+ * @brief Séries de consumo de todos os pares (camarim, item)
+ *
+ * Pares são criados no primeiro consumo e descartados quando o
+ * camarim é removido.
+ */
+class MedidorConsumo {
+private:  // Atributos privados
+    unordered_map<uint64_t, SerieConsumo> series;  // Chave = camarimId:itemId (64 bits)
+
+    /**
+     * @brief Junta camarimId e itemId em uma chave de 64 bits
+     */
+    static uint64_t chave(int camarimId, int itemId);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - nenhuma série
+     */
+    MedidorConsumo();
+
+    /**
+     * @brief Registra consumo de um item em um camarim
+     * @param agoraNs Instante (relógio monotônico, nanossegundos)
+     */
+    void registrar(int camarimId, int itemId, int quantidade, int64_t agoraNs);
+
+    /**
+     * @brief Total consumido pelo par na janela (0 se nunca consumiu)
+     */
+    int64_t consumo(int camarimId, int itemId, JanelaConsumo janela, int64_t agoraNs);
+
+    /**
+     * @brief Pares que mais consumiram na janela
+     * @param limite Quantidade máxima de linhas
+     * @return Linhas em ordem decrescente de consumo (pares sem consumo ficam de fora)
+     */
+    vector<ConsumoItem> maioresConsumidores(JanelaConsumo janela, size_t limite, int64_t agoraNs);
+
+    /**
+     * @brief Consumo por hora de cada item somando todos os camarins
+     * @return Map: chave = itemId, valor = unidades/hora na janela (só itens com consumo)
+     */
+    map<int, double> taxaPorItem(JanelaConsumo janela, int64_t agoraNs);
+
+    /**
+     * @brief Descarta as séries de um camarim removido
+     */
+    void removerCamarim(int camarimId);
+
+    /**
+     * @brief Quantidade de pares acompanhados
+     */
+    size_t quantidadeSeries() const;
+
+    /**
+     * @brief Duração da janela em minutos
+     */
+    static int minutosDaJanela(JanelaConsumo janela);
+
+    /**
+     * @brief Nome da janela para exibição ("15 min", "1 hora", "1 dia")
+     */
+    static string nomeJanela(JanelaConsumo janela);
+};  // Fim da classe MedidorConsumo
+
+#endif // CONSUMO_H
+// Fim do include guard
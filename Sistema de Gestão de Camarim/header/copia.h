@@ -0,0 +1,139 @@
+/**
+ * @file copia.h
+ * @brief Definição da classe CopiaSeguranca
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Cópia de segurança incremental dos arquivos do sistema (estado salvo,
+ * log de alterações, pedidos arquivados, diário de recebimentos). Cada
+ * arquivo é dividido em segmentos de 1 MB com um CRC-32C cada; uma nova
+ * cópia só grava os segmentos cujo CRC mudou desde a anterior, e a
+ * verificação confere todos os segmentos em várias threads.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef COPIA_H  // Se COPIA_H não foi definido
+#define COPIA_H  // Define COPIA_H
+
+// Bibliotecas necessárias
+#include <string>    // Para nomes de arquivos e diretório
+#include <vector>    // Para lista de arquivos, CRCs e falhas
+#include <cstdint>   // Para uint32_t/uint64_t/int64_t
+#include <cstddef>   // Para size_t
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @struct ResumoCopia
+ * @brief O que uma cópia gravou
+ */
+struct ResumoCopia {
+    size_t arquivos;            // Arquivos na cópia
+    size_t arquivosAlterados;   // Arquivos que tiveram algum segmento gravado
+    size_t arquivosRemovidos;   // Saíram da cópia (não existem mais na origem)
+    size_t segmentos;           // Segmentos de todos os arquivos
+    size_t segmentosCopiados;   // Segmentos gravados nesta cópia
+    uint64_t bytesCopiados;     // Bytes gravados nesta cópia
+    bool completa;              // Sem manifesto anterior válido: tudo foi copiado
+
+    ResumoCopia() : arquivos(0), arquivosAlterados(0), arquivosRemovidos(0), segmentos(0),
+                    segmentosCopiados(0), bytesCopiados(0), completa(false) {}
+};  // Fim da struct ResumoCopia
+
+/**
+ * @struct ResumoVerificacao
+ * @brief Resultado da verificação de uma cópia
+ */
+struct ResumoVerificacao {
+    size_t arquivos;        // Arquivos no manifesto
+    size_t segmentos;       // Segmentos conferidos
+    uint64_t bytes;         // Bytes lidos
+    unsigned threads;       // Threads usadas na leitura
+    vector<string> falhas;  // Arquivo ausente, tamanho diferente ou segmento com CRC diferente
+    vector<string> danificados;  // Arquivos com alguma falha (regravar com copiar())
+
+    ResumoVerificacao() : arquivos(0), segmentos(0), bytes(0), threads(0) {}
+};  // Fim da struct ResumoVerificacao
+
+/**
+ * @class CopiaSeguranca
+ * @brief Cópia incremental por segmentos e verificação paralela
+ *
+ * O diretório da cópia tem um arquivo comum para cada arquivo copiado
+ * (restaurar = copiar de volta) e um manifesto com tamanho, data de
+ * modificação e CRC de cada segmento. O manifesto tem CRC próprio e é
+ * trocado por inteiro (temporário + rename) só depois que os segmentos
+ * foram gravados: uma cópia interrompida deixa segmentos que não batem
+ * com o manifesto antigo, e a próxima cópia os grava de novo.
+ *
+ * Arquivo com tamanho e data de modificação iguais aos do manifesto nem
+ * é lido; os demais são lidos por inteiro para calcular os CRCs. Dano na
+ * própria cópia (que a origem não acusa) só a verificação encontra: os
+ * arquivos danificados voltam em copiar() para serem regravados inteiros.
+ */
+class CopiaSeguranca {
+private:  // Auxiliares
+    static const uint32_t TAMANHO_SEGMENTO = 1 << 20;  // 1 MB
+
+    /**
+     * @struct ArquivoCopiado
+     * @brief Entrada do manifesto
+     */
+    struct ArquivoCopiado {
+        string nome;            // Nome (relativo ao diretório de origem e ao da cópia)
+        uint64_t tamanho;       // Bytes
+        int64_t modificadoEm;   // Data de modificação na origem (unidade do sistema de arquivos)
+        vector<uint32_t> crcs;  // CRC-32C de cada segmento
+    };
+
+    /**
+     * @brief Lê o manifesto
+     * @param existe [saída] false se não há manifesto
+     * @throws PersistenciaException se o manifesto estiver corrompido
+     */
+    static vector<ArquivoCopiado> lerManifesto(const string& diretorio, bool& existe);
+
+    /**
+     * @brief Grava o manifesto (temporário + rename)
+     */
+    static void gravarManifesto(const string& diretorio, const vector<ArquivoCopiado>& arquivos);
+
+    /**
+     * @brief Copia os segmentos alterados de um arquivo
+     * @param anterior Entrada do manifesto anterior (nullptr = copiar tudo)
+     * @param atual [saída] Nova entrada do manifesto
+     */
+    static void copiarArquivo(const string& origem, const string& destino, const ArquivoCopiado* anterior,
+                              ArquivoCopiado& atual, ResumoCopia& resumo);
+
+public:  // Interface pública
+    /**
+     * @brief Atualiza a cópia com os arquivos informados
+     * @param arquivos Nomes dos arquivos (no diretório atual) que devem estar na cópia
+     * @param diretorio Diretório da cópia (criado se não existir)
+     * @param regravar Arquivos a gravar por inteiro (ex.: danificados na verificação)
+     * @return Resumo do que foi gravado
+     * @throws PersistenciaException se a leitura ou a gravação falhar
+     *
+     * Arquivos da cópia anterior que não estão na lista são apagados dela.
+     * Rodar sem alterações em andamento nos arquivos de origem
+     */
+    static ResumoCopia copiar(const vector<string>& arquivos, const string& diretorio,
+                              const vector<string>& regravar = vector<string>());
+
+    /**
+     * @brief Confere todos os segmentos da cópia contra o manifesto
+     * @param diretorio Diretório da cópia
+     * @param numThreads Threads de leitura (0 = uma por núcleo)
+     * @return Resumo com a lista de falhas (vazia = cópia íntegra)
+     * @throws PersistenciaException se não houver manifesto ou ele estiver corrompido
+     *
+     * As threads pegam segmentos de uma fila comum (contador atômico), em
+     * ordem de arquivo e posição: a leitura fica quase sequencial no disco
+     */
+    static ResumoVerificacao verificar(const string& diretorio, unsigned numThreads = 0);
+};  // Fim da classe CopiaSeguranca
+
+#endif // COPIA_H
+// Fim do include guard
@@ -0,0 +1,241 @@
+/**
+ * @file equipe.h
+ * @brief Definição das classes da equipe (Produtor, Runner, Seguranca) e GerenciadorEquipe
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Equipe de apoio do evento. As funções formam um conjunto FECHADO:
+ * cada uma é guardada por valor em seu próprio vetor, sem ponteiros
+ * para a classe base.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef EQUIPE_H  // Se EQUIPE_H não foi definido
+#define EQUIPE_H  // Define EQUIPE_H
+
+// Bibliotecas necessárias
+#include "pessoa.h"         // Classe base (herança)
+#include <string>           // Para nomes e atributos
+#include <vector>           // Um vetor contíguo por função
+#include <unordered_map>    // Índices ID → posição
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @enum FuncaoEquipe
+ * @brief Funções possíveis de um membro da equipe
+ */
+enum class FuncaoEquipe {
+    PRODUTOR,   // Produção (responsável por uma área do evento)
+    RUNNER,     // Leva e traz itens e artistas
+    SEGURANCA   // Guarda um posto (portão, corredor, camarim)
+};
+
+/**
+ * @brief Nome da função para exibição ("Produtor", "Runner", "Segurança")
+ */
+string nomeFuncao(FuncaoEquipe funcao);
+
+/**
+ * @class Produtor
+ * @brief Produtor responsável por uma área (ex: "Palco", "Hospitalidade")
+ *
+ * final: nenhuma classe deriva desta, então chamar exibir() em um
+ * Produtor (não em Pessoa&) dispensa a tabela virtual
+ */
+class Produtor final : public Pessoa {
+private:  // Atributos adicionais
+    string area;  // Área sob responsabilidade
+
+public:  // Métodos públicos
+    Produtor();
+    Produtor(int id, const string& nome, const string& area);
+
+    string getArea() const;
+    void setArea(const string& area);
+
+    string exibir() const override;
+};  // Fim da classe Produtor
+
+/**
+ * @class Runner
+ * @brief Runner com o veículo que usa (ex: "Moto", "A pé")
+ */
+class Runner final : public Pessoa {
+private:  // Atributos adicionais
+    string veiculo;  // Meio de transporte
+
+public:  // Métodos públicos
+    Runner();
+    Runner(int id, const string& nome, const string& veiculo);
+
+    string getVeiculo() const;
+    void setVeiculo(const string& veiculo);
+
+    string exibir() const override;
+};  // Fim da classe Runner
+
+/**
+ * @class Seguranca
+ * @brief Segurança alocado em um posto (ex: "Portão 2", "Corredor B")
+ */
+class Seguranca final : public Pessoa {
+private:  // Atributos adicionais
+    string posto;  // Posto de trabalho
+
+public:  // Métodos públicos
+    Seguranca();
+    Seguranca(int id, const string& nome, const string& posto);
+
+    string getPosto() const;
+    void setPosto(const string& posto);
+
+    string exibir() const override;
+};  // Fim da classe Seguranca
+
+/**
+ * @class GerenciadorEquipe
+ * @brief Gerencia a equipe guardada por valor, particionada por função
+ *
+ * ESTRUTURA:
+ * - Um vector por função (objetos contíguos, sem unique_ptr<Pessoa>)
+ * - Um índice ID → posição por função (busca O(1))
+ * - Um índice ID → função (para saber em qual vetor procurar)
+ *
+ * Percorrer a equipe (paraCada) chama o visitante com o tipo CONCRETO
+ * de cada pessoa: as chamadas não passam pela tabela virtual e cada
+ * vetor é lido em sequência.
+ */
+class GerenciadorEquipe {
+private:  // Atributos privados
+    vector<Produtor> produtores;    // Todos os produtores
+    vector<Runner> runners;         // Todos os runners
+    vector<Seguranca> segurancas;   // Todos os seguranças
+
+    unordered_map<int, size_t> indiceProdutores;  // ID → posição em produtores
+    unordered_map<int, size_t> indiceRunners;     // ID → posição em runners
+    unordered_map<int, size_t> indiceSegurancas;  // ID → posição em segurancas
+    unordered_map<int, FuncaoEquipe> funcaoPorId; // ID → função
+
+    int proximoId;  // IDs únicos para a equipe inteira
+    vector<int>* alterados;  // IDs alterados desde a última confirmação (nullptr = sem log)
+    friend class ArquivoSnapshot;  // Preenche vetores e índices direto, com os IDs salvos
+    friend class LogAlteracoes;    // Reaplica membros gravados no log
+
+    /**
+     * @brief Valida nome e atributo da função
+     * @throws ValidacaoException se algum estiver vazio
+     */
+    static void validar(const string& nome, const string& atributo, const string& rotulo);
+
+    /**
+     * @brief Remove de um vetor trocando com o último (O(1), mantém índice válido)
+     */
+    template<typename T>
+    static void removerTrocando(vector<T>& pessoas, unordered_map<int, size_t>& indice, int id);
+
+    /**
+     * @brief Anota o ID no log de alterações (se ligado)
+     */
+    void anotar(int id);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - equipe vazia
+     */
+    GerenciadorEquipe();
+
+    // ==================== CREATE ====================
+    int cadastrarProdutor(const string& nome, const string& area);
+    int cadastrarRunner(const string& nome, const string& veiculo);
+    int cadastrarSeguranca(const string& nome, const string& posto);
+
+    // ==================== READ ====================
+    /**
+     * @brief Busca por ID no vetor da função - O(1)
+     * @return Ponteiro ou nullptr (ID inexistente ou de outra função)
+     */
+    Produtor* buscarProdutor(int id);
+    Runner* buscarRunner(int id);
+    Seguranca* buscarSeguranca(int id);
+
+    /**
+     * @brief Função de um membro - O(1)
+     * @param funcao Recebe a função se o ID existir
+     * @return true se o ID existe
+     */
+    bool buscarFuncao(int id, FuncaoEquipe& funcao) const;
+
+    const vector<Produtor>& getProdutores() const;
+    const vector<Runner>& getRunners() const;
+    const vector<Seguranca>& getSegurancas() const;
+
+    /**
+     * @brief Total da equipe / total de uma função
+     */
+    size_t quantidade() const;
+    size_t quantidade(FuncaoEquipe funcao) const;
+
+    // ==================== DELETE ====================
+    /**
+     * @brief Remove membro da equipe
+     * @return true se removido
+     *
+     * A ordem dentro de cada função não é preservada (o último ocupa a vaga)
+     */
+    bool remover(int id);
+
+    // ==================== PERCURSO ====================
+    /**
+     * @brief Chama visitante(pessoa) para cada membro, função por função
+     *
+     * O visitante recebe const Produtor&, const Runner& ou const Seguranca&
+     * (use lambda genérica: [](const auto& pessoa) {...})
+     */
+    template<typename Visitante>
+    void paraCada(Visitante&& visitante) const {
+        for (const auto& produtor : produtores) {
+            visitante(produtor);
+        }
+        for (const auto& runner : runners) {
+            visitante(runner);
+        }
+        for (const auto& seguranca : segurancas) {
+            visitante(seguranca);
+        }
+    }
+
+    /**
+     * @brief IDs dos membros que satisfazem o predicado (mesma regra de paraCada)
+     */
+    template<typename Predicado>
+    vector<int> filtrar(Predicado&& predicado) const {
+        vector<int> ids;
+        paraCada([&](const auto& pessoa) {
+            if (predicado(pessoa)) {
+                ids.push_back(pessoa.getId());
+            }
+        });
+        return ids;
+    }
+
+    /**
+     * @brief IDs dos membros cujo nome contém o trecho
+     */
+    vector<int> buscarPorNome(const string& trecho) const;
+
+    /**
+     * @brief Equipe inteira formatada, uma pessoa por linha
+     */
+    string exibir() const;
+
+    /**
+     * @brief Passa a anotar os IDs cadastrados e removidos
+     * @param alterados Lista preenchida a cada alteração (nullptr = desliga)
+     */
+    void ligarAlteracoes(vector<int>* alterados);
+};  // Fim da classe GerenciadorEquipe
+
+#endif // EQUIPE_H
+// Fim do include guard
@@ -19,6 +19,8 @@
 #include <map>
 // Vector para retornar listas de itens
 #include <vector>
+// Function para observador de entradas de estoque
+#include <functional>
 
 /**
  * @struct ItemEstoque
@@ -59,6 +61,16 @@ class Estoque {
 private:  // ENCAPSULAMENTO: atributo privado
     map<int, ItemEstoque> itens;  // Map: chave = itemId, valor = ItemEstoque
     // MAP: acesso O(log n), sem chaves duplicadas, ordenado por chave
+    function<void(int)> observadorEntrada;  // Chamado após cada entrada (recebe itemId)
+    function<void(int)> observadorSaldo;    // Chamado após QUALQUER mudança de saldo (recebe itemId)
+    vector<int>* alterados;                 // Itens com saldo alterado desde a última confirmação
+    friend class LogAlteracoes;             // Lê o saldo e o nome de um item alterado
+    friend class ExportadorDados;           // Percorre o estoque sem listar() (que copia)
+    
+    /**
+     * @brief Avisa o observador de saldo (se houver) e anota o item no log
+     */
+    void avisarSaldo(int itemId);
     
 public:  // Interface pública
     /**
@@ -94,6 +106,48 @@ public:  // Interface pública
      */
     bool removerItem(int itemId, int quantidade);
     
+    /**
+     * @brief Remove vários itens de uma vez (SAÍDA EM LOTE)
+     * @param quantidades Map: chave = itemId, valor = quantidade a remover
+     * @throws EstoqueInsuficienteException se QUALQUER item não tiver saldo
+     * 
+     * TUDO OU NADA: verifica todos os itens antes de alterar o estoque,
+     * então uma falha não deixa o estoque parcialmente debitado
+     */
+    void removerLote(const map<int, int>& quantidades);
+    
+    /**
+     * @brief Adiciona vários itens de uma vez (ENTRADA EM LOTE)
+     * @param entradas Itens e quantidades a somar (mesmo item pode repetir)
+     * @throws ValidacaoException se QUALQUER entrada for inválida
+     * 
+     * TUDO OU NADA: valida todas as entradas antes de alterar o estoque.
+     * Observadores são avisados só depois do lote inteiro aplicado
+     */
+    void adicionarLote(const vector<ItemEstoque>& entradas);
+    
+    /**
+     * @brief Define função chamada após cada entrada de estoque
+     * @param observador Recebe o ID do item reposto
+     * 
+     * Usado para reavaliar backorders assim que o item chega
+     */
+    void definirObservadorEntrada(function<void(int itemId)> observador);
+    
+    /**
+     * @brief Define função chamada após cada mudança de saldo (entrada, saída ou ajuste)
+     * @param observador Recebe o ID do item alterado
+     * 
+     * Usado para manter a lista de compras automática sem recalcular tudo
+     */
+    void definirObservadorSaldo(function<void(int itemId)> observador);
+    
+    /**
+     * @brief Passa a anotar os itens com saldo alterado
+     * @param alterados Lista preenchida a cada mudança de saldo (nullptr = desliga)
+     */
+    void ligarAlteracoes(vector<int>* alterados);
+    
     /**
      * @brief Verifica se há quantidade suficiente de um item
      * @param itemId ID do item
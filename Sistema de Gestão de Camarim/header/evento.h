@@ -0,0 +1,198 @@
+/**
+ * @file evento.h
+ * @brief Definição das classes Evento e GerenciadorEventos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Vários palcos/locais funcionam ao mesmo tempo. Cada Evento é uma
+ * partição independente (shard) com seus próprios gerenciadores e sua
+ * própria trava: operações em eventos diferentes não disputam nada.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef EVENTO_H  // Se EVENTO_H não foi definido
+#define EVENTO_H  // Define EVENTO_H
+
+// Bibliotecas necessárias
+#include <string>      // Para nomes
+#include <vector>      // Para resumos
+#include <map>         // Para eventos por ID
+#include <memory>      // Para unique_ptr (evento não pode ser copiado nem movido)
+#include <mutex>       // Trava de cada evento
+#include <functional>  // Para operações executadas sob a trava
+#include "artista.h"
+#include "item.h"
+#include "estoque.h"
+#include "camarim.h"
+#include "pedido.h"
+#include "listacompras.h"
+#include "rider.h"
+#include "atribuicao.h"
+#include "agenda.h"
+#include "equipe.h"
+#include "listaautomatica.h"
+#include "fornecedor.h"
+#include "recebimento.h"
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @class Evento
+ * @brief Estado completo de um evento/local (um shard)
+ *
+ * Contém TODOS os gerenciadores que antes eram globais em main.cpp.
+ * A trava protege o evento inteiro: quem acessa de outra thread
+ * deve usar GerenciadorEventos::executar().
+ */
+class Evento {
+private:  // Atributos privados
+    int id;        // ID único do evento
+    string nome;   // Nome do evento/local (ex: "Palco Norte")
+
+    GerenciadorArtistas artistas;          // Artistas deste evento
+    GerenciadorItens itens;                // Catálogo deste evento
+    ListaAutomatica listaAutomatica;       // Faltas a comprar (após o catálogo; camarins e riders só guardados)
+    Estoque estoque;                       // Estoque deste evento
+    GerenciadorCamarins camarins;          // Camarins deste evento
+    GerenciadorPedidos pedidos;            // Pedidos deste evento
+    GerenciadorListaCompras listasCompras; // Listas de compras deste evento
+    GerenciadorRiders riders;              // Riders dos artistas deste evento
+    IndiceAtribuicao atribuicoes;          // Relação artista ↔ camarim
+    AgendaCamarins agenda;                 // Ocupação dos camarins por horário
+    GerenciadorEquipe equipe;              // Produtores, runners e seguranças
+    CatalogoFornecedores fornecedores;     // Ofertas de fornecedores por item
+    DiarioRecebimentos recebimentos;       // Mercadorias recebidas no estoque
+
+    mutable mutex trava;  // Domínio de trava do evento (mutable: travar em métodos const)
+
+public:  // Interface pública
+    /**
+     * @brief Construtor
+     * @param id ID do evento
+     * @param nome Nome do evento
+     */
+    Evento(int id, const string& nome);
+
+    // Gerenciadores e mutex não podem ser copiados
+    Evento(const Evento&) = delete;
+    Evento& operator=(const Evento&) = delete;
+
+    // ==================== GETTERS ====================
+    int getId() const;
+    string getNome() const;
+    mutex& getTrava() const;                      // Trava do evento inteiro
+
+    GerenciadorArtistas& getArtistas();
+    GerenciadorItens& getItens();
+    Estoque& getEstoque();
+    GerenciadorCamarins& getCamarins();
+    GerenciadorPedidos& getPedidos();
+    GerenciadorListaCompras& getListasCompras();
+    GerenciadorRiders& getRiders();
+    IndiceAtribuicao& getAtribuicoes();
+    AgendaCamarins& getAgenda();
+    GerenciadorEquipe& getEquipe();
+    ListaAutomatica& getListaAutomatica();
+    CatalogoFornecedores& getFornecedores();
+    DiarioRecebimentos& getRecebimentos();
+
+    const GerenciadorArtistas& getArtistas() const;
+    const Estoque& getEstoque() const;
+    const GerenciadorCamarins& getCamarins() const;
+    const GerenciadorPedidos& getPedidos() const;
+};  // Fim da classe Evento
+
+/**
+ * @struct ResumoEvento
+ * @brief Números de um evento para o relatório consolidado
+ */
+struct ResumoEvento {
+    int eventoId;              // ID do evento
+    string nome;               // Nome do evento
+    size_t artistas;           // Artistas cadastrados
+    size_t camarins;           // Camarins cadastrados
+    size_t pedidosPendentes;   // Pedidos ainda não atendidos
+    size_t pedidosAtendidos;   // Atendidos (em memória + arquivados)
+    size_t itensEstoque;       // Itens distintos no estoque
+    long long unidadesEstoque; // Soma das quantidades em estoque
+
+    ResumoEvento() : eventoId(0), nome(""), artistas(0), camarins(0), pedidosPendentes(0),
+                     pedidosAtendidos(0), itensEstoque(0), unidadesEstoque(0) {}
+};  // Fim da struct ResumoEvento
+
+/**
+ * @class GerenciadorEventos
+ * @brief Gerencia os eventos (shards) e relatórios entre eventos
+ *
+ * Eventos são guardados por unique_ptr: o endereço de cada evento
+ * não muda quando outros são criados ou removidos
+ */
+class GerenciadorEventos {
+private:  // Atributos privados
+    map<int, unique_ptr<Evento>> eventos;  // Chave = ID do evento
+    int proximoId;                         // Contador para gerar IDs únicos
+    friend class ArquivoSnapshot;          // Recria eventos com os IDs salvos
+    friend class LogAlteracoes;            // Recria e remove eventos registrados no log
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - nenhum evento, proximoId = 1
+     */
+    GerenciadorEventos();
+
+    /**
+     * @brief Cria novo evento vazio (CREATE)
+     * @return ID do evento
+     */
+    int criar(const string& nome);
+
+    /**
+     * @brief Busca evento por ID (READ)
+     * @return Ponteiro para o evento ou nullptr
+     */
+    Evento* buscarPorId(int id);
+
+    /**
+     * @brief Remove evento (DELETE)
+     * @return true se removido
+     *
+     * ATENÇÃO: o evento não pode estar em uso por outra thread
+     */
+    bool remover(int id);
+
+    /**
+     * @brief IDs e nomes de todos os eventos
+     */
+    vector<pair<int, string>> listar() const;
+
+    /**
+     * @brief Executa operação em um evento sob a trava dele
+     * @throws ValidacaoException se evento não existe
+     *
+     * Operações em eventos diferentes podem rodar em paralelo
+     */
+    void executar(int id, const function<void(Evento&)>& operacao);
+
+    /**
+     * @brief Executa operação em TODOS os eventos em paralelo
+     *
+     * Uma tarefa por evento, cada uma sob a trava do seu evento.
+     * Exceção de qualquer evento é relançada depois que todos terminam.
+     */
+    void paraCadaEmParalelo(const function<void(Evento&)>& operacao);
+
+    /**
+     * @brief Resumo de todos os eventos (calculado em paralelo)
+     * @return Um ResumoEvento por evento, em ordem de ID
+     */
+    vector<ResumoEvento> resumir();
+
+    /**
+     * @brief Relatório consolidado formatado (por evento + total geral)
+     */
+    static string exibirRelatorio(const vector<ResumoEvento>& resumos);
+};  // Fim da classe GerenciadorEventos
+
+#endif // EVENTO_H
+// Fim do include guard
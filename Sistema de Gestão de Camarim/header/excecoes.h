@@ -221,6 +221,24 @@ public:  // Construtor público
     // Formata mensagem: "Erro com Lista de Compras: " + detalhes
 };  // Fim da classe ListaComprasException
 
+/**
+ * @class PersistenciaException
+ * @brief Exceção relacionada a gravação e leitura de arquivos
+ * 
+ * Lançada quando ocorrem erros de disco
+ * (ex: arquivo não abre, gravação falha, registro corrompido)
+ */
+class PersistenciaException : public ExcecaoBase {  // HERDA de ExcecaoBase
+public:  // Construtor público
+    /**
+     * @brief Construtor que formata mensagem de erro de persistência
+     * @param msg Descrição do erro
+     */
+    explicit PersistenciaException(const string& msg)
+        : ExcecaoBase("Erro de Persistência: " + msg) {}
+    // Formata mensagem: "Erro de Persistência: " + detalhes
+};  // Fim da classe PersistenciaException
+
 /**
  * RESUMO DA HIERARQUIA DE EXCEÇÕES:
  * 
@@ -235,7 +253,8 @@ public:  // Construtor público
  *     │   EstoqueInsuficienteException (estoque insuficiente - 3 níveis!)
  *     ├── CamarimException (erros de camarins)
  *     ├── PedidoException (erros de pedidos)
- *     └── ListaComprasException (erros de lista de compras)
+ *     ├── ListaComprasException (erros de lista de compras)
+ *     └── PersistenciaException (erros de arquivos em disco)
  * 
  * VANTAGENS:
  * 1. Tratamento específico com catch(TipoException& e)
@@ -0,0 +1,156 @@
+/**
+ * @file exportacao.h
+ * @brief Definição das classes SaidaExportacao e ExportadorDados
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Exportação de catálogo, estoque, camarins, pedidos e listas de compras
+ * em CSV ou JSON. Os registros são escritos direto dos gerenciadores para
+ * um buffer fixo que é descarregado no arquivo quando enche: memória
+ * constante, qualquer que seja o tamanho da exportação.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef EXPORTACAO_H  // Se EXPORTACAO_H não foi definido
+#define EXPORTACAO_H  // Define EXPORTACAO_H
+
+// Bibliotecas necessárias
+#include <string>    // Para caminhos e textos exportados
+#include <cstdint>   // Para uint64_t (bytes escritos)
+#include <cstddef>   // Para size_t
+#include <cstdio>    // Para FILE (Windows)
+
+using namespace std;  // Namespace padrão
+
+class Evento;  // Declaração antecipada (evento.h é pesado)
+
+/**
+ * @enum FormatoExportacao
+ * @brief Formato do arquivo exportado
+ */
+enum class FormatoExportacao {
+    CSV,   // Uma linha por registro (filhos achatados: uma linha por item)
+    JSON   // Array de objetos (filhos aninhados em "itens")
+};
+
+/**
+ * @enum TipoExportacao
+ * @brief O que exportar do evento
+ */
+enum class TipoExportacao {
+    CATALOGO,
+    ESTOQUE,
+    CAMARINS,
+    PEDIDOS,
+    LISTAS
+};
+
+/**
+ * @struct ResumoExportacao
+ * @brief O que foi exportado
+ */
+struct ResumoExportacao {
+    size_t registros;  // Linhas do CSV ou objetos de primeiro nível do JSON
+    uint64_t bytes;    // Tamanho do arquivo
+
+    ResumoExportacao() : registros(0), bytes(0) {}
+};  // Fim da struct ResumoExportacao
+
+/**
+ * @class SaidaExportacao
+ * @brief Arquivo de saída com buffer fixo
+ *
+ * Números são formatados direto no buffer (sem strings temporárias).
+ * No POSIX escreve com write(2) no descritor; no Windows, com fwrite.
+ */
+class SaidaExportacao {
+private:  // ENCAPSULAMENTO: atributos privados
+    static const size_t TAMANHO_BUFFER = 1 << 16;  // 64 KB
+
+    string caminho;                // Arquivo de destino
+#ifdef _WIN32
+    FILE* arquivo;                 // nullptr = fechado
+#else
+    int descritor;                 // -1 = fechado
+#endif
+    char buffer[TAMANHO_BUFFER];   // Bytes ainda não escritos
+    size_t usado;                  // Quantos bytes do buffer estão ocupados
+    uint64_t escritos;             // Total já descarregado no arquivo
+
+    /**
+     * @brief Escreve o buffer inteiro no arquivo
+     * @throws PersistenciaException se a escrita falhar
+     */
+    void descarregar();
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - cria (ou substitui) o arquivo
+     * @throws PersistenciaException se o arquivo não puder ser criado
+     */
+    explicit SaidaExportacao(const string& caminho);
+
+    /**
+     * @brief Destrutor - fecha sem descarregar (use fechar() para confirmar)
+     */
+    ~SaidaExportacao();
+
+    SaidaExportacao(const SaidaExportacao&) = delete;
+    SaidaExportacao& operator=(const SaidaExportacao&) = delete;
+
+    // ==================== ESCRITA ====================
+    void escrever(const char* dados, size_t tamanho);
+    void escrever(const char* texto);     // Texto constante (terminado em '\0')
+    void escrever(char caractere);
+    void inteiro(long long valor);        // Em decimal
+    void centavos(long long valor);       // Como reais com duas casas: 1250 -> 12.50
+    void textoCsv(const string& texto);   // Entre aspas se precisar (aspas internas dobradas)
+    void textoJson(const string& texto);  // Entre aspas, com escapes
+
+    /**
+     * @brief Descarrega o que falta e fecha o arquivo
+     * @throws PersistenciaException se a escrita falhar
+     */
+    void fechar();
+
+    uint64_t getBytes() const;  // Bytes escritos (incluindo os ainda no buffer)
+};  // Fim da classe SaidaExportacao
+
+/**
+ * @class ExportadorDados
+ * @brief Exporta os dados de um evento sem cópias intermediárias
+ *
+ * Percorre os vetores dos gerenciadores (classe amiga deles) em vez de
+ * listar(), que copiaria tudo. Pedidos e listas em CSV saem com uma linha
+ * por item, repetindo os campos do pai; camarins, pedidos e listas sem
+ * itens saem com uma linha e os campos do item vazios.
+ *
+ * Pedidos já arquivados em disco não entram (só os que estão em memória).
+ */
+class ExportadorDados {
+private:  // Um exportador por tipo
+    static size_t exportarCatalogo(Evento& evento, FormatoExportacao formato, SaidaExportacao& saida);
+    static size_t exportarEstoque(Evento& evento, FormatoExportacao formato, SaidaExportacao& saida);
+    static size_t exportarCamarins(Evento& evento, FormatoExportacao formato, SaidaExportacao& saida);
+    static size_t exportarPedidos(Evento& evento, FormatoExportacao formato, SaidaExportacao& saida);
+    static size_t exportarListas(Evento& evento, FormatoExportacao formato, SaidaExportacao& saida);
+
+public:  // Interface pública
+    /**
+     * @brief Exporta um tipo de dado do evento
+     * @param evento Evento de origem (chamar com a trava dele)
+     * @param tipo O que exportar
+     * @param formato CSV ou JSON
+     * @param caminho Arquivo de destino (substituído por inteiro)
+     * @return Resumo da exportação
+     * @throws PersistenciaException se a gravação falhar (arquivo anterior fica intacto)
+     *
+     * Grava em um arquivo temporário e renomeia no fim
+     */
+    static ResumoExportacao exportar(Evento& evento, TipoExportacao tipo, FormatoExportacao formato,
+                                     const string& caminho);
+};  // Fim da classe ExportadorDados
+
+#endif // EXPORTACAO_H
+// Fim do include guard
@@ -0,0 +1,233 @@
+/**
+ * @file fornecedor.h
+ * @brief Definição das classes CatalogoFornecedores e DivisaoCompras
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * O mesmo item é comprado de vários fornecedores, cada um com seu preço,
+ * quantidade mínima e tamanho de embalagem. O catálogo guarda as ofertas
+ * por item e divide uma lista de compras em pedidos por fornecedor com o
+ * menor custo total.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef FORNECEDOR_H  // Se FORNECEDOR_H não foi definido
+#define FORNECEDOR_H  // Define FORNECEDOR_H
+
+// Bibliotecas necessárias
+#include <map>            // Para fornecedores e pedidos por fornecedor
+#include <set>            // Para itens de cada fornecedor
+#include <vector>         // Para ofertas de cada item
+#include <string>         // Para nomes
+#include <iostream>       // Para operator<<
+#include <unordered_map>  // Ofertas e planos por item
+#include "listacompras.h" // Lista a dividir
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @struct OfertaFornecedor
+ * @brief Condições de um fornecedor para um item
+ *
+ * Compra válida: múltiplo de tamanhoEmbalagem e no mínimo quantidadeMinima
+ */
+struct OfertaFornecedor {
+    int fornecedorId;
+    int itemId;
+    long long precoCentavos;  // Preço por unidade
+    int quantidadeMinima;     // Menor compra aceita (unidades)
+    int tamanhoEmbalagem;     // Unidades por embalagem
+
+    OfertaFornecedor()
+        : fornecedorId(0), itemId(0), precoCentavos(0), quantidadeMinima(1), tamanhoEmbalagem(1) {}
+    OfertaFornecedor(int fornecedorId, int itemId, long long precoCentavos, int quantidadeMinima, int tamanhoEmbalagem)
+        : fornecedorId(fornecedorId), itemId(itemId), precoCentavos(precoCentavos),
+          quantidadeMinima(quantidadeMinima), tamanhoEmbalagem(tamanhoEmbalagem) {}
+
+    /**
+     * @brief Menor compra válida (mínimo arredondado para embalagens inteiras)
+     */
+    int menorCompra() const;
+};  // Fim da struct OfertaFornecedor
+
+/**
+ * @struct CompraFornecedor
+ * @brief Linha de um pedido de compra a um fornecedor
+ */
+struct CompraFornecedor {
+    int itemId;
+    string nomeItem;
+    int quantidade;           // Unidades compradas (embalagens inteiras)
+    int necessaria;           // Parte desta compra que a lista precisava (o resto é sobra de embalagem)
+    long long precoCentavos;
+    long long subtotalCentavos;
+
+    CompraFornecedor()
+        : itemId(0), quantidade(0), necessaria(0), precoCentavos(0), subtotalCentavos(0) {}
+};  // Fim da struct CompraFornecedor
+
+/**
+ * @class DivisaoCompras
+ * @brief Pedidos de compra por fornecedor gerados a partir de uma lista
+ */
+class DivisaoCompras {
+    friend class CatalogoFornecedores;  // Único que preenche a divisão
+
+private:  // ENCAPSULAMENTO: atributos privados
+    map<int, vector<CompraFornecedor>> porFornecedor;  // Chave = fornecedorId
+    map<int, string> nomesFornecedores;                // Para exibição
+    vector<int> semOferta;                             // Itens que ninguém vende
+    long long totalCentavos;                           // Soma de todos os pedidos
+    long long totalListaCentavos;                      // Total da lista pelo preço do catálogo
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - divisão vazia
+     */
+    DivisaoCompras();
+
+    // ==================== GETTERS ====================
+    const map<int, vector<CompraFornecedor>>& getPorFornecedor() const;
+    const vector<int>& getSemOferta() const;
+    long long getTotalCentavos() const;
+    long long getTotalPedidoCentavos(int fornecedorId) const;  // Total do pedido a um fornecedor
+
+    /**
+     * @brief Exibe um bloco por fornecedor, os itens sem oferta e a economia
+     */
+    string exibir() const;
+
+    /**
+     * @brief Sobrecarga do operador << para cout
+     */
+    friend ostream& operator<<(ostream& os, const DivisaoCompras& divisao);
+};  // Fim da classe DivisaoCompras
+
+/**
+ * @class CatalogoFornecedores
+ * @brief Fornecedores, ofertas por item e divisão de listas de compras
+ *
+ * PLANO POR ITEM: o menor custo para cobrir N unidades com ofertas que têm
+ * mínimo e embalagem é uma mochila "ilimitada com entrada" sobre as
+ * unidades, O(ofertas do item × N) de tempo e O(N) de memória. O plano
+ * de cada item fica em cache e só é recalculado quando as ofertas DAQUELE
+ * item mudam ou a quantidade pedida muda: uma nova divisão após atualizar
+ * preços refaz só os itens afetados.
+ */
+class CatalogoFornecedores {
+private:  // Tipos internos
+    /**
+     * @brief Plano de compra de um item (resultado em cache)
+     */
+    struct PlanoItem {
+        int quantidade;                     // Quantidade para a qual foi calculado
+        vector<pair<size_t, int>> compras;  // (posição da oferta em ofertasPorItem, unidades)
+        long long custo;
+    };
+
+private:  // ENCAPSULAMENTO: atributos privados
+    map<int, string> fornecedores;                             // Chave = fornecedorId
+    int proximoId;                                             // Contador de IDs de fornecedor
+    unordered_map<int, vector<OfertaFornecedor>> ofertasPorItem;  // Chave = itemId
+    map<int, set<int>> itensPorFornecedor;                     // Para remover fornecedor inteiro
+    size_t totalOfertas;
+    unordered_map<int, PlanoItem> planos;                      // Cache por itemId
+    vector<int>* alterados;                                    // Fornecedores alterados (nullptr = sem log)
+    friend class ArquivoSnapshot;                              // Restaura fornecedores e proximoId
+    friend class LogAlteracoes;                                // Reaplica fornecedores gravados no log
+
+    /**
+     * @brief Menor custo para comprar ao menos 'quantidade' unidades do item
+     */
+    PlanoItem planejarItem(const vector<OfertaFornecedor>& ofertas, int quantidade) const;
+
+    /**
+     * @brief Descarta o plano em cache de um item (ofertas mudaram)
+     */
+    void invalidar(int itemId);
+
+    /**
+     * @brief Anota o fornecedor no log de alterações (se ligado)
+     *
+     * Ofertas vão para o log junto com o fornecedor que as faz
+     */
+    void anotar(int fornecedorId);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - catálogo vazio
+     */
+    CatalogoFornecedores();
+
+    // ==================== FORNECEDORES ====================
+    /**
+     * @brief Cadastra fornecedor
+     * @return ID do fornecedor
+     * @throws ValidacaoException se nome vazio
+     */
+    int cadastrarFornecedor(const string& nome);
+
+    /**
+     * @brief Remove fornecedor e todas as suas ofertas
+     * @return false se não existe
+     */
+    bool removerFornecedor(int fornecedorId);
+
+    /**
+     * @brief Nome do fornecedor ("" se não existe)
+     */
+    string nomeFornecedor(int fornecedorId) const;
+
+    const map<int, string>& getFornecedores() const;
+
+    // ==================== OFERTAS ====================
+    /**
+     * @brief Cria ou atualiza a oferta de um fornecedor para um item
+     * @throws ValidacaoException se fornecedor não existe, preço negativo,
+     *         mínimo ou embalagem menores que 1
+     */
+    void definirOferta(int fornecedorId, int itemId, long long precoCentavos,
+                       int quantidadeMinima = 1, int tamanhoEmbalagem = 1);
+
+    /**
+     * @brief Remove a oferta de um fornecedor para um item
+     * @return false se a oferta não existe
+     */
+    bool removerOferta(int fornecedorId, int itemId);
+
+    /**
+     * @brief Ofertas de um item (vazio se ninguém vende)
+     */
+    const vector<OfertaFornecedor>& ofertasDoItem(int itemId) const;
+
+    size_t quantidadeOfertas() const;
+
+    // ==================== DIVISÃO ====================
+    /**
+     * @brief Divide a lista em pedidos por fornecedor com o menor custo total
+     *
+     * Cada item é comprado em embalagens inteiras, respeitando mínimos;
+     * pode ser dividido entre fornecedores quando isso sai mais barato
+     */
+    DivisaoCompras dividir(const ListaCompras& lista);
+
+    /**
+     * @brief Exibe fornecedores e ofertas
+     */
+    string exibir() const;
+
+    /**
+     * @brief Sobrecarga do operador << para cout
+     */
+    friend ostream& operator<<(ostream& os, const CatalogoFornecedores& catalogo);
+
+    /**
+     * @brief Passa a anotar os fornecedores alterados (nome ou ofertas)
+     * @param alterados Lista preenchida a cada alteração (nullptr = desliga)
+     */
+    void ligarAlteracoes(vector<int>* alterados);
+};  // Fim da classe CatalogoFornecedores
+
+#endif // FORNECEDOR_H
+// Fim do include guard
@@ -0,0 +1,99 @@
+/**
+ * @file idempotencia.h
+ * @brief Definição da classe CacheIdempotencia
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Evita operações duplicadas quando um dispositivo reenvia a mesma
+ * requisição (ex: Wi-Fi instável). Cada requisição traz uma chave;
+ * um reenvio com a mesma chave devolve o resultado original.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef IDEMPOTENCIA_H  // Se IDEMPOTENCIA_H não foi definido
+#define IDEMPOTENCIA_H  // Define IDEMPOTENCIA_H
+
+// Bibliotecas necessárias
+#include <string>         // Para as chaves de requisição
+#include <unordered_map>  // Tabela hash: busca O(1)
+#include <deque>          // Fila por ordem de chegada (para expiração)
+#include <cstdint>        // Para int64_t (instantes em ns)
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @class CacheIdempotencia
+ * @brief Tabela hash LIMITADA de chave de requisição → resultado
+ *
+ * LIMITES DE MEMÓRIA:
+ * - No máximo `capacidade` chaves (as mais antigas saem primeiro)
+ * - Chaves mais velhas que `validadeNs` expiram
+ * - A tabela é reservada no construtor e nunca cresce além disso,
+ *   então a memória fica estável mesmo em execuções de vários dias
+ *
+ * Como as chaves entram em ordem de tempo, a fila de chegada também
+ * é a fila de expiração: a remoção é sempre pela frente (O(1) amortizado)
+ */
+class CacheIdempotencia {
+private:  // Atributos privados
+    /**
+     * @struct Entrada
+     * @brief Resultado guardado para uma chave
+     */
+    struct Entrada {
+        int resultado;      // Valor devolvido na primeira execução (ex: ID do pedido)
+        int64_t instante;   // Momento do registro (relógio monotônico)
+    };
+
+    unordered_map<string, Entrada> entradas;         // Chave → resultado
+    deque<pair<int64_t, const string*>> chegada;     // (instante, ponteiro para a chave no map)
+    size_t capacidade;                                // Máximo de chaves guardadas
+    int64_t validadeNs;                               // Tempo de vida de cada chave
+
+    /**
+     * @brief Remove chaves expiradas ou excedentes
+     * @param agoraNs Instante atual
+     */
+    void expirar(int64_t agoraNs);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor
+     * @param capacidade Máximo de chaves (padrão: 4096)
+     * @param validadeNs Tempo de vida das chaves (padrão: 10 minutos)
+     */
+    explicit CacheIdempotencia(size_t capacidade = 4096,
+                               int64_t validadeNs = 600LL * 1000000000LL);
+
+    // Fila guarda ponteiros para as chaves do map: cópia quebraria os ponteiros
+    CacheIdempotencia(const CacheIdempotencia&) = delete;
+    CacheIdempotencia& operator=(const CacheIdempotencia&) = delete;
+
+    /**
+     * @brief Procura resultado de uma requisição já processada
+     * @param chave Chave da requisição
+     * @param agoraNs Instante atual (relógio monotônico)
+     * @param resultado [saída] Resultado original, se encontrado
+     * @return true se a chave já foi processada e ainda é válida
+     *
+     * Busca O(1), sem alocar memória
+     */
+    bool buscar(const string& chave, int64_t agoraNs, int& resultado);
+
+    /**
+     * @brief Registra o resultado de uma requisição processada
+     * @param chave Chave da requisição
+     * @param resultado Resultado a devolver em reenvios
+     * @param agoraNs Instante atual (relógio monotônico)
+     */
+    void registrar(const string& chave, int resultado, int64_t agoraNs);
+
+    /**
+     * @brief Quantidade de chaves guardadas no momento
+     */
+    size_t tamanho() const;
+};  // Fim da classe CacheIdempotencia
+
+#endif // IDEMPOTENCIA_H
+// Fim do include guard
@@ -19,6 +19,10 @@
 #include <iostream>
 // Inclui biblioteca para trabalhar com vetores (arrays dinâmicos)
 #include <vector>
+// Inclui map para a versão de preço de cada item
+#include <map>
+// Inclui function para o observador de mudança de preço
+#include <functional>
 
 // Usa o namespace padrão para evitar escrever std:: antes de cada tipo
 using namespace std;
@@ -35,6 +39,7 @@ private:  // Modificador de acesso: só acessível dentro da própria classe (EN
     int id;           // Identificador único do item (número inteiro)
     string nome;      // Nome do item (texto/string)
     double preco;     // Preço unitário do item (número decimal de precisão dupla)
+    friend class ExportadorDados;  // Exporta sem copiar o nome
     
 public:  // Modificador de acesso: acessível de qualquer lugar do programa
     /**
@@ -101,6 +106,14 @@ class GerenciadorItens {  // Classe que gerencia todos os itens do sistema
 private:  // Atributos privados (ENCAPSULAMENTO)
     vector<Item> itens;    // Vetor (array dinâmico) que armazena todos os itens cadastrados
     int proximoId;         // Contador para gerar próximo ID único disponível
+    map<int, long long> versoesPreco;  // Versão do preço de cada item (chave = itemId)
+    long long ultimaVersaoPreco;       // Contador global de versões (nunca repete)
+    function<void(int)> observadorPreco;  // Chamado quando o preço de um item muda (recebe itemId)
+    vector<int>* alterados;               // IDs alterados desde a última confirmação (nullptr = sem log)
+    
+    friend class ArquivoSnapshot;  // Restaura itens com os IDs salvos (sem revalidar nomes)
+    friend class LogAlteracoes;    // Reaplica itens do log mantendo as versões de preço
+    friend class ExportadorDados;  // Percorre o catálogo sem listar() (que copia)
     
 public:  // Métodos públicos (interface da classe)
     /**
@@ -163,6 +176,29 @@ public:  // Métodos públicos (interface da classe)
     bool atualizar(int id, const string& nome, double preco);  
     // Busca um item pelo ID e atualiza seus dados (nome e preço)
     // Retorna true se atualizou com sucesso, false se não encontrou
+    // Se o preço mudou: nova versão de preço e aviso ao observador
+    
+    /**
+     * @brief Versão do preço atual de um item
+     * @param id ID do item
+     * @return Versão (>= 1), ou 0 se o item não existe
+     * 
+     * Linhas de lista de compras guardam a versão com que foram
+     * precificadas: versão diferente = preço desatualizado
+     */
+    long long getVersaoPreco(int id) const;
+    
+    /**
+     * @brief Define função chamada quando o preço de um item muda
+     * @param observador Recebe o ID do item alterado (também quando o item é removido)
+     */
+    void definirObservadorPreco(function<void(int itemId)> observador);
+    
+    /**
+     * @brief Passa a anotar os IDs de itens cadastrados, alterados e removidos
+     * @param alterados Lista preenchida a cada alteração (nullptr = desliga)
+     */
+    void ligarAlteracoes(vector<int>* alterados);
 };  // Fim da classe GerenciadorItens
 
 #endif // ITEM_H - Fim da proteção contra inclusão múltipla
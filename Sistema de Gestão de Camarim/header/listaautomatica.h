@@ -0,0 +1,176 @@
+/**
+ * @file listaautomatica.h
+ * @brief Definição da classe ListaAutomatica
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Lista de compras gerada a partir do que FALTA: tudo que pedidos,
+ * riders e estoque mínimo exigem, menos o que há no estoque e o que
+ * já está em alguma lista de compras. Mantida item a item conforme
+ * pedidos, estoque, camarins, riders e listas mudam, sem recalcular
+ * o catálogo inteiro.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef LISTAAUTOMATICA_H  // Se LISTAAUTOMATICA_H não foi definido
+#define LISTAAUTOMATICA_H  // Define LISTAAUTOMATICA_H
+
+// Bibliotecas necessárias
+#include <map>            // Para necessidades por item
+#include <set>            // Para camarins de cada artista
+#include <string>         // Para exibição
+#include <iostream>       // Para operator<<
+#include "item.h"         // Catálogo (nomes e preços)
+#include "listacompras.h" // Lista gerada
+#include "camarim.h"      // Camarins (o que cada um tem)
+#include "rider.h"        // Riders (o que cada camarim deve ter)
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @struct NecessidadeItem
+ * @brief Origem da demanda e da cobertura de um item
+ *
+ * falta = (pedidos + riders + minimo) - (estoque + emListas), nunca negativa
+ */
+struct NecessidadeItem {
+    int pedidos;   // Pendente nos pedidos não atendidos
+    int riders;    // Necessário para repor os camarins conforme o rider
+    int minimo;    // Estoque mínimo desejado
+    int estoque;   // Saldo atual no estoque
+    int emListas;  // Já presente em alguma lista de compras
+
+    NecessidadeItem() : pedidos(0), riders(0), minimo(0), estoque(0), emListas(0) {}
+
+    int falta() const;  // Quanto comprar
+    bool vazia() const; // true se nenhum campo tem valor (pode ser descartada)
+};  // Fim da struct NecessidadeItem
+
+/**
+ * @class ListaAutomatica
+ * @brief Lista de compras calculada a partir das faltas
+ *
+ * INCREMENTAL: cada mudança informa apenas o item afetado e só a linha
+ * desse item é recalculada (O(log n)). Os observadores de estoque,
+ * pedidos, camarins, riders, listas e preços chamam os métodos abaixo;
+ * nada percorre todos os camarins ou todas as listas.
+ *
+ * RIDERS: guarda a falta de cada item em cada camarim com artista.
+ * Mudança de um item (no camarim ou no rider) recalcula só essa falta
+ * e soma a diferença ao total do item; troca de artista ou de rider
+ * recalcula só aquele camarim.
+ */
+class ListaAutomatica {
+private:  // ENCAPSULAMENTO: atributos privados
+    /**
+     * @struct RiderCamarim
+     * @brief Faltas de um camarim em relação ao rider do seu artista
+     */
+    struct RiderCamarim {
+        int artistaId;        // Artista do camarim quando as faltas foram calculadas
+        map<int, int> faltas; // itemId → falta (só positivas)
+
+        RiderCamarim() : artistaId(0) {}
+    };
+
+    GerenciadorItens& catalogo;                 // Nomes e preços (do mesmo evento)
+    GerenciadorCamarins& camarins;              // O que cada camarim tem
+    GerenciadorRiders& riders;                  // O que cada camarim deve ter
+    map<int, NecessidadeItem> necessidades;     // Chave = itemId
+    map<int, RiderCamarim> ridersPorCamarim;    // Só camarins com artista
+    map<int, set<int>> camarinsPorArtista;      // artistaId → camarins (para mudanças de rider)
+    ListaCompras lista;                         // Resultado: só itens com falta
+    vector<int>* alterados;                     // Itens com mínimo alterado (nullptr = sem log)
+
+    /**
+     * @brief Recalcula a linha de um item na lista
+     *
+     * Item fora do catálogo sai da lista (não há preço para comprar)
+     */
+    void recalcular(int itemId);
+
+    /**
+     * @brief Altera um campo da necessidade e recalcula se mudou
+     */
+    void definirCampo(int itemId, int NecessidadeItem::* campo, int valor);
+
+    /**
+     * @brief Troca a falta de um item em um camarim e soma a diferença aos riders
+     */
+    void definirFaltaCamarim(RiderCamarim& estado, int itemId, int falta);
+
+    /**
+     * @brief Recalcula todas as faltas de um camarim (artista ou rider trocado)
+     */
+    void recalcularCamarim(int camarimId);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor (referências guardadas; só usadas depois de construídas)
+     * @param catalogo Catálogo do evento
+     * @param camarins Camarins do evento
+     * @param riders Riders do evento
+     */
+    ListaAutomatica(GerenciadorItens& catalogo, GerenciadorCamarins& camarins, GerenciadorRiders& riders);
+
+    // ==================== ATUALIZAÇÕES POR ITEM ====================
+    void definirPedidos(int itemId, int quantidade);  // Demanda pendente dos pedidos
+    void definirEstoque(int itemId, int quantidade);  // Saldo atual do estoque
+    void definirEmListas(int itemId, int quantidade); // Soma do item nas listas de compras
+
+    /**
+     * @brief Define estoque mínimo de um item (0 remove o mínimo)
+     * @throws ValidacaoException se mínimo negativo
+     * @throws ItemException se item não existe no catálogo
+     */
+    void definirEstoqueMinimo(int itemId, int minimo);
+
+    /**
+     * @brief Camarim mudou (observador de GerenciadorCamarins)
+     * @param itemId Item alterado (0 = camarim inteiro: cadastro, artista, remoção)
+     *
+     * Um item: O(log n). Camarim inteiro: O(itens do camarim + do rider)
+     */
+    void atualizarCamarim(int camarimId, int itemId);
+
+    /**
+     * @brief Rider de um artista mudou (observador de GerenciadorRiders)
+     * @param itemId Item alterado (0 = rider inteiro: cadastro ou remoção)
+     *
+     * Rider que não é o vigente do artista não muda nenhuma falta
+     */
+    void atualizarRider(int artistaId, int itemId);
+
+    /**
+     * @brief Preço de um item mudou ou o item saiu do catálogo
+     *
+     * Só a linha desse item é refeita, e só se a versão do preço mudou
+     */
+    void reprecificarItem(int itemId);
+
+    /**
+     * @brief Passa a anotar os itens com estoque mínimo alterado
+     * @param alterados Lista preenchida a cada alteração (nullptr = desliga)
+     *
+     * O mínimo é o único dado digitado da lista (o resto é derivado)
+     */
+    void ligarAlteracoes(vector<int>* alterados);
+
+    // ==================== GETTERS ====================
+    const ListaCompras& getLista() const;             // Lista gerada (referência, sem cópia)
+    NecessidadeItem getNecessidade(int itemId) const; // Detalhe de um item (zerada se não há)
+
+    /**
+     * @brief Exibe a lista com a origem de cada falta
+     */
+    string exibir() const;
+
+    /**
+     * @brief Sobrecarga do operador << para cout
+     */
+    friend ostream& operator<<(ostream& os, const ListaAutomatica& automatica);
+};  // Fim da classe ListaAutomatica
+
+#endif // LISTAAUTOMATICA_H
+// Fim do include guard
@@ -17,7 +17,12 @@
 #include <string>    // Para trabalhar com strings
 #include <vector>    // Para lista de ListaCompras
 #include <map>       // Para armazenar itens com chave itemId
+#include <set>       // Para listas de cada item e itens com preço alterado
+#include <functional>  // Para o observador de quantidades
+#include "mapapequeno.h"  // Mapa plano para os itens da lista
 #include <iostream>  // Para entrada/saída
+#include <cmath>     // Para llround (preço em centavos)
+#include "item.h"    // Catálogo (preços atuais na reprecificação)
 
 using namespace std;  // Namespace padrão
 
@@ -34,11 +39,14 @@ struct ItemCompra {
     int quantidade;    // Quantidade necessária para comprar
     double preco;      // Preço unitário do item
     double subtotal;   // Subtotal calculado (quantidade * preço)
+    long long precoCentavos;  // Preço unitário em centavos (base das somas exatas)
+    long long versaoPreco;    // Versão do preço no catálogo (0 = preço de fora do catálogo, fixo)
     
     /**
      * @brief Construtor padrão - inicializa com zeros
      */
-    ItemCompra() : itemId(0), nomeItem(""), quantidade(0), preco(0.0), subtotal(0.0) {}
+    ItemCompra() : itemId(0), nomeItem(""), quantidade(0), preco(0.0), subtotal(0.0), precoCentavos(0),
+                   versaoPreco(0) {}
     
     /**
      * @brief Construtor parametrizado - calcula subtotal automaticamente
@@ -46,11 +54,19 @@ struct ItemCompra {
      * @param nome Nome do item
      * @param qtd Quantidade a comprar
      * @param preco Preço unitário
+     * @param versaoPreco Versão do preço no catálogo (0 = não acompanha o catálogo)
      */
-    ItemCompra(int id, const string& nome, int qtd, double preco) 
+    ItemCompra(int id, const string& nome, int qtd, double preco, long long versaoPreco = 0) 
         : itemId(id), nomeItem(nome), quantidade(qtd), preco(preco), 
-          subtotal(qtd * preco) {}
-    // IMPORTANTE: subtotal é calculado no construtor (qtd * preco)
+          subtotal(0.0), precoCentavos(llround(preco * 100)), versaoPreco(versaoPreco) {
+        subtotal = getSubtotalCentavos() / 100.0;
+    }
+    // IMPORTANTE: subtotal é calculado no construtor (qtd * preco, em centavos)
+    
+    /**
+     * @brief Subtotal exato em centavos (quantidade * preço em centavos)
+     */
+    long long getSubtotalCentavos() const { return quantidade * precoCentavos; }
 };  // Fim da struct ItemCompra
 
 /**
@@ -63,12 +79,60 @@ struct ItemCompra {
  * - Atualizar quantidades (recalcula subtotais)
  * - Calcular total geral da compra
  * - Exibir lista formatada com valores
+ * 
+ * TOTAL CORRENTE: o total (em centavos, sem erro de arredondamento) é
+ * mantido a cada alteração, então calcularTotal() é O(1). Uma lista
+ * ligada a um gerenciador também mantém o total geral dele: cópias
+ * são desligadas (não alteram o gerenciador), movimentos levam a ligação.
+ * 
+ * ÍNDICE REVERSO: do mesmo jeito, uma lista ligada registra no índice do
+ * gerenciador (item -> listas) cada item que entra ou sai dela, e soma
+ * cada mudança de quantidade ao total por item do gerenciador.
  */
 class ListaCompras {
 private:  // ENCAPSULAMENTO: atributos privados
     int id;                         // ID único da lista
     string descricao;               // Descrição/título da lista
-    map<int, ItemCompra> itens;    // Map: chave = itemId, valor = ItemCompra
+    MapaPequeno<int, ItemCompra> itens;  // Chave = itemId, valor = ItemCompra (mapa plano)
+    long long totalCentavos;        // Soma corrente dos subtotais
+    long long* totalGeral;          // Total do gerenciador dono (nullptr = lista avulsa)
+    map<int, set<int>>* indiceItens;  // Índice do gerenciador: itemId -> IDs das listas (nullptr = avulsa)
+    vector<int>* alterados;         // Log de alterações do gerenciador (nullptr = avulsa ou sem log)
+    map<int, int>* quantidadesItens;  // Total por item do gerenciador (nullptr = avulsa)
+    const function<void(int)>* observadorItens;  // Avisado a cada mudança desse total
+    friend class ExportadorDados;   // Exporta sem copiar a descrição
+    
+    /**
+     * @brief Anota o ID no log de alterações (se ligado)
+     */
+    void marcarAlterado();
+    
+    /**
+     * @brief Soma delta ao total desta lista e ao total geral ligado
+     */
+    void ajustarTotal(long long delta);
+    
+    /**
+     * @brief Registra (ou retira) esta lista no índice ligado, para um item
+     */
+    void indexar(int itemId);
+    void desindexar(int itemId);
+    
+    /**
+     * @brief Registra (ou retira) todos os itens desta lista no índice ligado
+     */
+    void indexarTodos();
+    void desindexarTodos();
+    
+    /**
+     * @brief Soma delta à quantidade do item no total ligado e avisa o observador
+     */
+    void ajustarQuantidade(int itemId, int delta);
+    
+    /**
+     * @brief Soma (sinal = 1) ou retira (sinal = -1) todas as linhas do total ligado
+     */
+    void contarTodos(int sinal);
     
 public:  // Interface pública
     /**
@@ -84,13 +148,61 @@ public:  // Interface pública
     ListaCompras(int id, const string& descricao);
     
     /**
-     * @brief Destrutor - libera recursos
+     * @brief Construtor de cópia - a cópia é avulsa (não altera o total geral)
+     */
+    ListaCompras(const ListaCompras& outra);
+    
+    /**
+     * @brief Construtor de movimento - leva a ligação com o total geral
+     */
+    ListaCompras(ListaCompras&& outra) noexcept;
+    
+    /**
+     * @brief Atribuição por cópia - mantém a ligação desta lista, ajustando o total geral
+     */
+    ListaCompras& operator=(const ListaCompras& outra);
+    
+    /**
+     * @brief Atribuição por movimento - sai do total geral e assume a ligação da outra
+     */
+    ListaCompras& operator=(ListaCompras&& outra) noexcept;
+    
+    /**
+     * @brief Destrutor - retira o total desta lista do total geral ligado
      */
     ~ListaCompras();
     
+    /**
+     * @brief Liga a lista a um total geral (usado pelo gerenciador)
+     * @param total Acumulador que deve sobreviver à lista
+     */
+    void ligarTotalGeral(long long* total);
+    
+    /**
+     * @brief Liga a lista a um índice item -> listas (usado pelo gerenciador)
+     * @param indice Índice que deve sobreviver à lista
+     */
+    void ligarIndice(map<int, set<int>>* indice);
+    
+    /**
+     * @brief Liga a lista ao total por item (usado pelo gerenciador)
+     * @param quantidades Total itemId -> quantidade que deve sobreviver à lista
+     * @param observador Recebe o itemId a cada mudança (pode ser nullptr)
+     */
+    void ligarQuantidades(map<int, int>* quantidades, const function<void(int)>* observador);
+    
+    /**
+     * @brief Liga a lista ao log de alterações do gerenciador
+     * 
+     * Itens entram e saem pela própria lista, sem passar pelo gerenciador.
+     * Reprecificação pelo catálogo não conta: a linha acompanha o item
+     */
+    void ligarAlteracoes(vector<int>* alterados);
+    
     // ==================== GETTERS ====================
     int getId() const;             // Retorna ID da lista
     string getDescricao() const;   // Retorna descrição da lista
+    const MapaPequeno<int, ItemCompra>& getItens() const;  // Itens da lista (referência, sem cópia)
     
     // ==================== SETTERS ====================
     void setId(int id);                           // Define ID
@@ -102,11 +214,13 @@ public:  // Interface pública
      * @param nomeItem Nome do item
      * @param quantidade Quantidade a comprar
      * @param preco Preço unitário
+     * @param versaoPreco Versão do preço no catálogo (0 = preço fixo, ex.: de fornecedor)
      * 
      * Se item já existe: SOMA quantidade e recalcula subtotal
      * Se item não existe: cria novo ItemCompra
      */
-    void adicionarItem(int itemId, const string& nomeItem, int quantidade, double preco);
+    void adicionarItem(int itemId, const string& nomeItem, int quantidade, double preco,
+                       long long versaoPreco = 0);
     
     /**
      * @brief Remove item da lista de compras
@@ -126,14 +240,31 @@ public:  // Interface pública
      */
     void atualizarQuantidade(int itemId, int quantidade);
     
+    /**
+     * @brief Troca nome e preço de uma linha que acompanha o catálogo
+     * @param itemId ID do item
+     * @param nomeItem Nome atual no catálogo
+     * @param preco Preço atual no catálogo
+     * @param versaoPreco Versão do preço atual
+     * @return true se a linha foi alterada (false: não existe, preço fixo ou já na versão)
+     * 
+     * Ajusta o total corrente só pela diferença do subtotal
+     */
+    bool reprecificarItem(int itemId, const string& nomeItem, double preco, long long versaoPreco);
+    
     /**
      * @brief Calcula total geral da lista de compras
      * @return Valor total (soma de todos os subtotais)
      * 
-     * Percorre todos os itens somando seus subtotais
+     * O(1): devolve o total corrente
      */
     double calcularTotal() const;
     
+    /**
+     * @brief Total exato em centavos - O(1)
+     */
+    long long getTotalCentavos() const;
+    
     /**
      * @brief Limpa toda a lista (remove todos os itens)
      * 
@@ -165,11 +296,30 @@ public:  // Interface pública
  * 
  * Permite ter múltiplas listas de compras
  * (ex: "Compras Semanais", "Compras Mensais", etc)
+ * 
+ * REPRECIFICAÇÃO PREGUIÇOSA: mudanças de preço no catálogo só marcam o
+ * item (marcarPrecoAlterado). reprecificar() visita apenas as linhas
+ * dos itens marcados, achadas pelo índice item -> listas, em vez de
+ * percorrer todas as listas.
  */
 class GerenciadorListaCompras {
 private:  // Atributos privados
-    vector<ListaCompras> listas;  // Vector de listas de compras
+    long long totalGeralCentavos;  // Soma de todas as listas (declarado ANTES: sobrevive a elas)
+    map<int, set<int>> listasPorItem;  // Índice reverso itemId -> IDs das listas (também ANTES)
+    map<int, int> quantidadesItens;    // Soma das quantidades de cada item em todas as listas (ANTES)
+    function<void(int)> observadorQuantidade;  // Avisado quando essa soma muda (ANTES)
+    vector<ListaCompras> listas;  // Vector de listas de compras (em ordem crescente de ID)
     int proximoId;                // Contador para gerar IDs únicos
+    set<int> precosAlterados;     // Itens com preço mudado ainda não aplicados às listas
+    friend class ArquivoSnapshot; // Recria listas com os IDs salvos
+    friend class LogAlteracoes;   // Idem, a partir do log de alterações
+    friend class ExportadorDados; // Percorre as listas sem listar() (que copia)
+    vector<int>* alterados;       // IDs alterados desde a última confirmação (nullptr = sem log)
+    
+    /**
+     * @brief Busca binária por ID (listas ficam em ordem crescente de ID)
+     */
+    ListaCompras* buscarOrdenado(int id);
     
 public:  // Interface pública CRUD
     /**
@@ -177,6 +327,10 @@ public:  // Interface pública CRUD
      */
     GerenciadorListaCompras();
     
+    // Listas guardam ponteiro para o total geral: gerenciador não pode ser copiado
+    GerenciadorListaCompras(const GerenciadorListaCompras&) = delete;
+    GerenciadorListaCompras& operator=(const GerenciadorListaCompras&) = delete;
+    
     /**
      * @brief Cria nova lista de compras (CREATE)
      * @param descricao Descrição/título da lista
@@ -209,6 +363,73 @@ public:  // Interface pública CRUD
      * @return Vector com cópias de todas as listas
      */
     vector<ListaCompras> listar() const;
+    
+    /**
+     * @brief Acesso às listas sem cópia (consolidação de muitas listas grandes)
+     */
+    const vector<ListaCompras>& getListas() const;
+    
+    /**
+     * @brief Soma, por item, o que já está em alguma lista de compras
+     * @return Map: chave = itemId, valor = quantidade somada em todas as listas
+     * 
+     * Usado para não comprar de novo o que já foi listado. Mantido a cada
+     * alteração de qualquer lista (não percorre as listas)
+     */
+    const map<int, int>& quantidadesPorItem() const;
+    
+    /**
+     * @brief Quantidade de um item somada em todas as listas - O(log n)
+     */
+    int quantidadeEmListas(int itemId) const;
+    
+    /**
+     * @brief Define função chamada quando a soma de um item nas listas muda
+     * @param observador Recebe o ID do item
+     * 
+     * Vale para alterações feitas direto na lista (buscarPorId)
+     */
+    void definirObservadorQuantidade(function<void(int itemId)> observador);
+    
+    /**
+     * @brief Total de todas as listas - O(1)
+     * @return Valor total (mantido a cada alteração de qualquer lista)
+     */
+    double calcularTotalGeral() const;
+    
+    /**
+     * @brief Total de todas as listas em centavos - O(1)
+     */
+    long long getTotalGeralCentavos() const;
+    
+    /**
+     * @brief Marca o preço de um item como alterado no catálogo - O(log n)
+     * @param itemId ID do item
+     * 
+     * Item que não está em nenhuma lista é ignorado
+     */
+    void marcarPrecoAlterado(int itemId);
+    
+    /**
+     * @brief Aplica os preços atuais do catálogo às linhas dos itens marcados
+     * @param catalogo Catálogo de itens (nome, preço e versão atuais)
+     * @return Número de linhas alteradas
+     * 
+     * Linhas com preço fixo (versão 0) ou já na versão atual não mudam;
+     * item removido do catálogo mantém o último preço nas listas
+     */
+    int reprecificar(GerenciadorItens& catalogo);
+    
+    /**
+     * @brief Quantidade de itens esperando reprecificação
+     */
+    size_t getPrecosPendentes() const;
+    
+    /**
+     * @brief Passa a anotar os IDs alterados (listas atuais e futuras)
+     * @param alterados Lista preenchida a cada alteração (nullptr = desliga)
+     */
+    void ligarAlteracoes(vector<int>* alterados);
 };  // Fim da classe GerenciadorListaCompras
 
 #endif // LISTACOMPRAS_H
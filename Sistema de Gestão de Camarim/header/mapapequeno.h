@@ -0,0 +1,165 @@
+/**
+ * @file mapapequeno.h
+ * @brief Definição do template MapaPequeno
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Mapa ordenado "plano" para coleções pequenas (itens de um camarim,
+ * de um pedido ou de uma lista de compras). Mesma interface usada
+ * do std::map, mas com os pares guardados em sequência na memória.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef MAPAPEQUENO_H  // Se MAPAPEQUENO_H não foi definido
+#define MAPAPEQUENO_H  // Define MAPAPEQUENO_H
+
+// Bibliotecas necessárias
+#include <vector>     // Armazenamento contíguo dos pares
+#include <utility>    // Para pair
+#include <algorithm>  // Para lower_bound
+#include <stdexcept>  // Para out_of_range (mesmo comportamento de map::at)
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @class MapaPequeno
+ * @brief Mapa ordenado em vetor (flat map) para poucas dezenas de chaves
+ * @tparam K Tipo da chave (ex: itemId)
+ * @tparam V Tipo do valor
+ * @tparam N Capacidade reservada na primeira inserção
+ *
+ * POR QUE NÃO std::map?
+ * - map aloca um nó no heap POR ELEMENTO e percorre ponteiros
+ * - Aqui: UMA alocação para até N elementos (mapa vazio não aloca),
+ *   iteração sequencial na memória e cópia em bloco
+ *
+ * CUSTO: inserção/remoção O(n) por deslocar elementos, irrelevante
+ * para as 5-30 linhas típicas de um camarim ou pedido.
+ *
+ * ATENÇÃO: diferente de map, inserir ou remover invalida iteradores
+ * e referências para outros elementos.
+ */
+template <typename K, typename V, size_t N = 16>
+class MapaPequeno {
+public:  // Tipos compatíveis com map (permite usar auto, range-for, etc)
+    typedef pair<K, V> value_type;
+    typedef typename vector<value_type>::iterator iterator;
+    typedef typename vector<value_type>::const_iterator const_iterator;
+
+private:  // Atributos privados
+    vector<value_type> dados;  // Pares ordenados por chave
+
+    /**
+     * @brief Primeira posição com chave >= chave (busca binária)
+     */
+    iterator posicao(const K& chave) {
+        return lower_bound(dados.begin(), dados.end(), chave,
+                           [](const value_type& par, const K& k) { return par.first < k; });
+    }
+
+    const_iterator posicao(const K& chave) const {
+        return lower_bound(dados.begin(), dados.end(), chave,
+                           [](const value_type& par, const K& k) { return par.first < k; });
+    }
+
+public:  // Interface pública (subconjunto da interface de map)
+    // ==================== ITERAÇÃO (em ordem de chave) ====================
+    iterator begin() { return dados.begin(); }
+    iterator end() { return dados.end(); }
+    const_iterator begin() const { return dados.begin(); }
+    const_iterator end() const { return dados.end(); }
+
+    // ==================== CAPACIDADE ====================
+    bool empty() const { return dados.empty(); }
+    size_t size() const { return dados.size(); }
+
+    /**
+     * @brief Remove todos os elementos e devolve a memória
+     */
+    void clear() {
+        vector<value_type>().swap(dados);
+    }
+
+    // ==================== BUSCA ====================
+    /**
+     * @brief Busca por chave
+     * @return Iterador para o par ou end() se não existe
+     */
+    iterator find(const K& chave) {
+        iterator it = posicao(chave);
+        return (it != dados.end() && it->first == chave) ? it : dados.end();
+    }
+
+    const_iterator find(const K& chave) const {
+        const_iterator it = posicao(chave);
+        return (it != dados.end() && it->first == chave) ? it : dados.end();
+    }
+
+    size_t count(const K& chave) const {
+        return find(chave) != dados.end() ? 1 : 0;
+    }
+
+    /**
+     * @brief Acesso com verificação
+     * @throws out_of_range se a chave não existe (igual a map::at)
+     */
+    V& at(const K& chave) {
+        iterator it = find(chave);
+        if (it == dados.end()) {
+            throw out_of_range("MapaPequeno::at: chave inexistente");
+        }
+        return it->second;
+    }
+
+    const V& at(const K& chave) const {
+        const_iterator it = find(chave);
+        if (it == dados.end()) {
+            throw out_of_range("MapaPequeno::at: chave inexistente");
+        }
+        return it->second;
+    }
+
+    // ==================== MODIFICAÇÃO ====================
+    /**
+     * @brief Acesso com inserção (igual a map::operator[])
+     * @return Referência ao valor (criado com V() se a chave não existia)
+     */
+    V& operator[](const K& chave) {
+        iterator it = posicao(chave);
+        if (it != dados.end() && it->first == chave) {
+            return it->second;
+        }
+
+        if (dados.capacity() == 0) {
+            // Primeira inserção: reserva N de uma vez (uma alocação cobre o caso típico)
+            dados.reserve(N);
+            it = dados.begin();  // Vetor vazio: posição de inserção é o início
+        }
+        return dados.insert(it, value_type(chave, V()))->second;
+    }
+
+    /**
+     * @brief Remove por chave
+     * @return Quantidade removida (0 ou 1)
+     */
+    size_t erase(const K& chave) {
+        iterator it = find(chave);
+        if (it == dados.end()) {
+            return 0;
+        }
+        dados.erase(it);
+        return 1;
+    }
+
+    /**
+     * @brief Remove por iterador
+     * @return Iterador para o elemento seguinte
+     */
+    iterator erase(const_iterator it) {
+        return dados.erase(it);
+    }
+};  // Fim da classe MapaPequeno
+
+#endif // MAPAPEQUENO_H
+// Fim do include guard
@@ -0,0 +1,134 @@
+/**
+ * @file metricas.h
+ * @brief Histogramas de latência (estilo HDR) para o ciclo de vida dos pedidos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Mede quanto tempo os artistas esperam entre o pedido e a entrega.
+ * A gravação é lock-free (apenas incrementos atômicos) e as consultas
+ * retornam p50/p95/p99 para qualquer janela de tempo recente.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef METRICAS_H  // Se METRICAS_H não foi definido
+#define METRICAS_H  // Define METRICAS_H
+
+// Bibliotecas necessárias
+#include <atomic>    // Para contadores lock-free
+#include <cstdint>   // Para int64_t, uint32_t, uint64_t
+#include <string>    // Para exibição formatada
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @brief Retorna instante atual de um relógio MONOTÔNICO em nanossegundos
+ * @return Nanossegundos desde um ponto fixo (não volta no tempo)
+ *
+ * steady_clock não sofre ajustes de horário do sistema,
+ * por isso é o relógio correto para medir intervalos
+ */
+int64_t relogioMonotonicoNs();
+
+/**
+ * @struct PercentisLatencia
+ * @brief Resultado de uma consulta de latência
+ *
+ * Valores em nanossegundos; amostras = 0 significa janela sem dados
+ */
+struct PercentisLatencia {
+    int64_t p50;        // Mediana
+    int64_t p95;        // 95º percentil
+    int64_t p99;        // 99º percentil
+    uint64_t amostras;  // Quantidade de medições na janela
+
+    /**
+     * @brief Construtor padrão - janela vazia
+     */
+    PercentisLatencia() : p50(0), p95(0), p99(0), amostras(0) {}
+
+    /**
+     * @brief Exibe percentis formatados em segundos
+     * @return String no formato "p50=..s p95=..s p99=..s (n amostras)"
+     */
+    string exibir() const;
+};  // Fim da struct PercentisLatencia
+
+/**
+ * @class HistogramaLatencia
+ * @brief Histograma log-linear com janelas de tempo em anel
+ *
+ * ESTRUTURA (estilo HDR Histogram):
+ * - Valores gravados em microssegundos
+ * - Cada potência de 2 é dividida em SUB_FAIXAS faixas lineares
+ *   (erro relativo máximo de ~12%, independente da magnitude)
+ * - O tempo é dividido em JANELAS de DURACAO_JANELA_NS; um anel de
+ *   NUM_JANELAS histogramas guarda as últimas 24 horas
+ *
+ * GRAVAÇÃO: apenas fetch_add relaxado (lock-free, poucos nanossegundos)
+ * CONSULTA: soma as janelas do intervalo e percorre as faixas (O(faixas))
+ */
+class HistogramaLatencia {
+public:  // Constantes públicas (usadas também na implementação)
+    static const int BITS_SUB_FAIXA = 3;                   // 2^3 = 8 faixas por potência de 2
+    static const int SUB_FAIXAS = 1 << BITS_SUB_FAIXA;     // 8 faixas lineares
+    static const int MAGNITUDES = 38;                      // 2^40 µs ≈ 12 dias de alcance
+    static const int NUM_FAIXAS = (MAGNITUDES + 1) * SUB_FAIXAS;  // Total de faixas
+    static const int NUM_JANELAS = 24;                     // Anel de 24 janelas
+    static const int64_t DURACAO_JANELA_NS = 3600LL * 1000000000LL;  // 1 hora por janela
+
+private:  // Atributos privados
+    /**
+     * @struct Janela
+     * @brief Contadores de uma janela de tempo
+     */
+    struct Janela {
+        atomic<int64_t> numero;                  // Índice absoluto da janela (-1 = nunca usada)
+        atomic<uint32_t> contagens[NUM_FAIXAS];  // Contagem por faixa de latência
+
+        Janela();  // Zera todos os contadores
+    };
+
+    Janela janelas[NUM_JANELAS];  // Anel de janelas (memória fixa por série)
+
+    /**
+     * @brief Converte valor em µs para índice de faixa
+     */
+    static int indiceFaixa(uint64_t micros);
+
+    /**
+     * @brief Valor representativo (ponto médio) de uma faixa, em µs
+     */
+    static uint64_t valorFaixa(int indice);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - todas as janelas começam vazias
+     */
+    HistogramaLatencia();
+
+    // Contadores atômicos não podem ser copiados
+    HistogramaLatencia(const HistogramaLatencia&) = delete;
+    HistogramaLatencia& operator=(const HistogramaLatencia&) = delete;
+
+    /**
+     * @brief Grava uma medição (HOT PATH, lock-free)
+     * @param latenciaNs Latência medida em nanossegundos
+     * @param instanteNs Instante da medição (relógio monotônico)
+     */
+    void registrar(int64_t latenciaNs, int64_t instanteNs) noexcept;
+
+    /**
+     * @brief Calcula p50/p95/p99 das medições em um intervalo
+     * @param inicioNs Início do intervalo (relógio monotônico)
+     * @param fimNs Fim do intervalo (relógio monotônico)
+     * @return Percentis das janelas que cruzam o intervalo
+     *
+     * Granularidade: uma janela (1 hora); apenas as últimas
+     * NUM_JANELAS janelas estão disponíveis
+     */
+    PercentisLatencia consultar(int64_t inicioNs, int64_t fimNs) const;
+};  // Fim da classe HistogramaLatencia
+
+#endif // METRICAS_H
+// Fim do include guard
@@ -0,0 +1,191 @@
+/**
+ * @file orcamento.h
+ * @brief Definição da classe OtimizadorCompras
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Escolhe o que comprar quando o caixa do dia não cobre todas as faltas.
+ * Cada linha pode ficar de fora, ser comprada só na quantidade mínima
+ * que resolve o problema imediato, ou ser comprada inteira; o otimizador
+ * maximiza o valor (prioridade × unidades) sem passar do orçamento.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef ORCAMENTO_H  // Se ORCAMENTO_H não foi definido
+#define ORCAMENTO_H  // Define ORCAMENTO_H
+
+// Bibliotecas necessárias
+#include <vector>          // Para linhas de entrada e resultado
+#include <string>          // Para exibição
+#include <iostream>        // Para operator<<
+#include "item.h"          // Catálogo (nomes e preços)
+#include "listacompras.h"  // Resultado pode virar lista de compras
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @struct NecessidadeCompra
+ * @brief Uma linha de falta a ser considerada na compra
+ */
+struct NecessidadeCompra {
+    int itemId;              // Item do catálogo
+    int quantidade;          // Tudo que falta (compra inteira)
+    int quantidadeMinima;    // Mínimo que resolve (0 ou igual a quantidade = sem compra parcial)
+    bool itemDeRider;        // Exigido por contrato de artista (vem antes)
+    double horasAteFaltar;   // Projeção de ruptura (negativo = sem consumo medido)
+
+    NecessidadeCompra()
+        : itemId(0), quantidade(0), quantidadeMinima(0), itemDeRider(false), horasAteFaltar(-1.0) {}
+    NecessidadeCompra(int itemId, int quantidade, int quantidadeMinima, bool itemDeRider, double horasAteFaltar)
+        : itemId(itemId), quantidade(quantidade), quantidadeMinima(quantidadeMinima),
+          itemDeRider(itemDeRider), horasAteFaltar(horasAteFaltar) {}
+};  // Fim da struct NecessidadeCompra
+
+/**
+ * @enum ModoOtimizacao
+ * @brief Algoritmo usado pelo otimizador
+ */
+enum class ModoOtimizacao {
+    AUTOMATICO,  // Exato quando couber no limite, guloso caso contrário
+    EXATO,       // Programação dinâmica (mochila de múltipla escolha)
+    GULOSO       // Ordenação por valor/custo, O(n log n)
+};
+
+/**
+ * @struct CompraEscolhida
+ * @brief Linha escolhida pelo otimizador
+ */
+struct CompraEscolhida {
+    int itemId;
+    string nomeItem;
+    int quantidade;           // Quantidade a comprar (mínima ou inteira)
+    int quantidadeFaltante;   // Quantidade pedida na entrada
+    long long precoCentavos;  // Preço unitário do catálogo
+    long long custoCentavos;  // quantidade × preço
+    double valor;             // Valor atribuído à escolha
+
+    CompraEscolhida()
+        : itemId(0), quantidade(0), quantidadeFaltante(0), precoCentavos(0), custoCentavos(0), valor(0.0) {}
+};  // Fim da struct CompraEscolhida
+
+/**
+ * @class ResultadoOrcamento
+ * @brief Compras escolhidas, itens adiados e custo total
+ */
+class ResultadoOrcamento {
+    friend class OtimizadorCompras;  // Único que preenche o resultado
+
+private:  // ENCAPSULAMENTO: atributos privados
+    vector<CompraEscolhida> escolhidas;  // Em ordem de itemId
+    vector<int> adiadas;                 // Itens que ficaram de fora (ou sem preço no catálogo)
+    long long orcamentoCentavos;         // Orçamento informado
+    long long custoCentavos;             // Soma das escolhidas
+    double valor;                        // Valor obtido
+    double valorMaximo;                  // Valor se tudo fosse comprado inteiro
+    bool exato;                          // true = solução ótima (programação dinâmica)
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - resultado vazio
+     */
+    ResultadoOrcamento();
+
+    // ==================== GETTERS ====================
+    const vector<CompraEscolhida>& getEscolhidas() const;
+    const vector<int>& getAdiadas() const;
+    long long getOrcamentoCentavos() const;
+    long long getCustoCentavos() const;
+    double getValor() const;
+    double getValorMaximo() const;
+    bool isExato() const;
+
+    /**
+     * @brief Copia as escolhidas para uma lista de compras
+     */
+    void preencherLista(ListaCompras& lista) const;
+
+    /**
+     * @brief Exibe as escolhidas, o saldo do orçamento e os adiados
+     */
+    string exibir() const;
+
+    /**
+     * @brief Sobrecarga do operador << para cout
+     */
+    friend ostream& operator<<(ostream& os, const ResultadoOrcamento& resultado);
+};  // Fim da classe ResultadoOrcamento
+
+/**
+ * @class OtimizadorCompras
+ * @brief Mochila de múltipla escolha (nada / mínimo / inteira) com orçamento
+ *
+ * VALOR de uma linha: peso × (2 × mínimo + resto), ou seja, as unidades
+ * que resolvem o problema imediato valem o dobro das de folga.
+ * PESO: itens de rider valem 3×, e o peso cresce conforme a ruptura
+ * projetada se aproxima.
+ *
+ * EXATO: programação dinâmica sobre o custo (em centavos, divididos pelo
+ * MDC de todos os custos), O(linhas × orçamento). GULOSO: passos
+ * ordenados por valor/custo, comparado com a melhor escolha isolada
+ * (garante ao menos metade do ótimo).
+ */
+class OtimizadorCompras {
+public:  // Constantes públicas (limites do modo automático)
+    static const long long LIMITE_CELULAS_EXATO = 20000000;  // linhas × orçamento reduzido
+
+private:  // Tipos internos
+    /**
+     * @brief Alternativa de compra de uma linha (mínimo ou inteira)
+     */
+    struct Opcao {
+        int quantidade;
+        long long custo;   // Centavos
+        double valor;
+    };
+
+    /**
+     * @brief Linha pronta para otimizar (com preço e opções)
+     */
+    struct Linha {
+        int itemId;
+        string nomeItem;
+        int quantidadeFaltante;
+        long long precoCentavos;
+        vector<Opcao> opcoes;  // 1 ou 2 opções, custo crescente
+    };
+
+    /**
+     * @brief Solução ótima por programação dinâmica
+     * @return Índice da opção escolhida por linha (-1 = fora)
+     */
+    static vector<int> resolverExato(const vector<Linha>& linhas, long long orcamento, long long divisor);
+
+    /**
+     * @brief Solução gulosa por valor/custo
+     * @return Índice da opção escolhida por linha (-1 = fora)
+     */
+    static vector<int> resolverGuloso(const vector<Linha>& linhas, long long orcamento);
+
+public:  // Interface pública
+    /**
+     * @brief Peso por unidade de uma linha (rider e proximidade da ruptura)
+     */
+    static double peso(const NecessidadeCompra& necessidade);
+
+    /**
+     * @brief Escolhe o que comprar dentro do orçamento
+     * @param necessidades Faltas (uma linha por item)
+     * @param catalogo Preços atuais
+     * @param orcamentoCentavos Caixa disponível
+     * @param modo Algoritmo (AUTOMATICO escolhe pelo tamanho)
+     * @throws ValidacaoException se orçamento negativo, quantidades inválidas
+     *         ou lista grande demais para o modo EXATO
+     */
+    static ResultadoOrcamento otimizar(const vector<NecessidadeCompra>& necessidades,
+                                       GerenciadorItens& catalogo, long long orcamentoCentavos,
+                                       ModoOtimizacao modo = ModoOtimizacao::AUTOMATICO);
+};  // Fim da classe OtimizadorCompras
+
+#endif // ORCAMENTO_H
+// Fim do include guard
@@ -16,8 +16,18 @@
 // Bibliotecas necessárias
 #include <string>    // Para trabalhar com strings
 #include <vector>    // Para lista de pedidos
-#include <map>       // Para armazenar itens do pedido
+#include <map>       // Para mapas auxiliares (índices, séries)
 #include <iostream>  // Para entrada/saída
+#include <memory>    // Para unique_ptr (séries de latência)
+#include <cstdint>   // Para int64_t (timestamps)
+#include <set>       // Para índice item → pedidos aguardando
+#include <functional>  // Para observador de demanda
+#include "estoque.h"   // Estoque central (atendimento parcial)
+#include "camarim.h"   // Camarins de destino (atendimento parcial)
+#include "metricas.h"  // Histogramas de latência
+#include "idempotencia.h"  // Deduplicação de requisições reenviadas
+#include "arquivo.h"  // Arquivo frio de pedidos atendidos
+#include "mapapequeno.h"  // Mapa plano para os itens do pedido
 
 using namespace std;  // Namespace padrão
 
@@ -29,20 +39,26 @@ using namespace std;  // Namespace padrão
  * STRUCT: dados simples sem lógica complexa, membros públicos
  */
 struct ItemPedido {
-    int itemId;        // ID do item solicitado
-    string nomeItem;   // Nome do item
-    int quantidade;    // Quantidade solicitada
+    int itemId;              // ID do item solicitado
+    string nomeItem;         // Nome do item
+    int quantidade;          // Quantidade solicitada
+    int quantidadeAtendida;  // Quantidade já entregue (atendimento parcial)
     
     /**
      * @brief Construtor padrão
      */
-    ItemPedido() : itemId(0), nomeItem(""), quantidade(0) {}
+    ItemPedido() : itemId(0), nomeItem(""), quantidade(0), quantidadeAtendida(0) {}
     
     /**
      * @brief Construtor parametrizado
      */
     ItemPedido(int id, const string& nome, int qtd) 
-        : itemId(id), nomeItem(nome), quantidade(qtd) {}
+        : itemId(id), nomeItem(nome), quantidade(qtd), quantidadeAtendida(0) {}
+    
+    /**
+     * @brief Quantidade que ainda falta entregar
+     */
+    int quantidadePendente() const { return quantidade - quantidadeAtendida; }
 };  // Fim da struct ItemPedido
 
 /**
@@ -60,10 +76,28 @@ private:  // ENCAPSULAMENTO: atributos privados
     int id;                         // ID único do pedido
     int camarimId;                  // ID do camarim que fez o pedido
     string nomeArtista;             // Nome do artista (para facilitar exibição)
-    map<int, ItemPedido> itens;    // Map: chave = itemId, valor = ItemPedido
+    MapaPequeno<int, ItemPedido> itens;  // Chave = itemId, valor = ItemPedido (mapa plano)
     bool atendido;                  // Status: true = atendido, false = pendente
+    int prioridade;                 // 0 = normal, 1 = alta, 2 = urgente
+    int pedidoOrigemId;             // Pedido que originou este backorder (0 = nenhum)
+    int backorderId;                // Backorder gerado a partir deste pedido (0 = nenhum)
+    bool aguardandoEstoque;         // true = esperando chegada de itens no estoque
+    
+    // TIMESTAMPS MONOTÔNICOS (ns, relógio steady_clock; 0 = ainda não ocorreu)
+    int64_t criadoEm;               // Criação do pedido
+    int64_t ultimoItemEm;           // Último item adicionado
+    int64_t reservadoEm;            // Reserva dos itens no estoque
+    int64_t atendidoEm;             // Entrega ao camarim
+    
+    // ArquivoPedidos grava e reconstrói todos os atributos
+    friend class ArquivoPedidos;
+    friend class ArquivoSnapshot;  // Idem para o estado salvo do sistema
+    friend class LogAlteracoes;    // e para os registros do log de alterações
+    friend class ExportadorDados;  // e para exportar sem copiar o nome do artista
     
 public:  // Interface pública
+    static const int NUM_PRIORIDADES = 3;  // 0 = normal, 1 = alta, 2 = urgente
+    
     /**
      * @brief Construtor padrão - inicializa com valores vazios
      */
@@ -87,12 +121,24 @@ public:  // Interface pública
     int getCamarimId() const;       // Retorna ID do camarim
     string getNomeArtista() const;  // Retorna nome do artista
     bool isAtendido() const;        // Retorna status (atendido ou não)
+    bool isReservado() const;       // Retorna se itens já foram reservados
+    int getPrioridade() const;      // Retorna prioridade (0 a 2)
+    int64_t getCriadoEm() const;    // Timestamp de criação (ns)
+    int64_t getUltimoItemEm() const; // Timestamp do último item (ns)
+    int64_t getReservadoEm() const; // Timestamp da reserva (ns, 0 = não reservado)
+    int64_t getAtendidoEm() const;  // Timestamp do atendimento (ns, 0 = pendente)
+    const MapaPequeno<int, ItemPedido>& getItens() const;  // Itens do pedido (referência, sem cópia)
+    int getPedidoOrigemId() const;  // Pedido de origem (0 = não é backorder)
+    int getBackorderId() const;     // Backorder gerado (0 = nenhum)
+    bool isAguardandoEstoque() const; // true = esperando reposição do estoque
+    void setAguardandoEstoque(bool aguardando);  // Define espera por estoque
     
     // ==================== SETTERS (modificam atributos) ====================
     void setId(int id);                              // Define ID
     void setCamarimId(int camarimId);                // Define camarim
     void setNomeArtista(const string& nomeArtista);  // Define artista
     void setAtendido(bool atendido);                 // Define status
+    void setPrioridade(int prioridade);              // Define prioridade (0 a 2)
     
     /**
      * @brief Adiciona item ao pedido
@@ -114,11 +160,44 @@ public:  // Interface pública
      */
     bool removerItem(int itemId);
     
+    /**
+     * @brief Registra entrega parcial de um item
+     * @param itemId ID do item
+     * @param quantidade Quantidade entregue agora
+     * @throws PedidoException se item não está no pedido ou excede o pendente
+     */
+    void registrarEntrega(int itemId, int quantidade);
+    
+    /**
+     * @brief Verifica se todos os itens já foram entregues
+     * @return true se nenhuma linha tem quantidade pendente
+     */
+    bool isCompleto() const;
+    
+    /**
+     * @brief Separa o que não foi enviado em um novo pedido (BACKORDER)
+     * @param novoId ID do backorder
+     * @param enviados Map: chave = itemId, valor = quantidade enviada agora
+     * @return Backorder com as quantidades restantes
+     * 
+     * Este pedido fica apenas com o que foi enviado; o backorder herda
+     * camarim, artista, prioridade e instante de criação (a espera do
+     * artista conta desde o pedido original)
+     */
+    Pedido separarBackorder(int novoId, const map<int, int>& enviados);
+    
+    /**
+     * @brief Marca itens do pedido como reservados no estoque
+     * 
+     * Registra o timestamp da reserva (apenas na primeira vez)
+     */
+    void marcarReservado();
+    
     /**
      * @brief Marca pedido como atendido
      * 
      * Chamado após transferir itens do estoque para o camarim
-     * Muda atributo atendido de false para true
+     * Muda atributo atendido de false para true e registra o timestamp
      */
     void marcarAtendido();
     
@@ -152,6 +231,71 @@ private:  // Atributos privados
     vector<Pedido> pedidos;  // Vector dinâmico de pedidos
     int proximoId;           // Contador para gerar IDs únicos
     
+    // LATÊNCIA criação → atendimento (uma série por camarim e por prioridade)
+    // Séries criadas antes do atendimento: atender() só grava (sem alocar)
+    HistogramaLatencia latenciaGeral;                              // Todos os pedidos
+    map<int, unique_ptr<HistogramaLatencia>> latenciaPorCamarim;   // Chave = camarimId
+    HistogramaLatencia latenciaPorPrioridade[Pedido::NUM_PRIORIDADES]; // Índice = prioridade
+    
+    // BACKORDERS: chave = itemId, valor = IDs dos pedidos esperando este item
+    map<int, set<int>> aguardandoPorItem;
+    
+    /**
+     * @brief Coloca pedido no índice de espera de cada item pendente
+     */
+    void indexarEspera(Pedido& pedido);
+    
+    /**
+     * @brief Retira pedido do índice de espera de todos os itens
+     */
+    void desindexarEspera(const Pedido& pedido);
+    
+    // DEMANDA PENDENTE: chave = itemId, valor = soma do que falta entregar
+    // nos pedidos não atendidos e não reservados (mantida a cada alteração)
+    map<int, int> demandaPorItem;
+    function<void(int)> observadorDemanda;  // Chamado quando a demanda de um item muda
+    
+    /**
+     * @brief Pedido entra na demanda pendente? (não atendido e não reservado)
+     */
+    static bool contaDemanda(const Pedido& pedido);
+    
+    /**
+     * @brief Soma delta à demanda de um item e avisa o observador
+     */
+    void ajustarDemanda(int itemId, int delta);
+    
+    /**
+     * @brief Soma (sinal = +1) ou retira (sinal = -1) todo o pendente do pedido
+     */
+    void somarDemanda(const Pedido& pedido, int sinal);
+    
+    // IDEMPOTÊNCIA: reenvios com a mesma chave não duplicam operações
+    CacheIdempotencia requisicoesCriar;       // Chave → ID do pedido criado
+    CacheIdempotencia requisicoesAdicionar;   // Chave → ID do pedido alterado
+    
+    // ARQUIVO FRIO: atendidos antigos saem do vector e vão para o disco
+    unique_ptr<ArquivoPedidos> arquivo;   // nullptr = arquivamento desligado
+    int64_t idadeArquivamentoNs;          // Idade mínima (desde o atendimento) para arquivar
+    
+    /**
+     * @brief Cria a série de latência do camarim, se ainda não existe
+     * 
+     * Chamado quando um pedido entra no gerenciador (criação, snapshot, log)
+     */
+    void prepararLatencia(int camarimId);
+    friend class ArquivoSnapshot;  // Recoloca pedidos e refaz índices de espera e demanda
+    
+    // LOG DE ALTERAÇÕES: IDs dos pedidos mexidos desde a última confirmação
+    vector<int>* alterados;  // nullptr = sem log
+    
+    /**
+     * @brief Anota o pedido no log de alterações (se ligado)
+     */
+    void marcarAlterado(int id);
+    friend class LogAlteracoes;  // Substitui pedidos pelo estado gravado no log
+    friend class ExportadorDados;  // Percorre os pedidos sem listar() (que copia)
+    
 public:  // Interface pública (métodos CRUD)
     /**
      * @brief Construtor - inicializa lista vazia e proximoId = 1
@@ -162,12 +306,49 @@ public:  // Interface pública (métodos CRUD)
      * @brief Cria novo pedido (CREATE)
      * @param camarimId ID do camarim solicitante
      * @param nomeArtista Nome do artista
+     * @param prioridade 0 = normal, 1 = alta, 2 = urgente
      * @return ID do pedido criado
      * 
      * Gera ID automático, cria Pedido vazio (sem itens ainda)
      * Itens são adicionados depois com adicionarItem()
      */
-    int criar(int camarimId, const string& nomeArtista);
+    int criar(int camarimId, const string& nomeArtista, int prioridade = 0);
+    
+    /**
+     * @brief Cria pedido de forma IDEMPOTENTE (CREATE)
+     * @param camarimId ID do camarim solicitante
+     * @param nomeArtista Nome do artista
+     * @param prioridade 0 = normal, 1 = alta, 2 = urgente
+     * @param chaveRequisicao Chave única gerada pelo dispositivo ("" = sem chave)
+     * @return ID do pedido (o ORIGINAL, se a chave já foi usada)
+     * 
+     * Reenvio com a mesma chave devolve o ID original em O(1),
+     * sem criar outro pedido
+     */
+    int criar(int camarimId, const string& nomeArtista, int prioridade, const string& chaveRequisicao);
+    
+    /**
+     * @brief Adiciona item a um pedido de forma IDEMPOTENTE
+     * @param pedidoId ID do pedido
+     * @param itemId ID do item
+     * @param nomeItem Nome do item
+     * @param quantidade Quantidade solicitada
+     * @param chaveRequisicao Chave única gerada pelo dispositivo ("" = sem chave)
+     * @return true se o item foi adicionado, false se era um reenvio ignorado
+     * @throws PedidoException se pedido não existe ou se a chave já foi
+     *         usada em outro pedido
+     */
+    bool adicionarItem(int pedidoId, int itemId, const string& nomeItem, int quantidade,
+                       const string& chaveRequisicao = "");
+    
+    /**
+     * @brief Remove item de um pedido
+     * @return true se removido, false se o item não estava no pedido
+     * @throws PedidoException se pedido não existe ou já foi atendido
+     * 
+     * Use este método (e não Pedido::removerItem) para manter a demanda pendente
+     */
+    bool removerItem(int pedidoId, int itemId);
     
     /**
      * @brief Busca pedido por ID (READ)
@@ -178,6 +359,24 @@ public:  // Interface pública (métodos CRUD)
      */
     Pedido* buscarPorId(int id);
     
+    /**
+     * @brief Quanto falta entregar de um item nos pedidos pendentes - O(log n)
+     * @return Soma das quantidades pendentes (0 se ninguém pediu)
+     */
+    int obterDemandaPendente(int itemId) const;
+    
+    /**
+     * @brief Define função chamada quando a demanda pendente de um item muda
+     * @param observador Recebe o ID do item
+     */
+    void definirObservadorDemanda(function<void(int itemId)> observador);
+    
+    /**
+     * @brief Passa a anotar os IDs de pedidos criados, alterados, removidos e arquivados
+     * @param alterados Lista preenchida a cada alteração (nullptr = desliga)
+     */
+    void ligarAlteracoes(vector<int>* alterados);
+    
     /**
      * @brief Busca todos os pedidos de um camarim (READ)
      * @param camarimId ID do camarim
@@ -195,6 +394,15 @@ public:  // Interface pública (métodos CRUD)
      */
     vector<Pedido> listarPendentes() const;
     
+    /**
+     * @brief Lista pedidos pendentes cujos itens ainda não foram reservados
+     * @return Vector de PONTEIROS constantes (sem copiar os pedidos)
+     * 
+     * Usado pelo planejamento de ondas de separação; os ponteiros
+     * são válidos até a próxima inserção/remoção de pedidos
+     */
+    vector<const Pedido*> listarAguardandoSeparacao() const;
+    
     /**
      * @brief Remove pedido (DELETE)
      * @param id ID do pedido
@@ -209,6 +417,134 @@ public:  // Interface pública (métodos CRUD)
      * @return Vector com cópias de todos os pedidos
      */
     vector<Pedido> listar() const;
+    
+    /**
+     * @brief Marca itens do pedido como reservados no estoque
+     * @param id ID do pedido
+     * @throws PedidoException se pedido não existe ou já foi atendido
+     */
+    void reservar(int id);
+    
+    /**
+     * @brief Marca pedido como atendido e grava a latência de espera
+     * @param id ID do pedido
+     * @throws PedidoException se pedido não existe ou já foi atendido
+     * 
+     * Latência = atendidoEm - criadoEm, gravada nas séries geral,
+     * do camarim e da prioridade do pedido
+     */
+    void atender(int id);
+    
+    /**
+     * @brief Atende o que o estoque consegue e gera backorder do restante
+     * @param id ID do pedido
+     * @param estoque Estoque central (saída em lote)
+     * @param camarins Gerenciador de camarins (destino da entrega)
+     * @return ID do pedido que ficou aguardando estoque (0 = atendido por completo)
+     * @throws PedidoException se pedido não existe, já foi atendido ou está vazio
+     * @throws CamarimException se camarim do pedido não existe
+     * 
+     * - Estoque cobre tudo: entrega e marca atendido
+     * - Estoque cobre parte: entrega a parte, marca atendido e cria
+     *   backorder (ligado ao original) com o restante
+     * - Estoque não cobre nada: o próprio pedido fica aguardando
+     * Pedidos aguardando entram no índice item → pedidos
+     */
+    int atenderParcial(int id, Estoque& estoque, GerenciadorCamarins& camarins);
+    
+    /**
+     * @brief Reavalia pedidos que aguardam um item recém-chegado
+     * @param itemId Item que acabou de entrar no estoque
+     * @param estoque Estoque central
+     * @param camarins Gerenciador de camarins (destino da entrega)
+     * @return Quantidade de pedidos concluídos nesta reavaliação
+     * 
+     * Consulta apenas o índice do item (não percorre todos os pedidos);
+     * pedidos de maior prioridade e mais antigos são servidos primeiro
+     */
+    int reavaliarBackorders(int itemId, Estoque& estoque, GerenciadorCamarins& camarins);
+    
+    /**
+     * @brief Liga o arquivamento de pedidos atendidos
+     * @param caminho Arquivo em disco (criado se não existir)
+     * @param idadeMinimaNs Tempo desde o atendimento para o pedido ser arquivado
+     * @param bytesCacheIndice Memória máxima do cache do índice em disco
+     * @throws PersistenciaException se o arquivo não puder ser aberto
+     * 
+     * IDs novos continuam depois do maior ID já arquivado
+     */
+    void configurarArquivo(const string& caminho, int64_t idadeMinimaNs,
+                           size_t bytesCacheIndice = ArquivoPedidos::CACHE_INDICE_PADRAO);
+    
+    /**
+     * @brief Move pedidos atendidos antigos para o arquivo frio
+     * @param agoraNs Instante atual (relógio monotônico)
+     * @return Quantidade de pedidos arquivados
+     * @throws PersistenciaException se a gravação falhar (nada é removido)
+     * 
+     * Só pedidos atendidos há pelo menos idadeMinimaNs saem da memória;
+     * pendentes e backorders em espera continuam no vector
+     */
+    int arquivarAtendidos(int64_t agoraNs);
+    
+    /**
+     * @brief Move pedidos atendidos para o arquivo frio com idade informada
+     * @param agoraNs Instante atual (relógio monotônico)
+     * @param idadeMinimaNs Tempo mínimo desde o atendimento (0 = todos os atendidos)
+     * @return Quantidade de pedidos arquivados
+     */
+    int arquivarAtendidos(int64_t agoraNs, int64_t idadeMinimaNs);
+    
+    /**
+     * @brief Busca pedido no arquivo frio
+     * @param id ID do pedido
+     * @param pedido [saída] Pedido lido do disco
+     * @return true se o pedido está arquivado
+     */
+    bool buscarArquivado(int id, Pedido& pedido) const;
+    
+    /**
+     * @brief Percorre pedidos arquivados por faixa de ID
+     * @param idInicio Primeiro ID da faixa
+     * @param idFim Último ID da faixa
+     * @param visitante Recebe cada pedido em ordem de ID; retorna false para parar
+     * @return Quantidade de pedidos visitados (0 se não houver arquivo)
+     */
+    size_t percorrerArquivados(int idInicio, int idFim, const function<bool(const Pedido&)>& visitante) const;
+    
+    /**
+     * @brief Quantidade de pedidos no arquivo frio
+     */
+    size_t quantidadeArquivados() const;
+    
+    /**
+     * @brief Registros do arquivo frio ignorados por CRC errado ou ID ilegível (na abertura)
+     */
+    size_t arquivadosCorrompidos() const;
+    
+    /**
+     * @brief Quantidade de pedidos em memória
+     */
+    size_t quantidadeEmMemoria() const;
+    
+    /**
+     * @brief Percentis de espera de todos os pedidos em um intervalo
+     * @param inicioNs Início do intervalo (relógio monotônico)
+     * @param fimNs Fim do intervalo (relógio monotônico)
+     */
+    PercentisLatencia latenciaTotal(int64_t inicioNs, int64_t fimNs) const;
+    
+    /**
+     * @brief Percentis de espera por camarim em um intervalo
+     * @return Map: chave = camarimId, valor = percentis
+     */
+    map<int, PercentisLatencia> latenciaPorCamarins(int64_t inicioNs, int64_t fimNs) const;
+    
+    /**
+     * @brief Percentis de espera por prioridade em um intervalo
+     * @return Map: chave = prioridade, valor = percentis
+     */
+    map<int, PercentisLatencia> latenciaPorPrioridades(int64_t inicioNs, int64_t fimNs) const;
 };  // Fim da classe GerenciadorPedidos
 
 #endif // PEDIDO_H
@@ -5,7 +5,7 @@
  *          Jerônimo Rafael Bezerra Filho
  *          Yuri Wendel do Nascimento
  * 
- * Esta classe serve como base para Usuario e Artista, implementando
+ * Esta classe serve como base para Artista e para a equipe (equipe.h), implementando
  * herança e polimorfismo conforme requisitos do projeto.
  */
 
@@ -53,6 +53,13 @@ public: // Modificador de acesso: acessível de qualquer parte do programa
      */
     virtual ~Pessoa(); // Destrutor virtual permite destruição correta de objetos derivados
     
+    // Destrutor declarado desliga a cópia/movimento implícitos: pedidos explicitamente
+    // (derivadas guardadas por valor em vector são movidas, não copiadas, ao crescer)
+    Pessoa(const Pessoa&) = default;
+    Pessoa(Pessoa&&) = default;
+    Pessoa& operator=(const Pessoa&) = default;
+    Pessoa& operator=(Pessoa&&) = default;
+    
     // Getters - Métodos para ler os valores dos atributos (const = não modificam o objeto)
     int getId() const; // Retorna o id da pessoa
     string getNome() const; // Retorna o nome da pessoa
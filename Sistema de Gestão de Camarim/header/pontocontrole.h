@@ -0,0 +1,111 @@
+/**
+ * @file pontocontrole.h
+ * @brief Definição da classe PontoControle
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Compactação do log de alterações: o estado de todos os eventos é salvo
+ * e as gerações do log que ele já contém são apagadas. A captura do
+ * estado é rápida (memória); gravar o arquivo e apagar o log rodam em
+ * uma thread de fundo, sem travar o menu.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef PONTOCONTROLE_H  // Se PONTOCONTROLE_H não foi definido
+#define PONTOCONTROLE_H  // Define PONTOCONTROLE_H
+
+// Bibliotecas necessárias
+#include <string>               // Para caminhos e bytes capturados
+#include <cstdint>              // Para uint64_t/int64_t
+#include <mutex>                // Para proteger o trabalho pendente
+#include <condition_variable>   // Para acordar a thread de gravação
+#include <thread>               // Para a thread de gravação
+#include "snapshot.h"           // Para ResumoSnapshot
+
+using namespace std;  // Namespace padrão
+
+class GerenciadorEventos;  // Declarações antecipadas
+class LogAlteracoes;
+
+/**
+ * @class PontoControle
+ * @brief Salva o estado em segundo plano e apaga o log já coberto
+ *
+ * ORDEM: confirmar o log -> capturar o estado -> rotacionar o log (thread
+ * principal, sem alterações no meio); gravar o estado -> apagar as
+ * gerações até a capturada (thread de fundo). Se a gravação falhar, o log
+ * não é apagado: o estado anterior + log continuam recuperando tudo.
+ *
+ * Só a captura mais recente é gravada (uma nova substitui a que ainda
+ * não começou a ser gravada).
+ */
+class PontoControle {
+private:  // ENCAPSULAMENTO: atributos privados
+    string caminhoEstado;          // Arquivo do estado salvo
+    LogAlteracoes& log;            // Log compactado por este ponto de controle
+    uint64_t limiteBytes;          // Tamanho da geração aberta que pede um ponto de controle
+
+    mutex trava;                   // Protege tudo abaixo
+    condition_variable sinal;      // Acorda a thread (trabalho novo) e quem aguarda (trabalho feito)
+    bool temTrabalho;              // Há uma captura esperando gravação
+    bool ocupado;                  // A thread está gravando
+    bool encerrando;               // Destrutor pediu para parar
+    string dados;                  // Estado capturado (bytes do arquivo)
+    uint64_t geracaoCoberta;       // Última geração do log contida na captura
+    string prefixoLog;             // Prefixo das gerações a apagar
+    string ultimoErro;             // Falha da última gravação ("" = nenhuma)
+
+    thread trabalhador;            // Declarada por último: começa com os atributos prontos
+
+    /**
+     * @brief Laço da thread de gravação
+     */
+    void executar();
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - inicia a thread de gravação
+     * @param caminhoEstado Arquivo do estado salvo
+     * @param log Log de alterações a compactar
+     * @param limiteBytes Tamanho de geração a partir do qual necessario() é true
+     */
+    PontoControle(const string& caminhoEstado, LogAlteracoes& log, uint64_t limiteBytes);
+
+    /**
+     * @brief Destrutor - termina a gravação em andamento e encerra a thread
+     */
+    ~PontoControle();
+
+    PontoControle(const PontoControle&) = delete;
+    PontoControle& operator=(const PontoControle&) = delete;
+
+    /**
+     * @brief Indica se a geração aberta já passou do limite
+     */
+    bool necessario() const;
+
+    /**
+     * @brief Captura o estado e agenda a gravação
+     * @param eventos Eventos a salvar
+     * @param agoraNs Instante atual
+     * @return Resumo do estado capturado
+     *
+     * Rodar na thread principal, entre duas ações do menu. Se a escrita do
+     * log falhar, a captura segue: o estado capturado já contém as alterações
+     */
+    ResumoSnapshot capturar(GerenciadorEventos& eventos, int64_t agoraNs);
+
+    /**
+     * @brief Espera a gravação agendada terminar
+     */
+    void aguardar();
+
+    /**
+     * @brief Retorna e limpa a falha da última gravação ("" = nenhuma)
+     */
+    string extrairErro();
+};  // Fim da classe PontoControle
+
+#endif // PONTOCONTROLE_H
+// Fim do include guard
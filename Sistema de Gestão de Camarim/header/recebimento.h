@@ -0,0 +1,136 @@
+/**
+ * @file recebimento.h
+ * @brief Definição da classe DiarioRecebimentos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Recebimento de mercadoria: a lista de compras que chegou entra no
+ * estoque de uma vez (tudo ou nada), com as quantidades realmente
+ * recebidas. Cada recebimento é registrado no diário antes de tocar o
+ * estoque, e as diferenças entre pedido e recebido ficam guardadas.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef RECEBIMENTO_H  // Se RECEBIMENTO_H não foi definido
+#define RECEBIMENTO_H  // Define RECEBIMENTO_H
+
+// Bibliotecas necessárias
+#include <map>            // Para quantidades recebidas por item
+#include <vector>         // Para registros e linhas
+#include <string>         // Para caminho do diário e exibição
+#include <cstdint>        // Para int64_t (instante)
+#include "listacompras.h" // Lista recebida
+#include "estoque.h"      // Destino das entradas
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @struct DivergenciaRecebimento
+ * @brief Item que chegou em quantidade diferente da lista
+ */
+struct DivergenciaRecebimento {
+    int itemId;
+    string nomeItem;
+    int esperado;   // Quantidade da lista
+    int recebido;   // Quantidade que chegou
+
+    DivergenciaRecebimento() : itemId(0), esperado(0), recebido(0) {}
+    DivergenciaRecebimento(int itemId, const string& nomeItem, int esperado, int recebido)
+        : itemId(itemId), nomeItem(nomeItem), esperado(esperado), recebido(recebido) {}
+
+    int diferenca() const { return recebido - esperado; }  // Negativo = faltou
+};  // Fim da struct DivergenciaRecebimento
+
+/**
+ * @struct Recebimento
+ * @brief Registro de um recebimento confirmado
+ */
+struct Recebimento {
+    int id;
+    int listaId;                                  // Lista de compras recebida
+    int64_t instanteNs;                           // Relógio monotônico
+    vector<ItemEstoque> entradas;                 // O que entrou no estoque
+    vector<DivergenciaRecebimento> divergencias;  // Diferenças em relação à lista
+
+    Recebimento() : id(0), listaId(0), instanteNs(0) {}
+};  // Fim da struct Recebimento
+
+/**
+ * @class DiarioRecebimentos
+ * @brief Executa e registra recebimentos de mercadoria
+ *
+ * TRANSAÇÃO:
+ * 1. Valida tudo (itens da lista, quantidades)
+ * 2. Grava INICIO no diário (antes de mexer no estoque)
+ * 3. Entrada em lote no estoque (tudo ou nada)
+ * 4. Grava CONFIRMADO (ou CANCELADO se a entrada falhou)
+ * 5. Baixa a lista: itens recebidos por completo saem, o resto fica pendente
+ *
+ * Um INICIO sem CONFIRMADO nem CANCELADO indica queda no meio do passo 3:
+ * configurarArquivo() devolve esses recebimentos em getPendentes(). O diário
+ * não refaz a entrada (o estoque volta pelo log de alterações, e a entrada
+ * pode ou não ter chegado a ele); quem decide é o usuário, conferindo o estoque.
+ */
+class DiarioRecebimentos {
+private:  // ENCAPSULAMENTO: atributos privados
+    vector<Recebimento> registros;  // Recebimentos confirmados, em ordem
+    vector<Recebimento> pendentes;  // INICIO sem desfecho no arquivo (sem nomes nem divergências)
+    int proximoId;                  // Contador de IDs
+    string caminho;                 // Arquivo do diário ("" = só em memória)
+
+    /**
+     * @brief Acrescenta texto ao diário com uma única escrita
+     * @throws PersistenciaException se a gravação falhar
+     */
+    void gravar(const string& texto) const;
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - diário vazio, só em memória
+     */
+    DiarioRecebimentos();
+
+    /**
+     * @brief Liga o diário a um arquivo (acréscimo)
+     *
+     * Lê os INICIO já gravados para continuar a numeração: um recebimento
+     * novo nunca reaproveita o ID de uma execução anterior. Os INICIO sem
+     * CONFIRMADO/CANCELADO ficam em getPendentes().
+     * @throws PersistenciaException se o arquivo não puder ser aberto
+     */
+    void configurarArquivo(const string& caminho);
+
+    /**
+     * @brief Recebe uma lista de compras no estoque
+     * @param lista Lista que chegou (é baixada ao final)
+     * @param recebidos Map: chave = itemId, valor = quantidade recebida
+     *        (item ausente = chegou como na lista)
+     * @param estoque Estoque de destino
+     * @param agoraNs Instante do recebimento
+     * @return Registro do recebimento
+     * @throws ListaComprasException se um item recebido não está na lista
+     * @throws ValidacaoException se quantidade negativa
+     * @throws PersistenciaException se o diário não puder ser gravado (nada é alterado)
+     */
+    const Recebimento& receber(ListaCompras& lista, const map<int, int>& recebidos,
+                               Estoque& estoque, int64_t agoraNs);
+
+    // ==================== GETTERS ====================
+    const vector<Recebimento>& getRegistros() const;
+    const Recebimento* buscarPorId(int id) const;
+    const vector<Recebimento>& getPendentes() const;  // Interrompidos em execuções anteriores
+
+    /**
+     * @brief Exibe um recebimento (entradas e divergências)
+     */
+    static string exibir(const Recebimento& recebimento);
+
+    /**
+     * @brief Exibe o histórico resumido (uma linha por recebimento)
+     */
+    string exibirHistorico() const;
+};  // Fim da classe DiarioRecebimentos
+
+#endif // RECEBIMENTO_H
+// Fim do include guard
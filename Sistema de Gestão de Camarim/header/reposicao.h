@@ -0,0 +1,115 @@
+/**
+ * @file reposicao.h
+ * @brief Definição da classe PlanoReposicao
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Entre um show e outro cada camarim volta ao que o rider do artista
+ * pede. O plano compara o que o camarim TEM com o que o rider EXIGE
+ * e repõe só a diferença, com uma única saída de estoque.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef REPOSICAO_H  // Se REPOSICAO_H não foi definido
+#define REPOSICAO_H  // Define REPOSICAO_H
+
+// Bibliotecas necessárias
+#include <map>       // Para totais por item
+#include <vector>    // Para faltas por camarim
+#include <string>    // Para exibição
+#include <iostream>  // Para operator<<
+#include "rider.h"   // Riders (quantidades-alvo)
+#include "camarim.h" // Camarins (quantidades atuais)
+#include "item.h"    // Catálogo (nomes e validação)
+#include "estoque.h" // Estoque central (saída em lote)
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @struct FaltaCamarim
+ * @brief O que falta em um camarim para voltar ao rider
+ */
+struct FaltaCamarim {
+    int camarimId;                    // Camarim a repor
+    vector<pair<int, int>> faltas;    // (itemId, quantidade que falta), em ordem de itemId
+
+    FaltaCamarim() : camarimId(0) {}
+    explicit FaltaCamarim(int camarimId) : camarimId(camarimId) {}
+};  // Fim da struct FaltaCamarim
+
+/**
+ * @class PlanoReposicao
+ * @brief Faltas por camarim e total por item (o que retirar do estoque)
+ *
+ * Itens que o camarim tem A MAIS que o rider não são recolhidos:
+ * a reposição só completa.
+ */
+class PlanoReposicao {
+private:  // ENCAPSULAMENTO: atributos privados
+    vector<FaltaCamarim> porCamarim;  // Só camarins com falta, na ordem do gerenciador
+    map<int, int> totais;             // itemId → soma das faltas
+
+    /**
+     * @brief Compara um camarim com seu rider e acumula as faltas
+     *
+     * Itens do camarim e do rider estão ordenados por itemId: uma única
+     * passada pelas duas listas, O(n + m)
+     */
+    void comparar(const Camarim& camarim, const Rider& rider);
+
+    /**
+     * @brief Funde plano parcial neste (etapa de REDUÇÃO)
+     */
+    void mesclar(PlanoReposicao& outro);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - plano vazio
+     */
+    PlanoReposicao();
+
+    /**
+     * @brief Planeja a reposição de todos os camarins com artista e rider
+     * @param riders Riders (alvo = rider vigente do artista do camarim)
+     * @param camarins Camarins (percorridos por referência, sem cópia)
+     * @return Faltas por camarim e totais por item
+     *
+     * PARALELO: com muitos camarins, cada thread compara uma fatia
+     * contígua em um plano parcial; as parciais são fundidas em ordem
+     */
+    static PlanoReposicao planejar(const GerenciadorRiders& riders, const GerenciadorCamarins& camarins);
+
+    /**
+     * @brief Faltas de um único camarim em relação a um rider - O(n + m)
+     * @return Faltas em ordem de itemId (vazia se o camarim já atende o rider)
+     */
+    static FaltaCamarim faltasDoCamarim(const Camarim& camarim, const Rider& rider);
+
+    // ==================== GETTERS ====================
+    const vector<FaltaCamarim>& getPorCamarim() const;  // Faltas por camarim
+    const map<int, int>& getTotais() const;             // Formato de Estoque::removerLote
+    bool vazio() const;                                 // true se nada falta
+
+    /**
+     * @brief Executa o plano: UMA saída em lote e entrega nos camarins
+     * @return Quantidade de camarins repostos
+     * @throws CamarimException se um camarim do plano não existe mais
+     * @throws ItemException se um item saiu do catálogo
+     * @throws EstoqueInsuficienteException se faltar qualquer item (nada é retirado)
+     */
+    int executar(GerenciadorItens& catalogo, Estoque& estoque, GerenciadorCamarins& camarins) const;
+
+    /**
+     * @brief Exibe o plano formatado (totais + faltas por camarim)
+     */
+    string exibir() const;
+
+    /**
+     * @brief Sobrecarga do operador << para cout
+     */
+    friend ostream& operator<<(ostream& os, const PlanoReposicao& plano);
+};  // Fim da classe PlanoReposicao
+
+#endif // REPOSICAO_H
+// Fim do include guard
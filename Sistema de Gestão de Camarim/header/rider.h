@@ -0,0 +1,285 @@
+/**
+ * @file rider.h
+ * @brief Definição das classes Rider e GerenciadorRiders
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Rider = lista de itens que o contrato do artista exige no camarim.
+ * O rider é cadastrado uma vez e aplicado ao camarim a cada show,
+ * em vez de digitar item por item.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef RIDER_H  // Se RIDER_H não foi definido
+#define RIDER_H  // Define RIDER_H
+
+// Bibliotecas necessárias
+#include <string>    // Para trabalhar com strings
+#include <vector>    // Para lista de riders
+#include <map>       // Para quantidades por item (saída em lote)
+#include <unordered_map>  // Para índice artista → rider
+#include <functional>     // Para o observador de riders
+#include <iostream>  // Para operator<<
+#include "mapapequeno.h"  // Mapa plano para os itens do rider
+#include "item.h"         // Catálogo (validação dos itens)
+#include "estoque.h"      // Estoque central (saída em lote)
+#include "camarim.h"      // Camarins de destino
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @struct ItemRider
+ * @brief Representa um item exigido pelo rider
+ *
+ * STRUCT: dados simples, membros públicos por padrão
+ */
+struct ItemRider {
+    int itemId;        // ID do item (referência ao catálogo)
+    string nomeItem;   // Nome do item (cópia para exibição)
+    int quantidade;    // Quantidade exigida por show
+
+    /**
+     * @brief Construtor padrão - inicializa vazio
+     */
+    ItemRider() : itemId(0), nomeItem(""), quantidade(0) {}
+
+    /**
+     * @brief Construtor parametrizado
+     */
+    ItemRider(int id, const string& nome, int qtd)
+        : itemId(id), nomeItem(nome), quantidade(qtd) {}
+};  // Fim da struct ItemRider
+
+/**
+ * @class Rider
+ * @brief Modelo reutilizável de itens de camarim de um artista
+ *
+ * RESPONSABILIDADES:
+ * - Guardar os itens exigidos pelo contrato do artista
+ * - Informar as quantidades no formato de saída em lote do estoque
+ * - Exibir o rider formatado
+ */
+class Rider {
+private:  // ENCAPSULAMENTO: atributos privados
+    int id;                             // ID único do rider
+    int artistaId;                      // Artista dono do rider
+    string nome;                        // Descrição (ex: "Turnê 2025")
+    MapaPequeno<int, ItemRider> itens;  // Chave = itemId, valor = ItemRider
+    const function<void(int, int)>* observador;  // Observador do gerenciador (nullptr = nenhum)
+    vector<int>* alterados;             // Log de alterações do gerenciador (nullptr = sem log)
+
+    /**
+     * @brief Avisa o observador ligado (se houver) com (artistaId, itemId)
+     */
+    void avisarObservador(int itemId);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor padrão - inicializa vazio
+     */
+    Rider();
+
+    /**
+     * @brief Construtor parametrizado
+     * @param id ID do rider
+     * @param artistaId ID do artista dono
+     * @param nome Descrição do rider
+     */
+    Rider(int id, int artistaId, const string& nome);
+
+    /**
+     * @brief Construtor de cópia - a cópia é avulsa (sem log nem observador)
+     *
+     * Cópias de listar() não alteram o log nem a lista automática
+     */
+    Rider(const Rider& outro);
+
+    /**
+     * @brief Construtor de movimento - leva a ligação (log e observador)
+     */
+    Rider(Rider&& outro) noexcept;
+
+    /**
+     * @brief Atribuição por cópia - mantém a ligação deste rider
+     */
+    Rider& operator=(const Rider& outro);
+
+    /**
+     * @brief Atribuição por movimento - assume a ligação do outro
+     */
+    Rider& operator=(Rider&& outro) noexcept;
+
+    // ==================== GETTERS ====================
+    int getId() const;              // Retorna ID do rider
+    int getArtistaId() const;       // Retorna artista dono
+    string getNome() const;         // Retorna descrição
+    const MapaPequeno<int, ItemRider>& getItens() const;  // Itens (referência, sem cópia)
+
+    // ==================== SETTERS ====================
+    void setNome(const string& nome);  // Define descrição
+
+    /**
+     * @brief Define quantidade exigida de um item
+     * @param itemId ID do item
+     * @param nomeItem Nome do item
+     * @param quantidade Quantidade por show (SUBSTITUI a anterior)
+     * @throws ValidacaoException se quantidade <= 0
+     */
+    void definirItem(int itemId, const string& nomeItem, int quantidade);
+
+    /**
+     * @brief Remove item do rider
+     * @return true se removido
+     */
+    bool removerItem(int itemId);
+
+    /**
+     * @brief Converte itens em map itemId → quantidade
+     * @return Formato aceito por Estoque::removerLote
+     */
+    map<int, int> quantidadesPorItem() const;
+
+    /**
+     * @brief Liga o rider ao observador do gerenciador
+     * @param observador Recebe (artistaId, itemId); deve sobreviver ao rider
+     */
+    void ligarObservador(const function<void(int, int)>* observador);
+
+    /**
+     * @brief Liga o rider à lista de alterados do gerenciador
+     *
+     * Itens são definidos direto no rider, por fora do gerenciador
+     */
+    void ligarAlteracoes(vector<int>* alterados);
+
+    /**
+     * @brief Exibe rider formatado
+     */
+    string exibir() const;
+
+    /**
+     * @brief Sobrecarga do operador << para cout
+     */
+    friend ostream& operator<<(ostream& os, const Rider& rider);
+};  // Fim da classe Rider
+
+/**
+ * @class GerenciadorRiders
+ * @brief Gerencia riders e aplica riders aos camarins
+ *
+ * APLICAR RIDER = uma transação em lote:
+ * 1. Valida todos os itens no catálogo
+ * 2. Retira tudo do estoque com UMA saída em lote (tudo ou nada)
+ * 3. Insere todas as linhas no camarim
+ */
+class GerenciadorRiders {
+private:  // Atributos privados
+    vector<Rider> riders;  // Vector de riders
+    int proximoId;         // Contador para gerar IDs únicos
+    function<void(int, int)> observadorRider;  // Itens do rider de um artista mudaram
+    vector<int>* alterados;  // IDs alterados desde a última confirmação (nullptr = sem log)
+    friend class ArquivoSnapshot;  // Restaura riders e proximoId
+    friend class LogAlteracoes;    // Reaplica riders gravados no log
+
+    /**
+     * @brief Garante que todos os itens existem no catálogo
+     * @throws ItemException no primeiro item inexistente
+     */
+    static void validarCatalogo(const Rider& rider, GerenciadorItens& catalogo);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - inicializa vazio e proximoId = 1
+     */
+    GerenciadorRiders();
+
+    // Riders guardam ponteiro para o observador: gerenciador não pode ser copiado
+    GerenciadorRiders(const GerenciadorRiders&) = delete;
+    GerenciadorRiders& operator=(const GerenciadorRiders&) = delete;
+
+    /**
+     * @brief Cadastra rider vazio para um artista (CREATE)
+     * @param artistaId ID do artista dono
+     * @param nome Descrição do rider
+     * @return ID do rider criado
+     */
+    int cadastrar(int artistaId, const string& nome);
+
+    /**
+     * @brief Busca rider por ID (READ)
+     * @return Ponteiro para o rider ou nullptr
+     */
+    Rider* buscarPorId(int id);
+
+    /**
+     * @brief Rider vigente de um artista (o cadastrado por último)
+     * @return Ponteiro para o rider ou nullptr se o artista não tem rider
+     */
+    Rider* buscarPorArtista(int artistaId);
+
+    /**
+     * @brief Remove rider (DELETE)
+     * @return true se removido
+     */
+    bool remover(int id);
+
+    /**
+     * @brief Lista todos os riders (READ ALL)
+     */
+    vector<Rider> listar() const;
+
+    /**
+     * @brief Índice artista → rider vigente (o cadastrado por último)
+     *
+     * Ponteiros para dentro deste gerenciador: valem até o próximo
+     * cadastro/remoção de rider
+     */
+    unordered_map<int, const Rider*> indicePorArtista() const;
+
+    /**
+     * @brief Aplica rider a um camarim (transação em lote)
+     * @param riderId ID do rider
+     * @param camarimId ID do camarim de destino
+     * @param catalogo Catálogo de itens (validação)
+     * @param estoque Estoque central (saída em lote)
+     * @param camarins Gerenciador de camarins
+     * @throws ValidacaoException se rider não existe ou está vazio
+     * @throws CamarimException se camarim não existe
+     * @throws ItemException se algum item saiu do catálogo
+     * @throws EstoqueInsuficienteException se faltar qualquer item (nada é retirado)
+     */
+    void aplicar(int riderId, int camarimId, GerenciadorItens& catalogo,
+                 Estoque& estoque, GerenciadorCamarins& camarins);
+
+    /**
+     * @brief Abastece todos os camarins com o rider de seus artistas
+     * @return Quantidade de camarins abastecidos
+     * @throws ItemException / EstoqueInsuficienteException (nada é retirado)
+     *
+     * Abertura de portas: soma a demanda de TODOS os camarins e faz
+     * uma única saída em lote. Camarins sem artista ou cujo artista
+     * não tem rider são ignorados.
+     */
+    int provisionarCamarins(GerenciadorItens& catalogo, Estoque& estoque,
+                            GerenciadorCamarins& camarins);
+
+    /**
+     * @brief Define função chamada quando o que um artista exige muda
+     * @param observador Recebe (artistaId, itemId); itemId 0 = rider inteiro
+     *        (rider cadastrado ou removido: o vigente pode ter mudado)
+     *
+     * Vale para os riders atuais e futuros, inclusive itens definidos
+     * direto no rider
+     */
+    void definirObservadorRider(function<void(int artistaId, int itemId)> observador);
+
+    /**
+     * @brief Passa a anotar os IDs alterados (riders atuais e futuros)
+     * @param alterados Lista preenchida a cada alteração (nullptr = desliga)
+     */
+    void ligarAlteracoes(vector<int>* alterados);
+};  // Fim da classe GerenciadorRiders
+
+#endif // RIDER_H
+// Fim do include guard
@@ -0,0 +1,93 @@
+/**
+ * @file separacao.h
+ * @brief Definição da classe OndaSeparacao
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Consolida pedidos pendentes em uma única "onda de separação":
+ * o runner vai ao estoque uma vez só, com o total de cada item,
+ * e depois distribui nos camarins seguindo o detalhamento por camarim.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef SEPARACAO_H  // Se SEPARACAO_H não foi definido
+#define SEPARACAO_H  // Define SEPARACAO_H
+
+// Inclui Pedido e ItemPedido
+#include "pedido.h"
+// Bibliotecas necessárias
+#include <map>       // Para totais por item e por camarim
+#include <vector>    // Para IDs dos pedidos da onda
+#include <string>    // Para exibição
+#include <iostream>  // Para operator<<
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @class OndaSeparacao
+ * @brief Lista de separação consolidada de vários pedidos
+ *
+ * RESPONSABILIDADES:
+ * - Somar quantidades por item de N pedidos (o que retirar do estoque)
+ * - Manter o detalhamento por camarim (onde entregar cada item)
+ * - Informar quais pedidos fazem parte da onda
+ */
+class OndaSeparacao {
+private:  // ENCAPSULAMENTO: atributos privados
+    vector<int> pedidoIds;                      // Pedidos incluídos na onda
+    map<int, ItemPedido> totais;                // Chave = itemId, valor = total a retirar
+    map<int, map<int, ItemPedido>> porCamarim;  // Chave = camarimId → (itemId → quantidade)
+
+    /**
+     * @brief Soma um pedido aos totais desta onda
+     */
+    void acumular(const Pedido& pedido);
+
+    /**
+     * @brief Funde outra onda parcial nesta (etapa de REDUÇÃO)
+     */
+    void mesclar(const OndaSeparacao& outra);
+
+public:  // Interface pública
+    /**
+     * @brief Construtor - onda vazia
+     */
+    OndaSeparacao();
+
+    /**
+     * @brief Planeja onda a partir de pedidos pendentes
+     * @param pedidos Pedidos a consolidar (ponteiros, sem cópia)
+     * @return Onda com totais e detalhamento por camarim
+     *
+     * REDUÇÃO PARALELA: para conjuntos grandes, cada thread consolida
+     * uma fatia dos pedidos em uma onda parcial e as parciais são
+     * fundidas no final (soma é associativa e comutativa)
+     */
+    static OndaSeparacao planejar(const vector<const Pedido*>& pedidos);
+
+    // ==================== GETTERS ====================
+    const vector<int>& getPedidoIds() const;                       // Pedidos da onda
+    const map<int, ItemPedido>& getTotais() const;                 // Totais por item
+    const map<int, map<int, ItemPedido>>& getPorCamarim() const;   // Detalhamento por camarim
+    bool vazia() const;                                            // true se não há itens
+
+    /**
+     * @brief Converte totais em map itemId → quantidade
+     * @return Formato aceito por Estoque::removerLote
+     */
+    map<int, int> quantidadesPorItem() const;
+
+    /**
+     * @brief Exibe a onda formatada (totais + entregas por camarim)
+     */
+    string exibir() const;
+
+    /**
+     * @brief Sobrecarga do operador << para cout
+     */
+    friend ostream& operator<<(ostream& os, const OndaSeparacao& onda);
+};  // Fim da classe OndaSeparacao
+
+#endif // SEPARACAO_H
+// Fim do include guard
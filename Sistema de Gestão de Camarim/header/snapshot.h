@@ -0,0 +1,132 @@
+/**
+ * @file snapshot.h
+ * @brief Definição da classe ArquivoSnapshot
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Estado completo do sistema (todos os eventos) salvo em um arquivo
+ * binário versionado. O arquivo é organizado em seções de registros de
+ * tamanho fixo para ser mapeado em memória (mmap) e lido sem conversão:
+ * a partida do programa só copia os registros para os gerenciadores.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef SNAPSHOT_H  // Se SNAPSHOT_H não foi definido
+#define SNAPSHOT_H  // Define SNAPSHOT_H
+
+// Bibliotecas necessárias
+#include <string>    // Para caminho do arquivo
+#include <cstdint>   // Para int64_t/uint64_t (instantes e tamanhos)
+#include <cstddef>   // Para size_t
+
+using namespace std;  // Namespace padrão
+
+class GerenciadorEventos;    // Declarações antecipadas (evento.h é pesado)
+class Evento;
+struct EscritorSnapshot;     // Definidos em snapshot.cpp
+struct LeitorSnapshot;
+struct RegistroEvento;
+
+/**
+ * @struct ResumoSnapshot
+ * @brief O que foi gravado ou carregado
+ */
+struct ResumoSnapshot {
+    size_t eventos;      // Eventos no arquivo
+    size_t registros;    // Registros de todas as seções (sem contar o texto)
+    uint64_t bytes;      // Tamanho do arquivo
+    bool mapeado;        // true = lido com mmap; false = lido para um buffer
+    uint64_t geracaoLog; // Última geração do log de alterações contida no estado
+
+    ResumoSnapshot() : eventos(0), registros(0), bytes(0), mapeado(false), geracaoLog(0) {}
+};  // Fim da struct ResumoSnapshot
+
+/**
+ * @class ArquivoSnapshot
+ * @brief Grava e carrega o estado de todos os eventos
+ *
+ * FORMATO (versão 2, ordem de bytes da máquina que gravou):
+ * - Cabeçalho de 64 bytes: "CMPS", versão, marca de ordem de bytes,
+ *   número de seções, tamanho do arquivo, instante da gravação,
+ *   geração do log de alterações já contida no estado e CRC-32C de
+ *   todo o resto do arquivo (a versão 1, sem CRC, ainda é carregada)
+ * - Tabela de seções: tipo, evento, posição, quantidade e tamanho do registro
+ * - Seções alinhadas em 8 bytes, cada uma um vetor de registros fixos
+ *   (itens, artistas, camarins, estoque, pedidos, listas, riders, equipe,
+ *   reservas, fornecedores, ofertas, estoques mínimos)
+ * - Área de texto no fim: registros guardam (posição, tamanho) dos nomes
+ *
+ * Filhos (itens de um camarim, pedido, lista ou rider) ficam em seção
+ * própria, na ordem dos pais; o pai guarda só quantos são.
+ *
+ * O que é derivado (índices, demanda pendente, atribuições, total geral
+ * das listas) é refeito na carga. Métricas de latência e o histórico de
+ * recebimentos não entram: pedidos arquivados e o diário já estão em disco.
+ */
+class ArquivoSnapshot {
+private:  // Auxiliares com acesso aos gerenciadores (classe amiga deles)
+    /**
+     * @brief Grava as seções de um evento
+     */
+    static void gravarEvento(Evento& evento, EscritorSnapshot& escritor);
+
+    /**
+     * @brief Restaura um evento a partir das seções dele
+     * @param deslocamentoNs Somado aos instantes dos pedidos (relógio monotônico recomeça)
+     */
+    static void restaurarEvento(Evento& evento, const RegistroEvento& registro,
+                                const LeitorSnapshot& leitor, int64_t deslocamentoNs);
+
+public:  // Interface pública
+    /**
+     * @brief Monta o arquivo em memória (sem tocar o disco)
+     * @param eventos Eventos a gravar
+     * @param agoraNs Instante da gravação (relógio monotônico)
+     * @param geracaoLog Última geração do log de alterações contida no estado
+     * @param resumo [saída] Resumo do que foi montado
+     * @return Bytes do arquivo
+     *
+     * Separado da escrita para que a escrita rode em outra thread
+     */
+    static string serializar(GerenciadorEventos& eventos, int64_t agoraNs, uint64_t geracaoLog,
+                             ResumoSnapshot& resumo);
+
+    /**
+     * @brief Grava bytes já montados (arquivo temporário + rename)
+     * @throws PersistenciaException se a gravação falhar (arquivo anterior fica intacto)
+     */
+    static void gravarArquivo(const string& dados, const string& caminho);
+
+    /**
+     * @brief Grava o estado de todos os eventos
+     * @param eventos Eventos a gravar
+     * @param caminho Arquivo de destino (substituído por inteiro)
+     * @param agoraNs Instante da gravação (relógio monotônico)
+     * @param geracaoLog Última geração do log de alterações contida no estado
+     * @return Resumo do que foi gravado
+     * @throws PersistenciaException se a gravação falhar (arquivo anterior fica intacto)
+     *
+     * Grava em um arquivo temporário e renomeia: nunca deixa meio estado
+     */
+    static ResumoSnapshot gravar(GerenciadorEventos& eventos, const string& caminho, int64_t agoraNs,
+                                 uint64_t geracaoLog = 0);
+
+    /**
+     * @brief Carrega o estado salvo
+     * @param caminho Arquivo a ler
+     * @param eventos Gerenciador VAZIO que recebe os eventos
+     * @param agoraNs Instante da carga (relógio monotônico)
+     * @param resumo [saída] Resumo do que foi carregado
+     * @return false se o arquivo não existe (nada é alterado)
+     * @throws PersistenciaException se o arquivo for inválido ou de outra versão
+     *         (o gerenciador volta a ficar vazio)
+     *
+     * Tudo é validado (limites de seções, textos e filhos) antes do uso
+     */
+    static bool carregar(const string& caminho, GerenciadorEventos& eventos, int64_t agoraNs,
+                         ResumoSnapshot& resumo);
+};  // Fim da classe ArquivoSnapshot
+
+#endif // SNAPSHOT_H
+// Fim do include guard
@@ -0,0 +1,372 @@
+/**
+ * @file agenda.cpp
+ * @brief Implementação da classe AgendaCamarins
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa reservas por horário e consultas de conflito.
+ */
+
+// Inclui header da classe
+#include "agenda.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Para sort
+#include <algorithm>
+// Para stringstream (construir strings)
+#include <sstream>
+// Para formatação (setw, setfill)
+#include <iomanip>
+
+static const int MINUTOS_POR_DIA = 24 * 60;
+
+// ==================== Struct Reserva ====================
+
+/**
+ * Exibe reserva em uma linha
+ */
+string Reserva::exibir() const {
+    stringstream ss;
+    ss << "#" << id << " Camarim " << camarimId << ", Artista " << artistaId << ": "
+       << AgendaCamarins::formatarHorario(inicio) << " - "
+       << AgendaCamarins::formatarHorario(fim);
+    return ss.str();
+}
+
+/**
+ * Sobrecarga do operador << para cout
+ */
+ostream& operator<<(ostream& os, const Reserva& reserva) {
+    os << reserva.exibir();
+    return os;
+}
+
+// ==================== Classe AgendaCamarins ====================
+
+/**
+ * Construtor - agenda vazia
+ */
+AgendaCamarins::AgendaCamarins() : proximoId(1), alterados(nullptr) {}
+
+/**
+ * Valida intervalo [inicio, fim)
+ */
+void AgendaCamarins::validarIntervalo(int inicio, int fim) {
+    if (inicio < 0) {
+        throw ValidacaoException("Horário de início inválido");
+    }
+    if (fim <= inicio) {
+        throw ValidacaoException("Horário de saída deve ser depois da entrada");
+    }
+}
+
+/**
+ * Anota reserva alterada para o log
+ */
+void AgendaCamarins::anotar(int reservaId) {
+    if (alterados != nullptr) {
+        alterados->push_back(reservaId);
+    }
+}
+
+/**
+ * Reservas sobrepostas a [inicio, fim) - O(log n + k)
+ */
+vector<Reserva> AgendaCamarins::sobrepostas(const map<int, Reserva>& arvore, int inicio, int fim) {
+    vector<Reserva> resultado;
+    auto it = arvore.lower_bound(inicio);  // Primeira reserva que começa em inicio ou depois
+
+    // Reservas não se sobrepõem: só a ANTERIOR pode começar antes e ainda estar em andamento
+    if (it != arvore.begin()) {
+        auto anterior = prev(it);
+        if (anterior->second.fim > inicio) {
+            resultado.push_back(anterior->second);
+        }
+    }
+
+    // Demais: começam dentro do intervalo
+    for (; it != arvore.end() && it->first < fim; ++it) {
+        resultado.push_back(it->second);
+    }
+    return resultado;
+}
+
+/**
+ * Há sobreposição com [inicio, fim)? - O(log n)
+ */
+bool AgendaCamarins::ocupado(const map<int, Reserva>& arvore, int inicio, int fim) {
+    auto it = arvore.lower_bound(inicio);
+    if (it != arvore.end() && it->first < fim) {
+        return true;  // Alguém entra durante o intervalo
+    }
+    return it != arvore.begin() && prev(it)->second.fim > inicio;  // Alguém ainda não saiu
+}
+
+/**
+ * Reserva camarim para artista
+ */
+int AgendaCamarins::reservar(int camarimId, int artistaId, int inicio, int fim) {
+    validarIntervalo(inicio, fim);
+
+    // Conflito no camarim
+    auto camarim = porCamarim.find(camarimId);
+    if (camarim != porCamarim.end()) {
+        vector<Reserva> choques = sobrepostas(camarim->second, inicio, fim);
+        if (!choques.empty()) {
+            throw CamarimException("Camarim " + to_string(camarimId) +
+                                   " já ocupado neste horário (" + choques.front().exibir() + ")");
+        }
+    }
+
+    // Conflito do artista (não pode estar em dois camarins ao mesmo tempo)
+    auto artista = porArtista.find(artistaId);
+    if (artista != porArtista.end()) {
+        vector<Reserva> choques = sobrepostas(artista->second, inicio, fim);
+        if (!choques.empty()) {
+            throw ArtistaException("Artista " + to_string(artistaId) +
+                                   " já tem camarim neste horário (" + choques.front().exibir() + ")");
+        }
+    }
+
+    Reserva reserva(proximoId, camarimId, artistaId, inicio, fim);
+    porCamarim[camarimId][inicio] = reserva;
+    porArtista[artistaId][inicio] = reserva;
+    porId[reserva.id] = reserva;
+    anotar(reserva.id);
+    return proximoId++;
+}
+
+/**
+ * Reserva lote inteiro (tudo ou nada)
+ */
+vector<int> AgendaCamarins::reservarLote(const vector<Reserva>& lote) {
+    for (const auto& reserva : lote) {
+        validarIntervalo(reserva.inicio, reserva.fim);
+    }
+
+    // Posições do lote ordenadas por (camarim, início) e por (artista, início)
+    vector<size_t> ordemCamarim(lote.size()), ordemArtista(lote.size());
+    for (size_t i = 0; i < lote.size(); i++) {
+        ordemCamarim[i] = ordemArtista[i] = i;
+    }
+    sort(ordemCamarim.begin(), ordemCamarim.end(), [&lote](size_t a, size_t b) {
+        return lote[a].camarimId != lote[b].camarimId ? lote[a].camarimId < lote[b].camarimId
+                                                      : lote[a].inicio < lote[b].inicio;
+    });
+    sort(ordemArtista.begin(), ordemArtista.end(), [&lote](size_t a, size_t b) {
+        return lote[a].artistaId != lote[b].artistaId ? lote[a].artistaId < lote[b].artistaId
+                                                      : lote[a].inicio < lote[b].inicio;
+    });
+
+    // Camarins: vizinhos dentro do lote e contra a agenda atual
+    for (size_t k = 0; k < ordemCamarim.size(); k++) {
+        const Reserva& atual = lote[ordemCamarim[k]];
+        if (k > 0) {
+            const Reserva& anterior = lote[ordemCamarim[k - 1]];
+            if (anterior.camarimId == atual.camarimId && anterior.fim > atual.inicio) {
+                throw CamarimException("Lote com dois artistas no camarim " +
+                                       to_string(atual.camarimId) + " às " +
+                                       formatarHorario(atual.inicio));
+            }
+        }
+        auto camarim = porCamarim.find(atual.camarimId);
+        if (camarim != porCamarim.end() && ocupado(camarim->second, atual.inicio, atual.fim)) {
+            throw CamarimException("Camarim " + to_string(atual.camarimId) + " já ocupado às " +
+                                   formatarHorario(atual.inicio));
+        }
+    }
+
+    // Artistas: mesma verificação
+    for (size_t k = 0; k < ordemArtista.size(); k++) {
+        const Reserva& atual = lote[ordemArtista[k]];
+        if (k > 0) {
+            const Reserva& anterior = lote[ordemArtista[k - 1]];
+            if (anterior.artistaId == atual.artistaId && anterior.fim > atual.inicio) {
+                throw ArtistaException("Lote com o artista " + to_string(atual.artistaId) +
+                                       " em dois camarins às " + formatarHorario(atual.inicio));
+            }
+        }
+        auto artista = porArtista.find(atual.artistaId);
+        if (artista != porArtista.end() && ocupado(artista->second, atual.inicio, atual.fim)) {
+            throw ArtistaException("Artista " + to_string(atual.artistaId) +
+                                   " já tem camarim às " + formatarHorario(atual.inicio));
+        }
+    }
+
+    // Tudo validado: grava
+    vector<int> ids;
+    ids.reserve(lote.size());
+    for (const auto& pedida : lote) {
+        Reserva reserva(proximoId++, pedida.camarimId, pedida.artistaId, pedida.inicio, pedida.fim);
+        porCamarim[reserva.camarimId][reserva.inicio] = reserva;
+        porArtista[reserva.artistaId][reserva.inicio] = reserva;
+        porId[reserva.id] = reserva;
+        anotar(reserva.id);
+        ids.push_back(reserva.id);
+    }
+    return ids;
+}
+
+/**
+ * Cancela reserva
+ */
+bool AgendaCamarins::cancelar(int reservaId) {
+    auto it = porId.find(reservaId);
+    if (it == porId.end()) {
+        return false;
+    }
+
+    const Reserva& reserva = it->second;
+    porCamarim[reserva.camarimId].erase(reserva.inicio);
+    porArtista[reserva.artistaId].erase(reserva.inicio);
+    anotar(reservaId);  // Ausente na confirmação = removida
+    porId.erase(it);
+    return true;
+}
+
+/**
+ * Remove reservas de um camarim excluído
+ */
+void AgendaCamarins::removerCamarim(int camarimId) {
+    auto camarim = porCamarim.find(camarimId);
+    if (camarim == porCamarim.end()) {
+        return;
+    }
+    for (const auto& par : camarim->second) {
+        porArtista[par.second.artistaId].erase(par.second.inicio);
+        porId.erase(par.second.id);
+        anotar(par.second.id);
+    }
+    porCamarim.erase(camarim);
+}
+
+/**
+ * Remove reservas do artista
+ */
+void AgendaCamarins::removerArtista(int artistaId) {
+    auto artista = porArtista.find(artistaId);
+    if (artista == porArtista.end()) {
+        return;
+    }
+    for (const auto& par : artista->second) {
+        auto camarim = porCamarim.find(par.second.camarimId);
+        if (camarim != porCamarim.end()) {
+            camarim->second.erase(par.second.inicio);
+            if (camarim->second.empty()) {
+                porCamarim.erase(camarim);
+            }
+        }
+        porId.erase(par.second.id);
+        anotar(par.second.id);
+    }
+    porArtista.erase(artista);
+}
+
+/**
+ * Conflitos no camarim
+ */
+vector<Reserva> AgendaCamarins::conflitos(int camarimId, int inicio, int fim) const {
+    auto camarim = porCamarim.find(camarimId);
+    if (camarim == porCamarim.end()) {
+        return vector<Reserva>();
+    }
+    return sobrepostas(camarim->second, inicio, fim);
+}
+
+/**
+ * Camarim livre no intervalo?
+ */
+bool AgendaCamarins::livre(int camarimId, int inicio, int fim) const {
+    auto camarim = porCamarim.find(camarimId);
+    return camarim == porCamarim.end() || !ocupado(camarim->second, inicio, fim);
+}
+
+/**
+ * Camarins livres no intervalo
+ */
+vector<int> AgendaCamarins::camarinsLivres(const vector<int>& camarimIds, int inicio, int fim) const {
+    validarIntervalo(inicio, fim);
+
+    vector<int> livres;
+    for (int camarimId : camarimIds) {
+        if (livre(camarimId, inicio, fim)) {
+            livres.push_back(camarimId);
+        }
+    }
+    return livres;
+}
+
+/**
+ * Quem ocupa o camarim em um instante
+ */
+int AgendaCamarins::ocupante(int camarimId, int instante) const {
+    vector<Reserva> agora = conflitos(camarimId, instante, instante + 1);
+    return agora.empty() ? 0 : agora.front().artistaId;
+}
+
+/**
+ * Agenda do camarim
+ */
+vector<Reserva> AgendaCamarins::agendaDoCamarim(int camarimId) const {
+    vector<Reserva> agenda;
+    auto camarim = porCamarim.find(camarimId);
+    if (camarim != porCamarim.end()) {
+        for (const auto& par : camarim->second) {
+            agenda.push_back(par.second);
+        }
+    }
+    return agenda;
+}
+
+/**
+ * Agenda do artista
+ */
+vector<Reserva> AgendaCamarins::agendaDoArtista(int artistaId) const {
+    vector<Reserva> agenda;
+    auto artista = porArtista.find(artistaId);
+    if (artista != porArtista.end()) {
+        for (const auto& par : artista->second) {
+            agenda.push_back(par.second);
+        }
+    }
+    return agenda;
+}
+
+/**
+ * Total de reservas
+ */
+size_t AgendaCamarins::quantidade() const {
+    return porId.size();
+}
+
+/**
+ * Minutos do festival → "Dia D HH:MM"
+ */
+string AgendaCamarins::formatarHorario(int minutos) {
+    stringstream ss;
+    ss << "Dia " << (minutos / MINUTOS_POR_DIA + 1) << " "
+       << setfill('0') << setw(2) << (minutos % MINUTOS_POR_DIA) / 60 << ":"
+       << setw(2) << minutos % 60;
+    return ss.str();
+}
+
+/**
+ * Dia + hora + minuto → minutos do festival
+ */
+int AgendaCamarins::horario(int dia, int hora, int minuto) {
+    if (dia < 1) {
+        throw ValidacaoException("Dia deve ser 1 ou maior");
+    }
+    if (hora < 0 || hora > 24 || minuto < 0 || minuto > 59 || (hora == 24 && minuto != 0)) {
+        throw ValidacaoException("Horário inválido");
+    }
+    return (dia - 1) * MINUTOS_POR_DIA + hora * 60 + minuto;
+}
+
+/**
+ * Liga log de alterações
+ */
+void AgendaCamarins::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+}
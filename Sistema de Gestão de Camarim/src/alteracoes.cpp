@@ -0,0 +1,1122 @@
+/**
+ * @file alteracoes.cpp
+ * @brief Implementação da classe LogAlteracoes
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Monta os quadros do log (estado de cada entidade alterada), grava todos
+ * de uma vez a cada confirmação e reaplica as gerações na partida.
+ */
+
+// Inclui header da classe
+#include "alteracoes.h"
+// Inclui eventos e todos os gerenciadores deles
+#include "evento.h"
+// Inclui exceções personalizadas
+#include "excecoes.h"
+// Inclui o CRC-32C dos quadros
+#include "checksum.h"
+// Para sort, unique, lower_bound e max
+#include <algorithm>
+// Para listar e apagar as gerações
+#include <filesystem>
+// Para memcpy/memcmp
+#include <cstring>
+// Para ler uma geração inteira
+#include <iterator>
+
+// ==================== FORMATO ====================
+
+static const char ASSINATURA_LOG[4] = {'C', 'M', 'P', 'L'};
+static const uint32_t VERSAO_LOG = 1;
+
+/**
+ * Cabeçalho de cada arquivo de geração (16 bytes)
+ */
+struct CabecalhoLog {
+    char assinatura[4];
+    uint32_t versao;
+    uint64_t geracao;  // Confere com o número no nome do arquivo
+};
+static_assert(sizeof(CabecalhoLog) == 16, "Cabeçalho do log mudou de tamanho");
+
+// Quadro = tamanho (4) + CRC (4) + corpo; corpo = sequência (8) + tipo (4) + evento (4) + campos
+static const size_t TAMANHO_PREFIXO_QUADRO = 8;
+static const size_t TAMANHO_INICIO_CORPO = 16;
+
+/**
+ * Tipos de registro (nunca renumerar: ficam gravados nos arquivos)
+ */
+enum TipoRegistro : uint32_t {
+    REG_EVENTO = 1,         // nome
+    REG_EVENTO_REMOVIDO,    // (sem campos)
+    REG_ITEM,               // id, preço, nome
+    REG_ITEM_REMOVIDO,      // id
+    REG_ARTISTA,            // id, camarimId, nome
+    REG_ARTISTA_REMOVIDO,   // id
+    REG_CAMARIM,            // id, artistaId, nome, itens (itemId, quantidade, nome)
+    REG_CAMARIM_REMOVIDO,   // id
+    REG_ESTOQUE,            // itemId, presente, quantidade, nome
+    REG_PEDIDO,             // id, ..., instantes, instante da gravação, nome, itens
+    REG_PEDIDO_REMOVIDO,    // id
+    REG_LISTA,              // id, descrição, linhas (itemId, quantidade, preço, acompanha, nome)
+    REG_LISTA_REMOVIDA,     // id
+    REG_RIDER,              // id, artistaId, nome, itens (itemId, quantidade, nome)
+    REG_RIDER_REMOVIDO,     // id
+    REG_MEMBRO,             // id, função, nome, atributo
+    REG_MEMBRO_REMOVIDO,    // id
+    REG_RESERVA,            // id, camarimId, artistaId, início, fim
+    REG_RESERVA_REMOVIDA,   // id
+    REG_FORNECEDOR,         // id, nome, ofertas (itemId, preço em centavos, mínimo, embalagem)
+    REG_FORNECEDOR_REMOVIDO,// id
+    REG_MINIMO              // itemId, mínimo (0 = sem mínimo)
+};
+
+// ==================== CAMPOS ====================
+
+/**
+ * Acrescenta um valor de tamanho fixo (ordem de bytes da máquina)
+ */
+template <typename T>
+static void escrever(string& destino, T valor) {
+    destino.append(reinterpret_cast<const char*>(&valor), sizeof(valor));
+}
+
+/**
+ * Acrescenta um texto: tamanho (4 bytes) + bytes
+ */
+static void escreverTexto(string& destino, const string& texto) {
+    escrever<uint32_t>(destino, (uint32_t)texto.size());
+    destino.append(texto);
+}
+
+/**
+ * Lê os campos de um registro, conferindo cada limite
+ */
+class LeitorCampos {
+private:
+    const char* dados;
+    size_t tamanho;
+    size_t posicao;
+
+public:
+    LeitorCampos(const char* dados, size_t tamanho) : dados(dados), tamanho(tamanho), posicao(0) {}
+
+    template <typename T>
+    T ler() {
+        if (tamanho - posicao < sizeof(T)) {
+            throw PersistenciaException("Registro do log menor que o esperado");
+        }
+        T valor;
+        memcpy(&valor, dados + posicao, sizeof(T));
+        posicao += sizeof(T);
+        return valor;
+    }
+
+    string lerTexto() {
+        uint32_t tamanhoTexto = ler<uint32_t>();
+        if (tamanho - posicao < tamanhoTexto) {
+            throw PersistenciaException("Texto de registro do log fora do registro");
+        }
+        string texto(dados + posicao, tamanhoTexto);
+        posicao += tamanhoTexto;
+        return texto;
+    }
+
+    /**
+     * Quantidade de filhos: cada um ocupa ao menos tamanhoMinimo bytes
+     */
+    uint32_t lerQuantidade(size_t tamanhoMinimo) {
+        uint32_t quantidade = ler<uint32_t>();
+        if (quantidade > (tamanho - posicao) / tamanhoMinimo) {
+            throw PersistenciaException("Quantidade de itens maior que o registro do log");
+        }
+        return quantidade;
+    }
+
+    void conferirFim() const {
+        if (posicao != tamanho) {
+            throw PersistenciaException("Registro do log com sobra de bytes");
+        }
+    }
+};
+
+/**
+ * Primeira posição com ID >= id (os vetores dos gerenciadores crescem por ID)
+ */
+template <typename T>
+static typename vector<T>::iterator posicaoPorId(vector<T>& elementos, int id) {
+    return lower_bound(elementos.begin(), elementos.end(), id,
+                       [](const T& elemento, int valor) { return elemento.getId() < valor; });
+}
+
+/**
+ * Elemento com o ID (end() se não existe)
+ */
+template <typename T>
+static typename vector<T>::iterator buscarPorId(vector<T>& elementos, int id) {
+    auto it = posicaoPorId(elementos, id);
+    if (it != elementos.end() && it->getId() == id) {
+        return it;
+    }
+    // Ordem quebrada (não deveria acontecer): busca linear
+    return find_if(elementos.begin(), elementos.end(), [id](const T& elemento) { return elemento.getId() == id; });
+}
+
+/**
+ * Mesmo ajuste do estado salvo: o relógio monotônico recomeça a cada execução
+ */
+static int64_t ajustarInstante(int64_t instante, int64_t deslocamentoNs) {
+    if (instante == 0) {
+        return 0;
+    }
+    int64_t ajustado = instante + deslocamentoNs;
+    return ajustado == 0 ? 1 : ajustado;  // 0 significaria "não ocorreu"
+}
+
+/**
+ * Ordena e remove IDs repetidos
+ */
+static void normalizar(vector<int>& ids) {
+    sort(ids.begin(), ids.end());
+    ids.erase(unique(ids.begin(), ids.end()), ids.end());
+}
+
+// ==================== GRAVAÇÃO ====================
+
+/**
+ * Construtor - log desligado
+ */
+LogAlteracoes::LogAlteracoes()
+    : geracao(0), sequencia(0), bytesGeracao(0), quadrosPendentes(0) {}
+
+/**
+ * Caminho do arquivo de uma geração
+ */
+string LogAlteracoes::caminhoGeracao(const string& prefixo, uint64_t geracao) {
+    return prefixo + to_string(geracao) + ".log";
+}
+
+/**
+ * Cria o arquivo da geração atual com o cabeçalho
+ */
+bool LogAlteracoes::abrirGeracao() {
+    saida.clear();
+    saida.open(caminhoGeracao(prefixo, geracao), ios::binary | ios::trunc);
+    if (!saida.is_open()) {
+        return false;
+    }
+    CabecalhoLog cabecalho = {};
+    memcpy(cabecalho.assinatura, ASSINATURA_LOG, sizeof(ASSINATURA_LOG));
+    cabecalho.versao = VERSAO_LOG;
+    cabecalho.geracao = geracao;
+    saida.write(reinterpret_cast<const char*>(&cabecalho), sizeof(cabecalho));
+    saida.flush();
+    if (!saida) {
+        saida.close();
+        return false;
+    }
+    bytesGeracao = sizeof(cabecalho);
+    return true;
+}
+
+/**
+ * Começa a gravar em uma geração nova
+ */
+void LogAlteracoes::abrir(const string& prefixo, uint64_t geracao) {
+    if (saida.is_open()) {
+        saida.close();
+    }
+    this->prefixo = prefixo;
+    this->geracao = geracao;
+    sequencia = 0;
+    bytesGeracao = 0;
+    if (!abrirGeracao()) {
+        throw PersistenciaException("Não foi possível criar o log de alterações " +
+                                    caminhoGeracao(prefixo, geracao));
+    }
+}
+
+/**
+ * Monta um quadro: tamanho, CRC do corpo e corpo
+ */
+void LogAlteracoes::anexarQuadro(uint32_t tipo, int eventoId, const string& campos) {
+    size_t inicio = pendente.size();
+    uint32_t tamanho = (uint32_t)(TAMANHO_INICIO_CORPO + campos.size());
+    escrever<uint32_t>(pendente, tamanho);
+    escrever<uint32_t>(pendente, 0);  // CRC, preenchido abaixo
+    escrever<uint64_t>(pendente, ++sequencia);
+    escrever<uint32_t>(pendente, tipo);
+    escrever<int32_t>(pendente, eventoId);
+    pendente.append(campos);
+
+    uint32_t crc = crc32c(pendente.data() + inicio + TAMANHO_PREFIXO_QUADRO, tamanho);
+    memcpy(&pendente[inicio + 4], &crc, sizeof(crc));
+    quadrosPendentes++;
+}
+
+/**
+ * Liga os gerenciadores do evento às listas de IDs alterados
+ */
+void LogAlteracoes::acompanhar(Evento& evento) {
+    AlteracoesEvento& alteracoes = acompanhados[evento.getId()];
+    alteracoes.evento = &evento;
+    evento.getItens().ligarAlteracoes(&alteracoes.itens);
+    evento.getArtistas().ligarAlteracoes(&alteracoes.artistas);
+    evento.getCamarins().ligarAlteracoes(&alteracoes.camarins);
+    evento.getEstoque().ligarAlteracoes(&alteracoes.estoque);
+    evento.getPedidos().ligarAlteracoes(&alteracoes.pedidos);
+    evento.getListasCompras().ligarAlteracoes(&alteracoes.listas);
+    evento.getRiders().ligarAlteracoes(&alteracoes.riders);
+    evento.getEquipe().ligarAlteracoes(&alteracoes.equipe);
+    evento.getAgenda().ligarAlteracoes(&alteracoes.reservas);
+    evento.getFornecedores().ligarAlteracoes(&alteracoes.fornecedores);
+    evento.getListaAutomatica().ligarAlteracoes(&alteracoes.minimos);
+
+    string campos;
+    escreverTexto(campos, evento.getNome());
+    anexarQuadro(REG_EVENTO, evento.getId(), campos);
+}
+
+/**
+ * Desliga o evento e registra a remoção
+ */
+void LogAlteracoes::esquecer(int eventoId) {
+    auto it = acompanhados.find(eventoId);
+    if (it == acompanhados.end()) {
+        return;
+    }
+    Evento& evento = *it->second.evento;
+    evento.getItens().ligarAlteracoes(nullptr);
+    evento.getArtistas().ligarAlteracoes(nullptr);
+    evento.getCamarins().ligarAlteracoes(nullptr);
+    evento.getEstoque().ligarAlteracoes(nullptr);
+    evento.getPedidos().ligarAlteracoes(nullptr);
+    evento.getListasCompras().ligarAlteracoes(nullptr);
+    evento.getRiders().ligarAlteracoes(nullptr);
+    evento.getEquipe().ligarAlteracoes(nullptr);
+    evento.getAgenda().ligarAlteracoes(nullptr);
+    evento.getFornecedores().ligarAlteracoes(nullptr);
+    evento.getListaAutomatica().ligarAlteracoes(nullptr);
+    acompanhados.erase(it);
+
+    anexarQuadro(REG_EVENTO_REMOVIDO, eventoId, string());
+}
+
+/**
+ * Estado atual (ou remoção) de cada entidade anotada
+ */
+size_t LogAlteracoes::montarRegistros(AlteracoesEvento& alteracoes, int64_t agoraNs) {
+    Evento& evento = *alteracoes.evento;
+    int eventoId = evento.getId();
+    size_t antes = quadrosPendentes;
+    string campos;
+
+    // Catálogo primeiro: listas reaplicadas logo depois pegam a versão de preço nova
+    normalizar(alteracoes.itens);
+    for (int id : alteracoes.itens) {
+        campos.clear();
+        escrever<int32_t>(campos, id);
+        const Item* item = evento.getItens().buscarPorId(id);
+        if (item == nullptr) {
+            anexarQuadro(REG_ITEM_REMOVIDO, eventoId, campos);
+            continue;
+        }
+        escrever<double>(campos, item->getPreco());
+        escreverTexto(campos, item->getNome());
+        anexarQuadro(REG_ITEM, eventoId, campos);
+    }
+    alteracoes.itens.clear();
+
+    // Mínimos logo depois do catálogo (só valem para itens que existem)
+    normalizar(alteracoes.minimos);
+    for (int itemId : alteracoes.minimos) {
+        campos.clear();
+        escrever<int32_t>(campos, itemId);
+        escrever<int32_t>(campos, evento.getListaAutomatica().getNecessidade(itemId).minimo);
+        anexarQuadro(REG_MINIMO, eventoId, campos);
+    }
+    alteracoes.minimos.clear();
+
+    normalizar(alteracoes.estoque);
+    const map<int, ItemEstoque>& saldos = evento.getEstoque().itens;
+    for (int itemId : alteracoes.estoque) {
+        campos.clear();
+        auto it = saldos.find(itemId);
+        escrever<int32_t>(campos, itemId);
+        escrever<int32_t>(campos, it != saldos.end() ? 1 : 0);
+        escrever<int32_t>(campos, it != saldos.end() ? it->second.quantidade : 0);
+        escreverTexto(campos, it != saldos.end() ? it->second.nomeItem : string());
+        anexarQuadro(REG_ESTOQUE, eventoId, campos);
+    }
+    alteracoes.estoque.clear();
+
+    normalizar(alteracoes.artistas);
+    for (int id : alteracoes.artistas) {
+        campos.clear();
+        escrever<int32_t>(campos, id);
+        const Artista* artista = evento.getArtistas().buscarPorId(id);
+        if (artista == nullptr) {
+            anexarQuadro(REG_ARTISTA_REMOVIDO, eventoId, campos);
+            continue;
+        }
+        escrever<int32_t>(campos, artista->getCamarimId());
+        escreverTexto(campos, artista->getNome());
+        anexarQuadro(REG_ARTISTA, eventoId, campos);
+    }
+    alteracoes.artistas.clear();
+
+    normalizar(alteracoes.camarins);
+    for (int id : alteracoes.camarins) {
+        campos.clear();
+        escrever<int32_t>(campos, id);
+        const Camarim* camarim = evento.getCamarins().buscarPorId(id);
+        if (camarim == nullptr) {
+            anexarQuadro(REG_CAMARIM_REMOVIDO, eventoId, campos);
+            continue;
+        }
+        escrever<int32_t>(campos, camarim->getArtistaId());
+        escreverTexto(campos, camarim->getNome());
+        escrever<uint32_t>(campos, (uint32_t)camarim->getItens().size());
+        for (const auto& par : camarim->getItens()) {
+            escrever<int32_t>(campos, par.second.itemId);
+            escrever<int32_t>(campos, par.second.quantidade);
+            escreverTexto(campos, par.second.nomeItem);
+        }
+        anexarQuadro(REG_CAMARIM, eventoId, campos);
+    }
+    alteracoes.camarins.clear();
+
+    normalizar(alteracoes.riders);
+    for (int id : alteracoes.riders) {
+        campos.clear();
+        escrever<int32_t>(campos, id);
+        const Rider* rider = evento.getRiders().buscarPorId(id);
+        if (rider == nullptr) {
+            anexarQuadro(REG_RIDER_REMOVIDO, eventoId, campos);
+            continue;
+        }
+        escrever<int32_t>(campos, rider->getArtistaId());
+        escreverTexto(campos, rider->getNome());
+        escrever<uint32_t>(campos, (uint32_t)rider->getItens().size());
+        for (const auto& par : rider->getItens()) {
+            escrever<int32_t>(campos, par.second.itemId);
+            escrever<int32_t>(campos, par.second.quantidade);
+            escreverTexto(campos, par.second.nomeItem);
+        }
+        anexarQuadro(REG_RIDER, eventoId, campos);
+    }
+    alteracoes.riders.clear();
+
+    normalizar(alteracoes.equipe);
+    GerenciadorEquipe& equipe = evento.getEquipe();
+    for (int id : alteracoes.equipe) {
+        campos.clear();
+        escrever<int32_t>(campos, id);
+        FuncaoEquipe funcao;
+        if (!equipe.buscarFuncao(id, funcao)) {
+            anexarQuadro(REG_MEMBRO_REMOVIDO, eventoId, campos);
+            continue;
+        }
+        escrever<int32_t>(campos, (int32_t)funcao);
+        switch (funcao) {
+            case FuncaoEquipe::PRODUTOR:
+                escreverTexto(campos, equipe.buscarProdutor(id)->getNome());
+                escreverTexto(campos, equipe.buscarProdutor(id)->getArea());
+                break;
+            case FuncaoEquipe::RUNNER:
+                escreverTexto(campos, equipe.buscarRunner(id)->getNome());
+                escreverTexto(campos, equipe.buscarRunner(id)->getVeiculo());
+                break;
+            case FuncaoEquipe::SEGURANCA:
+                escreverTexto(campos, equipe.buscarSeguranca(id)->getNome());
+                escreverTexto(campos, equipe.buscarSeguranca(id)->getPosto());
+                break;
+        }
+        anexarQuadro(REG_MEMBRO, eventoId, campos);
+    }
+    alteracoes.equipe.clear();
+
+    normalizar(alteracoes.reservas);
+    const map<int, Reserva>& reservas = evento.getAgenda().porId;
+    for (int id : alteracoes.reservas) {
+        campos.clear();
+        escrever<int32_t>(campos, id);
+        auto it = reservas.find(id);
+        if (it == reservas.end()) {
+            anexarQuadro(REG_RESERVA_REMOVIDA, eventoId, campos);
+            continue;
+        }
+        escrever<int32_t>(campos, it->second.camarimId);
+        escrever<int32_t>(campos, it->second.artistaId);
+        escrever<int32_t>(campos, it->second.inicio);
+        escrever<int32_t>(campos, it->second.fim);
+        anexarQuadro(REG_RESERVA, eventoId, campos);
+    }
+    alteracoes.reservas.clear();
+
+    // Fornecedor vai inteiro: nome e todas as ofertas que ele faz
+    normalizar(alteracoes.fornecedores);
+    const CatalogoFornecedores& fornecedores = evento.getFornecedores();
+    for (int id : alteracoes.fornecedores) {
+        campos.clear();
+        escrever<int32_t>(campos, id);
+        auto nome = fornecedores.fornecedores.find(id);
+        if (nome == fornecedores.fornecedores.end()) {
+            anexarQuadro(REG_FORNECEDOR_REMOVIDO, eventoId, campos);
+            continue;
+        }
+        escreverTexto(campos, nome->second);
+        auto itens = fornecedores.itensPorFornecedor.find(id);
+        vector<const OfertaFornecedor*> ofertas;
+        if (itens != fornecedores.itensPorFornecedor.end()) {
+            for (int itemId : itens->second) {
+                for (const OfertaFornecedor& oferta : fornecedores.ofertasDoItem(itemId)) {
+                    if (oferta.fornecedorId == id) {
+                        ofertas.push_back(&oferta);
+                    }
+                }
+            }
+        }
+        escrever<uint32_t>(campos, (uint32_t)ofertas.size());
+        for (const OfertaFornecedor* oferta : ofertas) {
+            escrever<int32_t>(campos, oferta->itemId);
+            escrever<int64_t>(campos, oferta->precoCentavos);
+            escrever<int32_t>(campos, oferta->quantidadeMinima);
+            escrever<int32_t>(campos, oferta->tamanhoEmbalagem);
+        }
+        anexarQuadro(REG_FORNECEDOR, eventoId, campos);
+    }
+    alteracoes.fornecedores.clear();
+
+    // Pedidos: instantes vão com o instante da gravação (refeitos na reprodução)
+    normalizar(alteracoes.pedidos);
+    for (int id : alteracoes.pedidos) {
+        campos.clear();
+        escrever<int32_t>(campos, id);
+        const Pedido* pedido = evento.getPedidos().buscarPorId(id);
+        if (pedido == nullptr) {
+            anexarQuadro(REG_PEDIDO_REMOVIDO, eventoId, campos);
+            continue;
+        }
+        escrever<int32_t>(campos, pedido->camarimId);
+        escrever<int32_t>(campos, pedido->prioridade);
+        escrever<int32_t>(campos, (pedido->atendido ? 1 : 0) | (pedido->aguardandoEstoque ? 2 : 0));
+        escrever<int32_t>(campos, pedido->pedidoOrigemId);
+        escrever<int32_t>(campos, pedido->backorderId);
+        escrever<int64_t>(campos, pedido->criadoEm);
+        escrever<int64_t>(campos, pedido->ultimoItemEm);
+        escrever<int64_t>(campos, pedido->reservadoEm);
+        escrever<int64_t>(campos, pedido->atendidoEm);
+        escrever<int64_t>(campos, agoraNs);
+        escreverTexto(campos, pedido->nomeArtista);
+        escrever<uint32_t>(campos, (uint32_t)pedido->itens.size());
+        for (const auto& par : pedido->itens) {
+            escrever<int32_t>(campos, par.second.itemId);
+            escrever<int32_t>(campos, par.second.quantidade);
+            escrever<int32_t>(campos, par.second.quantidadeAtendida);
+            escreverTexto(campos, par.second.nomeItem);
+        }
+        anexarQuadro(REG_PEDIDO, eventoId, campos);
+    }
+    alteracoes.pedidos.clear();
+
+    // Listas: linhas que acompanham o catálogo saem com o preço atual
+    normalizar(alteracoes.listas);
+    if (!alteracoes.listas.empty()) {
+        evento.getListasCompras().reprecificar(evento.getItens());
+    }
+    for (int id : alteracoes.listas) {
+        campos.clear();
+        escrever<int32_t>(campos, id);
+        const ListaCompras* lista = evento.getListasCompras().buscarPorId(id);
+        if (lista == nullptr) {
+            anexarQuadro(REG_LISTA_REMOVIDA, eventoId, campos);
+            continue;
+        }
+        escreverTexto(campos, lista->getDescricao());
+        escrever<uint32_t>(campos, (uint32_t)lista->getItens().size());
+        for (const auto& par : lista->getItens()) {
+            escrever<int32_t>(campos, par.second.itemId);
+            escrever<int32_t>(campos, par.second.quantidade);
+            escrever<double>(campos, par.second.preco);
+            escrever<int32_t>(campos, par.second.versaoPreco != 0 ? 1 : 0);
+            escreverTexto(campos, par.second.nomeItem);
+        }
+        anexarQuadro(REG_LISTA, eventoId, campos);
+    }
+    alteracoes.listas.clear();
+
+    return quadrosPendentes - antes;
+}
+
+/**
+ * Confirmação em grupo: todos os quadros em uma escrita só
+ */
+size_t LogAlteracoes::confirmar(int64_t agoraNs) {
+    for (auto& par : acompanhados) {
+        montarRegistros(par.second, agoraNs);
+    }
+    size_t registros = quadrosPendentes;
+    if (pendente.empty()) {
+        return 0;
+    }
+    if (!saida.is_open()) {
+        pendente.clear();  // Sem arquivo: o próximo estado salvo leva as alterações
+        quadrosPendentes = 0;
+        return registros;
+    }
+
+    saida.write(pendente.data(), (streamsize)pendente.size());
+    saida.flush();
+    size_t tamanho = pendente.size();
+    pendente.clear();
+    quadrosPendentes = 0;
+    if (!saida) {
+        // Final rasgado é descartado na reprodução; segue só em memória até o próximo ponto de controle
+        saida.close();
+        throw PersistenciaException("Falha ao gravar o log de alterações " + caminhoGeracao(prefixo, geracao));
+    }
+    bytesGeracao += tamanho;
+    return registros;
+}
+
+/**
+ * Fecha a geração atual e abre a próxima
+ */
+uint64_t LogAlteracoes::rotacionar() {
+    uint64_t fechada = geracao;
+    if (geracao == 0) {
+        return 0;  // Log nunca foi configurado
+    }
+    if (saida.is_open()) {
+        saida.close();
+    }
+    geracao++;
+    sequencia = 0;
+    bytesGeracao = 0;
+    abrirGeracao();  // Se falhar, isGravando() passa a ser false
+    return fechada;
+}
+
+// ==================== GETTERS ====================
+
+const string& LogAlteracoes::getPrefixo() const {
+    return prefixo;
+}
+
+uint64_t LogAlteracoes::getGeracao() const {
+    return geracao;
+}
+
+uint64_t LogAlteracoes::getBytesGeracao() const {
+    return bytesGeracao;
+}
+
+bool LogAlteracoes::isGravando() const {
+    return saida.is_open();
+}
+
+// ==================== GERAÇÕES EM DISCO ====================
+
+/**
+ * Arquivos prefixo + número + ".log", em ordem crescente de geração
+ */
+vector<uint64_t> LogAlteracoes::listarGeracoes(const string& prefixo) {
+    vector<uint64_t> geracoes;
+    filesystem::path base(prefixo);
+    filesystem::path pasta = base.parent_path().empty() ? filesystem::path(".") : base.parent_path();
+    string inicio = base.filename().string();
+    const string fim = ".log";
+
+    error_code erro;
+    for (filesystem::directory_iterator it(pasta, erro), ultimo; !erro && it != ultimo; it.increment(erro)) {
+        string nome = it->path().filename().string();
+        if (nome.size() <= inicio.size() + fim.size() || nome.compare(0, inicio.size(), inicio) != 0 ||
+            nome.compare(nome.size() - fim.size(), fim.size(), fim) != 0) {
+            continue;
+        }
+        string numero = nome.substr(inicio.size(), nome.size() - inicio.size() - fim.size());
+        if (numero.size() > 19 || numero.find_first_not_of("0123456789") != string::npos) {
+            continue;
+        }
+        geracoes.push_back(stoull(numero));
+    }
+    sort(geracoes.begin(), geracoes.end());
+    return geracoes;
+}
+
+/**
+ * Maior geração em disco
+ */
+uint64_t LogAlteracoes::ultimaGeracao(const string& prefixo) {
+    vector<uint64_t> geracoes = listarGeracoes(prefixo);
+    return geracoes.empty() ? 0 : geracoes.back();
+}
+
+/**
+ * Apaga as gerações já contidas em um estado salvo
+ */
+size_t LogAlteracoes::apagarAte(const string& prefixo, uint64_t geracao) {
+    size_t apagados = 0;
+    for (uint64_t existente : listarGeracoes(prefixo)) {
+        if (existente > geracao) {
+            break;
+        }
+        error_code erro;
+        if (filesystem::remove(caminhoGeracao(prefixo, existente), erro)) {
+            apagados++;
+        }
+    }
+    return apagados;
+}
+
+// ==================== REPRODUÇÃO ====================
+
+/**
+ * Aplica um registro (campos lidos e conferidos antes de mexer nos gerenciadores)
+ */
+bool LogAlteracoes::aplicar(uint32_t tipo, int eventoId, LeitorCampos& campos,
+                            GerenciadorEventos& eventos, int64_t agoraNs, map<int, Evento*>& tocados) {
+    if (tipo == REG_EVENTO) {
+        string nome = campos.lerTexto();
+        campos.conferirFim();
+        if (eventoId <= 0) {
+            throw PersistenciaException("ID de evento inválido no log: " + to_string(eventoId));
+        }
+        if (!eventos.eventos.count(eventoId)) {
+            eventos.eventos[eventoId] = unique_ptr<Evento>(new Evento(eventoId, nome));
+        }
+        eventos.proximoId = max(eventos.proximoId, eventoId + 1);
+        return true;
+    }
+    if (tipo == REG_EVENTO_REMOVIDO) {
+        campos.conferirFim();
+        tocados.erase(eventoId);
+        return eventos.eventos.erase(eventoId) > 0;
+    }
+
+    auto encontrado = eventos.eventos.find(eventoId);
+    if (encontrado == eventos.eventos.end()) {
+        return false;  // Evento removido depois (ou nunca registrado)
+    }
+    Evento& evento = *encontrado->second;
+    int id = campos.ler<int32_t>();
+
+    switch (tipo) {
+        case REG_ITEM: {
+            double preco = campos.ler<double>();
+            string nome = campos.lerTexto();
+            campos.conferirFim();
+            GerenciadorItens& itens = evento.getItens();
+            auto it = buscarPorId(itens.itens, id);
+            if (it != itens.itens.end()) {
+                bool precoMudou = it->getPreco() != preco;
+                it->setNome(nome);
+                it->setPreco(preco);
+                if (precoMudou) {
+                    itens.versoesPreco[id] = ++itens.ultimaVersaoPreco;
+                    evento.getListasCompras().marcarPrecoAlterado(id);
+                }
+            } else {
+                itens.itens.insert(posicaoPorId(itens.itens, id), Item(id, nome, preco));
+                itens.versoesPreco[id] = ++itens.ultimaVersaoPreco;
+            }
+            itens.proximoId = max(itens.proximoId, id + 1);
+            break;
+        }
+        case REG_ITEM_REMOVIDO: {
+            campos.conferirFim();
+            GerenciadorItens& itens = evento.getItens();
+            auto it = buscarPorId(itens.itens, id);
+            if (it != itens.itens.end()) {
+                itens.itens.erase(it);
+                itens.versoesPreco.erase(id);
+            }
+            break;
+        }
+        case REG_ARTISTA: {
+            int camarimId = campos.ler<int32_t>();
+            string nome = campos.lerTexto();
+            campos.conferirFim();
+            GerenciadorArtistas& artistas = evento.getArtistas();
+            auto it = buscarPorId(artistas.artistas, id);
+            if (it != artistas.artistas.end()) {
+                *it = Artista(id, nome, camarimId);
+            } else {
+                artistas.artistas.insert(posicaoPorId(artistas.artistas, id), Artista(id, nome, camarimId));
+            }
+            artistas.proximoId = max(artistas.proximoId, id + 1);
+            break;
+        }
+        case REG_ARTISTA_REMOVIDO: {
+            campos.conferirFim();
+            GerenciadorArtistas& artistas = evento.getArtistas();
+            auto it = buscarPorId(artistas.artistas, id);
+            if (it != artistas.artistas.end()) {
+                artistas.artistas.erase(it);
+            }
+            break;
+        }
+        case REG_CAMARIM: {
+            int artistaId = campos.ler<int32_t>();
+            Camarim novo(id, campos.lerTexto(), artistaId);
+            uint32_t numItens = campos.lerQuantidade(12);
+            for (uint32_t i = 0; i < numItens; i++) {
+                int itemId = campos.ler<int32_t>();
+                int quantidade = campos.ler<int32_t>();
+                novo.inserirItem(itemId, campos.lerTexto(), quantidade);
+            }
+            campos.conferirFim();
+            GerenciadorCamarins& camarins = evento.getCamarins();
+            auto it = buscarPorId(camarins.camarins, id);
+            if (it != camarins.camarins.end()) {
+                *it = move(novo);
+            } else {
+                camarins.camarins.insert(posicaoPorId(camarins.camarins, id), move(novo));
+            }
+            camarins.proximoId = max(camarins.proximoId, id + 1);
+            break;
+        }
+        case REG_CAMARIM_REMOVIDO: {
+            campos.conferirFim();
+            GerenciadorCamarins& camarins = evento.getCamarins();
+            auto it = buscarPorId(camarins.camarins, id);
+            if (it != camarins.camarins.end()) {
+                camarins.camarins.erase(it);
+                camarins.consumo.removerCamarim(id);
+            }
+            break;
+        }
+        case REG_ESTOQUE: {
+            bool presente = campos.ler<int32_t>() != 0;
+            int quantidade = campos.ler<int32_t>();
+            string nome = campos.lerTexto();
+            campos.conferirFim();
+            map<int, ItemEstoque>& saldos = evento.getEstoque().itens;
+            if (presente) {
+                saldos[id] = ItemEstoque(id, nome, quantidade);
+            } else {
+                saldos.erase(id);
+            }
+            break;
+        }
+        case REG_PEDIDO: {
+            Pedido novo(id, 0, "");
+            novo.camarimId = campos.ler<int32_t>();
+            novo.prioridade = campos.ler<int32_t>();
+            int flags = campos.ler<int32_t>();
+            novo.atendido = (flags & 1) != 0;
+            novo.aguardandoEstoque = (flags & 2) != 0;
+            novo.pedidoOrigemId = campos.ler<int32_t>();
+            novo.backorderId = campos.ler<int32_t>();
+            novo.criadoEm = campos.ler<int64_t>();
+            novo.ultimoItemEm = campos.ler<int64_t>();
+            novo.reservadoEm = campos.ler<int64_t>();
+            novo.atendidoEm = campos.ler<int64_t>();
+            int64_t deslocamentoNs = agoraNs - campos.ler<int64_t>();
+            novo.criadoEm = ajustarInstante(novo.criadoEm, deslocamentoNs);
+            novo.ultimoItemEm = ajustarInstante(novo.ultimoItemEm, deslocamentoNs);
+            novo.reservadoEm = ajustarInstante(novo.reservadoEm, deslocamentoNs);
+            novo.atendidoEm = ajustarInstante(novo.atendidoEm, deslocamentoNs);
+            novo.nomeArtista = campos.lerTexto();
+            uint32_t numItens = campos.lerQuantidade(16);
+            for (uint32_t i = 0; i < numItens; i++) {
+                int itemId = campos.ler<int32_t>();
+                int quantidade = campos.ler<int32_t>();
+                int atendida = campos.ler<int32_t>();
+                ItemPedido linha(itemId, campos.lerTexto(), quantidade);
+                linha.quantidadeAtendida = atendida;
+                novo.itens[itemId] = linha;
+            }
+            campos.conferirFim();
+
+            // Índice de espera e demanda saem com o estado antigo e voltam com o novo
+            GerenciadorPedidos& pedidos = evento.getPedidos();
+            auto it = buscarPorId(pedidos.pedidos, id);
+            if (it != pedidos.pedidos.end()) {
+                if (it->aguardandoEstoque) {
+                    pedidos.desindexarEspera(*it);
+                }
+                if (GerenciadorPedidos::contaDemanda(*it)) {
+                    pedidos.somarDemanda(*it, -1);
+                }
+                *it = move(novo);
+            } else {
+                it = pedidos.pedidos.insert(posicaoPorId(pedidos.pedidos, id), move(novo));
+            }
+            pedidos.prepararLatencia(it->camarimId);
+            if (it->aguardandoEstoque) {
+                pedidos.indexarEspera(*it);
+            }
+            if (GerenciadorPedidos::contaDemanda(*it)) {
+                pedidos.somarDemanda(*it, 1);
+            }
+            pedidos.proximoId = max(pedidos.proximoId, id + 1);
+            break;
+        }
+        case REG_PEDIDO_REMOVIDO: {
+            campos.conferirFim();
+            GerenciadorPedidos& pedidos = evento.getPedidos();
+            auto it = buscarPorId(pedidos.pedidos, id);
+            if (it != pedidos.pedidos.end()) {
+                if (it->aguardandoEstoque) {
+                    pedidos.desindexarEspera(*it);
+                }
+                if (GerenciadorPedidos::contaDemanda(*it)) {
+                    pedidos.somarDemanda(*it, -1);
+                }
+                pedidos.pedidos.erase(it);
+            }
+            break;
+        }
+        case REG_LISTA: {
+            string descricao = campos.lerTexto();
+            uint32_t numItens = campos.lerQuantidade(24);
+            vector<ItemCompra> linhas;
+            vector<bool> acompanha;
+            linhas.reserve(numItens);
+            for (uint32_t i = 0; i < numItens; i++) {
+                ItemCompra linha;
+                linha.itemId = campos.ler<int32_t>();
+                linha.quantidade = campos.ler<int32_t>();
+                linha.preco = campos.ler<double>();
+                acompanha.push_back(campos.ler<int32_t>() != 0);
+                linha.nomeItem = campos.lerTexto();
+                linhas.push_back(linha);
+            }
+            campos.conferirFim();
+
+            GerenciadorListaCompras& listas = evento.getListasCompras();
+            auto it = buscarPorId(listas.listas, id);
+            if (it != listas.listas.end()) {
+                it->limpar();
+                it->setDescricao(descricao);
+            } else {
+                it = listas.listas.insert(posicaoPorId(listas.listas, id), ListaCompras(id, descricao));
+                it->ligarTotalGeral(&listas.totalGeralCentavos);
+                it->ligarIndice(&listas.listasPorItem);
+                it->ligarQuantidades(&listas.quantidadesItens, &listas.observadorQuantidade);
+            }
+            for (size_t i = 0; i < linhas.size(); i++) {
+                long long versao = acompanha[i] ? evento.getItens().getVersaoPreco(linhas[i].itemId) : 0;
+                it->adicionarItem(linhas[i].itemId, linhas[i].nomeItem, linhas[i].quantidade, linhas[i].preco, versao);
+            }
+            listas.proximoId = max(listas.proximoId, id + 1);
+            break;
+        }
+        case REG_LISTA_REMOVIDA: {
+            campos.conferirFim();
+            evento.getListasCompras().remover(id);
+            break;
+        }
+        case REG_RIDER: {
+            int artistaId = campos.ler<int32_t>();
+            Rider novo(id, artistaId, campos.lerTexto());
+            uint32_t numItens = campos.lerQuantidade(12);
+            for (uint32_t i = 0; i < numItens; i++) {
+                int itemId = campos.ler<int32_t>();
+                int quantidade = campos.ler<int32_t>();
+                novo.definirItem(itemId, campos.lerTexto(), quantidade);
+            }
+            campos.conferirFim();
+            GerenciadorRiders& riders = evento.getRiders();
+            auto it = buscarPorId(riders.riders, id);
+            if (it != riders.riders.end()) {
+                *it = move(novo);
+            } else {
+                riders.riders.insert(posicaoPorId(riders.riders, id), move(novo));
+            }
+            riders.proximoId = max(riders.proximoId, id + 1);
+            break;
+        }
+        case REG_RIDER_REMOVIDO: {
+            campos.conferirFim();
+            GerenciadorRiders& riders = evento.getRiders();
+            auto it = buscarPorId(riders.riders, id);
+            if (it != riders.riders.end()) {
+                riders.riders.erase(it);
+            }
+            break;
+        }
+        case REG_MEMBRO: {
+            int funcao = campos.ler<int32_t>();
+            string nome = campos.lerTexto();
+            string atributo = campos.lerTexto();
+            campos.conferirFim();
+            GerenciadorEquipe& equipe = evento.getEquipe();
+            equipe.remover(id);  // Membro não muda de função no lugar: sai e entra de novo
+            switch ((FuncaoEquipe)funcao) {
+                case FuncaoEquipe::PRODUTOR:
+                    equipe.indiceProdutores[id] = equipe.produtores.size();
+                    equipe.produtores.emplace_back(id, nome, atributo);
+                    break;
+                case FuncaoEquipe::RUNNER:
+                    equipe.indiceRunners[id] = equipe.runners.size();
+                    equipe.runners.emplace_back(id, nome, atributo);
+                    break;
+                case FuncaoEquipe::SEGURANCA:
+                    equipe.indiceSegurancas[id] = equipe.segurancas.size();
+                    equipe.segurancas.emplace_back(id, nome, atributo);
+                    break;
+                default:
+                    throw PersistenciaException("Função de equipe desconhecida no log: " + to_string(funcao));
+            }
+            equipe.funcaoPorId[id] = (FuncaoEquipe)funcao;
+            equipe.proximoId = max(equipe.proximoId, id + 1);
+            break;
+        }
+        case REG_MEMBRO_REMOVIDO: {
+            campos.conferirFim();
+            evento.getEquipe().remover(id);
+            break;
+        }
+        case REG_RESERVA: {
+            int camarimId = campos.ler<int32_t>();
+            int artistaId = campos.ler<int32_t>();
+            int inicio = campos.ler<int32_t>();
+            int fim = campos.ler<int32_t>();
+            campos.conferirFim();
+            AgendaCamarins& agenda = evento.getAgenda();
+            agenda.cancelar(id);  // Reservas não mudam no lugar: regravar é substituir
+            Reserva reserva(id, camarimId, artistaId, inicio, fim);
+            agenda.porCamarim[camarimId][inicio] = reserva;
+            agenda.porArtista[artistaId][inicio] = reserva;
+            agenda.porId[id] = reserva;
+            agenda.proximoId = max(agenda.proximoId, id + 1);
+            break;
+        }
+        case REG_RESERVA_REMOVIDA: {
+            campos.conferirFim();
+            evento.getAgenda().cancelar(id);
+            break;
+        }
+        case REG_FORNECEDOR: {
+            string nome = campos.lerTexto();
+            uint32_t numOfertas = campos.lerQuantidade(20);
+            vector<OfertaFornecedor> ofertas;
+            ofertas.reserve(numOfertas);
+            for (uint32_t i = 0; i < numOfertas; i++) {
+                OfertaFornecedor oferta;
+                oferta.fornecedorId = id;
+                oferta.itemId = campos.ler<int32_t>();
+                oferta.precoCentavos = campos.ler<int64_t>();
+                oferta.quantidadeMinima = campos.ler<int32_t>();
+                oferta.tamanhoEmbalagem = campos.ler<int32_t>();
+                ofertas.push_back(oferta);
+            }
+            campos.conferirFim();
+
+            // Ofertas que o fornecedor não faz mais saem; as gravadas entram ou são atualizadas
+            CatalogoFornecedores& fornecedores = evento.getFornecedores();
+            fornecedores.fornecedores[id] = nome;
+            auto itens = fornecedores.itensPorFornecedor.find(id);
+            if (itens != fornecedores.itensPorFornecedor.end()) {
+                set<int> anteriores = itens->second;  // removerOferta altera o conjunto original
+                for (int itemId : anteriores) {
+                    fornecedores.removerOferta(id, itemId);
+                }
+            }
+            for (const OfertaFornecedor& oferta : ofertas) {
+                fornecedores.definirOferta(id, oferta.itemId, oferta.precoCentavos,
+                                           oferta.quantidadeMinima, oferta.tamanhoEmbalagem);
+            }
+            fornecedores.proximoId = max(fornecedores.proximoId, id + 1);
+            break;
+        }
+        case REG_FORNECEDOR_REMOVIDO: {
+            campos.conferirFim();
+            evento.getFornecedores().removerFornecedor(id);
+            break;
+        }
+        case REG_MINIMO: {
+            int minimo = campos.ler<int32_t>();
+            campos.conferirFim();
+            if (minimo > 0 && evento.getItens().buscarPorId(id) == nullptr) {
+                minimo = 0;  // Item saiu do catálogo depois (o estado salvo também descarta)
+            }
+            evento.getListaAutomatica().definirEstoqueMinimo(id, minimo);
+            break;
+        }
+        default:
+            throw PersistenciaException("Tipo de registro desconhecido no log: " + to_string(tipo));
+    }
+    tocados[eventoId] = &evento;
+    return true;
+}
+
+/**
+ * Reaplica as gerações posteriores ao estado carregado, em ordem
+ */
+ResumoReproducao LogAlteracoes::reproduzir(const string& prefixo, uint64_t geracaoEstado,
+                                           GerenciadorEventos& eventos, int64_t agoraNs) {
+    ResumoReproducao resumo;
+    map<int, Evento*> tocados;  // Eventos cujas atribuições precisam ser refeitas
+
+    for (uint64_t geracao : listarGeracoes(prefixo)) {
+        resumo.maiorGeracao = geracao;
+        if (geracao <= geracaoEstado) {
+            continue;  // Já contida no estado (apagar falhou ou não chegou a rodar)
+        }
+        ifstream entrada(caminhoGeracao(prefixo, geracao), ios::binary);
+        string dados((istreambuf_iterator<char>(entrada)), istreambuf_iterator<char>());
+        resumo.arquivos++;
+
+        CabecalhoLog cabecalho;
+        if (dados.size() < sizeof(cabecalho)) {
+            resumo.bytesDescartados += dados.size();
+            continue;
+        }
+        memcpy(&cabecalho, dados.data(), sizeof(cabecalho));
+        if (memcmp(cabecalho.assinatura, ASSINATURA_LOG, sizeof(ASSINATURA_LOG)) != 0 ||
+            cabecalho.versao != VERSAO_LOG || cabecalho.geracao != geracao) {
+            resumo.bytesDescartados += dados.size();
+            continue;
+        }
+
+        // Para no primeiro quadro incompleto, corrompido ou fora de sequência
+        size_t posicao = sizeof(cabecalho);
+        uint64_t esperada = 1;
+        while (dados.size() - posicao >= TAMANHO_PREFIXO_QUADRO) {
+            uint32_t tamanho;
+            uint32_t crc;
+            memcpy(&tamanho, dados.data() + posicao, sizeof(tamanho));
+            memcpy(&crc, dados.data() + posicao + 4, sizeof(crc));
+            size_t inicioCorpo = posicao + TAMANHO_PREFIXO_QUADRO;
+            if (tamanho < TAMANHO_INICIO_CORPO || tamanho > dados.size() - inicioCorpo) {
+                break;
+            }
+            const char* corpo = dados.data() + inicioCorpo;
+            if (crc32c(corpo, tamanho) != crc) {
+                break;
+            }
+            uint64_t sequencia;
+            uint32_t tipo;
+            int32_t eventoId;
+            memcpy(&sequencia, corpo, sizeof(sequencia));
+            memcpy(&tipo, corpo + 8, sizeof(tipo));
+            memcpy(&eventoId, corpo + 12, sizeof(eventoId));
+            if (sequencia != esperada) {
+                break;
+            }
+            LeitorCampos campos(corpo + TAMANHO_INICIO_CORPO, tamanho - TAMANHO_INICIO_CORPO);
+            try {
+                if (aplicar(tipo, eventoId, campos, eventos, agoraNs, tocados)) {
+                    resumo.registros++;
+                }
+            } catch (const ExcecaoBase&) {
+                break;  // Registro íntegro mas inaplicável: o resto da geração depende dele
+            }
+            esperada++;
+            posicao = inicioCorpo + tamanho;
+        }
+        resumo.bytesDescartados += dados.size() - posicao;
+    }
+
+    for (auto& par : tocados) {
+        Evento& evento = *par.second;
+        evento.getAtribuicoes().reconstruir(evento.getArtistas(), evento.getCamarins());
+    }
+    return resumo;
+}
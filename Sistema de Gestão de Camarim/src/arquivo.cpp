@@ -0,0 +1,520 @@
+/**
+ * @file arquivo.cpp
+ * @brief Implementação da classe ArquivoPedidos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa gravação compacta (varint) e índice de pedidos arquivados.
+ */
+
+// Inclui header da classe
+#include "arquivo.h"
+// Inclui Pedido (classe amiga: acesso aos atributos para serializar)
+#include "pedido.h"
+// Inclui o índice em disco
+#include "arvoreb.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Inclui o CRC-32C dos registros
+#include "checksum.h"
+// Para leitura e gravação de arquivos
+#include <fstream>
+// Para resize_file (descartar registro incompleto) e file_size
+#include <filesystem>
+// Para memcmp
+#include <cstring>
+// Para max
+#include <algorithm>
+
+// Identificação do formato no início do arquivo
+static const char ASSINATURA[4] = {'C', 'M', 'P', 'A'};
+static const char VERSAO_FORMATO = 2;      // 2: CRC-32C no fim de cada registro
+static const char VERSAO_SEM_CRC = 1;      // Ainda lida (e estendida no mesmo formato)
+static const uint64_t TAMANHO_CRC = 4;
+static const uint64_t TAMANHO_CABECALHO = 5;
+
+// Registro maior que isto só pode ser lixo (protege contra alocação absurda)
+static const uint64_t MAX_REGISTRO = 1 << 24;
+
+// ==================== CODIFICAÇÃO VARINT ====================
+
+/**
+ * Grava inteiro sem sinal com 7 bits por byte (bit alto = "continua")
+ */
+static void escreverVarint(string& saida, uint64_t valor) {
+    while (valor >= 0x80) {
+        saida.push_back((char)((valor & 0x7F) | 0x80));
+        valor >>= 7;
+    }
+    saida.push_back((char)valor);
+}
+
+/**
+ * Lê inteiro varint; false se os bytes acabarem antes do fim do número
+ */
+static bool lerVarint(const char*& p, const char* fim, uint64_t& valor) {
+    valor = 0;
+    for (int deslocamento = 0; deslocamento < 64 && p < fim; deslocamento += 7) {
+        uint8_t byte = (uint8_t)*p++;
+        valor |= (uint64_t)(byte & 0x7F) << deslocamento;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * ZIGZAG: números negativos pequenos também ocupam poucos bytes
+ * (0 → 0, -1 → 1, 1 → 2, -2 → 3, ...)
+ */
+static void escreverInteiro(string& saida, int64_t valor) {
+    escreverVarint(saida, ((uint64_t)valor << 1) ^ (uint64_t)(valor >> 63));
+}
+
+static bool lerInteiro(const char*& p, const char* fim, int64_t& valor) {
+    uint64_t bruto;
+    if (!lerVarint(p, fim, bruto)) {
+        return false;
+    }
+    valor = (int64_t)(bruto >> 1) ^ -(int64_t)(bruto & 1);
+    return true;
+}
+
+/**
+ * Texto = tamanho (varint) + bytes
+ */
+static void escreverTexto(string& saida, const string& texto) {
+    escreverVarint(saida, texto.size());
+    saida.append(texto);
+}
+
+static bool lerTexto(const char*& p, const char* fim, string& texto) {
+    uint64_t tamanho;
+    if (!lerVarint(p, fim, tamanho) || tamanho > (uint64_t)(fim - p)) {
+        return false;
+    }
+    texto.assign(p, (size_t)tamanho);
+    p += tamanho;
+    return true;
+}
+
+/**
+ * CRC-32C do registro: 4 bytes, byte menos significativo primeiro
+ */
+static void escreverCrc(string& saida, uint32_t crc) {
+    for (int i = 0; i < 4; i++) {
+        saida.push_back((char)((crc >> (8 * i)) & 0xFF));
+    }
+}
+
+static uint32_t lerCrc(const char* p) {
+    uint32_t crc = 0;
+    for (int i = 0; i < 4; i++) {
+        crc |= (uint32_t)(uint8_t)p[i] << (8 * i);
+    }
+    return crc;
+}
+
+/**
+ * Timestamp relativo à criação (0 = evento não ocorreu)
+ */
+static int64_t relativo(int64_t instante, int64_t criadoEm) {
+    return instante == 0 ? 0 : instante - criadoEm + 1;
+}
+
+static int64_t absoluto(int64_t relativo, int64_t criadoEm) {
+    return relativo == 0 ? 0 : relativo + criadoEm - 1;
+}
+
+// ==================== Classe ArquivoPedidos ====================
+
+/**
+ * Construtor - abre (ou cria) arquivo e índice
+ */
+ArquivoPedidos::ArquivoPedidos(const string& caminho, size_t bytesCacheIndice)
+    : caminho(caminho), bytesCacheIndice(bytesCacheIndice), tamanhoBytes(0),
+      versao(VERSAO_FORMATO), registrosCorrompidos(0) {
+    carregarIndice();
+}
+
+/**
+ * Destrutor - o índice já foi sincronizado a cada lote
+ */
+ArquivoPedidos::~ArquivoPedidos() = default;
+
+/**
+ * Abre o índice e percorre só os registros que ele ainda não cobre
+ */
+void ArquivoPedidos::carregarIndice() {
+    string caminhoIndice = caminho + ".idx";
+    error_code erro;
+    uint64_t tamanhoArquivo;
+
+    ifstream entrada(caminho, ios::binary);
+    if (!entrada.is_open()) {
+        // Arquivo ainda não existe: cria só com o cabeçalho
+        ofstream novo(caminho, ios::binary);
+        if (!novo.is_open()) {
+            throw PersistenciaException("Não foi possível criar o arquivo " + caminho);
+        }
+        novo.write(ASSINATURA, sizeof(ASSINATURA));
+        novo.put(VERSAO_FORMATO);
+        versao = VERSAO_FORMATO;
+        if (!novo.flush()) {
+            throw PersistenciaException("Falha ao gravar cabeçalho em " + caminho);
+        }
+        filesystem::remove(caminhoIndice, erro);  // Índice de outro arquivo não vale para este
+        tamanhoArquivo = TAMANHO_CABECALHO;
+    } else {
+        char cabecalho[TAMANHO_CABECALHO];
+        if (!entrada.read(cabecalho, TAMANHO_CABECALHO) ||
+            memcmp(cabecalho, ASSINATURA, sizeof(ASSINATURA)) != 0) {
+            throw PersistenciaException("Arquivo " + caminho + " não é um arquivo de pedidos");
+        }
+        versao = cabecalho[sizeof(ASSINATURA)];
+        if (versao != VERSAO_FORMATO && versao != VERSAO_SEM_CRC) {
+            throw PersistenciaException("Versão de formato desconhecida em " + caminho);
+        }
+        tamanhoArquivo = filesystem::file_size(caminho);
+    }
+
+    try {
+        indice.reset(new ArvoreBMais(caminhoIndice, bytesCacheIndice));
+        if (indice->getMarca() > tamanhoArquivo) {
+            throw PersistenciaException("Índice " + caminhoIndice + " cobre dados que não existem");
+        }
+    } catch (const PersistenciaException&) {
+        // Índice inválido ou interrompido: refeito a partir dos dados
+        indice.reset();
+        filesystem::remove(caminhoIndice, erro);
+        indice.reset(new ArvoreBMais(caminhoIndice, bytesCacheIndice));
+    }
+
+    // Registros depois da marca: lidos em blocos (memória limitada ao bloco)
+    const size_t TAMANHO_BLOCO = 1 << 20;
+    uint64_t inicioBloco = max(indice->getMarca(), TAMANHO_CABECALHO);  // Posição de dados[0]
+    string dados;
+    size_t consumido = 0;
+    bool fimArquivo = inicioBloco >= tamanhoArquivo;
+    entrada.clear();
+    entrada.seekg((streamoff)inicioBloco);
+
+    // O tamanho fica fora do CRC: depois de um registro estragado a leitura
+    // procura, byte a byte, o próximo registro com CRC certo (ressincroniza)
+    bool ressincronizando = false;
+    bool danoNoFinal = false;  // Registro estragado ia até o fim do arquivo
+    bool parado = false;       // Versão sem CRC: não há como achar o próximo registro
+    uint64_t inicioDano = 0;
+
+    // Registro que não vale: no final é gravação interrompida, no meio é dano
+    auto descartar = [&](bool ateFimArquivo) {
+        if (!ressincronizando) {
+            ressincronizando = true;
+            danoNoFinal = ateFimArquivo;
+            inicioDano = inicioBloco + consumido;
+        }
+        consumido++;
+    };
+
+    while (!(fimArquivo && consumido == dados.size())) {
+        const char* inicioRegistro = dados.data() + consumido;
+        const char* fim = dados.data() + dados.size();
+        const char* p = inicioRegistro;
+        uint64_t tamanho = 0;
+        bool legivel = lerVarint(p, fim, tamanho) && tamanho <= MAX_REGISTRO;
+        bool completo = legivel && tamanho <= (uint64_t)(fim - p);
+        bool ateFimArquivo = fimArquivo && (legivel || p == fim);  // Faltam bytes, não é lixo
+
+        if (!completo && !fimArquivo && (legivel || p == fim)) {
+            // Registro continua no próximo bloco
+            dados.erase(0, consumido);
+            inicioBloco += consumido;
+            consumido = 0;
+            size_t antes = dados.size();
+            dados.resize(antes + TAMANHO_BLOCO);
+            entrada.read(&dados[antes], (streamsize)TAMANHO_BLOCO);
+            size_t lidos = (size_t)entrada.gcount();
+            dados.resize(antes + lidos);
+            fimArquivo = lidos < TAMANHO_BLOCO;
+            continue;
+        }
+
+        if (versao == VERSAO_SEM_CRC) {
+            if (!completo) {
+                if (ateFimArquivo) {
+                    break;  // Registro incompleto: gravação interrompida
+                }
+                registrosCorrompidos++;  // Tamanho ilegível no meio: o resto fica sem índice
+                parado = true;
+                break;
+            }
+        } else {
+            if (!completo) {
+                descartar(ateFimArquivo);
+                continue;
+            }
+            if (tamanho <= TAMANHO_CRC || lerCrc(p + tamanho - TAMANHO_CRC) != crc32c(p, tamanho - TAMANHO_CRC)) {
+                descartar(fimArquivo && p + tamanho == fim);
+                continue;
+            }
+            tamanho -= TAMANHO_CRC;
+        }
+        const char* proximo = p + tamanho + (versao == VERSAO_SEM_CRC ? 0 : TAMANHO_CRC);
+
+        // Só o ID é necessário para o índice (primeiro campo do registro)
+        const char* campo = p;
+        int64_t id;
+        if (!lerInteiro(campo, p + tamanho, id)) {
+            if (ressincronizando) {
+                descartar(false);  // CRC certo por acaso no meio do lixo: continua procurando
+                continue;
+            }
+            consumido = (size_t)(proximo - dados.data());  // ID ilegível: fica fora do índice
+            registrosCorrompidos++;
+            continue;
+        }
+        if (ressincronizando) {
+            ressincronizando = false;  // Achou o próximo registro: o trecho estragado conta como um
+            registrosCorrompidos++;
+        }
+        indice->inserir(id, inicioBloco + consumido);  // Registro mais recente vence
+        consumido = (size_t)(proximo - dados.data());
+    }
+    entrada.close();
+
+    if (ressincronizando && danoNoFinal) {
+        tamanhoBytes = inicioDano;  // Nenhum registro depois do último: gravação interrompida
+    } else if (ressincronizando || parado) {
+        if (ressincronizando) {
+            registrosCorrompidos++;
+        }
+        tamanhoBytes = tamanhoArquivo;  // Dano no meio: arquivo fica como está
+    } else {
+        tamanhoBytes = inicioBloco + consumido;
+    }
+    if (tamanhoBytes < tamanhoArquivo) {
+        // Descarta o final incompleto para que novos registros fiquem alinhados
+        filesystem::resize_file(caminho, tamanhoBytes);
+    }
+    indice->sincronizar(tamanhoBytes);
+}
+
+/**
+ * Serializa pedido (campos na ordem fixa do formato)
+ */
+void ArquivoPedidos::codificar(const Pedido& pedido, string& saida) {
+    escreverInteiro(saida, pedido.id);  // SEMPRE o primeiro campo (usado pelo índice)
+    escreverInteiro(saida, pedido.camarimId);
+    escreverTexto(saida, pedido.nomeArtista);
+    saida.push_back((char)((pedido.atendido ? 1 : 0) | (pedido.aguardandoEstoque ? 2 : 0)));
+    escreverInteiro(saida, pedido.prioridade);
+    escreverInteiro(saida, pedido.pedidoOrigemId);
+    escreverInteiro(saida, pedido.backorderId);
+
+    // Timestamps: criação absoluta, demais relativos (cabem em poucos bytes)
+    escreverInteiro(saida, pedido.criadoEm);
+    escreverInteiro(saida, relativo(pedido.ultimoItemEm, pedido.criadoEm));
+    escreverInteiro(saida, relativo(pedido.reservadoEm, pedido.criadoEm));
+    escreverInteiro(saida, relativo(pedido.atendidoEm, pedido.criadoEm));
+
+    escreverVarint(saida, pedido.itens.size());
+    for (const auto& par : pedido.itens) {
+        const ItemPedido& item = par.second;
+        escreverInteiro(saida, item.itemId);
+        escreverTexto(saida, item.nomeItem);
+        escreverInteiro(saida, item.quantidade);
+        escreverInteiro(saida, item.quantidadeAtendida);
+    }
+}
+
+/**
+ * Reconstrói pedido a partir do registro
+ */
+bool ArquivoPedidos::decodificar(const char* p, const char* fim, Pedido& pedido) {
+    int64_t id, camarimId, prioridade, origem, backorder;
+    int64_t criadoEm, ultimoItem, reservado, atendido;
+    string nomeArtista;
+
+    if (!lerInteiro(p, fim, id) || !lerInteiro(p, fim, camarimId) ||
+        !lerTexto(p, fim, nomeArtista) || p >= fim) {
+        return false;
+    }
+    uint8_t flags = (uint8_t)*p++;
+    if (!lerInteiro(p, fim, prioridade) || !lerInteiro(p, fim, origem) ||
+        !lerInteiro(p, fim, backorder) || !lerInteiro(p, fim, criadoEm) ||
+        !lerInteiro(p, fim, ultimoItem) || !lerInteiro(p, fim, reservado) ||
+        !lerInteiro(p, fim, atendido)) {
+        return false;
+    }
+
+    pedido = Pedido((int)id, (int)camarimId, nomeArtista);
+    pedido.atendido = (flags & 1) != 0;
+    pedido.aguardandoEstoque = (flags & 2) != 0;
+    pedido.prioridade = (int)prioridade;
+    pedido.pedidoOrigemId = (int)origem;
+    pedido.backorderId = (int)backorder;
+    pedido.criadoEm = criadoEm;
+    pedido.ultimoItemEm = absoluto(ultimoItem, criadoEm);
+    pedido.reservadoEm = absoluto(reservado, criadoEm);
+    pedido.atendidoEm = absoluto(atendido, criadoEm);
+
+    uint64_t numItens;
+    if (!lerVarint(p, fim, numItens)) {
+        return false;
+    }
+    for (uint64_t i = 0; i < numItens; i++) {
+        int64_t itemId, quantidade, entregue;
+        string nomeItem;
+        if (!lerInteiro(p, fim, itemId) || !lerTexto(p, fim, nomeItem) ||
+            !lerInteiro(p, fim, quantidade) || !lerInteiro(p, fim, entregue)) {
+            return false;
+        }
+        ItemPedido item((int)itemId, nomeItem, (int)quantidade);
+        item.quantidadeAtendida = (int)entregue;
+        pedido.itens[item.itemId] = item;
+    }
+    return p == fim;  // Sobra de bytes também indica registro corrompido
+}
+
+/**
+ * Acrescenta lote ao final do arquivo (append-only)
+ */
+void ArquivoPedidos::anexar(const vector<const Pedido*>& pedidos) {
+    if (pedidos.empty()) {
+        return;
+    }
+
+    // Monta o lote inteiro em memória: uma única escrita no disco
+    string lote;
+    string registro;
+    vector<pair<int, uint64_t>> posicoes;  // Entradas do índice, aplicadas após gravar
+    posicoes.reserve(pedidos.size());
+
+    for (const Pedido* pedido : pedidos) {
+        registro.clear();
+        codificar(*pedido, registro);
+        if (versao != VERSAO_SEM_CRC) {
+            escreverCrc(registro, crc32c(registro.data(), registro.size()));
+        }
+        posicoes.emplace_back(pedido->getId(), tamanhoBytes + lote.size());
+        escreverVarint(lote, registro.size());
+        lote.append(registro);
+    }
+
+    ofstream saida(caminho, ios::binary | ios::app);
+    if (!saida.is_open()) {
+        throw PersistenciaException("Não foi possível abrir " + caminho);
+    }
+    saida.write(lote.data(), (streamsize)lote.size());
+    if (!saida.flush()) {
+        throw PersistenciaException("Falha ao gravar pedidos em " + caminho);
+    }
+
+    // Gravação confirmada: agora o índice pode apontar para os registros
+    tamanhoBytes += lote.size();
+    for (const auto& par : posicoes) {
+        indice->inserir(par.first, par.second);
+    }
+    indice->sincronizar(tamanhoBytes);
+}
+
+/**
+ * Lê o registro de uma posição (varint do tamanho + conteúdo)
+ */
+void ArquivoPedidos::lerRegistro(ifstream& entrada, uint64_t posicao, int id, Pedido& pedido) const {
+    entrada.clear();
+    entrada.seekg((streamoff)posicao);
+
+    // Tamanho do registro: varint lido byte a byte
+    uint64_t tamanho = 0;
+    int deslocamento = 0;
+    char byte;
+    while (entrada.get(byte)) {
+        tamanho |= (uint64_t)((uint8_t)byte & 0x7F) << deslocamento;
+        if (((uint8_t)byte & 0x80) == 0) {
+            break;
+        }
+        deslocamento += 7;
+    }
+    if (!entrada || tamanho > MAX_REGISTRO) {
+        throw PersistenciaException("Registro do pedido " + to_string(id) + " corrompido");
+    }
+
+    string registro((size_t)tamanho, '\0');
+    if (!entrada.read(&registro[0], (streamsize)tamanho)) {
+        throw PersistenciaException("Registro do pedido " + to_string(id) + " corrompido");
+    }
+    if (versao != VERSAO_SEM_CRC) {
+        if (tamanho < TAMANHO_CRC ||
+            lerCrc(registro.data() + tamanho - TAMANHO_CRC) != crc32c(registro.data(), tamanho - TAMANHO_CRC)) {
+            throw PersistenciaException("Registro do pedido " + to_string(id) + " corrompido (CRC)");
+        }
+        registro.resize((size_t)(tamanho - TAMANHO_CRC));
+    }
+    if (!decodificar(registro.data(), registro.data() + registro.size(), pedido)) {
+        throw PersistenciaException("Registro do pedido " + to_string(id) + " corrompido");
+    }
+}
+
+/**
+ * Busca pedido arquivado (índice → seek direto pela posição)
+ */
+bool ArquivoPedidos::buscar(int id, Pedido& pedido) const {
+    uint64_t posicao;
+    if (!indice->buscar(id, posicao)) {
+        return false;
+    }
+
+    ifstream entrada(caminho, ios::binary);
+    if (!entrada.is_open()) {
+        throw PersistenciaException("Não foi possível abrir " + caminho);
+    }
+    lerRegistro(entrada, posicao, id, pedido);
+    return true;
+}
+
+/**
+ * Percorre a faixa em ordem de ID (folhas do índice, um registro por vez)
+ */
+size_t ArquivoPedidos::percorrerFaixa(int idInicio, int idFim,
+                                      const function<bool(const Pedido&)>& visitante) const {
+    ifstream entrada(caminho, ios::binary);
+    if (!entrada.is_open()) {
+        throw PersistenciaException("Não foi possível abrir " + caminho);
+    }
+
+    Pedido pedido;
+    return indice->percorrer(idInicio, idFim, [&](int64_t id, uint64_t posicao) {
+        lerRegistro(entrada, posicao, (int)id, pedido);
+        return visitante(pedido);
+    });
+}
+
+// ==================== GETTERS ====================
+
+bool ArquivoPedidos::contem(int id) const {
+    uint64_t posicao;
+    return indice->buscar(id, posicao);
+}
+
+size_t ArquivoPedidos::quantidade() const {
+    return (size_t)indice->getQuantidade();
+}
+
+uint64_t ArquivoPedidos::getTamanhoBytes() const {
+    return tamanhoBytes;
+}
+
+size_t ArquivoPedidos::getRegistrosCorrompidos() const {
+    return registrosCorrompidos;
+}
+
+int ArquivoPedidos::getMaiorId() const {
+    return (int)indice->getMaiorChave();
+}
+
+string ArquivoPedidos::getCaminho() const {
+    return caminho;
+}
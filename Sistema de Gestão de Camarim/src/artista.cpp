@@ -18,14 +18,14 @@
 // ==================== Classe Artista ====================
 
 // Construtor padrão - Inicializa artista com valores padrão
-Artista::Artista() : Pessoa(), camarimId(0) {}  
+Artista::Artista() : Pessoa(), camarimId(0), alterados(nullptr) {}  
 // Pessoa() = chama construtor padrão da classe BASE (inicializa id=0, nome="")
 // camarimId(0) = inicializa atributo específico da classe DERIVADA
 // HERANÇA: construtor da classe filha DEVE chamar construtor da classe pai
 
 // Construtor parametrizado - Recebe todos os valores necessários
 Artista::Artista(int id, const string& nome, int camarimId)
-    : Pessoa(id, nome), camarimId(camarimId) {}  
+    : Pessoa(id, nome), camarimId(camarimId), alterados(nullptr) {}  
 // Pessoa(id, nome) = chama construtor parametrizado da classe BASE
 // Passa id e nome para a classe pai inicializar seus atributos
 // camarimId(camarimId) = inicializa atributo adicional da classe DERIVADA
@@ -48,6 +48,13 @@ void Artista::setCamarimId(int camarimId) {
         throw ValidacaoException("ID de camarim inválido");
     }
     this->camarimId = camarimId;  // Atribui novo valor se válido
+    if (alterados != nullptr) {
+        alterados->push_back(id);  // Atribuição de camarim também vai para o log
+    }
+}
+
+void Artista::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
 }
 
 // POLIMORFISMO: Implementação do método virtual puro da classe base
@@ -63,26 +70,26 @@ string Artista::exibir() const {
 // ==================== Classe GerenciadorArtistas ====================
 
 // Construtor - Inicializa o gerenciador
-GerenciadorArtistas::GerenciadorArtistas() : proximoId(1) {}  
+GerenciadorArtistas::GerenciadorArtistas() : proximoId(1), alterados(nullptr) {}  
 // proximoId(1) = primeiro artista terá ID = 1
 // Vetor 'artistas' é inicializado automaticamente vazio
 
 // Cadastra novo artista no sistema (CREATE)
-int GerenciadorArtistas::cadastrar(const string& nome, int camarimId) {
+int GerenciadorArtistas::cadastrar(const string& nome) {
     // ========== VALIDAÇÕES ==========
     
     if (nome.empty()) {  // Verifica se nome não está vazio
         throw ValidacaoException("Nome do artista não pode ser vazio");
     }
     
-    if (camarimId < 0) {  // Verifica se camarimId é válido
-        throw ValidacaoException("ID de camarim inválido");
-    }
-    
     // ========== CADASTRO ==========
     
-    Artista novoArtista(proximoId, nome, camarimId);  // Cria novo objeto Artista
+    Artista novoArtista(proximoId, nome, 0);  // Cria novo objeto Artista (sem camarim)
+    novoArtista.ligarAlteracoes(alterados);
     artistas.push_back(novoArtista);  // Adiciona ao vetor (no final)
+    if (alterados != nullptr) {
+        alterados->push_back(proximoId);
+    }
     
     return proximoId++;  // Retorna ID usado e incrementa para próximo
 }
@@ -125,6 +132,9 @@ bool GerenciadorArtistas::remover(int id) {
     
     if (it != artistas.end()) {  // Se encontrou artista para remover
         artistas.erase(it, artistas.end());  // Remove efetivamente do vetor
+        if (alterados != nullptr) {
+            alterados->push_back(id);  // Ausente na confirmação = removido
+        }
         return true;  // Retorna sucesso
     }
     return false;  // Se não encontrou, retorna falha
@@ -136,8 +146,13 @@ vector<Artista> GerenciadorArtistas::listar() const {
     // const = não modifica o estado do gerenciador
 }
 
+// Todos os artistas por referência (percursos de leitura, sem cópia)
+const vector<Artista>& GerenciadorArtistas::getArtistas() const {
+    return artistas;
+}
+
 // Atualiza dados de um artista existente (UPDATE)
-bool GerenciadorArtistas::atualizar(int id, const string& nome, int camarimId) {
+bool GerenciadorArtistas::atualizar(int id, const string& nome) {
     // Busca o artista pelo ID
     Artista* artista = buscarPorId(id);  // Recebe ponteiro para o artista
     
@@ -149,7 +164,17 @@ bool GerenciadorArtistas::atualizar(int id, const string& nome, int camarimId) {
     // Atualiza os dados usando setters (que fazem validação)
     artista->setNome(nome);  // Atualiza nome via ponteiro
     // -> = operador de acesso a membro via ponteiro
-    artista->setCamarimId(camarimId);  // Atualiza camarimId via ponteiro
+    if (alterados != nullptr) {
+        alterados->push_back(id);  // Nome não passa pelo setter do artista
+    }
     
     return true;  // Retorna true indicando sucesso
 }
+
+// Liga log de alterações ao gerenciador e aos artistas já cadastrados
+void GerenciadorArtistas::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+    for (auto& artista : artistas) {
+        artista.ligarAlteracoes(alterados);
+    }
+}
@@ -0,0 +1,570 @@
+/**
+ * @file arvoreb.cpp
+ * @brief Implementação da classe ArvoreBMais
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Páginas de tamanho fixo, cache com o algoritmo do relógio e inserção
+ * com divisão de páginas de baixo para cima.
+ */
+
+// Inclui header da classe
+#include "arvoreb.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Inclui o CRC-32C das páginas
+#include "checksum.h"
+// Para memcpy/memmove/memset
+#include <cstring>
+// Para lower_bound/upper_bound
+#include <algorithm>
+// Para file_size
+#include <filesystem>
+
+// Identificação do formato no início do arquivo
+static const char ASSINATURA[4] = {'C', 'M', 'P', 'B'};
+static const uint32_t VERSAO_FORMATO = 2;  // 2: CRC em cada página e no cabeçalho
+
+static const uint32_t TAMANHO_PAGINA = 4096;
+static const uint16_t TIPO_FOLHA = 1;
+static const uint16_t TIPO_INTERNA = 2;
+static const size_t CAPACIDADE_FOLHA = 255;    // (4096 - 16) / (8 + 8)
+static const size_t CAPACIDADE_INTERNA = 339;  // (4096 - 16 - 4) / (8 + 4)
+static const size_t MINIMO_QUADROS = 16;       // Caminho raiz -> folha + divisões sempre cabem
+
+/**
+ * @struct CabecalhoPagina
+ * @brief Início de toda página de dados (16 bytes)
+ */
+struct CabecalhoPagina {
+    uint16_t tipo;        // TIPO_FOLHA ou TIPO_INTERNA
+    uint16_t quantidade;  // Chaves na página
+    uint32_t proxima;     // Folha: próxima folha (0 = última)
+    uint32_t crc;         // CRC-32C da página inteira com este campo zerado
+    uint32_t reservado;
+};
+
+/**
+ * @union ArvoreBMais::Pagina
+ * @brief Uma página como bytes, folha ou página interna
+ */
+union ArvoreBMais::Pagina {
+    char bytes[TAMANHO_PAGINA];
+    struct {
+        CabecalhoPagina cabecalho;
+        int64_t chaves[CAPACIDADE_FOLHA];
+        uint64_t valores[CAPACIDADE_FOLHA];
+    } folha;
+    struct {
+        CabecalhoPagina cabecalho;
+        int64_t chaves[CAPACIDADE_INTERNA];
+        uint32_t filhos[CAPACIDADE_INTERNA + 1];  // filhos[i] < chaves[i] <= filhos[i + 1]
+    } interna;
+};
+
+/**
+ * @struct CabecalhoArquivo
+ * @brief Conteúdo da página 0
+ */
+struct CabecalhoArquivo {
+    char assinatura[4];
+    uint32_t versao;
+    uint32_t tamanhoPagina;
+    uint32_t raiz;
+    uint32_t numPaginas;
+    uint32_t altura;
+    uint32_t limpo;        // 0 = alteração em andamento (páginas podem estar pela metade)
+    uint32_t crc;          // CRC-32C do cabeçalho com este campo zerado
+    uint64_t quantidade;
+    int64_t maiorChave;
+    uint64_t marca;
+};
+
+// ==================== Classe ArvoreBMais ====================
+
+/**
+ * Construtor - cria o arquivo (cabeçalho + folha raiz vazia) ou valida o existente
+ */
+ArvoreBMais::ArvoreBMais(const string& caminho, size_t bytesCache)
+    : caminho(caminho), ponteiroRelogio(0), raiz(1), numPaginas(2), altura(1),
+      quantidade(0), maiorChave(0), marca(0), emAlteracao(false), acertos(0), faltas(0) {
+    static_assert(sizeof(Pagina) == TAMANHO_PAGINA, "Página deve ter 4 KB");
+
+    size_t numQuadros = max(MINIMO_QUADROS, bytesCache / TAMANHO_PAGINA);
+    paginas.resize(numQuadros);
+    quadros.assign(numQuadros, Quadro{0, false, false, 0});
+    residentes.reserve(numQuadros);
+
+    error_code erro;
+    uintmax_t tamanhoArquivo = filesystem::file_size(caminho, erro);
+
+    if (erro || tamanhoArquivo == 0) {
+        arquivo.open(caminho, ios::in | ios::out | ios::binary | ios::trunc);
+        if (!arquivo.is_open()) {
+            throw PersistenciaException("Não foi possível criar o índice " + caminho);
+        }
+        Pagina& pagina = paginas[0];  // Cache ainda vazio: quadro usado como rascunho
+        gravarPagina(0, pagina);      // Reserva a página do cabeçalho
+        pagina.folha.cabecalho.tipo = TIPO_FOLHA;
+        gravarPagina(1, pagina);
+        memset(pagina.bytes, 0, TAMANHO_PAGINA);
+        gravarCabecalho(true);
+        return;
+    }
+
+    arquivo.open(caminho, ios::in | ios::out | ios::binary);
+    if (!arquivo.is_open()) {
+        throw PersistenciaException("Não foi possível abrir o índice " + caminho);
+    }
+
+    CabecalhoArquivo cabecalho;
+    uint32_t crcLido = 0;
+    if (arquivo.read(reinterpret_cast<char*>(&cabecalho), sizeof(cabecalho))) {
+        crcLido = cabecalho.crc;
+        cabecalho.crc = 0;
+    }
+    if (!arquivo || crcLido != crc32c(&cabecalho, sizeof(cabecalho)) ||
+        memcmp(cabecalho.assinatura, ASSINATURA, sizeof(ASSINATURA)) != 0 ||
+        cabecalho.versao != VERSAO_FORMATO || cabecalho.tamanhoPagina != TAMANHO_PAGINA ||
+        cabecalho.numPaginas < 2 || cabecalho.raiz == 0 || cabecalho.raiz >= cabecalho.numPaginas ||
+        cabecalho.altura == 0 || (uintmax_t)cabecalho.numPaginas * TAMANHO_PAGINA > tamanhoArquivo) {
+        throw PersistenciaException("Arquivo " + caminho + " não é um índice válido");
+    }
+    if (!cabecalho.limpo) {
+        throw PersistenciaException("Índice " + caminho + " não foi fechado corretamente");
+    }
+
+    raiz = cabecalho.raiz;
+    numPaginas = cabecalho.numPaginas;
+    altura = cabecalho.altura;
+    quantidade = cabecalho.quantidade;
+    maiorChave = cabecalho.maiorChave;
+    marca = cabecalho.marca;
+}
+
+/**
+ * Destrutor - fstream fecha sozinho (Pagina precisa estar completa aqui)
+ */
+ArvoreBMais::~ArvoreBMais() = default;
+
+// ==================== DISCO ====================
+
+void ArvoreBMais::gravarCabecalho(bool limpo) {
+    CabecalhoArquivo cabecalho;
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.assinatura, ASSINATURA, sizeof(ASSINATURA));
+    cabecalho.versao = VERSAO_FORMATO;
+    cabecalho.tamanhoPagina = TAMANHO_PAGINA;
+    cabecalho.raiz = raiz;
+    cabecalho.numPaginas = numPaginas;
+    cabecalho.altura = altura;
+    cabecalho.limpo = limpo ? 1 : 0;
+    cabecalho.quantidade = quantidade;
+    cabecalho.maiorChave = maiorChave;
+    cabecalho.marca = marca;
+    cabecalho.crc = crc32c(&cabecalho, sizeof(cabecalho));
+
+    arquivo.clear();
+    arquivo.seekp(0);
+    arquivo.write(reinterpret_cast<const char*>(&cabecalho), sizeof(cabecalho));
+    if (!arquivo.flush()) {
+        throw PersistenciaException("Falha ao gravar cabeçalho em " + caminho);
+    }
+}
+
+void ArvoreBMais::iniciarAlteracao() {
+    if (!emAlteracao) {
+        gravarCabecalho(false);  // Antes de qualquer página: queda daqui em diante é detectada
+        emAlteracao = true;
+    }
+}
+
+void ArvoreBMais::lerPagina(uint32_t numero, Pagina& destino) {
+    arquivo.clear();
+    arquivo.seekg((streamoff)numero * TAMANHO_PAGINA);
+    if (!arquivo.read(destino.bytes, TAMANHO_PAGINA)) {
+        throw PersistenciaException("Falha ao ler página " + to_string(numero) + " de " + caminho);
+    }
+}
+
+void ArvoreBMais::gravarPagina(uint32_t numero, Pagina& origem) {
+    origem.folha.cabecalho.crc = 0;
+    origem.folha.cabecalho.crc = crc32c(origem.bytes, TAMANHO_PAGINA);
+    arquivo.clear();
+    arquivo.seekp((streamoff)numero * TAMANHO_PAGINA);
+    if (!arquivo.write(origem.bytes, TAMANHO_PAGINA)) {
+        throw PersistenciaException("Falha ao gravar página " + to_string(numero) + " em " + caminho);
+    }
+}
+
+// ==================== CACHE ====================
+
+/**
+ * RELÓGIO: página usada desde a última volta ganha mais uma volta
+ */
+size_t ArvoreBMais::liberarQuadro() {
+    for (size_t passo = 0; passo < 2 * quadros.size(); passo++) {
+        size_t i = ponteiroRelogio;
+        ponteiroRelogio = (ponteiroRelogio + 1) % quadros.size();
+
+        Quadro& quadro = quadros[i];
+        if (quadro.fixacoes > 0) {
+            continue;
+        }
+        if (quadro.pagina == 0) {
+            return i;  // Quadro nunca usado
+        }
+        if (quadro.usado) {
+            quadro.usado = false;
+            continue;
+        }
+        if (quadro.sujo) {
+            gravarPagina(quadro.pagina, paginas[i]);
+            quadro.sujo = false;
+        }
+        residentes.erase(quadro.pagina);
+        quadro.pagina = 0;
+        return i;
+    }
+    throw PersistenciaException("Cache do índice " + caminho + " sem quadros livres");
+}
+
+size_t ArvoreBMais::fixar(uint32_t numero) {
+    size_t i;
+    auto it = residentes.find(numero);
+    if (it != residentes.end()) {
+        i = it->second;
+        acertos++;
+    } else {
+        if (numero == 0 || numero >= numPaginas) {
+            throw PersistenciaException("Índice " + caminho + " corrompido (página " +
+                                        to_string(numero) + " inexistente)");
+        }
+        i = liberarQuadro();
+        lerPagina(numero, paginas[i]);
+
+        CabecalhoPagina& cabecalho = paginas[i].folha.cabecalho;
+        uint32_t crcLido = cabecalho.crc;
+        cabecalho.crc = 0;
+        if (crcLido != crc32c(paginas[i].bytes, TAMANHO_PAGINA)) {
+            throw PersistenciaException("Índice " + caminho + " corrompido (CRC da página " +
+                                        to_string(numero) + ")");
+        }
+        if ((cabecalho.tipo != TIPO_FOLHA || cabecalho.quantidade > CAPACIDADE_FOLHA) &&
+            (cabecalho.tipo != TIPO_INTERNA || cabecalho.quantidade > CAPACIDADE_INTERNA)) {
+            throw PersistenciaException("Índice " + caminho + " corrompido (página " +
+                                        to_string(numero) + ")");
+        }
+        quadros[i] = Quadro{numero, false, false, 0};
+        residentes[numero] = i;
+        faltas++;
+    }
+    quadros[i].usado = true;
+    quadros[i].fixacoes++;
+    return i;
+}
+
+size_t ArvoreBMais::criarPagina(uint32_t& numero) {
+    size_t i = liberarQuadro();
+    numero = numPaginas++;
+    memset(paginas[i].bytes, 0, TAMANHO_PAGINA);
+    quadros[i] = Quadro{numero, true, true, 1};
+    residentes[numero] = i;
+    return i;
+}
+
+void ArvoreBMais::soltar(size_t quadro, bool sujo) {
+    quadros[quadro].fixacoes--;
+    if (sujo) {
+        quadros[quadro].sujo = true;
+    }
+}
+
+void ArvoreBMais::soltarTodas() {
+    for (Quadro& quadro : quadros) {
+        quadro.fixacoes = 0;
+    }
+}
+
+// ==================== INSERÇÃO ====================
+
+bool ArvoreBMais::inserirEm(uint32_t numero, int64_t chave, uint64_t valor, bool naBorda,
+                            bool& dividiu, int64_t& separador, uint32_t& nova) {
+    dividiu = false;
+    size_t q = fixar(numero);
+
+    if (paginas[q].folha.cabecalho.tipo == TIPO_FOLHA) {
+        auto& folha = paginas[q].folha;
+        size_t n = folha.cabecalho.quantidade;
+        size_t pos = lower_bound(folha.chaves, folha.chaves + n, chave) - folha.chaves;
+
+        if (pos < n && folha.chaves[pos] == chave) {
+            folha.valores[pos] = valor;
+            soltar(q, true);
+            return false;
+        }
+
+        auto* destino = &folha;
+        if (n == CAPACIDADE_FOLHA) {
+            // Cheia: no fim da última folha a esquerda fica cheia, senão divide ao meio
+            size_t corte = (pos == n && folha.cabecalho.proxima == 0) ? n : n / 2;
+            size_t qNova = criarPagina(nova);
+            auto& direita = paginas[qNova].folha;
+
+            direita.cabecalho.tipo = TIPO_FOLHA;
+            direita.cabecalho.quantidade = (uint16_t)(n - corte);
+            direita.cabecalho.proxima = folha.cabecalho.proxima;
+            memcpy(direita.chaves, folha.chaves + corte, (n - corte) * sizeof(int64_t));
+            memcpy(direita.valores, folha.valores + corte, (n - corte) * sizeof(uint64_t));
+            folha.cabecalho.quantidade = (uint16_t)corte;
+            folha.cabecalho.proxima = nova;
+
+            if (pos >= corte) {
+                destino = &direita;
+                pos -= corte;
+            }
+            n = destino->cabecalho.quantidade;
+            memmove(destino->chaves + pos + 1, destino->chaves + pos, (n - pos) * sizeof(int64_t));
+            memmove(destino->valores + pos + 1, destino->valores + pos, (n - pos) * sizeof(uint64_t));
+            destino->chaves[pos] = chave;
+            destino->valores[pos] = valor;
+            destino->cabecalho.quantidade++;
+
+            separador = direita.chaves[0];
+            dividiu = true;
+            soltar(qNova, true);
+            soltar(q, true);
+            return true;
+        }
+
+        memmove(folha.chaves + pos + 1, folha.chaves + pos, (n - pos) * sizeof(int64_t));
+        memmove(folha.valores + pos + 1, folha.valores + pos, (n - pos) * sizeof(uint64_t));
+        folha.chaves[pos] = chave;
+        folha.valores[pos] = valor;
+        folha.cabecalho.quantidade++;
+        soltar(q, true);
+        return true;
+    }
+
+    auto& interna = paginas[q].interna;
+    size_t n = interna.cabecalho.quantidade;
+    size_t pos = upper_bound(interna.chaves, interna.chaves + n, chave) - interna.chaves;
+
+    bool filhoDividiu;
+    int64_t separadorFilho;
+    uint32_t novoFilho;
+    bool chaveNova = inserirEm(interna.filhos[pos], chave, valor, naBorda && pos == n,
+                               filhoDividiu, separadorFilho, novoFilho);
+    if (!filhoDividiu) {
+        soltar(q, false);
+        return chaveNova;
+    }
+
+    if (n < CAPACIDADE_INTERNA) {
+        memmove(interna.chaves + pos + 1, interna.chaves + pos, (n - pos) * sizeof(int64_t));
+        memmove(interna.filhos + pos + 2, interna.filhos + pos + 1, (n - pos) * sizeof(uint32_t));
+        interna.chaves[pos] = separadorFilho;
+        interna.filhos[pos + 1] = novoFilho;
+        interna.cabecalho.quantidade++;
+        soltar(q, true);
+        return chaveNova;
+    }
+
+    // Cheia: monta as n + 1 chaves em ordem e sobe a do meio
+    int64_t chaves[CAPACIDADE_INTERNA + 1];
+    uint32_t filhos[CAPACIDADE_INTERNA + 2];
+    memcpy(chaves, interna.chaves, pos * sizeof(int64_t));
+    chaves[pos] = separadorFilho;
+    memcpy(chaves + pos + 1, interna.chaves + pos, (n - pos) * sizeof(int64_t));
+    memcpy(filhos, interna.filhos, (pos + 1) * sizeof(uint32_t));
+    filhos[pos + 1] = novoFilho;
+    memcpy(filhos + pos + 2, interna.filhos + pos + 1, (n - pos) * sizeof(uint32_t));
+
+    size_t total = n + 1;
+    size_t meio = (naBorda && pos == n) ? n : total / 2;
+    size_t qNova = criarPagina(nova);
+    auto& direita = paginas[qNova].interna;
+
+    interna.cabecalho.quantidade = (uint16_t)meio;
+    memcpy(interna.chaves, chaves, meio * sizeof(int64_t));
+    memcpy(interna.filhos, filhos, (meio + 1) * sizeof(uint32_t));
+
+    direita.cabecalho.tipo = TIPO_INTERNA;
+    direita.cabecalho.quantidade = (uint16_t)(total - meio - 1);
+    memcpy(direita.chaves, chaves + meio + 1, (total - meio - 1) * sizeof(int64_t));
+    memcpy(direita.filhos, filhos + meio + 1, (total - meio) * sizeof(uint32_t));
+
+    separador = chaves[meio];
+    dividiu = true;
+    soltar(qNova, true);
+    soltar(q, true);
+    return chaveNova;
+}
+
+/**
+ * Insere ou substitui (raiz dividida = árvore ganha um nível)
+ */
+bool ArvoreBMais::inserir(int64_t chave, uint64_t valor) {
+    bool chaveNova;
+    try {
+        iniciarAlteracao();
+
+        bool dividiu;
+        int64_t separador;
+        uint32_t nova;
+        chaveNova = inserirEm(raiz, chave, valor, true, dividiu, separador, nova);
+
+        if (dividiu) {
+            uint32_t novaRaiz;
+            size_t q = criarPagina(novaRaiz);
+            auto& interna = paginas[q].interna;
+            interna.cabecalho.tipo = TIPO_INTERNA;
+            interna.cabecalho.quantidade = 1;
+            interna.chaves[0] = separador;
+            interna.filhos[0] = raiz;
+            interna.filhos[1] = nova;
+            soltar(q, true);
+            raiz = novaRaiz;
+            altura++;
+        }
+    } catch (...) {
+        soltarTodas();  // Arquivo continua "em alteração": será reconstruído
+        throw;
+    }
+
+    if (chaveNova) {
+        quantidade++;
+        if (quantidade == 1 || chave > maiorChave) {
+            maiorChave = chave;
+        }
+    }
+    return chaveNova;
+}
+
+// ==================== CONSULTA ====================
+
+uint32_t ArvoreBMais::descerAteFolha(int64_t chave) {
+    uint32_t numero = raiz;
+    for (uint32_t nivel = 1; nivel < altura; nivel++) {
+        size_t q = fixar(numero);
+        const auto& interna = paginas[q].interna;
+        if (interna.cabecalho.tipo != TIPO_INTERNA) {
+            soltar(q, false);
+            throw PersistenciaException("Índice " + caminho + " corrompido (página " +
+                                        to_string(numero) + " fora do nível)");
+        }
+        size_t n = interna.cabecalho.quantidade;
+        numero = interna.filhos[upper_bound(interna.chaves, interna.chaves + n, chave) - interna.chaves];
+        soltar(q, false);
+    }
+    return numero;
+}
+
+bool ArvoreBMais::buscar(int64_t chave, uint64_t& valor) {
+    try {
+        size_t q = fixar(descerAteFolha(chave));
+        const auto& folha = paginas[q].folha;
+        size_t n = folha.cabecalho.quantidade;
+        size_t pos = lower_bound(folha.chaves, folha.chaves + n, chave) - folha.chaves;
+        bool encontrada = pos < n && folha.chaves[pos] == chave;
+        if (encontrada) {
+            valor = folha.valores[pos];
+        }
+        soltar(q, false);
+        return encontrada;
+    } catch (...) {
+        soltarTodas();
+        throw;
+    }
+}
+
+size_t ArvoreBMais::percorrer(int64_t inicio, int64_t fim, const function<bool(int64_t, uint64_t)>& visitante) {
+    size_t visitados = 0;
+    if (inicio > fim || quantidade == 0) {
+        return visitados;
+    }
+
+    try {
+        uint32_t numero = descerAteFolha(inicio);
+        while (numero != 0) {
+            size_t q = fixar(numero);
+            const auto& folha = paginas[q].folha;
+            size_t n = folha.cabecalho.quantidade;
+            size_t pos = lower_bound(folha.chaves, folha.chaves + n, inicio) - folha.chaves;
+
+            for (; pos < n; pos++) {
+                if (folha.chaves[pos] > fim) {
+                    soltar(q, false);
+                    return visitados;
+                }
+                visitados++;
+                if (!visitante(folha.chaves[pos], folha.valores[pos])) {
+                    soltar(q, false);
+                    return visitados;
+                }
+            }
+            numero = folha.cabecalho.proxima;
+            soltar(q, false);
+        }
+    } catch (...) {
+        soltarTodas();
+        throw;
+    }
+    return visitados;
+}
+
+/**
+ * Páginas primeiro, cabeçalho limpo por último
+ */
+void ArvoreBMais::sincronizar(uint64_t novaMarca) {
+    if (!emAlteracao && novaMarca == marca) {
+        return;
+    }
+    for (size_t i = 0; i < quadros.size(); i++) {
+        if (quadros[i].pagina != 0 && quadros[i].sujo) {
+            gravarPagina(quadros[i].pagina, paginas[i]);
+            quadros[i].sujo = false;
+        }
+    }
+    if (!arquivo.flush()) {
+        throw PersistenciaException("Falha ao gravar páginas em " + caminho);
+    }
+    marca = novaMarca;
+    gravarCabecalho(true);
+    emAlteracao = false;
+}
+
+// ==================== GETTERS ====================
+
+uint64_t ArvoreBMais::getQuantidade() const {
+    return quantidade;
+}
+
+int64_t ArvoreBMais::getMaiorChave() const {
+    return maiorChave;
+}
+
+uint64_t ArvoreBMais::getMarca() const {
+    return marca;
+}
+
+uint32_t ArvoreBMais::getAltura() const {
+    return altura;
+}
+
+uint32_t ArvoreBMais::getNumPaginas() const {
+    return numPaginas;
+}
+
+size_t ArvoreBMais::getCapacidadeCache() const {
+    return quadros.size();
+}
+
+uint64_t ArvoreBMais::getAcertos() const {
+    return acertos;
+}
+
+uint64_t ArvoreBMais::getFaltas() const {
+    return faltas;
+}
@@ -0,0 +1,252 @@
+/**
+ * @file atribuicao.cpp
+ * @brief Implementação da classe IndiceAtribuicao
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa a relação artista ↔ camarim e sua verificação paralela.
+ */
+
+// Inclui header da classe
+#include "atribuicao.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Para std::async / future (verificação paralela)
+#include <future>
+// Para hardware_concurrency
+#include <thread>
+// Para conjuntos de IDs existentes
+#include <unordered_set>
+// Para min
+#include <algorithm>
+
+// Abaixo deste número de registros por fatia, criar threads custa mais que verificar
+static const size_t MIN_REGISTROS_POR_TAREFA = 4096;
+
+/**
+ * Construtor - índice vazio
+ */
+IndiceAtribuicao::IndiceAtribuicao() {}
+
+/**
+ * Atribui camarim a artista (valida tudo, depois altera)
+ */
+void IndiceAtribuicao::atribuir(int artistaId, int camarimId,
+                                GerenciadorArtistas& artistas, GerenciadorCamarins& camarins) {
+    // ========== VALIDAÇÃO (nada foi alterado ainda) ==========
+    Artista* artista = artistas.buscarPorId(artistaId);
+    if (artista == nullptr) {
+        throw ArtistaException("Artista com ID " + to_string(artistaId) + " não encontrado");
+    }
+    Camarim* camarim = camarins.buscarPorId(camarimId);
+    if (camarim == nullptr) {
+        throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+    }
+
+    int camarimAnterior = getCamarimDoArtista(artistaId);
+    int artistaAnterior = getArtistaDoCamarim(camarimId);
+    if (camarimAnterior == camarimId) {
+        return;  // Já atribuído
+    }
+
+    // ========== ALTERAÇÃO ==========
+    // Camarim antigo do artista fica livre
+    if (camarimAnterior != 0) {
+        artistaPorCamarim.erase(camarimAnterior);
+        Camarim* antigo = camarins.buscarPorId(camarimAnterior);
+        if (antigo != nullptr) {
+            antigo->setArtistaId(0);
+        }
+    }
+    // Artista antigo do camarim fica sem camarim
+    if (artistaAnterior != 0) {
+        camarimPorArtista.erase(artistaAnterior);
+        Artista* antigo = artistas.buscarPorId(artistaAnterior);
+        if (antigo != nullptr) {
+            antigo->setCamarimId(0);
+        }
+    }
+
+    camarimPorArtista[artistaId] = camarimId;
+    artistaPorCamarim[camarimId] = artistaId;
+    artista->setCamarimId(camarimId);  // Espelhos
+    camarim->setArtistaId(artistaId);
+}
+
+/**
+ * Libera camarim de um artista
+ */
+bool IndiceAtribuicao::liberarArtista(int artistaId, GerenciadorArtistas& artistas,
+                                      GerenciadorCamarins& camarins) {
+    auto it = camarimPorArtista.find(artistaId);
+    if (it == camarimPorArtista.end()) {
+        return false;
+    }
+
+    int camarimId = it->second;
+    camarimPorArtista.erase(it);
+    artistaPorCamarim.erase(camarimId);
+
+    Artista* artista = artistas.buscarPorId(artistaId);
+    if (artista != nullptr) {
+        artista->setCamarimId(0);
+    }
+    Camarim* camarim = camarins.buscarPorId(camarimId);
+    if (camarim != nullptr) {
+        camarim->setArtistaId(0);
+    }
+    return true;
+}
+
+/**
+ * Libera artista de um camarim
+ */
+bool IndiceAtribuicao::liberarCamarim(int camarimId, GerenciadorArtistas& artistas,
+                                      GerenciadorCamarins& camarins) {
+    int artistaId = getArtistaDoCamarim(camarimId);
+    if (artistaId == 0) {
+        return false;
+    }
+    return liberarArtista(artistaId, artistas, camarins);
+}
+
+/**
+ * Camarim do artista (O(1))
+ */
+int IndiceAtribuicao::getCamarimDoArtista(int artistaId) const {
+    auto it = camarimPorArtista.find(artistaId);
+    return it == camarimPorArtista.end() ? 0 : it->second;
+}
+
+/**
+ * Artista do camarim (O(1))
+ */
+int IndiceAtribuicao::getArtistaDoCamarim(int camarimId) const {
+    auto it = artistaPorCamarim.find(camarimId);
+    return it == artistaPorCamarim.end() ? 0 : it->second;
+}
+
+/**
+ * Quantidade de atribuições
+ */
+size_t IndiceAtribuicao::tamanho() const {
+    return camarimPorArtista.size();
+}
+
+/**
+ * Reconstrói índice a partir dos artistas
+ */
+void IndiceAtribuicao::reconstruir(GerenciadorArtistas& artistas, GerenciadorCamarins& camarins) {
+    camarimPorArtista.clear();
+    artistaPorCamarim.clear();
+
+    // Camarins começam livres; as atribuições válidas são regravadas abaixo
+    for (const auto& camarim : camarins.getCamarins()) {
+        camarins.buscarPorId(camarim.getId())->setArtistaId(0);
+    }
+
+    // Sem cópia: atribuir() não insere nem remove artistas
+    for (const auto& artista : artistas.getArtistas()) {
+        int camarimId = artista.getCamarimId();
+        if (camarimId == 0) {
+            continue;
+        }
+        if (camarins.buscarPorId(camarimId) == nullptr) {
+            artistas.buscarPorId(artista.getId())->setCamarimId(0);  // Camarim não existe mais
+            continue;
+        }
+        atribuir(artista.getId(), camarimId, artistas, camarins);  // Conflito: último vence
+    }
+}
+
+/**
+ * Verificação paralela de consistência
+ */
+vector<string> IndiceAtribuicao::verificar(const GerenciadorArtistas& artistas,
+                                           const GerenciadorCamarins& camarins) const {
+    // Por referência: verificar() é const e nada muda durante as tarefas
+    const vector<Artista>& listaArtistas = artistas.getArtistas();
+    const vector<Camarim>& listaCamarins = camarins.getCamarins();
+
+    // IDs existentes (somente leitura nas threads)
+    unordered_set<int> idsArtistas, idsCamarins;
+    idsArtistas.reserve(listaArtistas.size());
+    idsCamarins.reserve(listaCamarins.size());
+    for (const auto& artista : listaArtistas) {
+        idsArtistas.insert(artista.getId());
+    }
+    for (const auto& camarim : listaCamarins) {
+        idsCamarins.insert(camarim.getId());
+    }
+
+    // Cada tarefa verifica uma fatia e devolve suas próprias mensagens
+    vector<future<vector<string>>> tarefas;
+
+    auto verificarArtistas = [&](size_t inicio, size_t fim) {
+        vector<string> erros;
+        for (size_t i = inicio; i < fim; i++) {
+            const Artista& artista = listaArtistas[i];
+            int indice = getCamarimDoArtista(artista.getId());
+            if (indice != artista.getCamarimId()) {
+                erros.push_back("Artista " + to_string(artista.getId()) + ": camarim gravado " +
+                                to_string(artista.getCamarimId()) + ", índice " + to_string(indice));
+            }
+            if (indice != 0 && idsCamarins.count(indice) == 0) {
+                erros.push_back("Artista " + to_string(artista.getId()) +
+                                ": camarim " + to_string(indice) + " não existe");
+            }
+            if (indice != 0 && getArtistaDoCamarim(indice) != artista.getId()) {
+                erros.push_back("Artista " + to_string(artista.getId()) +
+                                ": índice reverso do camarim " + to_string(indice) + " diverge");
+            }
+        }
+        return erros;
+    };
+
+    auto verificarCamarins = [&](size_t inicio, size_t fim) {
+        vector<string> erros;
+        for (size_t i = inicio; i < fim; i++) {
+            const Camarim& camarim = listaCamarins[i];
+            int indice = getArtistaDoCamarim(camarim.getId());
+            if (indice != camarim.getArtistaId()) {
+                erros.push_back("Camarim " + to_string(camarim.getId()) + ": artista gravado " +
+                                to_string(camarim.getArtistaId()) + ", índice " + to_string(indice));
+            }
+            if (indice != 0 && idsArtistas.count(indice) == 0) {
+                erros.push_back("Camarim " + to_string(camarim.getId()) +
+                                ": artista " + to_string(indice) + " não existe");
+            }
+        }
+        return erros;
+    };
+
+    // Divide cada lista em fatias; conjunto pequeno vira uma fatia só,
+    // executada na thread atual (launch::deferred roda dentro de get())
+    auto dividir = [&tarefas](size_t total, auto verificador) {
+        size_t numTarefas = 1;
+        if (total >= 2 * MIN_REGISTROS_POR_TAREFA) {
+            numTarefas = min((size_t)max(thread::hardware_concurrency(), 1u),
+                             total / MIN_REGISTROS_POR_TAREFA);
+        }
+        launch politica = numTarefas > 1 ? launch::async : launch::deferred;
+        size_t fatia = (total + numTarefas - 1) / numTarefas;
+        for (size_t inicio = 0; inicio < total; inicio += fatia) {
+            tarefas.push_back(async(politica, verificador, inicio, min(total, inicio + fatia)));
+        }
+    };
+
+    dividir(listaArtistas.size(), verificarArtistas);
+    dividir(listaCamarins.size(), verificarCamarins);
+
+    // Junta os resultados na ordem das fatias
+    vector<string> erros;
+    for (auto& tarefa : tarefas) {
+        vector<string> parcial = tarefa.get();
+        erros.insert(erros.end(), parcial.begin(), parcial.end());
+    }
+    if (camarimPorArtista.size() != artistaPorCamarim.size()) {
+        erros.push_back("Índice com tamanhos diferentes nos dois sentidos");
+    }
+    return erros;
+}
@@ -24,17 +24,66 @@
 /**
  * Construtor padrão - inicializa com valores vazios/zero
  */
-Camarim::Camarim() : id(0), nome(""), artistaId(0) {}
+Camarim::Camarim() : id(0), nome(""), artistaId(0), alterados(nullptr), observador(nullptr) {}
 // Lista de inicialização: mais eficiente que atribuição no corpo
 
 /**
  * Construtor parametrizado - inicializa com valores fornecidos
  */
 Camarim::Camarim(int id, const string& nome, int artistaId)
-    : id(id), nome(nome), artistaId(artistaId) {}
+    : id(id), nome(nome), artistaId(artistaId), alterados(nullptr), observador(nullptr) {}
 // Inicializa diretamente os atributos privados
 // artistaId = 0 significa que não há artista associado ainda
 
+/**
+ * Construtor de cópia - cópia avulsa (não fica ligada ao gerenciador)
+ */
+Camarim::Camarim(const Camarim& outro)
+    : id(outro.id), nome(outro.nome), artistaId(outro.artistaId), itens(outro.itens),
+      alterados(nullptr), observador(nullptr) {}
+
+/**
+ * Construtor de movimento - leva a ligação
+ */
+Camarim::Camarim(Camarim&& outro) noexcept
+    : id(outro.id), nome(move(outro.nome)), artistaId(outro.artistaId), itens(move(outro.itens)),
+      alterados(outro.alterados), observador(outro.observador) {
+    outro.alterados = nullptr;
+    outro.observador = nullptr;
+}
+
+/**
+ * Atribuição por cópia - mantém a ligação deste camarim
+ */
+Camarim& Camarim::operator=(const Camarim& outro) {
+    if (this != &outro) {
+        id = outro.id;
+        nome = outro.nome;
+        artistaId = outro.artistaId;
+        itens = outro.itens;
+        marcarAlterado();     // Conteúdo substituído (a ligação continua a deste camarim)
+        avisarObservador(0);
+    }
+    return *this;
+}
+
+/**
+ * Atribuição por movimento - assume a ligação do outro
+ */
+Camarim& Camarim::operator=(Camarim&& outro) noexcept {
+    if (this != &outro) {
+        id = outro.id;
+        nome = move(outro.nome);
+        artistaId = outro.artistaId;
+        itens = move(outro.itens);
+        alterados = outro.alterados;
+        observador = outro.observador;
+        outro.alterados = nullptr;
+        outro.observador = nullptr;
+    }
+    return *this;
+}
+
 /**
  * Destrutor - libera recursos
  */
@@ -64,6 +113,10 @@ int Camarim::getArtistaId() const {
     return artistaId;  // 0 = sem artista
 }
 
+const MapaPequeno<int, ItemCamarim>& Camarim::getItens() const {
+    return itens;  // Referência const: leitura sem copiar os itens
+}
+
 // ==================== SETTERS (métodos que modificam atributos) ====================
 
 /**
@@ -74,7 +127,10 @@ void Camarim::setId(int id) {
         throw ValidacaoException("ID do camarim inválido");
         // Lança exceção específica de validação
     }
+    avisarObservador(0);  // Camarim sai do ID antigo
     this->id = id;  // this-> diferencia parâmetro de atributo
+    marcarAlterado();
+    avisarObservador(0);
 }
 
 /**
@@ -85,6 +141,7 @@ void Camarim::setNome(const string& nome) {
         throw ValidacaoException("Nome do camarim não pode ser vazio");
     }
     this->nome = nome;  // Atualiza atributo privado
+    marcarAlterado();
 }
 
 /**
@@ -92,6 +149,40 @@ void Camarim::setNome(const string& nome) {
  */
 void Camarim::setArtistaId(int artistaId) {
     this->artistaId = artistaId;  // Permite 0 (sem artista)
+    marcarAlterado();
+    avisarObservador(0);
+}
+
+/**
+ * Liga ao log de alterações do gerenciador
+ */
+void Camarim::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+}
+
+/**
+ * Liga ao observador de conteúdo do gerenciador
+ */
+void Camarim::ligarObservador(const function<void(int, int)>* observador) {
+    this->observador = observador;
+}
+
+/**
+ * Anota o camarim no log de alterações
+ */
+void Camarim::marcarAlterado() {
+    if (alterados != nullptr) {
+        alterados->push_back(id);
+    }
+}
+
+/**
+ * Avisa o observador de conteúdo
+ */
+void Camarim::avisarObservador(int itemId) {
+    if (observador != nullptr && *observador) {
+        (*observador)(id, itemId);
+    }
 }
 
 /**
@@ -122,6 +213,8 @@ void Camarim::inserirItem(int itemId, const string& nomeItem, int quantidade) {
         // Chama construtor parametrizado de ItemCamarim
         // Insere par chave-valor no map
     }
+    marcarAlterado();
+    avisarObservador(itemId);
 }
 
 /**
@@ -150,6 +243,8 @@ bool Camarim::removerItem(int itemId, int quantidade) {
     if (itens[itemId].quantidade == 0) {
         itens.erase(itemId);  // erase() remove elemento do map
     }
+    marcarAlterado();
+    avisarObservador(itemId);
     
     return true;  // Sucesso na remoção
 }
@@ -225,23 +320,28 @@ ostream& operator<<(ostream& os, const Camarim& camarim) {
 /**
  * Construtor - inicializa próximo ID como 1
  */
-GerenciadorCamarins::GerenciadorCamarins() : proximoId(1) {}
+GerenciadorCamarins::GerenciadorCamarins() : proximoId(1), alterados(nullptr) {}
 // IDs começam em 1 (0 geralmente significa "nenhum")
 
 /**
  * Cadastra novo camarim (CREATE)
  */
-int GerenciadorCamarins::cadastrar(const string& nome, int artistaId) {
+int GerenciadorCamarins::cadastrar(const string& nome) {
     if (nome.empty()) {  // Validação: nome obrigatório
         throw ValidacaoException("Nome do camarim não pode ser vazio");
     }
     
     // Cria novo camarim com ID automático
-    Camarim novoCamarim(proximoId, nome, artistaId);
+    Camarim novoCamarim(proximoId, nome, 0);
+    novoCamarim.ligarAlteracoes(alterados);
+    novoCamarim.ligarObservador(&observadorConteudo);
     
     // Adiciona ao vector de camarins
-    camarins.push_back(novoCamarim);
-    // push_back() adiciona ao final do vector (faz cópia do objeto)
+    camarins.push_back(move(novoCamarim));
+    // move: o camarim no vector leva a ligação (uma cópia seria avulsa)
+    if (alterados != nullptr) {
+        alterados->push_back(proximoId);
+    }
     
     return proximoId++;  // Retorna ID usado e incrementa para próximo
     // Pós-incremento: retorna valor atual, depois incrementa
@@ -297,6 +397,13 @@ bool GerenciadorCamarins::remover(int id) {
         camarins.erase(it, camarins.end());
         // erase(início, fim) remove range do vector
         // Remove todos desde it até o final
+        consumo.removerCamarim(id);  // Séries do camarim deixam de existir
+        if (alterados != nullptr) {
+            alterados->push_back(id);  // Ausente na confirmação = removido
+        }
+        if (observadorConteudo) {
+            observadorConteudo(id, 0);  // Camarim não existe mais
+        }
         return true;  // Sucesso
     }
     return false;  // Não encontrado
@@ -310,10 +417,37 @@ vector<Camarim> GerenciadorCamarins::listar() const {
     // Vector faz deep copy de todos os objetos
 }
 
+/**
+ * Consumo de item (retirada + registro)
+ */
+void GerenciadorCamarins::consumirItem(int camarimId, int itemId, int quantidade, int64_t agoraNs) {
+    Camarim* camarim = buscarPorId(camarimId);
+    if (camarim == nullptr) {
+        throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+    }
+    
+    camarim->removerItem(itemId, quantidade);  // Valida e lança exceção antes de registrar
+    consumo.registrar(camarimId, itemId, quantidade, agoraNs);
+}
+
+/**
+ * Séries de consumo
+ */
+MedidorConsumo& GerenciadorCamarins::getConsumo() {
+    return consumo;
+}
+
+/**
+ * Todos os camarins por referência
+ */
+const vector<Camarim>& GerenciadorCamarins::getCamarins() const {
+    return camarins;
+}
+
 /**
  * Atualiza dados de um camarim (UPDATE)
  */
-bool GerenciadorCamarins::atualizar(int id, const string& nome, int artistaId) {
+bool GerenciadorCamarins::atualizar(int id, const string& nome) {
     Camarim* camarim = buscarPorId(id);
     // Busca ponteiro para o camarim (nullptr se não encontrar)
     
@@ -325,7 +459,26 @@ bool GerenciadorCamarins::atualizar(int id, const string& nome, int artistaId) {
     // Atualiza campos usando setters (que fazem validação)
     camarim->setNome(nome);
     // -> = acesso a membro através de ponteiro (equivale a (*camarim).setNome(nome))
-    camarim->setArtistaId(artistaId);
     
     return true;  // Sucesso na atualização
 }
+
+/**
+ * Liga log de alterações ao gerenciador e aos camarins já cadastrados
+ */
+void GerenciadorCamarins::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+    for (auto& camarim : camarins) {
+        camarim.ligarAlteracoes(alterados);
+    }
+}
+
+/**
+ * Define o observador de conteúdo e liga os camarins já cadastrados
+ */
+void GerenciadorCamarins::definirObservadorConteudo(function<void(int camarimId, int itemId)> observador) {
+    observadorConteudo = observador;  // Camarins guardam o endereço: trocar a função basta
+    for (auto& camarim : camarins) {
+        camarim.ligarObservador(&observadorConteudo);
+    }
+}
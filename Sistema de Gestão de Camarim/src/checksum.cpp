@@ -0,0 +1,176 @@
+/**
+ * @file checksum.cpp
+ * @brief Implementação do CRC-32C
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa o CRC-32C com a instrução do processador (SSE4.2 no x86-64,
+ * extensão CRC no ARMv8) e, sem ela, por tabelas (oito bytes por passo).
+ */
+
+// Inclui header da função
+#include "checksum.h"
+// Para memcpy (leitura de 8 bytes sem exigir alinhamento)
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CRC32C_X86
+#include <nmmintrin.h>  // _mm_crc32_u64 / _mm_crc32_u8
+#ifdef _MSC_VER
+#include <intrin.h>     // __cpuid
+#endif
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define CRC32C_ARM
+#include <arm_acle.h>   // __crc32cd / __crc32cb
+#endif
+
+// Polinômio de Castagnoli, forma refletida
+static const uint32_t POLINOMIO_CRC32C = 0x82F63B78u;
+
+// ==================== POR TABELAS ====================
+
+/**
+ * Oito tabelas de 256 entradas: valores[k][b] = CRC do byte b seguido de k zeros
+ */
+struct TabelaCrc32c {
+    uint32_t valores[8][256];
+
+    TabelaCrc32c() {
+        for (uint32_t byte = 0; byte < 256; byte++) {
+            uint32_t crc = byte;
+            for (int bit = 0; bit < 8; bit++) {
+                crc = (crc & 1) ? (crc >> 1) ^ POLINOMIO_CRC32C : crc >> 1;
+            }
+            valores[0][byte] = crc;
+        }
+        for (uint32_t byte = 0; byte < 256; byte++) {
+            for (int k = 1; k < 8; k++) {
+                uint32_t anterior = valores[k - 1][byte];
+                valores[k][byte] = valores[0][anterior & 0xFF] ^ (anterior >> 8);
+            }
+        }
+    }
+};
+
+/**
+ * Oito bytes por passo (slicing-by-8): oito consultas independentes
+ */
+static uint32_t crc32cTabela(const unsigned char* bytes, size_t tamanho, uint32_t crc) {
+    static const TabelaCrc32c tabela;  // Montada uma vez (inicialização thread-safe)
+    const auto& t = tabela.valores;
+
+    while (tamanho >= 8) {
+        uint32_t baixo = crc ^ ((uint32_t)bytes[0] | (uint32_t)bytes[1] << 8 |
+                                (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24);
+        crc = t[7][baixo & 0xFF] ^ t[6][(baixo >> 8) & 0xFF] ^
+              t[5][(baixo >> 16) & 0xFF] ^ t[4][baixo >> 24] ^
+              t[3][bytes[4]] ^ t[2][bytes[5]] ^ t[1][bytes[6]] ^ t[0][bytes[7]];
+        bytes += 8;
+        tamanho -= 8;
+    }
+    while (tamanho-- > 0) {
+        crc = t[0][(crc ^ *bytes++) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+// ==================== POR HARDWARE ====================
+
+#if defined(CRC32C_X86)
+
+#if defined(__GNUC__)
+#define ALVO_SSE42 __attribute__((target("sse4.2")))  // Só esta função usa SSE4.2
+#else
+#define ALVO_SSE42
+#endif
+
+ALVO_SSE42 static uint32_t crc32cHardware(const unsigned char* bytes, size_t tamanho, uint32_t crc) {
+    uint64_t atual = crc;
+    while (tamanho >= 8) {
+        uint64_t palavra;
+        memcpy(&palavra, bytes, sizeof(palavra));
+        atual = _mm_crc32_u64(atual, palavra);
+        bytes += 8;
+        tamanho -= 8;
+    }
+    uint32_t resto = (uint32_t)atual;
+    while (tamanho-- > 0) {
+        resto = _mm_crc32_u8(resto, *bytes++);
+    }
+    return resto;
+}
+
+static bool processadorTemCrc32c() {
+#if defined(_MSC_VER)
+    int registros[4];
+    __cpuid(registros, 1);
+    return (registros[2] & (1 << 20)) != 0;  // ECX bit 20 = SSE4.2
+#else
+    return __builtin_cpu_supports("sse4.2");
+#endif
+}
+
+#elif defined(CRC32C_ARM)
+
+static uint32_t crc32cHardware(const unsigned char* bytes, size_t tamanho, uint32_t crc) {
+    while (tamanho >= 8) {
+        uint64_t palavra;
+        memcpy(&palavra, bytes, sizeof(palavra));
+        crc = __crc32cd(crc, palavra);
+        bytes += 8;
+        tamanho -= 8;
+    }
+    while (tamanho-- > 0) {
+        crc = __crc32cb(crc, *bytes++);
+    }
+    return crc;
+}
+
+static bool processadorTemCrc32c() {
+    return true;  // Compilado com a extensão CRC: todo processador alvo tem a instrução
+}
+
+#endif
+
+// ==================== ESCOLHA ====================
+
+typedef uint32_t (*FuncaoCrc32c)(const unsigned char*, size_t, uint32_t);
+
+/**
+ * Instrução do processador se disponível, senão tabelas (decidido uma vez)
+ */
+static FuncaoCrc32c escolherImplementacao() {
+#if defined(CRC32C_X86) || defined(CRC32C_ARM)
+    if (processadorTemCrc32c()) {
+        return crc32cHardware;
+    }
+#endif
+    return crc32cTabela;
+}
+
+static FuncaoCrc32c implementacao() {
+    static const FuncaoCrc32c escolhida = escolherImplementacao();
+    return escolhida;
+}
+
+/**
+ * CRC-32C de um bloco (continua a partir de crc)
+ */
+uint32_t crc32c(const void* dados, size_t tamanho, uint32_t crc) {
+    return ~implementacao()(static_cast<const unsigned char*>(dados), tamanho, ~crc);
+}
+
+/**
+ * Versão por tabelas, sem consultar o processador
+ */
+uint32_t crc32cSoftware(const void* dados, size_t tamanho, uint32_t crc) {
+    return ~crc32cTabela(static_cast<const unsigned char*>(dados), tamanho, ~crc);
+}
+
+/**
+ * Indica se crc32c() usa a instrução do processador
+ */
+bool crc32cPorHardware() {
+    return implementacao() != crc32cTabela;
+}
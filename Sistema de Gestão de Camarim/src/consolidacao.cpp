@@ -0,0 +1,192 @@
+/**
+ * @file consolidacao.cpp
+ * @brief Implementação da classe CompraConsolidada
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa a soma das listas por redução paralela.
+ */
+
+// Inclui header da classe
+#include "consolidacao.h"
+// Para threads da redução paralela
+#include <thread>
+// Para min
+#include <algorithm>
+// Para stringstream (construir strings)
+#include <sstream>
+// Para formatação (setw, left, setprecision)
+#include <iomanip>
+
+// Abaixo deste número de linhas por thread, criar threads custa mais que somar
+static const size_t MIN_LINHAS_POR_THREAD = 4096;
+
+/**
+ * Construtor - consolidação vazia
+ */
+CompraConsolidada::CompraConsolidada() : totalCentavos(0) {}
+
+/**
+ * Soma uma lista
+ */
+void CompraConsolidada::acumular(const ListaCompras& lista) {
+    listaIds.push_back(lista.getId());
+    for (const auto& par : lista.getItens()) {
+        const ItemCompra& item = par.second;
+        LinhaConsolidada& linha = linhas[item.itemId];
+        if (linha.origens.empty()) {  // Primeira lista com este item
+            linha.itemId = item.itemId;
+            linha.nomeItem = item.nomeItem;
+            linha.precoCentavos = item.precoCentavos;
+        } else if (item.precoCentavos != linha.precoCentavos) {
+            linha.precosDivergentes = true;
+        }
+        linha.quantidade += item.quantidade;
+        linha.subtotalCentavos += item.getSubtotalCentavos();
+        linha.origens.emplace_back(lista.getId(), item.quantidade);
+        totalCentavos += item.getSubtotalCentavos();
+    }
+}
+
+/**
+ * Funde parcial (origens da outra vêm depois)
+ */
+void CompraConsolidada::mesclar(CompraConsolidada& outra) {
+    listaIds.insert(listaIds.end(), outra.listaIds.begin(), outra.listaIds.end());
+    for (auto& par : outra.linhas) {
+        LinhaConsolidada& origem = par.second;
+        auto it = linhas.find(par.first);
+        if (it == linhas.end()) {
+            linhas.emplace(par.first, move(origem));  // Item novo: move a linha inteira
+            continue;
+        }
+        LinhaConsolidada& linha = it->second;
+        if (origem.precoCentavos != linha.precoCentavos || origem.precosDivergentes) {
+            linha.precosDivergentes = true;
+        }
+        linha.quantidade += origem.quantidade;
+        linha.subtotalCentavos += origem.subtotalCentavos;
+        linha.origens.insert(linha.origens.end(), origem.origens.begin(), origem.origens.end());
+    }
+    totalCentavos += outra.totalCentavos;
+}
+
+/**
+ * Consolida listas (redução paralela)
+ */
+CompraConsolidada CompraConsolidada::consolidar(const vector<const ListaCompras*>& listas, unsigned limiteThreads) {
+    size_t totalLinhas = 0;
+    for (const ListaCompras* lista : listas) {
+        totalLinhas += lista->getItens().size();
+    }
+
+    size_t numThreads = limiteThreads;
+    if (numThreads == 0) {
+        numThreads = max(thread::hardware_concurrency(), 1u);  // hardware_concurrency() pode retornar 0
+    }
+    numThreads = min(numThreads, min(listas.size(), totalLinhas / MIN_LINHAS_POR_THREAD));
+
+    // Poucas linhas: consolida na thread atual
+    if (numThreads <= 1) {
+        CompraConsolidada compra;
+        for (const ListaCompras* lista : listas) {
+            compra.acumular(*lista);
+        }
+        return compra;
+    }
+
+    // Fatias contíguas com número parecido de LINHAS (listas têm tamanhos diferentes)
+    vector<size_t> inicios(1, 0);
+    size_t alvo = (totalLinhas + numThreads - 1) / numThreads;
+    size_t acumulado = 0;
+    for (size_t i = 0; i < listas.size() && inicios.size() < numThreads; i++) {
+        acumulado += listas[i]->getItens().size();
+        if (acumulado >= alvo * inicios.size()) {
+            inicios.push_back(i + 1);
+        }
+    }
+    inicios.push_back(listas.size());
+
+    // MAP: cada thread consolida sua fatia em uma parcial
+    size_t fatias = inicios.size() - 1;
+    vector<CompraConsolidada> parciais(fatias);
+    vector<thread> threads;
+    for (size_t t = 0; t < fatias; t++) {
+        size_t inicio = inicios[t];
+        size_t fim = inicios[t + 1];
+        threads.emplace_back([&listas, &parciais, t, inicio, fim]() {
+            for (size_t i = inicio; i < fim; i++) {
+                parciais[t].acumular(*listas[i]);
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();  // Aguarda todas as fatias
+    }
+
+    // REDUCE: funde em ordem (origens ficam na ordem das listas)
+    CompraConsolidada compra = move(parciais[0]);
+    for (size_t t = 1; t < fatias; t++) {
+        compra.mesclar(parciais[t]);
+    }
+    return compra;
+}
+
+// ==================== GETTERS ====================
+
+const vector<int>& CompraConsolidada::getListaIds() const { return listaIds; }
+const map<int, LinhaConsolidada>& CompraConsolidada::getLinhas() const { return linhas; }
+long long CompraConsolidada::getTotalCentavos() const { return totalCentavos; }
+bool CompraConsolidada::vazia() const { return linhas.empty(); }
+
+/**
+ * Copia linhas para lista de compras
+ */
+void CompraConsolidada::preencherLista(ListaCompras& lista) const {
+    for (const auto& par : linhas) {
+        const LinhaConsolidada& linha = par.second;
+        lista.adicionarItem(linha.itemId, linha.nomeItem, linha.quantidade, linha.precoCentavos / 100.0);
+    }
+}
+
+/**
+ * Exibe consolidação formatada
+ */
+string CompraConsolidada::exibir() const {
+    stringstream ss;
+    ss << fixed << setprecision(2);
+    ss << "=== PEDIDO CONSOLIDADO ===" << endl;
+    ss << "Listas: " << listaIds.size() << " | Itens: " << linhas.size() << endl;
+
+    if (linhas.empty()) {
+        ss << "  Nenhum item nas listas" << endl;
+        return ss.str();
+    }
+
+    ss << left << setw(5) << "  ID" << setw(22) << "Nome"
+       << right << setw(8) << "Qtd" << setw(13) << "Subtotal" << "   Origem (lista: qtd)" << endl;
+    ss << "  " << string(70, '-') << endl;
+    for (const auto& par : linhas) {
+        const LinhaConsolidada& linha = par.second;
+        ss << left << setw(5) << "  " + to_string(linha.itemId) << setw(22) << linha.nomeItem.substr(0, 21)
+           << right << setw(8) << linha.quantidade
+           << setw(4) << "R$ " << setw(9) << linha.subtotalCentavos / 100.0 << "  ";
+        for (const auto& origem : linha.origens) {
+            ss << " " << origem.first << ":" << origem.second;
+        }
+        ss << (linha.precosDivergentes ? "  (preços diferentes)" : "") << endl;
+    }
+    ss << "  " << string(70, '-') << endl;
+    ss << right << setw(37) << "TOTAL: R$ " << setw(9) << totalCentavos / 100.0 << endl;
+    return ss.str();
+}
+
+/**
+ * Sobrecarga do operador << para cout
+ */
+ostream& operator<<(ostream& os, const CompraConsolidada& compra) {
+    os << compra.exibir();
+    return os;
+}
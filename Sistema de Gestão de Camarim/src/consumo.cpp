@@ -0,0 +1,224 @@
+/**
+ * @file consumo.cpp
+ * @brief Implementação das classes SerieConsumo e MedidorConsumo
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa os anéis de consumo e o ranking de maiores consumidores.
+ */
+
+// Inclui header da classe
+#include "consumo.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Para partial_sort, fill, min
+#include <algorithm>
+
+static const int64_t NS_POR_MINUTO = 60LL * 1000000000LL;
+
+// ==================== Classe SerieConsumo ====================
+
+/**
+ * Construtor - série zerada
+ */
+SerieConsumo::SerieConsumo() : minutoAtual(0), soma15(0), soma60(0), somaDia(0) {
+    fill(porMinuto, porMinuto + BALDES_MINUTO, 0);
+    fill(porQuarto, porQuarto + BALDES_QUARTO, 0);
+}
+
+/**
+ * Avança o relógio zerando os baldes que saíram das janelas
+ */
+void SerieConsumo::avancar(int64_t minuto) {
+    if (minuto <= minutoAtual) {
+        return;
+    }
+
+    // ========== ANEL DE MINUTOS ==========
+    if (minuto - minutoAtual >= BALDES_MINUTO) {
+        // Mais de uma hora sem consumo: anel inteiro expirou
+        fill(porMinuto, porMinuto + BALDES_MINUTO, 0);
+        soma15 = soma60 = 0;
+    } else {
+        for (int64_t m = minutoAtual + 1; m <= minuto; m++) {
+            soma15 -= porMinuto[(m + BALDES_MINUTO - 15) % BALDES_MINUTO];  // Minuto m - 15 sai da janela
+            int& balde = porMinuto[m % BALDES_MINUTO];      // Era o minuto m - 60
+            soma60 -= balde;
+            balde = 0;
+        }
+    }
+
+    // ========== ANEL DE QUARTOS DE HORA ==========
+    int64_t quartoAtual = minutoAtual / MINUTOS_POR_QUARTO;
+    int64_t quarto = minuto / MINUTOS_POR_QUARTO;
+    if (quarto - quartoAtual >= BALDES_QUARTO) {
+        fill(porQuarto, porQuarto + BALDES_QUARTO, 0);
+        somaDia = 0;
+    } else {
+        for (int64_t q = quartoAtual + 1; q <= quarto; q++) {
+            int& balde = porQuarto[q % BALDES_QUARTO];      // Era o quarto q - 96
+            somaDia -= balde;
+            balde = 0;
+        }
+    }
+
+    minutoAtual = minuto;
+}
+
+/**
+ * Registra consumo
+ */
+void SerieConsumo::registrar(int quantidade, int64_t minuto) {
+    avancar(minuto);
+    porMinuto[minutoAtual % BALDES_MINUTO] += quantidade;
+    porQuarto[(minutoAtual / MINUTOS_POR_QUARTO) % BALDES_QUARTO] += quantidade;
+    soma15 += quantidade;
+    soma60 += quantidade;
+    somaDia += quantidade;
+}
+
+/**
+ * Total na janela
+ */
+int64_t SerieConsumo::total(JanelaConsumo janela, int64_t minuto) {
+    avancar(minuto);
+    switch (janela) {
+        case JanelaConsumo::QUINZE_MINUTOS: return soma15;
+        case JanelaConsumo::UMA_HORA:       return soma60;
+        case JanelaConsumo::UM_DIA:         return somaDia;
+    }
+    return 0;
+}
+
+// ==================== Classe MedidorConsumo ====================
+
+/**
+ * Construtor - nenhuma série
+ */
+MedidorConsumo::MedidorConsumo() {}
+
+/**
+ * Chave de 64 bits do par (camarim, item)
+ */
+uint64_t MedidorConsumo::chave(int camarimId, int itemId) {
+    return ((uint64_t)(uint32_t)camarimId << 32) | (uint32_t)itemId;
+}
+
+/**
+ * Registra consumo
+ */
+void MedidorConsumo::registrar(int camarimId, int itemId, int quantidade, int64_t agoraNs) {
+    if (quantidade <= 0) {
+        throw ValidacaoException("Quantidade consumida deve ser maior que zero");
+    }
+    series[chave(camarimId, itemId)].registrar(quantidade, agoraNs / NS_POR_MINUTO);
+}
+
+/**
+ * Total do par na janela
+ */
+int64_t MedidorConsumo::consumo(int camarimId, int itemId, JanelaConsumo janela, int64_t agoraNs) {
+    auto it = series.find(chave(camarimId, itemId));
+    if (it == series.end()) {
+        return 0;
+    }
+    return it->second.total(janela, agoraNs / NS_POR_MINUTO);
+}
+
+/**
+ * Maiores consumidores: O(p + k log k) com partial_sort (p = pares, k = limite)
+ */
+vector<ConsumoItem> MedidorConsumo::maioresConsumidores(JanelaConsumo janela, size_t limite,
+                                                        int64_t agoraNs) {
+    int64_t minuto = agoraNs / NS_POR_MINUTO;
+    double horas = minutosDaJanela(janela) / 60.0;
+
+    vector<ConsumoItem> ranking;
+    for (auto& par : series) {
+        int64_t quantidade = par.second.total(janela, minuto);
+        if (quantidade <= 0) {
+            continue;  // Sem consumo na janela
+        }
+        ConsumoItem linha;
+        linha.camarimId = (int)(par.first >> 32);
+        linha.itemId = (int)(uint32_t)par.first;
+        linha.quantidade = quantidade;
+        linha.porHora = quantidade / horas;
+        ranking.push_back(linha);
+    }
+
+    // Só os 'limite' primeiros precisam ficar ordenados
+    size_t topo = min(limite, ranking.size());
+    partial_sort(ranking.begin(), ranking.begin() + topo, ranking.end(),
+                 [](const ConsumoItem& a, const ConsumoItem& b) {
+                     if (a.quantidade != b.quantidade) {
+                         return a.quantidade > b.quantidade;
+                     }
+                     return a.camarimId != b.camarimId ? a.camarimId < b.camarimId
+                                                       : a.itemId < b.itemId;
+                 });
+    ranking.resize(topo);
+    return ranking;
+}
+
+/**
+ * Taxa por item (todos os camarins)
+ */
+map<int, double> MedidorConsumo::taxaPorItem(JanelaConsumo janela, int64_t agoraNs) {
+    int64_t minuto = agoraNs / NS_POR_MINUTO;
+    double horas = minutosDaJanela(janela) / 60.0;
+
+    map<int, double> taxas;
+    for (auto& par : series) {
+        int64_t quantidade = par.second.total(janela, minuto);
+        if (quantidade > 0) {
+            taxas[(int)(uint32_t)par.first] += quantidade / horas;
+        }
+    }
+    return taxas;
+}
+
+/**
+ * Descarta séries de um camarim
+ */
+void MedidorConsumo::removerCamarim(int camarimId) {
+    for (auto it = series.begin(); it != series.end();) {
+        if ((int)(it->first >> 32) == camarimId) {
+            it = series.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+/**
+ * Quantidade de pares
+ */
+size_t MedidorConsumo::quantidadeSeries() const {
+    return series.size();
+}
+
+/**
+ * Duração da janela em minutos
+ */
+int MedidorConsumo::minutosDaJanela(JanelaConsumo janela) {
+    switch (janela) {
+        case JanelaConsumo::QUINZE_MINUTOS: return 15;
+        case JanelaConsumo::UMA_HORA:       return 60;
+        case JanelaConsumo::UM_DIA:         return 24 * 60;
+    }
+    return 0;
+}
+
+/**
+ * Nome da janela
+ */
+string MedidorConsumo::nomeJanela(JanelaConsumo janela) {
+    switch (janela) {
+        case JanelaConsumo::QUINZE_MINUTOS: return "15 min";
+        case JanelaConsumo::UMA_HORA:       return "1 hora";
+        case JanelaConsumo::UM_DIA:         return "1 dia";
+    }
+    return "";
+}
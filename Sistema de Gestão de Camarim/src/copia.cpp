@@ -0,0 +1,399 @@
+/**
+ * @file copia.cpp
+ * @brief Implementação da classe CopiaSeguranca
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa o manifesto com CRC, a cópia só dos segmentos alterados e a
+ * verificação com uma fila de segmentos dividida entre threads.
+ */
+
+// Inclui header da classe
+#include "copia.h"
+// Inclui o CRC-32C dos segmentos
+#include "checksum.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Para leitura e gravação dos arquivos
+#include <fstream>
+// Para diretórios, tamanhos, datas e rename
+#include <filesystem>
+// Para memcpy (campos do manifesto)
+#include <cstring>
+// Para sort, min, max
+#include <algorithm>
+// Para nome -> entrada do manifesto anterior e arquivos danificados
+#include <map>
+#include <set>
+// Para as threads da verificação
+#include <thread>
+#include <atomic>
+#include <mutex>
+
+// Identificação do formato no início do manifesto
+static const char ASSINATURA[4] = {'C', 'M', 'P', 'K'};
+static const uint32_t VERSAO_FORMATO = 1;
+static const char* NOME_MANIFESTO = "manifesto.bin";
+
+// ==================== CODIFICAÇÃO DO MANIFESTO ====================
+
+template <typename T>
+static void anexarCampo(string& saida, const T& valor) {
+    saida.append(reinterpret_cast<const char*>(&valor), sizeof(valor));
+}
+
+/**
+ * Lê um campo; false se os bytes acabarem
+ */
+template <typename T>
+static bool lerCampo(const char*& p, const char* fim, T& valor) {
+    if ((size_t)(fim - p) < sizeof(valor)) {
+        return false;
+    }
+    memcpy(&valor, p, sizeof(valor));
+    p += sizeof(valor);
+    return true;
+}
+
+/**
+ * Lê até encher o buffer ou o arquivo acabar
+ */
+static size_t lerBloco(ifstream& entrada, char* destino, size_t tamanho) {
+    entrada.read(destino, (streamsize)tamanho);
+    return (size_t)entrada.gcount();
+}
+
+static string caminhoNaCopia(const string& diretorio, const string& nome) {
+    return (filesystem::path(diretorio) / nome).string();
+}
+
+// ==================== Classe CopiaSeguranca ====================
+
+/**
+ * Manifesto: "CMPK", versão, tamanho do segmento, arquivos, CRC de tudo no fim
+ */
+vector<CopiaSeguranca::ArquivoCopiado> CopiaSeguranca::lerManifesto(const string& diretorio, bool& existe) {
+    vector<ArquivoCopiado> arquivos;
+    string caminho = caminhoNaCopia(diretorio, NOME_MANIFESTO);
+    ifstream entrada(caminho, ios::binary);
+    existe = entrada.is_open();
+    if (!existe) {
+        return arquivos;
+    }
+
+    string dados((istreambuf_iterator<char>(entrada)), istreambuf_iterator<char>());
+    uint32_t crcGravado;
+    if (dados.size() < sizeof(ASSINATURA) + sizeof(crcGravado) ||
+        memcmp(dados.data(), ASSINATURA, sizeof(ASSINATURA)) != 0) {
+        throw PersistenciaException("Arquivo " + caminho + " não é um manifesto de cópia");
+    }
+    memcpy(&crcGravado, dados.data() + dados.size() - sizeof(crcGravado), sizeof(crcGravado));
+    if (crcGravado != crc32c(dados.data(), dados.size() - sizeof(crcGravado))) {
+        throw PersistenciaException("Manifesto " + caminho + " corrompido (CRC não confere)");
+    }
+
+    const char* p = dados.data() + sizeof(ASSINATURA);
+    const char* fim = dados.data() + dados.size() - sizeof(crcGravado);
+    uint32_t versao, tamanhoSegmento, quantidade;
+    if (!lerCampo(p, fim, versao) || !lerCampo(p, fim, tamanhoSegmento) || !lerCampo(p, fim, quantidade) ||
+        versao != VERSAO_FORMATO || tamanhoSegmento != TAMANHO_SEGMENTO) {
+        throw PersistenciaException("Manifesto " + caminho + " de outra versão");
+    }
+
+    for (uint32_t i = 0; i < quantidade; i++) {
+        ArquivoCopiado arquivo;
+        uint32_t tamanhoNome, numSegmentos;
+        if (!lerCampo(p, fim, tamanhoNome) || tamanhoNome > (size_t)(fim - p)) {
+            throw PersistenciaException("Manifesto " + caminho + " truncado");
+        }
+        arquivo.nome.assign(p, tamanhoNome);
+        p += tamanhoNome;
+        if (!lerCampo(p, fim, arquivo.tamanho) || !lerCampo(p, fim, arquivo.modificadoEm) ||
+            !lerCampo(p, fim, numSegmentos) ||
+            numSegmentos != (arquivo.tamanho + TAMANHO_SEGMENTO - 1) / TAMANHO_SEGMENTO ||
+            numSegmentos > (size_t)(fim - p) / sizeof(uint32_t)) {
+            throw PersistenciaException("Manifesto " + caminho + " truncado");
+        }
+        arquivo.crcs.resize(numSegmentos);
+        memcpy(arquivo.crcs.data(), p, numSegmentos * sizeof(uint32_t));
+        p += numSegmentos * sizeof(uint32_t);
+        arquivos.push_back(move(arquivo));
+    }
+    return arquivos;
+}
+
+void CopiaSeguranca::gravarManifesto(const string& diretorio, const vector<ArquivoCopiado>& arquivos) {
+    string dados(ASSINATURA, sizeof(ASSINATURA));
+    anexarCampo(dados, VERSAO_FORMATO);
+    anexarCampo(dados, (uint32_t)TAMANHO_SEGMENTO);
+    anexarCampo(dados, (uint32_t)arquivos.size());
+    for (const ArquivoCopiado& arquivo : arquivos) {
+        anexarCampo(dados, (uint32_t)arquivo.nome.size());
+        dados.append(arquivo.nome);
+        anexarCampo(dados, arquivo.tamanho);
+        anexarCampo(dados, arquivo.modificadoEm);
+        anexarCampo(dados, (uint32_t)arquivo.crcs.size());
+        dados.append(reinterpret_cast<const char*>(arquivo.crcs.data()), arquivo.crcs.size() * sizeof(uint32_t));
+    }
+    anexarCampo(dados, crc32c(dados.data(), dados.size()));
+
+    // Temporário + rename: o manifesto anterior vale até o novo estar completo
+    string caminho = caminhoNaCopia(diretorio, NOME_MANIFESTO);
+    string temporario = caminho + ".tmp";
+    {
+        ofstream saida(temporario, ios::binary | ios::trunc);
+        if (!saida.is_open()) {
+            throw PersistenciaException("Não foi possível criar " + temporario);
+        }
+        saida.write(dados.data(), (streamsize)dados.size());
+        if (!saida.flush()) {
+            throw PersistenciaException("Falha ao gravar " + temporario);
+        }
+    }
+    error_code erro;
+    filesystem::rename(temporario, caminho, erro);
+    if (erro) {
+        throw PersistenciaException("Não foi possível substituir " + caminho + ": " + erro.message());
+    }
+}
+
+/**
+ * Lê a origem inteira; grava na cópia só os segmentos com CRC diferente
+ */
+void CopiaSeguranca::copiarArquivo(const string& origem, const string& destino, const ArquivoCopiado* anterior,
+                                   ArquivoCopiado& atual, ResumoCopia& resumo) {
+    ifstream entrada(origem, ios::binary);
+    if (!entrada.is_open()) {
+        throw PersistenciaException("Não foi possível abrir " + origem);
+    }
+    if (!filesystem::exists(destino)) {
+        ofstream criar(destino, ios::binary);
+        if (!criar.is_open()) {
+            throw PersistenciaException("Não foi possível criar " + destino);
+        }
+    }
+    fstream saida(destino, ios::in | ios::out | ios::binary);
+    if (!saida.is_open()) {
+        throw PersistenciaException("Não foi possível abrir " + destino);
+    }
+
+    vector<char> segmento(TAMANHO_SEGMENTO);
+    uint64_t posicao = 0;
+    size_t copiados = 0;
+    atual.crcs.clear();
+
+    while (true) {
+        size_t lidos = lerBloco(entrada, segmento.data(), TAMANHO_SEGMENTO);
+        if (lidos == 0) {
+            break;
+        }
+        size_t i = atual.crcs.size();
+        uint32_t crc = crc32c(segmento.data(), lidos);
+        atual.crcs.push_back(crc);
+
+        if (anterior == nullptr || i >= anterior->crcs.size() || anterior->crcs[i] != crc) {
+            saida.seekp((streamoff)posicao);
+            if (!saida.write(segmento.data(), (streamsize)lidos)) {
+                throw PersistenciaException("Falha ao gravar " + destino);
+            }
+            copiados++;
+            resumo.bytesCopiados += lidos;
+        }
+        posicao += lidos;
+        if (lidos < TAMANHO_SEGMENTO) {
+            break;
+        }
+    }
+    if (entrada.bad()) {
+        throw PersistenciaException("Falha ao ler " + origem);
+    }
+    if (!saida.flush()) {
+        throw PersistenciaException("Falha ao gravar " + destino);
+    }
+    saida.close();
+    error_code erro;
+    filesystem::resize_file(destino, posicao, erro);  // Origem encolheu: descarta a sobra
+    if (erro) {
+        throw PersistenciaException("Falha ao ajustar o tamanho de " + destino + ": " + erro.message());
+    }
+
+    atual.tamanho = posicao;
+    resumo.segmentos += atual.crcs.size();
+    resumo.segmentosCopiados += copiados;
+    if (copiados > 0 || (anterior != nullptr && anterior->tamanho != posicao)) {
+        resumo.arquivosAlterados++;
+    }
+}
+
+/**
+ * Atualiza a cópia: segmentos alterados, arquivos removidos, manifesto por último
+ */
+ResumoCopia CopiaSeguranca::copiar(const vector<string>& arquivos, const string& diretorio,
+                                   const vector<string>& regravar) {
+    ResumoCopia resumo;
+    error_code erro;
+    filesystem::create_directories(diretorio, erro);
+    if (erro) {
+        throw PersistenciaException("Não foi possível criar o diretório " + diretorio + ": " + erro.message());
+    }
+
+    bool existe = false;
+    vector<ArquivoCopiado> manifesto;
+    try {
+        manifesto = lerManifesto(diretorio, existe);
+    } catch (const PersistenciaException&) {
+        manifesto.clear();  // Sem manifesto confiável: copia tudo de novo
+    }
+    resumo.completa = manifesto.empty();
+
+    map<string, const ArquivoCopiado*> anteriores;
+    for (const ArquivoCopiado& arquivo : manifesto) {
+        anteriores[arquivo.nome] = &arquivo;
+    }
+
+    vector<ArquivoCopiado> novos;
+    novos.reserve(arquivos.size());
+    for (const string& nome : arquivos) {
+        string destino = caminhoNaCopia(diretorio, nome);
+        uintmax_t tamanhoOrigem = filesystem::file_size(nome, erro);
+        if (erro) {
+            throw PersistenciaException("Não foi possível ler " + nome + ": " + erro.message());
+        }
+        filesystem::file_time_type modificadoEm = filesystem::last_write_time(nome, erro);
+        if (erro) {
+            throw PersistenciaException("Não foi possível ler " + nome + ": " + erro.message());
+        }
+
+        ArquivoCopiado atual;
+        atual.nome = nome;
+        atual.modificadoEm = (int64_t)modificadoEm.time_since_epoch().count();
+
+        auto it = anteriores.find(nome);
+        const ArquivoCopiado* anterior = it == anteriores.end() ? nullptr : it->second;
+        uintmax_t tamanhoCopia = filesystem::file_size(destino, erro);
+        if (erro || find(regravar.begin(), regravar.end(), nome) != regravar.end()) {
+            anterior = nullptr;  // Cópia sumiu ou está danificada: grava todos os segmentos
+        }
+
+        // Tamanho e data iguais, cópia presente: arquivo não mudou (nem é lido)
+        if (anterior != nullptr && anterior->modificadoEm == atual.modificadoEm &&
+            anterior->tamanho == tamanhoOrigem && tamanhoCopia == tamanhoOrigem) {
+            novos.push_back(*anterior);
+            resumo.segmentos += anterior->crcs.size();
+            continue;
+        }
+
+        copiarArquivo(nome, destino, anterior, atual, resumo);
+        novos.push_back(move(atual));
+    }
+
+    // Arquivos que não existem mais na origem saem da cópia
+    for (const ArquivoCopiado& arquivo : manifesto) {
+        if (find(arquivos.begin(), arquivos.end(), arquivo.nome) == arquivos.end()) {
+            filesystem::remove(caminhoNaCopia(diretorio, arquivo.nome), erro);
+            resumo.arquivosRemovidos++;
+        }
+    }
+
+    gravarManifesto(diretorio, novos);
+    resumo.arquivos = novos.size();
+    return resumo;
+}
+
+/**
+ * Fila de segmentos (arquivo, índice) dividida entre threads por contador atômico
+ */
+ResumoVerificacao CopiaSeguranca::verificar(const string& diretorio, unsigned numThreads) {
+    ResumoVerificacao resumo;
+    bool existe = false;
+    vector<ArquivoCopiado> manifesto = lerManifesto(diretorio, existe);
+    if (!existe) {
+        throw PersistenciaException("Nenhuma cópia em " + diretorio);
+    }
+    resumo.arquivos = manifesto.size();
+
+    set<string> danificados;
+    mutex travaFalhas;  // Threads registram falhas ao mesmo tempo
+    auto registrarFalha = [&](const string& nome, const string& descricao) {
+        lock_guard<mutex> guarda(travaFalhas);
+        resumo.falhas.push_back(nome + ": " + descricao);
+        danificados.insert(nome);
+    };
+
+    // Arquivo ausente ou de outro tamanho: nem entra na fila
+    struct Segmento {
+        size_t arquivo;
+        size_t indice;
+    };
+    vector<Segmento> fila;
+    for (size_t a = 0; a < manifesto.size(); a++) {
+        error_code erro;
+        uintmax_t tamanho = filesystem::file_size(caminhoNaCopia(diretorio, manifesto[a].nome), erro);
+        if (erro) {
+            registrarFalha(manifesto[a].nome, "ausente na cópia");
+            continue;
+        }
+        if (tamanho != manifesto[a].tamanho) {
+            registrarFalha(manifesto[a].nome, to_string(tamanho) + " bytes, manifesto diz " +
+                                              to_string(manifesto[a].tamanho));
+            continue;
+        }
+        for (size_t s = 0; s < manifesto[a].crcs.size(); s++) {
+            fila.push_back(Segmento{a, s});
+        }
+    }
+
+    if (numThreads == 0) {
+        numThreads = max(thread::hardware_concurrency(), 1u);  // hardware_concurrency() pode retornar 0
+    }
+    numThreads = (unsigned)max<size_t>(1, min<size_t>(numThreads, fila.size()));
+    resumo.threads = numThreads;
+
+    atomic<size_t> proximo(0);
+    atomic<uint64_t> bytesLidos(0);
+
+    auto trabalhador = [&]() {
+        vector<char> buffer(TAMANHO_SEGMENTO);
+        ifstream entrada;
+        size_t arquivoAberto = manifesto.size();  // Nenhum
+
+        for (size_t i = proximo.fetch_add(1); i < fila.size(); i = proximo.fetch_add(1)) {
+            const ArquivoCopiado& arquivo = manifesto[fila[i].arquivo];
+            if (fila[i].arquivo != arquivoAberto) {
+                entrada.close();
+                entrada.clear();
+                entrada.open(caminhoNaCopia(diretorio, arquivo.nome), ios::binary);
+                arquivoAberto = fila[i].arquivo;
+            }
+
+            uint64_t posicao = (uint64_t)fila[i].indice * TAMANHO_SEGMENTO;
+            size_t esperado = (size_t)min<uint64_t>(TAMANHO_SEGMENTO, arquivo.tamanho - posicao);
+            entrada.clear();
+            entrada.seekg((streamoff)posicao);
+            size_t lidos = entrada.is_open() ? lerBloco(entrada, buffer.data(), esperado) : 0;
+            bytesLidos.fetch_add(lidos, memory_order_relaxed);
+
+            if (lidos != esperado || crc32c(buffer.data(), lidos) != arquivo.crcs[fila[i].indice]) {
+                registrarFalha(arquivo.nome, "segmento " + to_string(fila[i].indice) + " (bytes " +
+                                             to_string(posicao) + " a " + to_string(posicao + esperado) +
+                                             (lidos != esperado ? ") ilegível" : ") com CRC diferente"));
+            }
+        }
+    };
+
+    vector<thread> threads;
+    for (unsigned t = 1; t < numThreads; t++) {
+        threads.emplace_back(trabalhador);
+    }
+    trabalhador();  // A thread atual também lê
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    sort(resumo.falhas.begin(), resumo.falhas.end());
+    resumo.danificados.assign(danificados.begin(), danificados.end());
+    resumo.segmentos = fila.size();
+    resumo.bytes = bytesLidos.load();
+    return resumo;
+}
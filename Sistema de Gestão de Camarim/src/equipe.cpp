@@ -0,0 +1,232 @@
+/**
+ * @file equipe.cpp
+ * @brief Implementação das classes da equipe e GerenciadorEquipe
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa o cadastro da equipe particionado por função.
+ */
+
+// Inclui header da classe
+#include "equipe.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Para stringstream (construir strings)
+#include <sstream>
+
+/**
+ * Nome da função para exibição
+ */
+string nomeFuncao(FuncaoEquipe funcao) {
+    switch (funcao) {
+        case FuncaoEquipe::PRODUTOR:  return "Produtor";
+        case FuncaoEquipe::RUNNER:    return "Runner";
+        case FuncaoEquipe::SEGURANCA: return "Segurança";
+    }
+    return "";
+}
+
+// ==================== Classe Produtor ====================
+
+Produtor::Produtor() : Pessoa(), area("") {}
+Produtor::Produtor(int id, const string& nome, const string& area) : Pessoa(id, nome), area(area) {}
+
+string Produtor::getArea() const { return area; }
+void Produtor::setArea(const string& area) { this->area = area; }
+
+string Produtor::exibir() const {
+    return "Produtor [ID: " + to_string(id) + ", Nome: " + nome + ", Área: " + area + "]";
+}
+
+// ==================== Classe Runner ====================
+
+Runner::Runner() : Pessoa(), veiculo("") {}
+Runner::Runner(int id, const string& nome, const string& veiculo) : Pessoa(id, nome), veiculo(veiculo) {}
+
+string Runner::getVeiculo() const { return veiculo; }
+void Runner::setVeiculo(const string& veiculo) { this->veiculo = veiculo; }
+
+string Runner::exibir() const {
+    return "Runner [ID: " + to_string(id) + ", Nome: " + nome + ", Veículo: " + veiculo + "]";
+}
+
+// ==================== Classe Seguranca ====================
+
+Seguranca::Seguranca() : Pessoa(), posto("") {}
+Seguranca::Seguranca(int id, const string& nome, const string& posto) : Pessoa(id, nome), posto(posto) {}
+
+string Seguranca::getPosto() const { return posto; }
+void Seguranca::setPosto(const string& posto) { this->posto = posto; }
+
+string Seguranca::exibir() const {
+    return "Segurança [ID: " + to_string(id) + ", Nome: " + nome + ", Posto: " + posto + "]";
+}
+
+// ==================== Classe GerenciadorEquipe ====================
+
+/**
+ * Construtor - equipe vazia
+ */
+GerenciadorEquipe::GerenciadorEquipe() : proximoId(1), alterados(nullptr) {}
+
+/**
+ * Valida nome e atributo
+ */
+void GerenciadorEquipe::validar(const string& nome, const string& atributo, const string& rotulo) {
+    if (nome.empty()) {
+        throw ValidacaoException("Nome não pode ser vazio");
+    }
+    if (atributo.empty()) {
+        throw ValidacaoException(rotulo + " não pode ser vazio");
+    }
+}
+
+/**
+ * Remove trocando com o último: só a pessoa movida tem o índice atualizado
+ */
+template<typename T>
+void GerenciadorEquipe::removerTrocando(vector<T>& pessoas, unordered_map<int, size_t>& indice, int id) {
+    auto it = indice.find(id);
+    size_t posicao = it->second;
+    indice.erase(it);
+
+    if (posicao != pessoas.size() - 1) {
+        pessoas[posicao] = std::move(pessoas.back());
+        indice[pessoas[posicao].getId()] = posicao;
+    }
+    pessoas.pop_back();
+}
+
+/**
+ * Anota alteração para o log
+ */
+void GerenciadorEquipe::anotar(int id) {
+    if (alterados != nullptr) {
+        alterados->push_back(id);
+    }
+}
+
+// ==================== CREATE ====================
+
+int GerenciadorEquipe::cadastrarProdutor(const string& nome, const string& area) {
+    validar(nome, area, "Área");
+    indiceProdutores[proximoId] = produtores.size();
+    produtores.emplace_back(proximoId, nome, area);  // Construído direto no vetor
+    funcaoPorId[proximoId] = FuncaoEquipe::PRODUTOR;
+    anotar(proximoId);
+    return proximoId++;
+}
+
+int GerenciadorEquipe::cadastrarRunner(const string& nome, const string& veiculo) {
+    validar(nome, veiculo, "Veículo");
+    indiceRunners[proximoId] = runners.size();
+    runners.emplace_back(proximoId, nome, veiculo);
+    funcaoPorId[proximoId] = FuncaoEquipe::RUNNER;
+    anotar(proximoId);
+    return proximoId++;
+}
+
+int GerenciadorEquipe::cadastrarSeguranca(const string& nome, const string& posto) {
+    validar(nome, posto, "Posto");
+    indiceSegurancas[proximoId] = segurancas.size();
+    segurancas.emplace_back(proximoId, nome, posto);
+    funcaoPorId[proximoId] = FuncaoEquipe::SEGURANCA;
+    anotar(proximoId);
+    return proximoId++;
+}
+
+// ==================== READ ====================
+
+Produtor* GerenciadorEquipe::buscarProdutor(int id) {
+    auto it = indiceProdutores.find(id);
+    return it == indiceProdutores.end() ? nullptr : &produtores[it->second];
+}
+
+Runner* GerenciadorEquipe::buscarRunner(int id) {
+    auto it = indiceRunners.find(id);
+    return it == indiceRunners.end() ? nullptr : &runners[it->second];
+}
+
+Seguranca* GerenciadorEquipe::buscarSeguranca(int id) {
+    auto it = indiceSegurancas.find(id);
+    return it == indiceSegurancas.end() ? nullptr : &segurancas[it->second];
+}
+
+bool GerenciadorEquipe::buscarFuncao(int id, FuncaoEquipe& funcao) const {
+    auto it = funcaoPorId.find(id);
+    if (it == funcaoPorId.end()) {
+        return false;
+    }
+    funcao = it->second;
+    return true;
+}
+
+const vector<Produtor>& GerenciadorEquipe::getProdutores() const { return produtores; }
+const vector<Runner>& GerenciadorEquipe::getRunners() const { return runners; }
+const vector<Seguranca>& GerenciadorEquipe::getSegurancas() const { return segurancas; }
+
+size_t GerenciadorEquipe::quantidade() const {
+    return funcaoPorId.size();
+}
+
+size_t GerenciadorEquipe::quantidade(FuncaoEquipe funcao) const {
+    switch (funcao) {
+        case FuncaoEquipe::PRODUTOR:  return produtores.size();
+        case FuncaoEquipe::RUNNER:    return runners.size();
+        case FuncaoEquipe::SEGURANCA: return segurancas.size();
+    }
+    return 0;
+}
+
+// ==================== DELETE ====================
+
+bool GerenciadorEquipe::remover(int id) {
+    auto it = funcaoPorId.find(id);
+    if (it == funcaoPorId.end()) {
+        return false;
+    }
+
+    switch (it->second) {
+        case FuncaoEquipe::PRODUTOR:
+            removerTrocando(produtores, indiceProdutores, id);
+            break;
+        case FuncaoEquipe::RUNNER:
+            removerTrocando(runners, indiceRunners, id);
+            break;
+        case FuncaoEquipe::SEGURANCA:
+            removerTrocando(segurancas, indiceSegurancas, id);
+            break;
+    }
+    funcaoPorId.erase(it);
+    anotar(id);  // Ausente na confirmação = removido
+    return true;
+}
+
+// ==================== PERCURSO ====================
+
+vector<int> GerenciadorEquipe::buscarPorNome(const string& trecho) const {
+    return filtrar([&trecho](const auto& pessoa) {
+        return pessoa.getNome().find(trecho) != string::npos;
+    });
+}
+
+/**
+ * Equipe inteira em uma única string (sem stream por pessoa)
+ */
+string GerenciadorEquipe::exibir() const {
+    string saida;
+    saida.reserve(quantidade() * 64);  // Estimativa de uma linha por pessoa
+    paraCada([&saida](const auto& pessoa) {
+        saida += pessoa.exibir();  // Tipo concreto e final: chamada direta
+        saida += '\n';
+    });
+    return saida;
+}
+
+/**
+ * Liga log de alterações
+ */
+void GerenciadorEquipe::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+}
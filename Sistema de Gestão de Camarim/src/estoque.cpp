@@ -16,11 +16,13 @@
 #include <sstream>
 // Para formatação (setw, left)
 #include <iomanip>
+// Para numeric_limits (limite de quantidade no lote)
+#include <limits>
 
 /**
  * Construtor - inicializa map vazio
  */
-Estoque::Estoque() {}
+Estoque::Estoque() : alterados(nullptr) {}
 // Map é inicializado vazio automaticamente
 
 /**
@@ -56,6 +58,46 @@ void Estoque::adicionarItem(int itemId, const string& nomeItem, int quantidade)
         itens[itemId] = ItemEstoque(itemId, nomeItem, quantidade);
         // Chama construtor parametrizado de ItemEstoque
     }
+    
+    avisarSaldo(itemId);
+    
+    // Avisa quem espera reposição (ex: backorders de pedidos)
+    if (quantidade > 0 && observadorEntrada) {
+        observadorEntrada(itemId);
+    }
+}
+
+/**
+ * Define observador de entradas
+ */
+void Estoque::definirObservadorEntrada(function<void(int itemId)> observador) {
+    observadorEntrada = observador;
+}
+
+/**
+ * Define observador de saldo
+ */
+void Estoque::definirObservadorSaldo(function<void(int itemId)> observador) {
+    observadorSaldo = observador;
+}
+
+/**
+ * Avisa observador de saldo
+ */
+void Estoque::avisarSaldo(int itemId) {
+    if (alterados != nullptr) {
+        alterados->push_back(itemId);
+    }
+    if (observadorSaldo) {
+        observadorSaldo(itemId);
+    }
+}
+
+/**
+ * Liga log de alterações
+ */
+void Estoque::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
 }
 
 /**
@@ -91,9 +133,104 @@ bool Estoque::removerItem(int itemId, int quantidade) {
         itens.erase(itemId);  // erase() remove elemento do map
     }
     
+    avisarSaldo(itemId);
     return true;  // Sucesso
 }
 
+/**
+ * Remove vários itens de uma vez (tudo ou nada)
+ */
+void Estoque::removerLote(const map<int, int>& quantidades) {
+    // FASE 1: valida TODOS os itens sem modificar nada
+    for (const auto& par : quantidades) {
+        if (par.second < 0) {
+            throw ValidacaoException("Quantidade não pode ser negativa");
+        }
+        
+        auto it = itens.find(par.first);
+        int disponivel = (it == itens.end()) ? 0 : it->second.quantidade;
+        
+        if (disponivel < par.second) {
+            throw EstoqueInsuficienteException(
+                "Item ID " + to_string(par.first) +
+                ". Disponível: " + to_string(disponivel) +
+                ", Solicitado: " + to_string(par.second)
+            );
+        }
+    }
+    
+    // FASE 2: aplica todas as saídas (não pode mais falhar)
+    for (const auto& par : quantidades) {
+        auto it = itens.find(par.first);
+        if (it == itens.end()) {
+            continue;  // Só ocorre com quantidade 0 para item inexistente
+        }
+        
+        it->second.quantidade -= par.second;
+        if (it->second.quantidade == 0) {
+            itens.erase(it);  // Remove item zerado (mesma regra de removerItem)
+        }
+    }
+    
+    // FASE 3: avisos só depois do lote inteiro aplicado
+    for (const auto& par : quantidades) {
+        if (par.second > 0) {
+            avisarSaldo(par.first);
+        }
+    }
+}
+
+/**
+ * Adiciona vários itens de uma vez (tudo ou nada)
+ */
+void Estoque::adicionarLote(const vector<ItemEstoque>& entradas) {
+    // FASE 1: valida TODAS as entradas sem modificar nada
+    map<int, long long> novosSaldos;  // Saldo final de cada item (detecta estouro de int)
+    for (const auto& entrada : entradas) {
+        if (entrada.itemId < 0) {
+            throw ValidacaoException("ID do item inválido");
+        }
+        if (entrada.nomeItem.empty()) {
+            throw ValidacaoException("Nome do item não pode ser vazio");
+        }
+        if (entrada.quantidade < 0) {
+            throw ValidacaoException("Quantidade não pode ser negativa");
+        }
+        
+        auto saldo = novosSaldos.find(entrada.itemId);
+        if (saldo == novosSaldos.end()) {
+            saldo = novosSaldos.emplace(entrada.itemId, obterQuantidade(entrada.itemId)).first;
+        }
+        saldo->second += entrada.quantidade;
+        if (saldo->second > numeric_limits<int>::max()) {
+            throw ValidacaoException("Quantidade do item ID " + to_string(entrada.itemId) +
+                                     " excede o limite do estoque");
+        }
+    }
+    
+    // FASE 2: aplica todas as entradas (não pode mais falhar)
+    for (const auto& entrada : entradas) {
+        auto it = itens.find(entrada.itemId);
+        if (it == itens.end()) {
+            itens[entrada.itemId] = entrada;  // Item novo no estoque
+        } else {
+            it->second.quantidade += entrada.quantidade;
+        }
+    }
+    
+    // FASE 3: avisos só depois do lote inteiro aplicado
+    for (const auto& par : novosSaldos) {
+        avisarSaldo(par.first);
+    }
+    if (observadorEntrada) {
+        for (const auto& par : novosSaldos) {
+            if (par.second > 0) {
+                observadorEntrada(par.first);  // Ex: backorders que esperavam o item
+            }
+        }
+    }
+}
+
 /**
  * Verifica se há quantidade suficiente de um item
  */
@@ -168,6 +305,8 @@ void Estoque::atualizarQuantidade(int itemId, int novaQuantidade) {
     if (novaQuantidade == 0) {
         itens.erase(itemId);
     }
+    
+    avisarSaldo(itemId);
 }
 
 /**
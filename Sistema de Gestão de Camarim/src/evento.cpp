@@ -0,0 +1,210 @@
+/**
+ * @file evento.cpp
+ * @brief Implementação das classes Evento e GerenciadorEventos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa a partição do sistema por evento e os relatórios paralelos.
+ */
+
+// Inclui header da classe
+#include "evento.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Para std::async / future (uma tarefa por evento)
+#include <future>
+// Para stringstream (construir strings)
+#include <sstream>
+// Para formatação (setw, left)
+#include <iomanip>
+
+// ==================== Classe Evento ====================
+
+/**
+ * Construtor - evento com gerenciadores vazios
+ */
+Evento::Evento(int id, const string& nome) : id(id), nome(nome), listaAutomatica(itens, camarins, riders) {}
+
+// ==================== GETTERS ====================
+
+int Evento::getId() const { return id; }
+string Evento::getNome() const { return nome; }
+mutex& Evento::getTrava() const { return trava; }
+
+GerenciadorArtistas& Evento::getArtistas() { return artistas; }
+GerenciadorItens& Evento::getItens() { return itens; }
+Estoque& Evento::getEstoque() { return estoque; }
+GerenciadorCamarins& Evento::getCamarins() { return camarins; }
+GerenciadorPedidos& Evento::getPedidos() { return pedidos; }
+GerenciadorListaCompras& Evento::getListasCompras() { return listasCompras; }
+GerenciadorRiders& Evento::getRiders() { return riders; }
+IndiceAtribuicao& Evento::getAtribuicoes() { return atribuicoes; }
+AgendaCamarins& Evento::getAgenda() { return agenda; }
+GerenciadorEquipe& Evento::getEquipe() { return equipe; }
+ListaAutomatica& Evento::getListaAutomatica() { return listaAutomatica; }
+CatalogoFornecedores& Evento::getFornecedores() { return fornecedores; }
+DiarioRecebimentos& Evento::getRecebimentos() { return recebimentos; }
+
+const GerenciadorArtistas& Evento::getArtistas() const { return artistas; }
+const Estoque& Evento::getEstoque() const { return estoque; }
+const GerenciadorCamarins& Evento::getCamarins() const { return camarins; }
+const GerenciadorPedidos& Evento::getPedidos() const { return pedidos; }
+
+// ==================== Classe GerenciadorEventos ====================
+
+/**
+ * Construtor - nenhum evento
+ */
+GerenciadorEventos::GerenciadorEventos() : proximoId(1) {}
+
+/**
+ * Cria novo evento
+ */
+int GerenciadorEventos::criar(const string& nome) {
+    if (nome.empty()) {
+        throw ValidacaoException("Nome do evento não pode ser vazio");
+    }
+
+    eventos[proximoId] = unique_ptr<Evento>(new Evento(proximoId, nome));
+    return proximoId++;
+}
+
+/**
+ * Busca evento por ID
+ */
+Evento* GerenciadorEventos::buscarPorId(int id) {
+    auto it = eventos.find(id);
+    return it == eventos.end() ? nullptr : it->second.get();
+}
+
+/**
+ * Remove evento
+ */
+bool GerenciadorEventos::remover(int id) {
+    return eventos.erase(id) > 0;
+}
+
+/**
+ * Lista IDs e nomes
+ */
+vector<pair<int, string>> GerenciadorEventos::listar() const {
+    vector<pair<int, string>> lista;
+    for (const auto& par : eventos) {
+        lista.push_back(make_pair(par.first, par.second->getNome()));
+    }
+    return lista;
+}
+
+/**
+ * Executa operação em um evento sob a trava dele
+ */
+void GerenciadorEventos::executar(int id, const function<void(Evento&)>& operacao) {
+    Evento* evento = buscarPorId(id);
+    if (evento == nullptr) {
+        throw ValidacaoException("Evento com ID " + to_string(id) + " não encontrado");
+    }
+
+    lock_guard<mutex> guarda(evento->getTrava());
+    operacao(*evento);
+}
+
+/**
+ * Executa operação em todos os eventos em paralelo
+ */
+void GerenciadorEventos::paraCadaEmParalelo(const function<void(Evento&)>& operacao) {
+    // Um único evento não precisa de thread extra
+    launch politica = eventos.size() > 1 ? launch::async : launch::deferred;
+
+    vector<future<void>> tarefas;
+    tarefas.reserve(eventos.size());
+    for (auto& par : eventos) {
+        Evento* evento = par.second.get();
+        tarefas.push_back(async(politica, [evento, &operacao]() {
+            lock_guard<mutex> guarda(evento->getTrava());  // Cada tarefa trava só o seu evento
+            operacao(*evento);
+        }));
+    }
+
+    // Espera TODAS as tarefas antes de relançar (operacao é referência desta pilha)
+    exception_ptr primeiroErro;
+    for (auto& tarefa : tarefas) {
+        try {
+            tarefa.get();
+        } catch (...) {
+            if (!primeiroErro) {
+                primeiroErro = current_exception();
+            }
+        }
+    }
+    if (primeiroErro) {
+        rethrow_exception(primeiroErro);
+    }
+}
+
+/**
+ * Resumo de todos os eventos (em paralelo)
+ */
+vector<ResumoEvento> GerenciadorEventos::resumir() {
+    // Posição de cada evento no resultado definida antes: cada tarefa escreve só a sua
+    vector<ResumoEvento> resumos(eventos.size());
+    map<int, size_t> posicao;
+    for (const auto& par : eventos) {
+        size_t indice = posicao.size();
+        posicao[par.first] = indice;
+    }
+
+    paraCadaEmParalelo([&resumos, &posicao](Evento& evento) {
+        ResumoEvento& resumo = resumos[posicao.at(evento.getId())];
+        resumo.eventoId = evento.getId();
+        resumo.nome = evento.getNome();
+        resumo.artistas = evento.getArtistas().getArtistas().size();  // Por referência: só conta
+        resumo.camarins = evento.getCamarins().getCamarins().size();
+        resumo.pedidosPendentes = evento.getPedidos().listarPendentes().size();
+        resumo.pedidosAtendidos = evento.getPedidos().quantidadeEmMemoria() -
+                                  resumo.pedidosPendentes +
+                                  evento.getPedidos().quantidadeArquivados();
+
+        vector<ItemEstoque> itens = evento.getEstoque().listar();
+        resumo.itensEstoque = itens.size();
+        for (const auto& item : itens) {
+            resumo.unidadesEstoque += item.quantidade;
+        }
+    });
+    return resumos;
+}
+
+/**
+ * Relatório consolidado formatado
+ */
+string GerenciadorEventos::exibirRelatorio(const vector<ResumoEvento>& resumos) {
+    stringstream ss;
+    ResumoEvento total;
+
+    ss << left << setw(5) << "ID" << setw(22) << "Evento"
+       << right << setw(10) << "Artistas" << setw(10) << "Camarins"
+       << setw(11) << "Pendentes" << setw(11) << "Atendidos"
+       << setw(8) << "Itens" << setw(10) << "Unidades" << "\n";
+    ss << string(87, '-') << "\n";
+
+    for (const auto& resumo : resumos) {
+        ss << left << setw(5) << resumo.eventoId << setw(22) << resumo.nome.substr(0, 21)
+           << right << setw(10) << resumo.artistas << setw(10) << resumo.camarins
+           << setw(11) << resumo.pedidosPendentes << setw(11) << resumo.pedidosAtendidos
+           << setw(8) << resumo.itensEstoque << setw(10) << resumo.unidadesEstoque << "\n";
+
+        total.artistas += resumo.artistas;
+        total.camarins += resumo.camarins;
+        total.pedidosPendentes += resumo.pedidosPendentes;
+        total.pedidosAtendidos += resumo.pedidosAtendidos;
+        total.itensEstoque += resumo.itensEstoque;
+        total.unidadesEstoque += resumo.unidadesEstoque;
+    }
+
+    ss << string(87, '-') << "\n";
+    ss << left << setw(5) << "" << setw(22) << "TOTAL"
+       << right << setw(10) << total.artistas << setw(10) << total.camarins
+       << setw(11) << total.pedidosPendentes << setw(11) << total.pedidosAtendidos
+       << setw(8) << total.itensEstoque << setw(10) << total.unidadesEstoque << "\n";
+    return ss.str();
+}
@@ -0,0 +1,547 @@
+/**
+ * @file exportacao.cpp
+ * @brief Implementação das classes SaidaExportacao e ExportadorDados
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Formatação de números e textos direto no buffer de saída e um
+ * exportador por tipo de dado (CSV e JSON).
+ */
+
+// Inclui header das classes
+#include "exportacao.h"
+// Inclui eventos e todos os gerenciadores deles
+#include "evento.h"
+// Inclui exceções personalizadas
+#include "excecoes.h"
+// Para to_chars (inteiro -> texto sem alocação)
+#include <charconv>
+// Para strlen
+#include <cstring>
+// Para llround (preço do catálogo -> centavos)
+#include <cmath>
+// Para renomear o temporário
+#include <filesystem>
+
+#ifndef _WIN32
+// Descritor de arquivo (POSIX)
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+// ==================== SAÍDA COM BUFFER ====================
+
+/**
+ * Construtor - cria o arquivo
+ */
+SaidaExportacao::SaidaExportacao(const string& caminho) : caminho(caminho), usado(0), escritos(0) {
+#ifdef _WIN32
+    arquivo = fopen(caminho.c_str(), "wb");
+    if (arquivo == nullptr) {
+        throw PersistenciaException("Não foi possível criar " + caminho);
+    }
+#else
+    descritor = open(caminho.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descritor < 0) {
+        throw PersistenciaException("Não foi possível criar " + caminho);
+    }
+#endif
+}
+
+/**
+ * Destrutor - só fecha (saída abandonada por erro)
+ */
+SaidaExportacao::~SaidaExportacao() {
+#ifdef _WIN32
+    if (arquivo != nullptr) {
+        fclose(arquivo);
+    }
+#else
+    if (descritor >= 0) {
+        close(descritor);
+    }
+#endif
+}
+
+/**
+ * Escreve o buffer inteiro (write pode escrever menos que o pedido)
+ */
+void SaidaExportacao::descarregar() {
+    size_t feito = 0;
+#ifdef _WIN32
+    feito = fwrite(buffer, 1, usado, arquivo);
+#else
+    while (feito < usado) {
+        ssize_t resultado = write(descritor, buffer + feito, usado - feito);
+        if (resultado < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        feito += (size_t)resultado;
+    }
+#endif
+    if (feito != usado) {
+        throw PersistenciaException("Falha ao gravar a exportação em " + caminho);
+    }
+    escritos += usado;
+    usado = 0;
+}
+
+void SaidaExportacao::escrever(const char* dados, size_t tamanho) {
+    while (tamanho > 0) {
+        if (usado == TAMANHO_BUFFER) {
+            descarregar();
+        }
+        size_t parte = min(tamanho, TAMANHO_BUFFER - usado);
+        memcpy(buffer + usado, dados, parte);
+        usado += parte;
+        dados += parte;
+        tamanho -= parte;
+    }
+}
+
+void SaidaExportacao::escrever(const char* texto) {
+    escrever(texto, strlen(texto));
+}
+
+void SaidaExportacao::escrever(char caractere) {
+    if (usado == TAMANHO_BUFFER) {
+        descarregar();
+    }
+    buffer[usado++] = caractere;
+}
+
+/**
+ * Inteiro formatado direto no buffer (20 dígitos + sinal cabem sempre)
+ */
+void SaidaExportacao::inteiro(long long valor) {
+    if (TAMANHO_BUFFER - usado < 24) {
+        descarregar();
+    }
+    to_chars_result resultado = to_chars(buffer + usado, buffer + TAMANHO_BUFFER, valor);
+    usado = (size_t)(resultado.ptr - buffer);
+}
+
+/**
+ * Centavos como reais: parte inteira, ponto e dois dígitos
+ */
+void SaidaExportacao::centavos(long long valor) {
+    if (valor < 0) {
+        escrever('-');
+        valor = -valor;
+    }
+    inteiro(valor / 100);
+    escrever('.');
+    escrever((char)('0' + valor % 100 / 10));
+    escrever((char)('0' + valor % 10));
+}
+
+/**
+ * Texto no CSV: aspas só se tiver separador, aspas ou quebra de linha
+ */
+void SaidaExportacao::textoCsv(const string& texto) {
+    if (texto.find_first_of(",\"\r\n") == string::npos) {
+        escrever(texto.data(), texto.size());
+        return;
+    }
+    escrever('"');
+    size_t inicio = 0;
+    for (size_t i = 0; i < texto.size(); i++) {
+        if (texto[i] == '"') {
+            escrever(texto.data() + inicio, i - inicio + 1);  // Inclui a aspa...
+            escrever('"');                                    // ...e a dobra
+            inicio = i + 1;
+        }
+    }
+    escrever(texto.data() + inicio, texto.size() - inicio);
+    escrever('"');
+}
+
+/**
+ * Texto no JSON: trechos sem escape são copiados de uma vez
+ */
+void SaidaExportacao::textoJson(const string& texto) {
+    static const char HEX[] = "0123456789abcdef";
+    escrever('"');
+    size_t inicio = 0;
+    for (size_t i = 0; i < texto.size(); i++) {
+        unsigned char c = (unsigned char)texto[i];
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;  // UTF-8 passa como está
+        }
+        escrever(texto.data() + inicio, i - inicio);
+        inicio = i + 1;
+        switch (c) {
+            case '"':  escrever("\\\"", 2); break;
+            case '\\': escrever("\\\\", 2); break;
+            case '\n': escrever("\\n", 2); break;
+            case '\r': escrever("\\r", 2); break;
+            case '\t': escrever("\\t", 2); break;
+            default: {
+                char escape[6] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xF]};
+                escrever(escape, sizeof(escape));
+            }
+        }
+    }
+    escrever(texto.data() + inicio, texto.size() - inicio);
+    escrever('"');
+}
+
+/**
+ * Descarrega e fecha
+ */
+void SaidaExportacao::fechar() {
+    descarregar();
+#ifdef _WIN32
+    bool ok = fclose(arquivo) == 0;
+    arquivo = nullptr;
+#else
+    bool ok = close(descritor) == 0;
+    descritor = -1;
+#endif
+    if (!ok) {
+        throw PersistenciaException("Falha ao fechar a exportação " + caminho);
+    }
+}
+
+uint64_t SaidaExportacao::getBytes() const {
+    return escritos + usado;
+}
+
+// ==================== EXPORTADORES ====================
+
+/**
+ * Separador entre objetos do array JSON
+ */
+static void abrirObjeto(SaidaExportacao& saida, size_t indice) {
+    saida.escrever(indice == 0 ? "\n  {" : ",\n  {");
+}
+
+/**
+ * Catálogo: id, nome, preço
+ */
+size_t ExportadorDados::exportarCatalogo(Evento& evento, FormatoExportacao formato, SaidaExportacao& saida) {
+    const vector<Item>& itens = evento.getItens().itens;
+    if (formato == FormatoExportacao::CSV) {
+        saida.escrever("id,nome,preco\n");
+        for (const Item& item : itens) {
+            saida.inteiro(item.id);
+            saida.escrever(',');
+            saida.textoCsv(item.nome);
+            saida.escrever(',');
+            saida.centavos(llround(item.preco * 100));
+            saida.escrever('\n');
+        }
+        return itens.size();
+    }
+    saida.escrever('[');
+    for (size_t i = 0; i < itens.size(); i++) {
+        abrirObjeto(saida, i);
+        saida.escrever("\"id\":");
+        saida.inteiro(itens[i].id);
+        saida.escrever(",\"nome\":");
+        saida.textoJson(itens[i].nome);
+        saida.escrever(",\"preco\":");
+        saida.centavos(llround(itens[i].preco * 100));
+        saida.escrever('}');
+    }
+    saida.escrever("\n]\n");
+    return itens.size();
+}
+
+/**
+ * Estoque: itemId, nome, quantidade
+ */
+size_t ExportadorDados::exportarEstoque(Evento& evento, FormatoExportacao formato, SaidaExportacao& saida) {
+    const map<int, ItemEstoque>& saldos = evento.getEstoque().itens;
+    if (formato == FormatoExportacao::CSV) {
+        saida.escrever("item_id,nome,quantidade\n");
+        for (const auto& par : saldos) {
+            saida.inteiro(par.second.itemId);
+            saida.escrever(',');
+            saida.textoCsv(par.second.nomeItem);
+            saida.escrever(',');
+            saida.inteiro(par.second.quantidade);
+            saida.escrever('\n');
+        }
+        return saldos.size();
+    }
+    saida.escrever('[');
+    size_t i = 0;
+    for (const auto& par : saldos) {
+        abrirObjeto(saida, i++);
+        saida.escrever("\"item_id\":");
+        saida.inteiro(par.second.itemId);
+        saida.escrever(",\"nome\":");
+        saida.textoJson(par.second.nomeItem);
+        saida.escrever(",\"quantidade\":");
+        saida.inteiro(par.second.quantidade);
+        saida.escrever('}');
+    }
+    saida.escrever("\n]\n");
+    return saldos.size();
+}
+
+/**
+ * Camarins: CSV com uma linha por item do camarim
+ */
+size_t ExportadorDados::exportarCamarins(Evento& evento, FormatoExportacao formato, SaidaExportacao& saida) {
+    const vector<Camarim>& camarins = evento.getCamarins().getCamarins();
+    if (formato == FormatoExportacao::CSV) {
+        size_t linhas = 0;
+        saida.escrever("camarim_id,nome,artista_id,item_id,item,quantidade\n");
+        for (const Camarim& camarim : camarins) {
+            auto cabecalho = [&]() {
+                saida.inteiro(camarim.id);
+                saida.escrever(',');
+                saida.textoCsv(camarim.nome);
+                saida.escrever(',');
+                saida.inteiro(camarim.artistaId);
+                saida.escrever(',');
+            };
+            if (camarim.itens.empty()) {
+                cabecalho();
+                saida.escrever(",,\n");
+                linhas++;
+            }
+            for (const auto& par : camarim.itens) {
+                cabecalho();
+                saida.inteiro(par.second.itemId);
+                saida.escrever(',');
+                saida.textoCsv(par.second.nomeItem);
+                saida.escrever(',');
+                saida.inteiro(par.second.quantidade);
+                saida.escrever('\n');
+                linhas++;
+            }
+        }
+        return linhas;
+    }
+    saida.escrever('[');
+    for (size_t i = 0; i < camarins.size(); i++) {
+        const Camarim& camarim = camarins[i];
+        abrirObjeto(saida, i);
+        saida.escrever("\"id\":");
+        saida.inteiro(camarim.id);
+        saida.escrever(",\"nome\":");
+        saida.textoJson(camarim.nome);
+        saida.escrever(",\"artista_id\":");
+        saida.inteiro(camarim.artistaId);
+        saida.escrever(",\"itens\":[");
+        bool primeiro = true;
+        for (const auto& par : camarim.itens) {
+            saida.escrever(primeiro ? "{\"item_id\":" : ",{\"item_id\":");
+            primeiro = false;
+            saida.inteiro(par.second.itemId);
+            saida.escrever(",\"nome\":");
+            saida.textoJson(par.second.nomeItem);
+            saida.escrever(",\"quantidade\":");
+            saida.inteiro(par.second.quantidade);
+            saida.escrever('}');
+        }
+        saida.escrever("]}");
+    }
+    saida.escrever("\n]\n");
+    return camarins.size();
+}
+
+/**
+ * Situação do pedido como texto fixo
+ */
+static const char* situacaoPedido(bool atendido, bool aguardandoEstoque) {
+    if (atendido) {
+        return "atendido";
+    }
+    return aguardandoEstoque ? "aguardando_estoque" : "pendente";
+}
+
+/**
+ * Pedidos: CSV com uma linha por item do pedido
+ */
+size_t ExportadorDados::exportarPedidos(Evento& evento, FormatoExportacao formato, SaidaExportacao& saida) {
+    const vector<Pedido>& pedidos = evento.getPedidos().pedidos;
+    if (formato == FormatoExportacao::CSV) {
+        size_t linhas = 0;
+        saida.escrever("pedido_id,camarim_id,artista,prioridade,situacao,pedido_origem_id,backorder_id,"
+                       "item_id,item,quantidade,atendida\n");
+        for (const Pedido& pedido : pedidos) {
+            auto cabecalho = [&]() {
+                saida.inteiro(pedido.id);
+                saida.escrever(',');
+                saida.inteiro(pedido.camarimId);
+                saida.escrever(',');
+                saida.textoCsv(pedido.nomeArtista);
+                saida.escrever(',');
+                saida.inteiro(pedido.prioridade);
+                saida.escrever(',');
+                saida.escrever(situacaoPedido(pedido.atendido, pedido.aguardandoEstoque));
+                saida.escrever(',');
+                saida.inteiro(pedido.pedidoOrigemId);
+                saida.escrever(',');
+                saida.inteiro(pedido.backorderId);
+                saida.escrever(',');
+            };
+            if (pedido.itens.empty()) {
+                cabecalho();
+                saida.escrever(",,,\n");
+                linhas++;
+            }
+            for (const auto& par : pedido.itens) {
+                cabecalho();
+                saida.inteiro(par.second.itemId);
+                saida.escrever(',');
+                saida.textoCsv(par.second.nomeItem);
+                saida.escrever(',');
+                saida.inteiro(par.second.quantidade);
+                saida.escrever(',');
+                saida.inteiro(par.second.quantidadeAtendida);
+                saida.escrever('\n');
+                linhas++;
+            }
+        }
+        return linhas;
+    }
+    saida.escrever('[');
+    for (size_t i = 0; i < pedidos.size(); i++) {
+        const Pedido& pedido = pedidos[i];
+        abrirObjeto(saida, i);
+        saida.escrever("\"id\":");
+        saida.inteiro(pedido.id);
+        saida.escrever(",\"camarim_id\":");
+        saida.inteiro(pedido.camarimId);
+        saida.escrever(",\"artista\":");
+        saida.textoJson(pedido.nomeArtista);
+        saida.escrever(",\"prioridade\":");
+        saida.inteiro(pedido.prioridade);
+        saida.escrever(",\"situacao\":\"");
+        saida.escrever(situacaoPedido(pedido.atendido, pedido.aguardandoEstoque));
+        saida.escrever("\",\"pedido_origem_id\":");
+        saida.inteiro(pedido.pedidoOrigemId);
+        saida.escrever(",\"backorder_id\":");
+        saida.inteiro(pedido.backorderId);
+        saida.escrever(",\"itens\":[");
+        bool primeiro = true;
+        for (const auto& par : pedido.itens) {
+            saida.escrever(primeiro ? "{\"item_id\":" : ",{\"item_id\":");
+            primeiro = false;
+            saida.inteiro(par.second.itemId);
+            saida.escrever(",\"nome\":");
+            saida.textoJson(par.second.nomeItem);
+            saida.escrever(",\"quantidade\":");
+            saida.inteiro(par.second.quantidade);
+            saida.escrever(",\"atendida\":");
+            saida.inteiro(par.second.quantidadeAtendida);
+            saida.escrever('}');
+        }
+        saida.escrever("]}");
+    }
+    saida.escrever("\n]\n");
+    return pedidos.size();
+}
+
+/**
+ * Listas de compras: CSV com uma linha por item (preços já reprecificados)
+ */
+size_t ExportadorDados::exportarListas(Evento& evento, FormatoExportacao formato, SaidaExportacao& saida) {
+    GerenciadorListaCompras& gerenciador = evento.getListasCompras();
+    gerenciador.reprecificar(evento.getItens());  // Linhas que acompanham o catálogo saem com o preço atual
+    const vector<ListaCompras>& listas = gerenciador.listas;
+    if (formato == FormatoExportacao::CSV) {
+        size_t linhas = 0;
+        saida.escrever("lista_id,descricao,item_id,item,quantidade,preco,subtotal\n");
+        for (const ListaCompras& lista : listas) {
+            auto cabecalho = [&]() {
+                saida.inteiro(lista.id);
+                saida.escrever(',');
+                saida.textoCsv(lista.descricao);
+                saida.escrever(',');
+            };
+            if (lista.itens.empty()) {
+                cabecalho();
+                saida.escrever(",,,,\n");
+                linhas++;
+            }
+            for (const auto& par : lista.itens) {
+                cabecalho();
+                saida.inteiro(par.second.itemId);
+                saida.escrever(',');
+                saida.textoCsv(par.second.nomeItem);
+                saida.escrever(',');
+                saida.inteiro(par.second.quantidade);
+                saida.escrever(',');
+                saida.centavos(par.second.precoCentavos);
+                saida.escrever(',');
+                saida.centavos(par.second.precoCentavos * par.second.quantidade);
+                saida.escrever('\n');
+                linhas++;
+            }
+        }
+        return linhas;
+    }
+    saida.escrever('[');
+    for (size_t i = 0; i < listas.size(); i++) {
+        const ListaCompras& lista = listas[i];
+        abrirObjeto(saida, i);
+        saida.escrever("\"id\":");
+        saida.inteiro(lista.id);
+        saida.escrever(",\"descricao\":");
+        saida.textoJson(lista.descricao);
+        saida.escrever(",\"total\":");
+        saida.centavos(lista.totalCentavos);
+        saida.escrever(",\"itens\":[");
+        bool primeiro = true;
+        for (const auto& par : lista.itens) {
+            saida.escrever(primeiro ? "{\"item_id\":" : ",{\"item_id\":");
+            primeiro = false;
+            saida.inteiro(par.second.itemId);
+            saida.escrever(",\"nome\":");
+            saida.textoJson(par.second.nomeItem);
+            saida.escrever(",\"quantidade\":");
+            saida.inteiro(par.second.quantidade);
+            saida.escrever(",\"preco\":");
+            saida.centavos(par.second.precoCentavos);
+            saida.escrever(",\"subtotal\":");
+            saida.centavos(par.second.precoCentavos * par.second.quantidade);
+            saida.escrever('}');
+        }
+        saida.escrever("]}");
+    }
+    saida.escrever("\n]\n");
+    return listas.size();
+}
+
+/**
+ * Exporta para um temporário e renomeia
+ */
+ResumoExportacao ExportadorDados::exportar(Evento& evento, TipoExportacao tipo, FormatoExportacao formato,
+                                           const string& caminho) {
+    string temporario = caminho + ".tmp";
+    ResumoExportacao resumo;
+    try {
+        SaidaExportacao saida(temporario);
+        switch (tipo) {
+            case TipoExportacao::CATALOGO: resumo.registros = exportarCatalogo(evento, formato, saida); break;
+            case TipoExportacao::ESTOQUE:  resumo.registros = exportarEstoque(evento, formato, saida); break;
+            case TipoExportacao::CAMARINS: resumo.registros = exportarCamarins(evento, formato, saida); break;
+            case TipoExportacao::PEDIDOS:  resumo.registros = exportarPedidos(evento, formato, saida); break;
+            case TipoExportacao::LISTAS:   resumo.registros = exportarListas(evento, formato, saida); break;
+        }
+        saida.fechar();
+        resumo.bytes = saida.getBytes();
+    } catch (...) {
+        error_code erro;
+        filesystem::remove(temporario, erro);  // Exportação pela metade não fica no disco
+        throw;
+    }
+
+    error_code erro;
+    filesystem::rename(temporario, caminho, erro);
+    if (erro) {
+        throw PersistenciaException("Não foi possível substituir " + caminho + ": " + erro.message());
+    }
+    return resumo;
+}
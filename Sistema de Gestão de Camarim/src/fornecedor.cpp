@@ -0,0 +1,416 @@
+/**
+ * @file fornecedor.cpp
+ * @brief Implementação das classes CatalogoFornecedores e DivisaoCompras
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa o cadastro de ofertas e o plano de menor custo por item.
+ */
+
+// Inclui header da classe
+#include "fornecedor.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Para min, max
+#include <algorithm>
+// Para numeric_limits (custo "infinito")
+#include <limits>
+// Para stringstream (construir strings)
+#include <sstream>
+// Para formatação (setw, left, setprecision)
+#include <iomanip>
+
+static const long long CUSTO_INFINITO = numeric_limits<long long>::max();
+
+// ==================== Struct OfertaFornecedor ====================
+
+int OfertaFornecedor::menorCompra() const {
+    return ((quantidadeMinima + tamanhoEmbalagem - 1) / tamanhoEmbalagem) * tamanhoEmbalagem;
+}
+
+// ==================== Classe DivisaoCompras ====================
+
+/**
+ * Construtor - divisão vazia
+ */
+DivisaoCompras::DivisaoCompras() : totalCentavos(0), totalListaCentavos(0) {}
+
+// ==================== GETTERS ====================
+
+const map<int, vector<CompraFornecedor>>& DivisaoCompras::getPorFornecedor() const { return porFornecedor; }
+const vector<int>& DivisaoCompras::getSemOferta() const { return semOferta; }
+long long DivisaoCompras::getTotalCentavos() const { return totalCentavos; }
+
+long long DivisaoCompras::getTotalPedidoCentavos(int fornecedorId) const {
+    auto it = porFornecedor.find(fornecedorId);
+    if (it == porFornecedor.end()) {
+        return 0;
+    }
+    long long total = 0;
+    for (const auto& compra : it->second) {
+        total += compra.subtotalCentavos;
+    }
+    return total;
+}
+
+/**
+ * Exibe divisão formatada
+ */
+string DivisaoCompras::exibir() const {
+    stringstream ss;
+    ss << fixed << setprecision(2);
+    ss << "=== PEDIDOS POR FORNECEDOR ===" << endl;
+
+    if (porFornecedor.empty()) {
+        ss << "  Nenhum item da lista tem oferta de fornecedor" << endl;
+    }
+    for (const auto& par : porFornecedor) {
+        auto nome = nomesFornecedores.find(par.first);
+        ss << "\nFornecedor " << par.first << " - " << (nome == nomesFornecedores.end() ? "" : nome->second) << endl;
+        ss << left << setw(5) << "  ID" << setw(22) << "Nome"
+           << right << setw(8) << "Qtd" << setw(8) << "Sobra" << setw(13) << "Unit." << setw(13) << "Subtotal" << endl;
+        ss << "  " << string(67, '-') << endl;
+        for (const auto& compra : par.second) {
+            ss << left << setw(5) << "  " + to_string(compra.itemId) << setw(22) << compra.nomeItem.substr(0, 21)
+               << right << setw(8) << compra.quantidade << setw(8) << compra.quantidade - compra.necessaria
+               << setw(4) << "R$ " << setw(9) << compra.precoCentavos / 100.0
+               << setw(4) << "R$ " << setw(9) << compra.subtotalCentavos / 100.0 << endl;
+        }
+        ss << right << setw(60) << "Pedido: R$ " << setw(9) << getTotalPedidoCentavos(par.first) / 100.0 << endl;
+    }
+
+    if (!semOferta.empty()) {
+        ss << "\nSem oferta de fornecedor:";
+        for (int itemId : semOferta) {
+            ss << " " << itemId;
+        }
+        ss << endl;
+    }
+
+    ss << "\nTotal dos pedidos: R$ " << totalCentavos / 100.0
+       << " (lista pelo catálogo: R$ " << totalListaCentavos / 100.0 << ")" << endl;
+    return ss.str();
+}
+
+/**
+ * Sobrecarga do operador << para cout
+ */
+ostream& operator<<(ostream& os, const DivisaoCompras& divisao) {
+    os << divisao.exibir();
+    return os;
+}
+
+// ==================== Classe CatalogoFornecedores ====================
+
+/**
+ * Construtor - catálogo vazio
+ */
+CatalogoFornecedores::CatalogoFornecedores() : proximoId(1), totalOfertas(0), alterados(nullptr) {}
+
+// ==================== FORNECEDORES ====================
+
+int CatalogoFornecedores::cadastrarFornecedor(const string& nome) {
+    if (nome.empty()) {
+        throw ValidacaoException("Nome do fornecedor não pode ser vazio");
+    }
+    fornecedores[proximoId] = nome;
+    anotar(proximoId);
+    return proximoId++;
+}
+
+bool CatalogoFornecedores::removerFornecedor(int fornecedorId) {
+    if (fornecedores.find(fornecedorId) == fornecedores.end()) {
+        return false;
+    }
+    auto itens = itensPorFornecedor.find(fornecedorId);
+    if (itens != itensPorFornecedor.end()) {
+        set<int> copia = itens->second;  // removerOferta altera o conjunto original
+        for (int itemId : copia) {
+            removerOferta(fornecedorId, itemId);
+        }
+    }
+    fornecedores.erase(fornecedorId);
+    anotar(fornecedorId);  // Ausente na confirmação = removido
+    return true;
+}
+
+string CatalogoFornecedores::nomeFornecedor(int fornecedorId) const {
+    auto it = fornecedores.find(fornecedorId);
+    return it == fornecedores.end() ? "" : it->second;
+}
+
+const map<int, string>& CatalogoFornecedores::getFornecedores() const {
+    return fornecedores;
+}
+
+// ==================== OFERTAS ====================
+
+void CatalogoFornecedores::invalidar(int itemId) {
+    planos.erase(itemId);
+}
+
+void CatalogoFornecedores::anotar(int fornecedorId) {
+    if (alterados != nullptr) {
+        alterados->push_back(fornecedorId);
+    }
+}
+
+/**
+ * Cria ou atualiza oferta (só o plano do item é descartado)
+ */
+void CatalogoFornecedores::definirOferta(int fornecedorId, int itemId, long long precoCentavos,
+                                         int quantidadeMinima, int tamanhoEmbalagem) {
+    if (fornecedores.find(fornecedorId) == fornecedores.end()) {
+        throw ValidacaoException("Fornecedor com ID " + to_string(fornecedorId) + " não encontrado");
+    }
+    if (precoCentavos < 0) {
+        throw ValidacaoException("Preço não pode ser negativo");
+    }
+    if (quantidadeMinima < 1 || tamanhoEmbalagem < 1) {
+        throw ValidacaoException("Quantidade mínima e embalagem devem ser maiores que zero");
+    }
+
+    vector<OfertaFornecedor>& ofertas = ofertasPorItem[itemId];
+    for (auto& oferta : ofertas) {
+        if (oferta.fornecedorId == fornecedorId) {  // Atualização
+            oferta.precoCentavos = precoCentavos;
+            oferta.quantidadeMinima = quantidadeMinima;
+            oferta.tamanhoEmbalagem = tamanhoEmbalagem;
+            invalidar(itemId);
+            anotar(fornecedorId);
+            return;
+        }
+    }
+
+    ofertas.push_back(OfertaFornecedor(fornecedorId, itemId, precoCentavos, quantidadeMinima, tamanhoEmbalagem));
+    itensPorFornecedor[fornecedorId].insert(itemId);
+    totalOfertas++;
+    invalidar(itemId);
+    anotar(fornecedorId);
+}
+
+/**
+ * Remove oferta (troca com a última e remove do fim)
+ */
+bool CatalogoFornecedores::removerOferta(int fornecedorId, int itemId) {
+    auto it = ofertasPorItem.find(itemId);
+    if (it == ofertasPorItem.end()) {
+        return false;
+    }
+    vector<OfertaFornecedor>& ofertas = it->second;
+    for (size_t i = 0; i < ofertas.size(); i++) {
+        if (ofertas[i].fornecedorId == fornecedorId) {
+            ofertas[i] = ofertas.back();
+            ofertas.pop_back();
+            if (ofertas.empty()) {
+                ofertasPorItem.erase(it);
+            }
+            itensPorFornecedor[fornecedorId].erase(itemId);
+            totalOfertas--;
+            invalidar(itemId);
+            anotar(fornecedorId);
+            return true;
+        }
+    }
+    return false;
+}
+
+const vector<OfertaFornecedor>& CatalogoFornecedores::ofertasDoItem(int itemId) const {
+    static const vector<OfertaFornecedor> nenhuma;
+    auto it = ofertasPorItem.find(itemId);
+    return it == ofertasPorItem.end() ? nenhuma : it->second;
+}
+
+size_t CatalogoFornecedores::quantidadeOfertas() const {
+    return totalOfertas;
+}
+
+// ==================== DIVISÃO ====================
+
+/**
+ * Menor custo para cobrir 'quantidade' unidades
+ *
+ * custo[u] = menor custo para ter u unidades (u = quantidade significa "u ou mais").
+ * Para cada oferta: entrada = menor compra; depois, embalagens extras à vontade.
+ */
+CatalogoFornecedores::PlanoItem CatalogoFornecedores::planejarItem(const vector<OfertaFornecedor>& ofertas,
+                                                                   int quantidade) const {
+    PlanoItem plano;
+    plano.quantidade = quantidade;
+    plano.custo = 0;
+
+    // ATALHO: menor preço unitário sem embalagem e com mínimo atendido resolve sozinho
+    size_t maisBarata = 0;
+    for (size_t i = 1; i < ofertas.size(); i++) {
+        if (ofertas[i].precoCentavos < ofertas[maisBarata].precoCentavos) {
+            maisBarata = i;
+        }
+    }
+    const OfertaFornecedor& barata = ofertas[maisBarata];
+    if (barata.tamanhoEmbalagem == 1 && barata.quantidadeMinima <= quantidade) {
+        plano.compras.push_back(make_pair(maisBarata, quantidade));
+        plano.custo = quantidade * barata.precoCentavos;
+        return plano;
+    }
+
+    size_t u, n = (size_t)quantidade;
+    vector<long long> custo(n + 1, CUSTO_INFINITO);
+    custo[0] = 0;
+    // Para reconstruir: só a ÚLTIMA oferta que melhorou custo[u], de onde veio e quanto comprou.
+    // Memória O(N), não O(ofertas × N): a reconstrução pode passar pela mesma oferta mais
+    // de uma vez, e essas compras são somadas (entrada é múltipla da embalagem)
+    vector<int> ofertaDe(n + 1, -1), origemDe(n + 1, 0), unidadesDe(n + 1, 0);
+    vector<long long> comOferta(n + 1);
+    vector<int> origemOferta(n + 1), unidadesOferta(n + 1);
+
+    for (size_t i = 0; i < ofertas.size(); i++) {
+        const OfertaFornecedor& oferta = ofertas[i];
+        size_t entrada = (size_t)oferta.menorCompra();
+        size_t embalagem = (size_t)oferta.tamanhoEmbalagem;
+        fill(comOferta.begin(), comOferta.end(), CUSTO_INFINITO);
+
+        // 1. Entrada: a menor compra aceita por este fornecedor
+        for (u = 0; u <= n; u++) {
+            if (custo[u] == CUSTO_INFINITO) {
+                continue;
+            }
+            size_t destino = min(n, u + entrada);
+            long long total = custo[u] + (long long)entrada * oferta.precoCentavos;
+            if (total < comOferta[destino]) {
+                comOferta[destino] = total;
+                origemOferta[destino] = (int)u;
+                unidadesOferta[destino] = (int)entrada;
+            }
+        }
+
+        // 2. Embalagens extras do mesmo fornecedor (u crescente: várias embalagens)
+        for (u = 0; u < n; u++) {
+            if (comOferta[u] == CUSTO_INFINITO) {
+                continue;
+            }
+            size_t destino = min(n, u + embalagem);
+            long long total = comOferta[u] + (long long)embalagem * oferta.precoCentavos;
+            if (total < comOferta[destino]) {
+                comOferta[destino] = total;
+                origemOferta[destino] = origemOferta[u];
+                unidadesOferta[destino] = unidadesOferta[u] + (int)embalagem;
+            }
+        }
+
+        // 3. Usar ou não este fornecedor
+        for (u = 0; u <= n; u++) {
+            if (comOferta[u] < custo[u]) {
+                custo[u] = comOferta[u];
+                ofertaDe[u] = (int)i;
+                origemDe[u] = origemOferta[u];
+                unidadesDe[u] = unidadesOferta[u];
+            }
+        }
+    }
+
+    // Reconstrução de trás para frente. custo[origem] só pode ter caído depois que a
+    // oferta o usou, então o caminho custa no máximo custo[n] (e não menos: é o ótimo)
+    plano.custo = custo[n];
+    map<size_t, int> porOferta;
+    for (u = n; u > 0 && ofertaDe[u] >= 0; u = (size_t)origemDe[u]) {
+        porOferta[(size_t)ofertaDe[u]] += unidadesDe[u];
+    }
+    for (auto it = porOferta.rbegin(); it != porOferta.rend(); ++it) {
+        plano.compras.push_back(*it);
+    }
+    return plano;
+}
+
+/**
+ * Divide a lista em pedidos por fornecedor
+ */
+DivisaoCompras CatalogoFornecedores::dividir(const ListaCompras& lista) {
+    DivisaoCompras divisao;
+    divisao.totalListaCentavos = lista.getTotalCentavos();
+
+    for (const auto& par : lista.getItens()) {
+        const ItemCompra& item = par.second;
+        auto ofertas = ofertasPorItem.find(item.itemId);
+        if (ofertas == ofertasPorItem.end()) {
+            divisao.semOferta.push_back(item.itemId);
+            continue;
+        }
+
+        // Plano em cache vale enquanto ofertas e quantidade não mudarem
+        auto cache = planos.find(item.itemId);
+        if (cache == planos.end() || cache->second.quantidade != item.quantidade) {
+            planos[item.itemId] = planejarItem(ofertas->second, item.quantidade);
+            cache = planos.find(item.itemId);
+        }
+        const PlanoItem& plano = cache->second;
+
+        int restante = item.quantidade;
+        for (const auto& escolha : plano.compras) {
+            const OfertaFornecedor& oferta = ofertas->second[escolha.first];
+            CompraFornecedor compra;
+            compra.itemId = item.itemId;
+            compra.nomeItem = item.nomeItem;
+            compra.quantidade = escolha.second;
+            compra.necessaria = min(restante, escolha.second);
+            compra.precoCentavos = oferta.precoCentavos;
+            compra.subtotalCentavos = escolha.second * oferta.precoCentavos;
+            restante -= compra.necessaria;
+
+            divisao.porFornecedor[oferta.fornecedorId].push_back(compra);
+            divisao.nomesFornecedores[oferta.fornecedorId] = nomeFornecedor(oferta.fornecedorId);
+        }
+        divisao.totalCentavos += plano.custo;
+    }
+    return divisao;
+}
+
+/**
+ * Exibe fornecedores e ofertas
+ */
+string CatalogoFornecedores::exibir() const {
+    stringstream ss;
+    ss << fixed << setprecision(2);
+    ss << "=== FORNECEDORES ===" << endl;
+    if (fornecedores.empty()) {
+        ss << "  Nenhum fornecedor cadastrado" << endl;
+        return ss.str();
+    }
+
+    for (const auto& fornecedor : fornecedores) {
+        ss << "\n" << fornecedor.first << " - " << fornecedor.second << endl;
+        auto itens = itensPorFornecedor.find(fornecedor.first);
+        if (itens == itensPorFornecedor.end() || itens->second.empty()) {
+            ss << "  Sem ofertas" << endl;
+            continue;
+        }
+        ss << left << setw(10) << "  Item" << right << setw(12) << "Preço" << setw(9) << "Mínimo"
+           << setw(11) << "Embalagem" << endl;
+        for (int itemId : itens->second) {
+            for (const auto& oferta : ofertasPorItem.at(itemId)) {
+                if (oferta.fornecedorId == fornecedor.first) {
+                    ss << left << setw(10) << "  " + to_string(itemId)
+                       << right << setw(3) << "R$ " << setw(9) << oferta.precoCentavos / 100.0
+                       << setw(9) << oferta.quantidadeMinima << setw(11) << oferta.tamanhoEmbalagem << endl;
+                }
+            }
+        }
+    }
+    ss << "\nTotal de ofertas: " << totalOfertas << endl;
+    return ss.str();
+}
+
+/**
+ * Liga log de alterações
+ */
+void CatalogoFornecedores::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+}
+
+/**
+ * Sobrecarga do operador << para cout
+ */
+ostream& operator<<(ostream& os, const CatalogoFornecedores& catalogo) {
+    os << catalogo.exibir();
+    return os;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file idempotencia.cpp
+ * @brief Implementação da classe CacheIdempotencia
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa tabela hash limitada com expiração por tempo.
+ */
+
+// Inclui header da classe
+#include "idempotencia.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+
+/**
+ * Construtor - reserva a tabela uma única vez
+ */
+CacheIdempotencia::CacheIdempotencia(size_t capacidade, int64_t validadeNs)
+    : capacidade(capacidade), validadeNs(validadeNs) {
+    if (capacidade == 0) {
+        throw ValidacaoException("Capacidade do cache deve ser maior que zero");
+    }
+    entradas.reserve(capacidade + 1);  // +1: registrar insere antes de expirar o excedente
+}
+
+/**
+ * Remove chaves expiradas ou excedentes (sempre as mais antigas)
+ */
+void CacheIdempotencia::expirar(int64_t agoraNs) {
+    while (!chegada.empty() &&
+           (chegada.front().first + validadeNs <= agoraNs || entradas.size() > capacidade)) {
+        entradas.erase(*chegada.front().second);  // Ponteiro aponta para a chave dentro do map
+        chegada.pop_front();
+    }
+}
+
+/**
+ * Procura resultado de requisição já processada
+ */
+bool CacheIdempotencia::buscar(const string& chave, int64_t agoraNs, int& resultado) {
+    expirar(agoraNs);  // Garante que chave vencida não seja devolvida
+
+    auto it = entradas.find(chave);
+    if (it == entradas.end()) {
+        return false;  // Requisição nova
+    }
+
+    resultado = it->second.resultado;  // REENVIO: devolve resultado original
+    return true;
+}
+
+/**
+ * Registra resultado de requisição processada
+ */
+void CacheIdempotencia::registrar(const string& chave, int resultado, int64_t agoraNs) {
+    auto inserido = entradas.emplace(chave, Entrada{resultado, agoraNs});
+    if (!inserido.second) {
+        return;  // Chave já registrada: mantém o resultado original
+    }
+
+    // Referências a elementos de unordered_map sobrevivem a rehash
+    chegada.emplace_back(agoraNs, &inserido.first->first);
+    expirar(agoraNs);  // Mantém o limite de capacidade
+}
+
+/**
+ * Quantidade de chaves guardadas
+ */
+size_t CacheIdempotencia::tamanho() const {
+    return entradas.size();
+}
@@ -107,7 +107,7 @@ bool Item::operator==(const Item& outro) const {
 // ==================== Classe GerenciadorItens ====================
 
 // Construtor - Inicializa o gerenciador
-GerenciadorItens::GerenciadorItens() : proximoId(1) {}  
+GerenciadorItens::GerenciadorItens() : proximoId(1), ultimaVersaoPreco(0), alterados(nullptr) {}  
 // Inicializa proximoId com 1 (primeiro ID disponível)
 // Vetor itens é inicializado automaticamente vazio
 
@@ -134,6 +134,10 @@ int GerenciadorItens::cadastrar(const string& nome, double preco) {
     Item novoItem(proximoId, nome, preco);  // Cria novo item com ID atual
     itens.push_back(novoItem);  // Adiciona o item no FINAL do vetor
     // push_back() adiciona elemento ao final do vector
+    versoesPreco[proximoId] = ++ultimaVersaoPreco;  // Primeiro preço do item
+    if (alterados != nullptr) {
+        alterados->push_back(proximoId);
+    }
     
     return proximoId++;  // Retorna o ID usado e depois incrementa para o próximo
     // proximoId++ = usa o valor atual, DEPOIS incrementa
@@ -179,6 +183,13 @@ bool GerenciadorItens::remover(int id) {
         // end() retorna iterador para "após o último elemento"
         itens.erase(it, itens.end());  // erase() realmente REMOVE do vetor
         // Remove do iterador 'it' até o fim
+        versoesPreco.erase(id);  // Listas mantêm o último preço conhecido
+        if (alterados != nullptr) {
+            alterados->push_back(id);  // Ausente na confirmação = removido
+        }
+        if (observadorPreco) {
+            observadorPreco(id);  // Sem preço no catálogo (versão 0)
+        }
         return true;  // Retorna true indicando sucesso
     }
     return false;  // Retorna false se não encontrou o item
@@ -210,8 +221,35 @@ bool GerenciadorItens::atualizar(int id, const string& nome, double preco) {
     }
     
     // Se todas as validações passaram, atualiza os dados
+    bool precoMudou = item->getPreco() != preco;  // Guarda antes de alterar
     item->setNome(nome);   // Chama o setter via ponteiro (item->setNome)
     item->setPreco(preco); // Chama o setter via ponteiro
+    if (alterados != nullptr) {
+        alterados->push_back(id);
+    }
+    
+    if (precoMudou) {
+        versoesPreco[id] = ++ultimaVersaoPreco;  // Linhas com versão antiga ficam desatualizadas
+        if (observadorPreco) {
+            observadorPreco(id);  // Avisa quem precisa reprecificar (só este item)
+        }
+    }
     
     return true;  // Retorna true indicando sucesso na atualização
 }
+
+// Retorna a versão do preço atual de um item
+long long GerenciadorItens::getVersaoPreco(int id) const {
+    auto it = versoesPreco.find(id);  // Busca no map (O(log n))
+    return it == versoesPreco.end() ? 0 : it->second;  // 0 = item inexistente
+}
+
+// Define o observador de mudança de preço
+void GerenciadorItens::definirObservadorPreco(function<void(int itemId)> observador) {
+    observadorPreco = observador;  // Substitui o observador anterior (se houver)
+}
+
+// Liga o log de alterações
+void GerenciadorItens::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+}
@@ -0,0 +1,278 @@
+/**
+ * @file listaautomatica.cpp
+ * @brief Implementação da classe ListaAutomatica
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa o cálculo incremental das faltas e a lista gerada.
+ */
+
+// Inclui header da classe
+#include "listaautomatica.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Faltas de um camarim em relação ao rider
+#include "reposicao.h"
+// Para max
+#include <algorithm>
+// Para stringstream (construir strings)
+#include <sstream>
+// Para formatação (setw, left, setprecision)
+#include <iomanip>
+
+// ==================== Struct NecessidadeItem ====================
+
+int NecessidadeItem::falta() const {
+    return max(0, (pedidos + riders + minimo) - (estoque + emListas));
+}
+
+bool NecessidadeItem::vazia() const {
+    return pedidos == 0 && riders == 0 && minimo == 0 && estoque == 0 && emListas == 0;
+}
+
+// ==================== Classe ListaAutomatica ====================
+
+/**
+ * Construtor
+ */
+ListaAutomatica::ListaAutomatica(GerenciadorItens& catalogo, GerenciadorCamarins& camarins,
+                                 GerenciadorRiders& riders)
+    : catalogo(catalogo), camarins(camarins), riders(riders), lista(0, "Lista automática (faltas)"),
+      alterados(nullptr) {}
+
+/**
+ * Recalcula a linha de um item
+ */
+void ListaAutomatica::recalcular(int itemId) {
+    int falta = 0;
+    auto it = necessidades.find(itemId);
+    if (it != necessidades.end()) {
+        falta = it->second.falta();
+        if (it->second.vazia()) {
+            necessidades.erase(it);  // Não guarda itens sem nenhum valor
+        }
+    }
+
+    lista.removerItem(itemId);
+    if (falta <= 0) {
+        return;
+    }
+
+    Item* item = catalogo.buscarPorId(itemId);
+    if (item == nullptr) {
+        return;  // Fora do catálogo: não há como comprar
+    }
+    lista.adicionarItem(itemId, item->getNome(), falta, item->getPreco(), catalogo.getVersaoPreco(itemId));
+}
+
+/**
+ * Altera um campo e recalcula só se mudou
+ */
+void ListaAutomatica::definirCampo(int itemId, int NecessidadeItem::* campo, int valor) {
+    auto it = necessidades.find(itemId);
+    int atual = (it == necessidades.end()) ? 0 : it->second.*campo;
+    if (atual == valor) {
+        return;  // Nada mudou
+    }
+    necessidades[itemId].*campo = valor;
+    recalcular(itemId);
+}
+
+/**
+ * Troca a falta de um item em um camarim
+ */
+void ListaAutomatica::definirFaltaCamarim(RiderCamarim& estado, int itemId, int falta) {
+    auto it = estado.faltas.find(itemId);
+    int anterior = (it == estado.faltas.end()) ? 0 : it->second;
+    if (anterior == falta) {
+        return;
+    }
+    if (falta > 0) {
+        estado.faltas[itemId] = falta;
+    } else {
+        estado.faltas.erase(it);
+    }
+    definirCampo(itemId, &NecessidadeItem::riders, getNecessidade(itemId).riders + falta - anterior);
+}
+
+/**
+ * Recalcula um camarim inteiro
+ */
+void ListaAutomatica::recalcularCamarim(int camarimId) {
+    Camarim* camarim = camarins.buscarPorId(camarimId);
+    int artistaId = (camarim == nullptr) ? 0 : camarim->getArtistaId();
+
+    // Faltas antigas saem (e o camarim sai do artista anterior)
+    auto it = ridersPorCamarim.find(camarimId);
+    if (it != ridersPorCamarim.end()) {
+        RiderCamarim& estado = it->second;
+        while (!estado.faltas.empty()) {
+            definirFaltaCamarim(estado, estado.faltas.begin()->first, 0);
+        }
+        auto artista = camarinsPorArtista.find(estado.artistaId);
+        if (artista != camarinsPorArtista.end()) {
+            artista->second.erase(camarimId);
+            if (artista->second.empty()) {
+                camarinsPorArtista.erase(artista);
+            }
+        }
+        ridersPorCamarim.erase(it);
+    }
+
+    if (artistaId == 0) {
+        return;  // Camarim removido ou sem artista: não tem alvo
+    }
+
+    RiderCamarim& estado = ridersPorCamarim[camarimId];
+    estado.artistaId = artistaId;
+    camarinsPorArtista[artistaId].insert(camarimId);
+    Rider* rider = riders.buscarPorArtista(artistaId);
+    if (rider != nullptr) {
+        for (const auto& linha : PlanoReposicao::faltasDoCamarim(*camarim, *rider).faltas) {
+            definirFaltaCamarim(estado, linha.first, linha.second);
+        }
+    }
+}
+
+// ==================== ATUALIZAÇÕES POR ITEM ====================
+
+void ListaAutomatica::definirPedidos(int itemId, int quantidade) {
+    definirCampo(itemId, &NecessidadeItem::pedidos, quantidade);
+}
+
+void ListaAutomatica::definirEstoque(int itemId, int quantidade) {
+    definirCampo(itemId, &NecessidadeItem::estoque, quantidade);
+}
+
+void ListaAutomatica::definirEmListas(int itemId, int quantidade) {
+    definirCampo(itemId, &NecessidadeItem::emListas, quantidade);
+}
+
+void ListaAutomatica::definirEstoqueMinimo(int itemId, int minimo) {
+    if (minimo < 0) {
+        throw ValidacaoException("Estoque mínimo não pode ser negativo");
+    }
+    if (minimo > 0 && catalogo.buscarPorId(itemId) == nullptr) {
+        throw ItemException("Item com ID " + to_string(itemId) + " não encontrado");
+    }
+    definirCampo(itemId, &NecessidadeItem::minimo, minimo);
+    if (alterados != nullptr) {
+        alterados->push_back(itemId);
+    }
+}
+
+// ==================== OBSERVADORES ====================
+
+/**
+ * Camarim mudou
+ */
+void ListaAutomatica::atualizarCamarim(int camarimId, int itemId) {
+    auto it = ridersPorCamarim.find(camarimId);
+    if (itemId == 0) {
+        recalcularCamarim(camarimId);
+        return;
+    }
+    if (it == ridersPorCamarim.end()) {
+        return;  // Camarim sem artista: itens não mudam nenhuma falta
+    }
+
+    // Só um item: compara o que o camarim tem com o que o rider pede
+    Camarim* camarim = camarins.buscarPorId(camarimId);
+    Rider* rider = riders.buscarPorArtista(it->second.artistaId);
+    int falta = 0;
+    if (camarim != nullptr && rider != nullptr) {
+        auto pede = rider->getItens().find(itemId);
+        if (pede != rider->getItens().end()) {
+            auto tem = camarim->getItens().find(itemId);
+            falta = pede->second.quantidade - (tem == camarim->getItens().end() ? 0 : tem->second.quantidade);
+        }
+    }
+    definirFaltaCamarim(it->second, itemId, max(0, falta));
+}
+
+/**
+ * Rider de um artista mudou
+ */
+void ListaAutomatica::atualizarRider(int artistaId, int itemId) {
+    auto artista = camarinsPorArtista.find(artistaId);
+    if (artista == camarinsPorArtista.end()) {
+        return;  // Artista sem camarim: o rider não tem onde faltar
+    }
+    // Mesmo cálculo de uma mudança no camarim (um item ou o camarim inteiro)
+    vector<int> afetados(artista->second.begin(), artista->second.end());  // Recalcular mexe no conjunto
+    for (int camarimId : afetados) {
+        atualizarCamarim(camarimId, itemId);
+    }
+}
+
+/**
+ * Preço de um item mudou
+ */
+void ListaAutomatica::reprecificarItem(int itemId) {
+    auto linha = lista.getItens().find(itemId);
+    if (linha == lista.getItens().end() || linha->second.versaoPreco == catalogo.getVersaoPreco(itemId)) {
+        return;  // Fora da lista ou já no preço atual
+    }
+    recalcular(itemId);  // Item fora do catálogo (versão 0) sai da lista
+}
+
+/**
+ * Liga log de alterações
+ */
+void ListaAutomatica::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+}
+
+// ==================== GETTERS ====================
+
+const ListaCompras& ListaAutomatica::getLista() const {
+    return lista;
+}
+
+NecessidadeItem ListaAutomatica::getNecessidade(int itemId) const {
+    auto it = necessidades.find(itemId);
+    return it == necessidades.end() ? NecessidadeItem() : it->second;
+}
+
+/**
+ * Exibe a lista com a origem de cada falta
+ */
+string ListaAutomatica::exibir() const {
+    stringstream ss;
+    ss << fixed << setprecision(2);
+    ss << "=== LISTA AUTOMÁTICA ===" << endl;
+
+    if (lista.getItens().empty()) {
+        ss << "  Nada a comprar: estoque e listas cobrem toda a demanda" << endl;
+        return ss.str();
+    }
+
+    ss << left << setw(5) << "  ID" << setw(20) << "Nome"
+       << right << setw(8) << "Pedidos" << setw(8) << "Riders" << setw(8) << "Mínimo"
+       << setw(9) << "Estoque" << setw(10) << "Em listas" << setw(9) << "Comprar"
+       << setw(13) << "Subtotal" << endl;
+    ss << "  " << string(88, '-') << endl;
+
+    for (const auto& par : lista.getItens()) {
+        const ItemCompra& item = par.second;
+        NecessidadeItem necessidade = getNecessidade(item.itemId);
+        ss << left << setw(5) << "  " + to_string(item.itemId) << setw(20) << item.nomeItem.substr(0, 19)
+           << right << setw(8) << necessidade.pedidos << setw(8) << necessidade.riders
+           << setw(8) << necessidade.minimo << setw(9) << necessidade.estoque
+           << setw(10) << necessidade.emListas << setw(9) << item.quantidade
+           << setw(4) << "R$ " << setw(9) << item.subtotal << endl;
+    }
+
+    ss << "  " << string(88, '-') << endl;
+    ss << right << setw(78) << "TOTAL: R$ " << setw(9) << lista.calcularTotal() << endl;
+    return ss.str();
+}
+
+/**
+ * Sobrecarga do operador << para cout
+ */
+ostream& operator<<(ostream& os, const ListaAutomatica& automatica) {
+    os << automatica.exibir();
+    return os;
+}
@@ -24,21 +24,214 @@
 /**
  * Construtor padrão - inicializa com valores vazios
  */
-ListaCompras::ListaCompras() : id(0), descricao("") {}
+ListaCompras::ListaCompras()
+    : id(0), descricao(""), totalCentavos(0), totalGeral(nullptr), indiceItens(nullptr), alterados(nullptr),
+      quantidadesItens(nullptr), observadorItens(nullptr) {}
 
 /**
  * Construtor parametrizado
  */
 ListaCompras::ListaCompras(int id, const string& descricao)
-    : id(id), descricao(descricao) {}
+    : id(id), descricao(descricao), totalCentavos(0), totalGeral(nullptr), indiceItens(nullptr),
+      alterados(nullptr), quantidadesItens(nullptr), observadorItens(nullptr) {}
 // Lista começa vazia (map itens vazio)
 
 /**
- * Destrutor - libera recursos
+ * Construtor de cópia - cópia avulsa
  */
-ListaCompras::~ListaCompras() {}
+ListaCompras::ListaCompras(const ListaCompras& outra)
+    : id(outra.id), descricao(outra.descricao), itens(outra.itens),
+      totalCentavos(outra.totalCentavos), totalGeral(nullptr), indiceItens(nullptr), alterados(nullptr),
+      quantidadesItens(nullptr), observadorItens(nullptr) {}
+
+/**
+ * Construtor de movimento - leva a ligação
+ */
+ListaCompras::ListaCompras(ListaCompras&& outra) noexcept
+    : id(outra.id), descricao(move(outra.descricao)), itens(move(outra.itens)),
+      totalCentavos(outra.totalCentavos), totalGeral(outra.totalGeral), indiceItens(outra.indiceItens),
+      alterados(outra.alterados), quantidadesItens(outra.quantidadesItens), observadorItens(outra.observadorItens) {
+    outra.totalCentavos = 0;
+    outra.totalGeral = nullptr;  // A origem não conta mais no total geral
+    outra.indiceItens = nullptr; // Entradas do índice (mesmo ID) passam a ser desta lista
+    outra.alterados = nullptr;
+    outra.quantidadesItens = nullptr;  // Quantidades já contadas passam a ser desta lista
+    outra.observadorItens = nullptr;
+}
+
+/**
+ * Atribuição por cópia - mantém a ligação desta lista
+ */
+ListaCompras& ListaCompras::operator=(const ListaCompras& outra) {
+    if (this != &outra) {
+        ajustarTotal(outra.totalCentavos - totalCentavos);
+        desindexarTodos();  // Itens (e ID) antigos saem do índice
+        contarTodos(-1);    // e do total por item
+        id = outra.id;
+        descricao = outra.descricao;
+        itens = outra.itens;
+        indexarTodos();
+        contarTodos(1);
+        marcarAlterado();  // Conteúdo substituído (a ligação continua a desta lista)
+    }
+    return *this;
+}
+
+/**
+ * Atribuição por movimento - assume a ligação da outra
+ */
+ListaCompras& ListaCompras::operator=(ListaCompras&& outra) noexcept {
+    if (this != &outra) {
+        ajustarTotal(-totalCentavos);  // Conteúdo antigo sai do total geral
+        desindexarTodos();             // do índice
+        contarTodos(-1);               // e do total por item
+        id = outra.id;
+        descricao = move(outra.descricao);
+        itens = move(outra.itens);
+        totalCentavos = outra.totalCentavos;
+        totalGeral = outra.totalGeral;
+        indiceItens = outra.indiceItens;
+        alterados = outra.alterados;
+        quantidadesItens = outra.quantidadesItens;
+        observadorItens = outra.observadorItens;
+        outra.totalCentavos = 0;
+        outra.totalGeral = nullptr;
+        outra.indiceItens = nullptr;
+        outra.alterados = nullptr;
+        outra.quantidadesItens = nullptr;
+        outra.observadorItens = nullptr;
+    }
+    return *this;
+}
+
+/**
+ * Destrutor - retira o total do total geral ligado
+ */
+ListaCompras::~ListaCompras() {
+    ajustarTotal(-totalCentavos);
+    desindexarTodos();
+    contarTodos(-1);
+}
 // Map é destruído automaticamente
 
+/**
+ * Liga a lista a um total geral
+ */
+void ListaCompras::ligarTotalGeral(long long* total) {
+    if (totalGeral != nullptr) {
+        *totalGeral -= totalCentavos;  // Sai do total anterior
+    }
+    totalGeral = total;
+    if (totalGeral != nullptr) {
+        *totalGeral += totalCentavos;
+    }
+}
+
+/**
+ * Liga a lista a um índice item -> listas
+ */
+void ListaCompras::ligarIndice(map<int, set<int>>* indice) {
+    desindexarTodos();  // Sai do índice anterior
+    indiceItens = indice;
+    indexarTodos();
+}
+
+/**
+ * Liga a lista ao total por item
+ */
+void ListaCompras::ligarQuantidades(map<int, int>* quantidades, const function<void(int)>* observador) {
+    contarTodos(-1);  // Sai do total anterior
+    quantidadesItens = quantidades;
+    observadorItens = observador;
+    contarTodos(1);
+}
+
+/**
+ * Liga a lista ao log de alterações
+ */
+void ListaCompras::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+}
+
+/**
+ * Anota a lista no log de alterações
+ */
+void ListaCompras::marcarAlterado() {
+    if (alterados != nullptr) {
+        alterados->push_back(id);
+    }
+}
+
+/**
+ * Registra lista no índice para um item
+ */
+void ListaCompras::indexar(int itemId) {
+    if (indiceItens != nullptr) {
+        (*indiceItens)[itemId].insert(id);
+    }
+}
+
+/**
+ * Retira lista do índice para um item
+ */
+void ListaCompras::desindexar(int itemId) {
+    if (indiceItens == nullptr) {
+        return;
+    }
+    auto it = indiceItens->find(itemId);
+    if (it != indiceItens->end()) {
+        it->second.erase(id);
+        if (it->second.empty()) {
+            indiceItens->erase(it);  // Item sem listas não fica no índice
+        }
+    }
+}
+
+void ListaCompras::indexarTodos() {
+    for (const auto& par : itens) {
+        indexar(par.first);
+    }
+}
+
+void ListaCompras::desindexarTodos() {
+    for (const auto& par : itens) {
+        desindexar(par.first);
+    }
+}
+
+/**
+ * Ajusta a quantidade de um item no total ligado
+ */
+void ListaCompras::ajustarQuantidade(int itemId, int delta) {
+    if (quantidadesItens == nullptr || delta == 0) {
+        return;
+    }
+    auto it = quantidadesItens->emplace(itemId, 0).first;
+    it->second += delta;
+    if (it->second == 0) {
+        quantidadesItens->erase(it);  // Item fora de todas as listas não fica no total
+    }
+    if (observadorItens != nullptr && *observadorItens) {
+        (*observadorItens)(itemId);
+    }
+}
+
+void ListaCompras::contarTodos(int sinal) {
+    for (const auto& par : itens) {
+        ajustarQuantidade(par.first, sinal * par.second.quantidade);
+    }
+}
+
+/**
+ * Ajusta total da lista e total geral
+ */
+void ListaCompras::ajustarTotal(long long delta) {
+    totalCentavos += delta;
+    if (totalGeral != nullptr) {
+        *totalGeral += delta;
+    }
+}
+
 // ==================== GETTERS ====================
 
 /**
@@ -55,6 +248,13 @@ string ListaCompras::getDescricao() const {
     return descricao;
 }
 
+/**
+ * Retorna itens da lista (referência constante)
+ */
+const MapaPequeno<int, ItemCompra>& ListaCompras::getItens() const {
+    return itens;
+}
+
 // ==================== SETTERS ====================
 
 /**
@@ -64,7 +264,11 @@ void ListaCompras::setId(int id) {
     if (id < 0) {
         throw ValidacaoException("ID da lista inválido");
     }
+    desindexarTodos();  // Índice guarda o ID: reindexa com o novo
+    marcarAlterado();   // ID antigo deixa de existir
     this->id = id;
+    indexarTodos();
+    marcarAlterado();
 }
 
 /**
@@ -75,12 +279,14 @@ void ListaCompras::setDescricao(const string& descricao) {
         throw ValidacaoException("Descrição não pode ser vazia");
     }
     this->descricao = descricao;
+    marcarAlterado();
 }
 
 /**
  * Adiciona item à lista de compras
  */
-void ListaCompras::adicionarItem(int itemId, const string& nomeItem, int quantidade, double preco) {
+void ListaCompras::adicionarItem(int itemId, const string& nomeItem, int quantidade, double preco,
+                                 long long versaoPreco) {
     // VALIDAÇÕES:
     if (itemId < 0) {
         throw ValidacaoException("ID do item inválido");
@@ -99,17 +305,26 @@ void ListaCompras::adicionarItem(int itemId, const string& nomeItem, int quantid
     }
     
     // Se item já existe: SOMA quantidade e RECALCULA subtotal
-    if (itens.find(itemId) != itens.end()) {
-        itens[itemId].quantidade += quantidade;  // Soma quantidade
+    auto it = itens.find(itemId);
+    if (it != itens.end()) {
+        ItemCompra& item = it->second;
+        item.quantidade += quantidade;  // Soma quantidade
         
         // IMPORTANTE: recalcula subtotal após atualizar quantidade
-        itens[itemId].subtotal = itens[itemId].quantidade * itens[itemId].preco;
+        item.subtotal = item.getSubtotalCentavos() / 100.0;
         // subtotal = quantidade total * preço unitário
+        ajustarTotal(quantidade * item.precoCentavos);  // Só a parte acrescentada
+        ajustarQuantidade(itemId, quantidade);
     } else {
         // Item NÃO EXISTE: cria novo ItemCompra
-        itens[itemId] = ItemCompra(itemId, nomeItem, quantidade, preco);
+        ItemCompra item(itemId, nomeItem, quantidade, preco, versaoPreco);
         // Construtor de ItemCompra já calcula subtotal
+        ajustarTotal(item.getSubtotalCentavos());
+        itens[itemId] = item;
+        indexar(itemId);
+        ajustarQuantidade(itemId, quantidade);
     }
+    marcarAlterado();
 }
 
 /**
@@ -124,7 +339,12 @@ bool ListaCompras::removerItem(int itemId) {
     }
     
     // Remove completamente do map
+    ajustarTotal(-it->second.getSubtotalCentavos());
+    int quantidade = it->second.quantidade;
     itens.erase(itemId);
+    desindexar(itemId);
+    ajustarQuantidade(itemId, -quantidade);
+    marcarAlterado();
     return true;  // Sucesso
 }
 
@@ -142,36 +362,68 @@ void ListaCompras::atualizarQuantidade(int itemId, int quantidade) {
     }
     
     // SUBSTITUI quantidade (não soma)
-    itens[itemId].quantidade = quantidade;
+    ItemCompra& item = itens[itemId];
+    long long anterior = item.getSubtotalCentavos();
+    int quantidadeAnterior = item.quantidade;
+    item.quantidade = quantidade;
     
     // CRUCIAL: recalcula subtotal após atualizar quantidade
-    itens[itemId].subtotal = quantidade * itens[itemId].preco;
+    item.subtotal = item.getSubtotalCentavos() / 100.0;
     // subtotal = nova quantidade * preço unitário
+    ajustarTotal(item.getSubtotalCentavos() - anterior);
+    ajustarQuantidade(itemId, quantidade - quantidadeAnterior);
+    marcarAlterado();
 }
 
 /**
- * Calcula total geral da lista de compras
+ * Reprecifica uma linha pelo catálogo
  */
-double ListaCompras::calcularTotal() const {
-    double total = 0.0;  // Inicializa acumulador como 0.0 (double)
+bool ListaCompras::reprecificarItem(int itemId, const string& nomeItem, double preco, long long versaoPreco) {
+    auto it = itens.find(itemId);
+    if (it == itens.end()) {
+        return false;
+    }
     
-    // Percorre todos os itens do map
-    for (const auto& par : itens) {
-        // par.first = itemId (não usado aqui)
-        // par.second = ItemCompra
-        
-        total += par.second.subtotal;
-        // Soma subtotal de cada item ao total geral
+    ItemCompra& item = it->second;
+    if (item.versaoPreco == 0 || item.versaoPreco == versaoPreco) {
+        return false;  // Preço fixo ou já atualizado
     }
     
-    return total;  // Retorna soma de todos os subtotais
+    long long anterior = item.getSubtotalCentavos();
+    item.nomeItem = nomeItem;
+    item.preco = preco;
+    item.precoCentavos = llround(preco * 100);
+    item.versaoPreco = versaoPreco;
+    item.subtotal = item.getSubtotalCentavos() / 100.0;
+    ajustarTotal(item.getSubtotalCentavos() - anterior);  // Só a diferença
+    return true;
+}
+
+/**
+ * Calcula total geral da lista de compras
+ */
+double ListaCompras::calcularTotal() const {
+    // Total corrente: mantido por adicionarItem, removerItem,
+    // atualizarQuantidade e limpar (não percorre os itens)
+    return totalCentavos / 100.0;
+}
+
+/**
+ * Total exato em centavos
+ */
+long long ListaCompras::getTotalCentavos() const {
+    return totalCentavos;
 }
 
 /**
  * Limpa toda a lista (remove todos os itens)
  */
 void ListaCompras::limpar() {
-    itens.clear();  // Método clear() do map remove todos os elementos
+    ajustarTotal(-totalCentavos);
+    desindexarTodos();
+    contarTodos(-1);
+    itens.clear();  // clear() remove todos os elementos e libera a memória
+    marcarAlterado();
 }
 
 /**
@@ -241,7 +493,7 @@ ostream& operator<<(ostream& os, const ListaCompras& lista) {
 /**
  * Construtor - inicializa próximo ID como 1
  */
-GerenciadorListaCompras::GerenciadorListaCompras() : proximoId(1) {}
+GerenciadorListaCompras::GerenciadorListaCompras() : totalGeralCentavos(0), proximoId(1), alterados(nullptr) {}
 
 /**
  * Cria nova lista de compras (CREATE)
@@ -256,7 +508,14 @@ int GerenciadorListaCompras::criar(const string& descricao) {
     
     // Adiciona ao vector
     listas.push_back(novaLista);
-    // push_back() faz cópia do objeto
+    // push_back() faz cópia do objeto (cópia começa avulsa)
+    listas.back().ligarTotalGeral(&totalGeralCentavos);  // Alterações da lista chegam ao total geral
+    listas.back().ligarIndice(&listasPorItem);           // ao índice item -> listas
+    listas.back().ligarQuantidades(&quantidadesItens, &observadorQuantidade);  // ao total por item
+    listas.back().ligarAlteracoes(alterados);            // e ao log de alterações
+    if (alterados != nullptr) {
+        alterados->push_back(proximoId);
+    }
     
     return proximoId++;  // Retorna ID usado e incrementa
 }
@@ -292,6 +551,9 @@ bool GerenciadorListaCompras::remover(int id) {
     if (it != listas.end()) {  // Se encontrou lista(s) a remover
         listas.erase(it, listas.end());
         // Remove do vector
+        if (alterados != nullptr) {
+            alterados->push_back(id);  // Ausente na confirmação = removida
+        }
         return true;  // Sucesso
     }
     return false;  // Não encontrou
@@ -303,3 +565,105 @@ bool GerenciadorListaCompras::remover(int id) {
 vector<ListaCompras> GerenciadorListaCompras::listar() const {
     return listas;  // Retorna CÓPIA de todo o vector
 }
+
+/**
+ * Listas sem cópia
+ */
+const vector<ListaCompras>& GerenciadorListaCompras::getListas() const {
+    return listas;
+}
+
+/**
+ * Soma das quantidades por item em todas as listas (mantida pelas listas)
+ */
+const map<int, int>& GerenciadorListaCompras::quantidadesPorItem() const {
+    return quantidadesItens;
+}
+
+/**
+ * Quantidade de um item em todas as listas
+ */
+int GerenciadorListaCompras::quantidadeEmListas(int itemId) const {
+    auto it = quantidadesItens.find(itemId);
+    return it == quantidadesItens.end() ? 0 : it->second;
+}
+
+/**
+ * Define o observador do total por item
+ */
+void GerenciadorListaCompras::definirObservadorQuantidade(function<void(int itemId)> observador) {
+    observadorQuantidade = observador;  // Listas guardam o endereço: trocar a função basta
+}
+
+/**
+ * Total geral (todas as listas)
+ */
+double GerenciadorListaCompras::calcularTotalGeral() const {
+    return totalGeralCentavos / 100.0;
+}
+
+/**
+ * Total geral em centavos
+ */
+long long GerenciadorListaCompras::getTotalGeralCentavos() const {
+    return totalGeralCentavos;
+}
+
+/**
+ * Busca binária por ID
+ */
+ListaCompras* GerenciadorListaCompras::buscarOrdenado(int id) {
+    // criar() acrescenta IDs crescentes no fim e remover() preserva a ordem
+    auto it = lower_bound(listas.begin(), listas.end(), id,
+                          [](const ListaCompras& l, int valor) { return l.getId() < valor; });
+    return (it != listas.end() && it->getId() == id) ? &*it : nullptr;
+}
+
+/**
+ * Marca item com preço alterado
+ */
+void GerenciadorListaCompras::marcarPrecoAlterado(int itemId) {
+    if (listasPorItem.count(itemId)) {  // Só interessa se alguma lista tem o item
+        precosAlterados.insert(itemId);
+    }
+}
+
+/**
+ * Reprecifica só as linhas dos itens marcados
+ */
+int GerenciadorListaCompras::reprecificar(GerenciadorItens& catalogo) {
+    int alteradas = 0;
+    for (int itemId : precosAlterados) {
+        Item* item = catalogo.buscarPorId(itemId);
+        auto indice = listasPorItem.find(itemId);
+        if (item == nullptr || indice == listasPorItem.end()) {
+            continue;  // Saiu do catálogo ou de todas as listas
+        }
+        long long versao = catalogo.getVersaoPreco(itemId);
+        for (int listaId : indice->second) {
+            ListaCompras* lista = buscarOrdenado(listaId);
+            if (lista != nullptr && lista->reprecificarItem(itemId, item->getNome(), item->getPreco(), versao)) {
+                alteradas++;
+            }
+        }
+    }
+    precosAlterados.clear();
+    return alteradas;
+}
+
+/**
+ * Itens esperando reprecificação
+ */
+size_t GerenciadorListaCompras::getPrecosPendentes() const {
+    return precosAlterados.size();
+}
+
+/**
+ * Liga log de alterações ao gerenciador e às listas já criadas
+ */
+void GerenciadorListaCompras::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+    for (auto& lista : listas) {
+        lista.ligarAlteracoes(alterados);
+    }
+}
@@ -15,6 +15,10 @@
 #include <string>     // Para trabalhar com strings
 #include <limits>     // Para numeric_limits (limpar buffer)
 #include <iomanip>    // Para formatação (setw, left, right)
+#include <mutex>      // Para travar o evento ativo durante os menus
+#include <cmath>      // Para llround (reais → centavos)
+#include <filesystem> // Para renomear estado salvo inválido e listar arquivos da cópia
+#include <algorithm>  // Para ordenar os arquivos da cópia
 
 // ==================== HEADERS DO PROJETO ====================
 #include "artista.h"      // Classe Artista e GerenciadorArtistas
@@ -23,18 +27,69 @@
 #include "camarim.h"      // Classe Camarim e GerenciadorCamarins
 #include "pedido.h"       // Classe Pedido e GerenciadorPedidos
 #include "listacompras.h" // Classe ListaCompras e gerenciador
+#include "listaautomatica.h" // Lista de compras gerada pelas faltas
+#include "orcamento.h"    // Compra otimizada dentro do orçamento do dia
+#include "fornecedor.h"   // Ofertas de fornecedores e divisão das compras
+#include "consolidacao.h" // Várias listas de compras em um pedido só
+#include "recebimento.h"  // Recebimento de mercadoria no estoque (diário)
+#include "separacao.h"    // Ondas de separação (pedidos consolidados)
+#include "rider.h"        // Riders de artistas (abastecimento de camarins)
+#include "reposicao.h"    // Reposição dos camarins até o rider (entre shows)
+#include "atribuicao.h"   // Relação artista ↔ camarim (índice único)
+#include "agenda.h"       // Reservas de camarins por horário
+#include "equipe.h"       // Equipe de apoio (produtores, runners, seguranças)
+#include "evento.h"       // Eventos (um conjunto de gerenciadores por local)
+#include "snapshot.h"     // Estado de todos os eventos salvo em arquivo binário
+#include "alteracoes.h"   // Log de alterações (recupera o que veio depois do estado salvo)
+#include "pontocontrole.h" // Estado salvo em segundo plano, compactando o log
+#include "exportacao.h"   // Exportação em CSV/JSON
+#include "copia.h"        // Cópia de segurança incremental e verificação
+#include "checksum.h"     // Para informar se o CRC usa o processador
 #include "excecoes.h"     // Hierarquia de exceções customizadas
 
 using namespace std;  // Namespace padrão da STL
 
-// ==================== GERENCIADORES GLOBAIS ====================
-// Instâncias globais dos gerenciadores (únicas em todo o programa)
-GerenciadorArtistas gerenciadorArtistas;          // Gerencia artistas
-GerenciadorItens gerenciadorItens;                // Gerencia catálogo de itens
-Estoque estoque;                                   // Controla estoque central
-GerenciadorCamarins gerenciadorCamarins;          // Gerencia camarins
-GerenciadorPedidos gerenciadorPedidos;            // Gerencia pedidos de itens
-GerenciadorListaCompras gerenciadorListaCompras;  // Gerencia listas de compras
+// ==================== EVENTOS ====================
+// Log declarado antes: os gerenciadores guardam ponteiros para dentro dele
+LogAlteracoes logAlteracoes;            // Alterações de todos os eventos desde o estado salvo
+PontoControle* pontoControle = nullptr; // Criado em main (dono da thread de gravação)
+
+// Cada evento/local é um shard independente, com seus próprios gerenciadores
+GerenciadorEventos gerenciadorEventos;  // Todos os eventos
+Evento* eventoAtivo = nullptr;          // Evento em que os menus operam
+
+// ==================== GERENCIADORES DO EVENTO ATIVO ====================
+// Apontam para dentro de eventoAtivo (ver ativarEvento)
+GerenciadorArtistas* gerenciadorArtistas = nullptr;          // Gerencia artistas
+GerenciadorItens* gerenciadorItens = nullptr;                // Gerencia catálogo de itens
+Estoque* estoque = nullptr;                                  // Controla estoque central
+GerenciadorCamarins* gerenciadorCamarins = nullptr;          // Gerencia camarins
+GerenciadorPedidos* gerenciadorPedidos = nullptr;            // Gerencia pedidos de itens
+GerenciadorListaCompras* gerenciadorListaCompras = nullptr;  // Gerencia listas de compras
+GerenciadorRiders* gerenciadorRiders = nullptr;              // Gerencia riders dos artistas
+IndiceAtribuicao* indiceAtribuicao = nullptr;                // Dono da relação artista ↔ camarim
+AgendaCamarins* agendaCamarins = nullptr;                    // Ocupação dos camarins ao longo do festival
+GerenciadorEquipe* gerenciadorEquipe = nullptr;              // Produtores, runners e seguranças
+ListaAutomatica* listaAutomatica = nullptr;                  // Faltas a comprar (mantida pelos observadores)
+CatalogoFornecedores* catalogoFornecedores = nullptr;        // Ofertas por item (preço, mínimo, embalagem)
+DiarioRecebimentos* diarioRecebimentos = nullptr;            // Recebimentos de mercadoria
+
+// Pedidos atendidos há mais de 30 minutos saem da memória para um arquivo por evento
+const string PREFIXO_ARQUIVO_PEDIDOS = "pedidos_arquivados_";  // + ID do evento + ".dat"
+const int64_t IDADE_ARQUIVAMENTO_NS = 30LL * 60 * 1000000000LL;
+
+// Diário de recebimentos de mercadoria, um por evento
+const string PREFIXO_DIARIO_RECEBIMENTOS = "recebimentos_";  // + ID do evento + ".log"
+
+// Estado de todos os eventos: carregado na partida e salvo ao finalizar
+const string ARQUIVO_ESTADO = "camarim_estado.snap";
+
+// Log de alterações: uma geração por ponto de controle; passou do limite, o estado é salvo
+const string PREFIXO_LOG_ALTERACOES = "camarim_alteracoes_";  // + geração + ".log"
+const uint64_t LIMITE_LOG_BYTES = 4ULL * 1024 * 1024;
+
+// Cópia de segurança: só os segmentos alterados desde a anterior
+const string DIRETORIO_COPIA = "copia_seguranca";
 
 /**
  * @brief Limpa buffer de entrada
@@ -92,6 +147,33 @@ double lerDouble() {
     }
 }
 
+/**
+ * @brief Lê horário do festival no formato dia + HH:MM
+ * @param rotulo Texto exibido antes da pergunta (ex: "Entrada")
+ * @return Minutos desde o início do festival (dia 1, 00:00)
+ * @throws ValidacaoException se o formato ou os valores forem inválidos
+ */
+int lerHorarioFestival(const string& rotulo) {
+    int dia;
+    string hora;  // Formato HH:MM
+    
+    cout << rotulo << " - Dia: ";
+    cin >> dia;
+    cout << rotulo << " - Hora (HH:MM): ";
+    cin >> hora;
+    
+    size_t separador = hora.find(':');
+    if (separador == string::npos) {
+        throw ValidacaoException("Hora deve estar no formato HH:MM");
+    }
+    try {
+        return AgendaCamarins::horario(dia, stoi(hora.substr(0, separador)),
+                                       stoi(hora.substr(separador + 1)));
+    } catch (const invalid_argument&) {
+        throw ValidacaoException("Hora deve estar no formato HH:MM");
+    }
+}
+
 // ==================== Funções de Itens (Catálogo) ====================
 
 /**
@@ -102,7 +184,7 @@ double lerDouble() {
  */
 void exibirItens() {
     // Busca todos os itens do catálogo
-    vector<Item> itens = gerenciadorItens.listar();
+    vector<Item> itens = gerenciadorItens->listar();
     
     if (itens.empty()) {  // Se não há itens cadastrados
         cout << "\nNenhum item cadastrado no catálogo.\n" << endl;
@@ -138,7 +220,7 @@ void cadastrarItem() {
     
     // TRY-CATCH: Captura exceções lançadas durante cadastro
     try {
-        int id = gerenciadorItens.cadastrar(nome, preco);
+        int id = gerenciadorItens->cadastrar(nome, preco);
         // Cadastra item e recebe ID gerado automaticamente
         
         cout << "\n[OK] Item cadastrado no catálogo com ID: " << id << endl;
@@ -164,7 +246,7 @@ void removerItem() {
     cin >> id;
     
     try {
-        if (gerenciadorItens.remover(id)) {
+        if (gerenciadorItens->remover(id)) {
             // remover() retorna true se encontrou e removeu
             cout << "\n[OK] Item removido do catálogo com sucesso!" << endl;
         } else {
@@ -198,7 +280,7 @@ void atualizarItem() {
     preco = lerDouble();  // Lê valor double aceitando vírgula ou ponto
     
     try {
-        if (gerenciadorItens.atualizar(id, nome, preco)) {
+        if (gerenciadorItens->atualizar(id, nome, preco)) {
             cout << "\n[OK] Item atualizado com sucesso!" << endl;
         } else {
             cout << "\n[ERRO] Item não encontrado!" << endl;
@@ -223,7 +305,7 @@ void buscarItemPorNome() {
     getline(cin, nome);
     
     // Busca retorna PONTEIRO (nullptr se não encontrar)
-    Item* item = gerenciadorItens.buscarPorNome(nome);
+    Item* item = gerenciadorItens->buscarPorNome(nome);
     
     if (item) {  // Se ponteiro não é nullptr (encontrou)
         cout << "\n" << item->exibir() << endl;
@@ -241,7 +323,7 @@ void buscarItemPorNome() {
  * Lista artistas com seus IDs e camarins associados
  */
 void exibirArtistas() {
-    vector<Artista> artistas = gerenciadorArtistas.listar();
+    vector<Artista> artistas = gerenciadorArtistas->listar();
     
     if (artistas.empty()) {
         cout << "\nNenhum artista cadastrado.\n" << endl;
@@ -276,8 +358,17 @@ void cadastrarArtista() {
     cin >> camarimId;
     
     try {
-        int id = gerenciadorArtistas.cadastrar(nome, camarimId);
+        // Cadastra sem camarim: a relação é gravada pelo índice de atribuição
+        int id = gerenciadorArtistas->cadastrar(nome);
         cout << "\n[OK] Artista cadastrado com ID: " << id << endl;
+        
+        if (camarimId != 0) {
+            try {
+                indiceAtribuicao->atribuir(id, camarimId, *gerenciadorArtistas, *gerenciadorCamarins);
+            } catch (const ExcecaoBase& e) {
+                cout << "[AVISO] " << e.what() << " - artista ficou sem camarim" << endl;
+            }
+        }
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
     }
@@ -290,7 +381,9 @@ void removerArtista() {
     cin >> id;
     
     try {
-        gerenciadorArtistas.remover(id);
+        indiceAtribuicao->liberarArtista(id, *gerenciadorArtistas, *gerenciadorCamarins);  // Libera o camarim
+        agendaCamarins->removerArtista(id);  // Reservas do artista deixam de existir
+        gerenciadorArtistas->remover(id);
         cout << "\n[OK] Artista removido com sucesso!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -312,12 +405,21 @@ void atualizarArtista() {
     cout << "Novo ID do Camarim: ";
     cin >> camarimId;
     
+    // Valida o camarim ANTES de alterar qualquer coisa
+    if (camarimId != 0 && !gerenciadorCamarins->buscarPorId(camarimId)) {
+        cout << "\n[ERRO] Camarim não encontrado!" << endl;
+        return;
+    }
+    
     try {
-        if (gerenciadorArtistas.atualizar(id, nome, camarimId)) {
-            cout << "\n[OK] Artista atualizado com sucesso!" << endl;
+        // Nome pelo gerenciador; relação pelo índice (mantém os dois lados iguais)
+        gerenciadorArtistas->atualizar(id, nome);
+        if (camarimId == 0) {
+            indiceAtribuicao->liberarArtista(id, *gerenciadorArtistas, *gerenciadorCamarins);
         } else {
-            cout << "\n[ERRO] Artista não encontrado!" << endl;
+            indiceAtribuicao->atribuir(id, camarimId, *gerenciadorArtistas, *gerenciadorCamarins);
         }
+        cout << "\n[OK] Artista atualizado com sucesso!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
     }
@@ -326,14 +428,14 @@ void atualizarArtista() {
 // ==================== Funções de Estoque ====================
 
 void exibirEstoque() {
-    auto itens = estoque.listar();
+    auto itens = estoque->listar();
     if (itens.empty()) {
         cout << "\nEstoque vazio.\n" << endl;
         return;
     }
     
     cout << "\n=== Estoque ===" << endl;
-    cout << estoque << endl;
+    cout << *estoque << endl;
 }
 
 void cadastrarItemEstoque() {
@@ -344,7 +446,7 @@ void cadastrarItemEstoque() {
     cin >> itemId;
     
     // Buscar item no catálogo
-    Item* item = gerenciadorItens.buscarPorId(itemId);
+    Item* item = gerenciadorItens->buscarPorId(itemId);
     if (!item) {
         cout << "\n[ERRO] Item não encontrado no catálogo!" << endl;
         cout << "Dica: Cadastre o item no catálogo primeiro (Menu Itens)." << endl;
@@ -356,7 +458,7 @@ void cadastrarItemEstoque() {
     cin >> quantidade;
     
     try {
-        estoque.adicionarItem(item->getId(), item->getNome(), quantidade);
+        estoque->adicionarItem(item->getId(), item->getNome(), quantidade);
         cout << "\n[OK] Item adicionado ao estoque!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -374,7 +476,7 @@ void removerItemEstoque() {
     cin >> quantidade;
     
     try {
-        estoque.removerItem(itemId, quantidade);
+        estoque->removerItem(itemId, quantidade);
         cout << "\n[OK] Item removido do estoque!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -390,7 +492,7 @@ void verificarDisponibilidadeEstoque() {
     cout << "Quantidade desejada: ";
     cin >> quantidade;
     
-    if (estoque.verificarDisponibilidade(itemId, quantidade)) {
+    if (estoque->verificarDisponibilidade(itemId, quantidade)) {
         cout << "\n[OK] Quantidade disponível em estoque!" << endl;
     } else {
         cout << "\n[AVISO] Quantidade insuficiente em estoque!" << endl;
@@ -403,7 +505,7 @@ void consultarQuantidadeEstoque() {
     cout << "ID do Item: ";
     cin >> itemId;
     
-    int quantidade = estoque.obterQuantidade(itemId);
+    int quantidade = estoque->obterQuantidade(itemId);
     
     if (quantidade > 0) {
         cout << "\nQuantidade em estoque: " << quantidade << endl;
@@ -422,7 +524,7 @@ void atualizarQuantidadeEstoque() {
     cin >> novaQuantidade;
     
     try {
-        estoque.atualizarQuantidade(itemId, novaQuantidade);
+        estoque->atualizarQuantidade(itemId, novaQuantidade);
         cout << "\n[OK] Quantidade atualizada!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -432,7 +534,7 @@ void atualizarQuantidadeEstoque() {
 // ==================== Funções de Camarim ====================
 
 void exibirCamarins() {
-    vector<Camarim> camarins = gerenciadorCamarins.listar();
+    vector<Camarim> camarins = gerenciadorCamarins->listar();
     if (camarins.empty()) {
         cout << "\nNenhum camarim cadastrado." << endl;
         return;
@@ -458,8 +560,17 @@ void cadastrarCamarim() {
     cin >> artistaId;
     
     try {
-        int id = gerenciadorCamarins.cadastrar(nome, artistaId);
+        // Cadastra sem artista: a relação é gravada pelo índice de atribuição
+        int id = gerenciadorCamarins->cadastrar(nome);
         cout << "\n[OK] Camarim cadastrado com ID: " << id << endl;
+        
+        if (artistaId != 0) {
+            try {
+                indiceAtribuicao->atribuir(artistaId, id, *gerenciadorArtistas, *gerenciadorCamarins);
+            } catch (const ExcecaoBase& e) {
+                cout << "[AVISO] " << e.what() << " - camarim ficou sem artista" << endl;
+            }
+        }
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
     }
@@ -472,7 +583,9 @@ void removerCamarim() {
     cin >> id;
     
     try {
-        if (gerenciadorCamarins.remover(id)) {
+        indiceAtribuicao->liberarCamarim(id, *gerenciadorArtistas, *gerenciadorCamarins);  // Libera o artista
+        agendaCamarins->removerCamarim(id);  // Reservas do camarim deixam de existir
+        if (gerenciadorCamarins->remover(id)) {
             cout << "\n[OK] Camarim removido com sucesso!" << endl;
         } else {
             cout << "\n[ERRO] Camarim não encontrado!" << endl;
@@ -489,7 +602,7 @@ void cadastrarItemCamarim() {
     cout << "ID do Camarim: ";
     cin >> camarimId;
     
-    Camarim* camarim = gerenciadorCamarins.buscarPorId(camarimId);
+    Camarim* camarim = gerenciadorCamarins->buscarPorId(camarimId);
     if (!camarim) {
         cout << "\n[ERRO] Camarim não encontrado!" << endl;
         return;
@@ -499,7 +612,7 @@ void cadastrarItemCamarim() {
     cin >> itemId;
     
     // Buscar item no catálogo
-    Item* item = gerenciadorItens.buscarPorId(itemId);
+    Item* item = gerenciadorItens->buscarPorId(itemId);
     if (!item) {
         cout << "\n[ERRO] Item não encontrado no catálogo!" << endl;
         cout << "Dica: Cadastre o item no catálogo primeiro (Menu Itens)." << endl;
@@ -525,7 +638,7 @@ void removerItemCamarim() {
     cout << "ID do Camarim: ";
     cin >> camarimId;
     
-    Camarim* camarim = gerenciadorCamarins.buscarPorId(camarimId);
+    Camarim* camarim = gerenciadorCamarins->buscarPorId(camarimId);
     if (!camarim) {
         cout << "\n[ERRO] Camarim não encontrado!" << endl;
         return;
@@ -538,7 +651,8 @@ void removerItemCamarim() {
     cin >> quantidade;
     
     try {
-        camarim->removerItem(itemId, quantidade);
+        // Retirada do camarim = consumo (entra nas taxas por item)
+        gerenciadorCamarins->consumirItem(camarimId, itemId, quantidade, relogioMonotonicoNs());
         cout << "\n[OK] Item removido do camarim!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -560,12 +674,24 @@ void atualizarCamarim() {
     cout << "Novo ID do Artista: ";
     cin >> artistaId;
     
+    // Valida o artista ANTES de alterar qualquer coisa
+    if (artistaId != 0 && !gerenciadorArtistas->buscarPorId(artistaId)) {
+        cout << "\n[ERRO] Artista não encontrado!" << endl;
+        return;
+    }
+    
     try {
-        if (gerenciadorCamarins.atualizar(id, nome, artistaId)) {
-            cout << "\n[OK] Camarim atualizado com sucesso!" << endl;
-        } else {
+        // Nome pelo gerenciador; relação pelo índice (mantém os dois lados iguais)
+        if (!gerenciadorCamarins->atualizar(id, nome)) {
             cout << "\n[ERRO] Camarim não encontrado!" << endl;
+            return;
+        }
+        if (artistaId == 0) {
+            indiceAtribuicao->liberarCamarim(id, *gerenciadorArtistas, *gerenciadorCamarins);
+        } else {
+            indiceAtribuicao->atribuir(artistaId, id, *gerenciadorArtistas, *gerenciadorCamarins);
         }
+        cout << "\n[OK] Camarim atualizado com sucesso!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
     }
@@ -578,7 +704,8 @@ void buscarCamarimPorArtista() {
     cout << "ID do Artista: ";
     cin >> artistaId;
     
-    Camarim* camarim = gerenciadorCamarins.buscarPorArtista(artistaId);
+    // Índice de atribuição: O(1) em vez de percorrer todos os camarins
+    Camarim* camarim = gerenciadorCamarins->buscarPorId(indiceAtribuicao->getCamarimDoArtista(artistaId));
     
     if (camarim) {
         cout << "\n" << camarim->exibir() << endl;
@@ -587,10 +714,144 @@ void buscarCamarimPorArtista() {
     }
 }
 
+/**
+ * @brief Reserva camarim para um artista em um horário
+ * 
+ * Um camarim recebe vários artistas ao longo do dia, mas nunca
+ * dois ao mesmo tempo (e um artista nunca ocupa dois camarins)
+ */
+void reservarHorarioCamarim() {
+    int camarimId, artistaId;
+    
+    cout << "\n=== Reservar Horário de Camarim ===" << endl;
+    cout << "ID do Camarim: ";
+    cin >> camarimId;
+    
+    if (!gerenciadorCamarins->buscarPorId(camarimId)) {
+        cout << "\n[ERRO] Camarim não encontrado!" << endl;
+        return;
+    }
+    
+    cout << "ID do Artista: ";
+    cin >> artistaId;
+    
+    if (!gerenciadorArtistas->buscarPorId(artistaId)) {
+        cout << "\n[ERRO] Artista não encontrado!" << endl;
+        return;
+    }
+    
+    try {
+        int inicio = lerHorarioFestival("Entrada");
+        int fim = lerHorarioFestival("Saída");
+        int id = agendaCamarins->reservar(camarimId, artistaId, inicio, fim);
+        cout << "\n[OK] Reserva criada com ID: " << id << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void exibirAgendaCamarim() {
+    int camarimId;
+    
+    cout << "\n=== Agenda do Camarim ===" << endl;
+    cout << "ID do Camarim: ";
+    cin >> camarimId;
+    
+    vector<Reserva> agenda = agendaCamarins->agendaDoCamarim(camarimId);
+    if (agenda.empty()) {
+        cout << "\nNenhuma reserva para este camarim." << endl;
+        return;
+    }
+    
+    for (const auto& reserva : agenda) {
+        cout << "  " << reserva << endl;
+    }
+}
+
+void buscarCamarinsLivres() {
+    cout << "\n=== Camarins Livres ===" << endl;
+    
+    try {
+        int inicio = lerHorarioFestival("De");
+        int fim = lerHorarioFestival("Até");
+        
+        vector<int> ids;
+        for (const auto& camarim : gerenciadorCamarins->listar()) {
+            ids.push_back(camarim.getId());
+        }
+        
+        vector<int> livres = agendaCamarins->camarinsLivres(ids, inicio, fim);
+        if (livres.empty()) {
+            cout << "\nNenhum camarim livre neste intervalo." << endl;
+            return;
+        }
+        
+        cout << "\n" << livres.size() << " camarim(ns) livre(s):" << endl;
+        for (int id : livres) {
+            cout << "  " << id << " - " << gerenciadorCamarins->buscarPorId(id)->getNome() << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void cancelarReservaCamarim() {
+    int reservaId;
+    
+    cout << "\n=== Cancelar Reserva ===" << endl;
+    cout << "ID da Reserva: ";
+    cin >> reservaId;
+    
+    if (agendaCamarins->cancelar(reservaId)) {
+        cout << "\n[OK] Reserva cancelada!" << endl;
+    } else {
+        cout << "\n[ERRO] Reserva não encontrada!" << endl;
+    }
+}
+
+/**
+ * @brief Ranking de consumo: quais camarins gastam mais rápido cada item
+ */
+void exibirMaioresConsumos() {
+    int opcaoJanela, limite;
+    
+    cout << "\n=== Maiores Consumos ===" << endl;
+    cout << "Janela (1 = 15 min, 2 = 1 hora, 3 = 1 dia): ";
+    cin >> opcaoJanela;
+    if (opcaoJanela < 1 || opcaoJanela > 3) {
+        cout << "\n[ERRO] Janela inválida!" << endl;
+        return;
+    }
+    cout << "Quantidade de linhas: ";
+    cin >> limite;
+    if (limite <= 0) {
+        cout << "\n[ERRO] Quantidade deve ser maior que zero!" << endl;
+        return;
+    }
+    
+    JanelaConsumo janela = opcaoJanela == 1 ? JanelaConsumo::QUINZE_MINUTOS
+                         : opcaoJanela == 2 ? JanelaConsumo::UMA_HORA : JanelaConsumo::UM_DIA;
+    vector<ConsumoItem> ranking = gerenciadorCamarins->getConsumo().maioresConsumidores(
+        janela, (size_t)limite, relogioMonotonicoNs());
+    
+    if (ranking.empty()) {
+        cout << "\n[INFO] Nenhum consumo na janela de " << MedidorConsumo::nomeJanela(janela) << "." << endl;
+        return;
+    }
+    
+    cout << "\n" << left << setw(10) << "Camarim" << setw(8) << "Item"
+         << setw(12) << "Consumido" << "Por hora" << endl;
+    cout << string(38, '-') << endl;
+    for (const auto& linha : ranking) {
+        cout << left << setw(10) << linha.camarimId << setw(8) << linha.itemId
+             << setw(12) << linha.quantidade << fixed << setprecision(1) << linha.porHora << endl;
+    }
+}
+
 // ==================== Funções de Pedidos ====================
 
 void exibirPedidos() {
-    vector<Pedido> pedidos = gerenciadorPedidos.listar();
+    vector<Pedido> pedidos = gerenciadorPedidos->listar();
     if (pedidos.empty()) {
         cout << "\nNenhum pedido cadastrado.\n" << endl;
         return;
@@ -603,8 +864,8 @@ void exibirPedidos() {
 }
 
 void cadastrarPedido() {
-    int camarimId;
-    string nomeArtista;
+    int camarimId, prioridade;
+    string nomeArtista, chave;
     
     cout << "\n=== Criar Pedido ===" << endl;
     cout << "ID do Camarim: ";
@@ -614,8 +875,15 @@ void cadastrarPedido() {
     cout << "Nome do Artista: ";
     getline(cin, nomeArtista);
     
+    cout << "Prioridade (0=Normal, 1=Alta, 2=Urgente): ";
+    cin >> prioridade;
+    limparBuffer();
+    
+    cout << "Chave da requisição (Enter = nenhuma): ";
+    getline(cin, chave);  // Mesma chave = reenvio, não cria outro pedido
+    
     try {
-        int id = gerenciadorPedidos.criar(camarimId, nomeArtista);
+        int id = gerenciadorPedidos->criar(camarimId, nomeArtista, prioridade, chave);
         cout << "\n[OK] Pedido criado com ID: " << id << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -629,7 +897,7 @@ void removerPedido() {
     cin >> id;
     
     try {
-        gerenciadorPedidos.remover(id);
+        gerenciadorPedidos->remover(id);
         cout << "\n[OK] Pedido removido com sucesso!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -638,12 +906,13 @@ void removerPedido() {
 
 void adicionarItemPedido() {
     int pedidoId, itemId, quantidade;
+    string chave;
     
     cout << "\n=== Adicionar Item ao Pedido ===" << endl;
     cout << "ID do Pedido: ";
     cin >> pedidoId;
     
-    Pedido* pedido = gerenciadorPedidos.buscarPorId(pedidoId);
+    Pedido* pedido = gerenciadorPedidos->buscarPorId(pedidoId);
     if (!pedido) {
         cout << "\n[ERRO] Pedido não encontrado!" << endl;
         return;
@@ -653,7 +922,7 @@ void adicionarItemPedido() {
     cin >> itemId;
     
     // Buscar item no catálogo
-    Item* item = gerenciadorItens.buscarPorId(itemId);
+    Item* item = gerenciadorItens->buscarPorId(itemId);
     if (!item) {
         cout << "\n[ERRO] Item não encontrado no catálogo!" << endl;
         cout << "Dica: Cadastre o item no catálogo primeiro (Menu Itens)." << endl;
@@ -663,10 +932,18 @@ void adicionarItemPedido() {
     cout << "Item selecionado: " << item->getNome() << endl;
     cout << "Quantidade: ";
     cin >> quantidade;
+    limparBuffer();
+    
+    cout << "Chave da requisição (Enter = nenhuma): ";
+    getline(cin, chave);
     
     try {
-        pedido->adicionarItem(item->getId(), item->getNome(), quantidade);
-        cout << "\n[OK] Item adicionado ao pedido!" << endl;
+        if (gerenciadorPedidos->adicionarItem(pedido->getId(), item->getId(), item->getNome(),
+                                             quantidade, chave)) {
+            cout << "\n[OK] Item adicionado ao pedido!" << endl;
+        } else {
+            cout << "\n[AVISO] Requisição repetida, item já havia sido adicionado." << endl;
+        }
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
     }
@@ -679,7 +956,7 @@ void removerItemPedido() {
     cout << "ID do Pedido: ";
     cin >> pedidoId;
     
-    Pedido* pedido = gerenciadorPedidos.buscarPorId(pedidoId);
+    Pedido* pedido = gerenciadorPedidos->buscarPorId(pedidoId);
     if (!pedido) {
         cout << "\n[ERRO] Pedido não encontrado!" << endl;
         return;
@@ -689,7 +966,7 @@ void removerItemPedido() {
     cin >> itemId;
     
     try {
-        if (pedido->removerItem(itemId)) {
+        if (gerenciadorPedidos->removerItem(pedidoId, itemId)) {
             cout << "\n[OK] Item removido do pedido!" << endl;
         } else {
             cout << "\n[ERRO] Item não encontrado no pedido!" << endl;
@@ -706,22 +983,139 @@ void marcarPedidoAtendido() {
     cout << "ID do Pedido: ";
     cin >> pedidoId;
     
-    Pedido* pedido = gerenciadorPedidos.buscarPorId(pedidoId);
-    if (!pedido) {
-        cout << "\n[ERRO] Pedido não encontrado!" << endl;
+    try {
+        gerenciadorPedidos->atender(pedidoId);  // Marca e grava latência de espera
+        cout << "\n[OK] Pedido marcado como atendido!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Atende o que o estoque permite e gera backorder do restante
+ * 
+ * O backorder é atendido automaticamente quando o item faltante
+ * voltar ao estoque (ver observador configurado em main)
+ */
+void atenderPedidoParcial() {
+    int pedidoId;
+    
+    cout << "\n=== Atender Parcialmente ===" << endl;
+    cout << "ID do Pedido: ";
+    cin >> pedidoId;
+    
+    try {
+        int restante = gerenciadorPedidos->atenderParcial(pedidoId, *estoque, *gerenciadorCamarins);
+        if (restante == 0) {
+            cout << "\n[OK] Pedido atendido por completo!" << endl;
+        } else if (restante == pedidoId) {
+            cout << "\n[INFO] Nenhum item disponível. Pedido aguarda reposição do estoque." << endl;
+        } else {
+            cout << "\n[OK] Pedido atendido parcialmente. Backorder gerado (ID: " 
+                 << restante << ")" << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Consulta pedido que já saiu da memória (arquivo frio)
+ */
+void buscarPedidoArquivado() {
+    int pedidoId;
+    
+    cout << "\n=== Buscar Pedido Arquivado ===" << endl;
+    cout << "ID do Pedido: ";
+    cin >> pedidoId;
+    
+    try {
+        Pedido pedido;
+        if (gerenciadorPedidos->buscarArquivado(pedidoId, pedido)) {
+            cout << "\n" << pedido << endl;
+        } else {
+            cout << "\n[ERRO] Pedido não encontrado no arquivo." << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Lista pedidos arquivados com ID em uma faixa
+ * 
+ * Percorre o índice em ordem de ID lendo um pedido por vez;
+ * a listagem para nos primeiros LIMITE_LISTAGEM pedidos
+ */
+void listarPedidosArquivadosFaixa() {
+    const size_t LIMITE_LISTAGEM = 50;
+    int idInicio, idFim;
+    size_t listados = 0;
+    bool truncado = false;
+    
+    cout << "\n=== Pedidos Arquivados por Faixa ===" << endl;
+    cout << "ID inicial: ";
+    cin >> idInicio;
+    cout << "ID final: ";
+    cin >> idFim;
+    
+    if (idInicio > idFim) {
+        cout << "\n[ERRO] O ID inicial deve ser menor ou igual ao final." << endl;
         return;
     }
     
     try {
-        pedido->marcarAtendido();
-        cout << "\n[OK] Pedido marcado como atendido!" << endl;
+        gerenciadorPedidos->percorrerArquivados(idInicio, idFim, [&](const Pedido& pedido) {
+            if (listados == LIMITE_LISTAGEM) {
+                truncado = true;  // Há mais pedidos na faixa
+                return false;
+            }
+            cout << "#" << pedido.getId() << " | Camarim " << pedido.getCamarimId()
+                 << " | " << pedido.getNomeArtista() << " | " << pedido.getItens().size() << " item(ns)" << endl;
+            listados++;
+            return true;
+        });
+        if (listados == 0) {
+            cout << "\nNenhum pedido arquivado nessa faixa." << endl;
+        } else if (truncado) {
+            cout << "\n[INFO] Exibindo os primeiros " << LIMITE_LISTAGEM << "; refine a faixa para ver os demais." << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Arquiva agora os pedidos atendidos há pelo menos N minutos
+ * 
+ * O arquivamento também roda automaticamente a cada volta
+ * do menu principal, com a idade configurada em main
+ */
+void arquivarPedidosAtendidos() {
+    int minutos;
+    
+    cout << "\n=== Arquivar Pedidos Atendidos ===" << endl;
+    cout << "Atendidos há pelo menos quantos minutos? ";
+    cin >> minutos;
+    
+    if (minutos < 0) {
+        cout << "\n[ERRO] Informe um número de minutos não negativo." << endl;
+        return;
+    }
+    
+    try {
+        int arquivados = gerenciadorPedidos->arquivarAtendidos(relogioMonotonicoNs(),
+                                                              (int64_t)minutos * 60 * 1000000000LL);
+        cout << "\n[OK] " << arquivados << " pedido(s) arquivado(s). Em memória: "
+             << gerenciadorPedidos->quantidadeEmMemoria() << ", no arquivo: "
+             << gerenciadorPedidos->quantidadeArquivados() << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
     }
 }
 
 void listarPedidosPendentes() {
-    vector<Pedido> pedidos = gerenciadorPedidos.listarPendentes();
+    vector<Pedido> pedidos = gerenciadorPedidos->listarPendentes();
     if (pedidos.empty()) {
         cout << "\nNenhum pedido pendente." << endl;
         return;
@@ -740,7 +1134,7 @@ void buscarPedidosPorCamarim() {
     cout << "ID do Camarim: ";
     cin >> camarimId;
     
-    vector<Pedido> pedidos = gerenciadorPedidos.buscarPorCamarim(camarimId);
+    vector<Pedido> pedidos = gerenciadorPedidos->buscarPorCamarim(camarimId);
     
     if (pedidos.empty()) {
         cout << "\nNenhum pedido encontrado para este camarim." << endl;
@@ -760,23 +1154,152 @@ void buscarArtistasPorCamarim() {
     cout << "ID do Camarim: ";
     cin >> camarimId;
     
-    vector<Artista> artistas = gerenciadorArtistas.buscarPorCamarim(camarimId);
+    // Índice de atribuição: O(1) em vez de percorrer todos os artistas
+    Artista* artista = gerenciadorArtistas->buscarPorId(indiceAtribuicao->getArtistaDoCamarim(camarimId));
     
-    if (artistas.empty()) {
+    if (!artista) {
         cout << "\nNenhum artista encontrado para este camarim." << endl;
         return;
     }
     
-    cout << "\n=== Artistas do Camarim " << camarimId << " ===" << endl;
-    for (const auto& artista : artistas) {
-        cout << artista.exibir() << endl;
+    cout << "\n=== Artista do Camarim " << camarimId << " ===" << endl;
+    cout << artista->exibir() << endl;
+}
+
+/**
+ * @brief Confere se índice, artistas e camarins concordam entre si
+ */
+void verificarAtribuicoes() {
+    cout << "\n=== Verificar Atribuições ===" << endl;
+    
+    vector<string> erros = indiceAtribuicao->verificar(*gerenciadorArtistas, *gerenciadorCamarins);
+    if (erros.empty()) {
+        cout << "\n[OK] " << indiceAtribuicao->tamanho() << " atribuição(ões), nenhuma inconsistência." << endl;
+        return;
+    }
+    
+    cout << "\n[AVISO] " << erros.size() << " inconsistência(s):" << endl;
+    for (const auto& erro : erros) {
+        cout << "  - " << erro << endl;
+    }
+}
+
+/**
+ * @brief Exibe p50/p95/p99 do tempo de espera dos pedidos
+ * 
+ * Janela informada em minutos contados a partir de agora
+ * (granularidade de 1 hora, últimas 24 horas disponíveis)
+ */
+void exibirLatenciaPedidos() {
+    int minutos;
+    
+    cout << "\n=== Latência de Atendimento ===" << endl;
+    cout << "Janela em minutos (ex: 60 = última hora): ";
+    cin >> minutos;
+    
+    if (minutos <= 0) {
+        cout << "\n[ERRO] Janela deve ser maior que zero!" << endl;
+        return;
+    }
+    
+    int64_t fim = relogioMonotonicoNs();
+    int64_t inicio = fim - (int64_t)minutos * 60 * 1000000000LL;
+    
+    cout << "\nGeral: " << gerenciadorPedidos->latenciaTotal(inicio, fim).exibir() << endl;
+    
+    const char* nomesPrioridade[] = {"Normal", "Alta", "Urgente"};
+    cout << "\nPor prioridade:" << endl;
+    for (const auto& par : gerenciadorPedidos->latenciaPorPrioridades(inicio, fim)) {
+        cout << "  " << left << setw(10) << nomesPrioridade[par.first]
+             << par.second.exibir() << endl;
+    }
+    
+    cout << "\nPor camarim:" << endl;
+    for (const auto& par : gerenciadorPedidos->latenciaPorCamarins(inicio, fim)) {
+        cout << "  Camarim " << left << setw(5) << par.first
+             << par.second.exibir() << endl;
+    }
+}
+
+/**
+ * @brief Consolida pedidos pendentes em uma onda de separação
+ * 
+ * FLUXO:
+ * 1. Soma os itens de todos os pedidos pendentes (não reservados)
+ * 2. Exibe totais por item e entregas por camarim
+ * 3. Se confirmado: retira tudo do estoque em UM lote (tudo ou nada),
+ *    entrega nos camarins e marca os pedidos como atendidos
+ */
+void planejarOndaSeparacao() {
+    cout << "\n=== Planejar Onda de Separação ===" << endl;
+    
+    OndaSeparacao onda = OndaSeparacao::planejar(gerenciadorPedidos->listarAguardandoSeparacao());
+    cout << onda << endl;
+    
+    if (onda.vazia()) {
+        return;  // Nada a separar
+    }
+    
+    char confirmacao;
+    cout << "Retirar do estoque e entregar? (s/n): ";
+    cin >> confirmacao;
+    if (confirmacao != 's' && confirmacao != 'S') {
+        cout << "\n[AVISO] Onda descartada." << endl;
+        return;
+    }
+    
+    // Confere camarins ANTES de mexer no estoque
+    for (const auto& camarim : onda.getPorCamarim()) {
+        if (gerenciadorCamarins->buscarPorId(camarim.first) == nullptr) {
+            cout << "\n[ERRO] Camarim " << camarim.first << " não encontrado!" << endl;
+            return;
+        }
+    }
+    
+    try {
+        // Saída em lote: falha em qualquer item cancela a onda inteira
+        estoque->removerLote(onda.quantidadesPorItem());
+        
+        for (int pedidoId : onda.getPedidoIds()) {
+            gerenciadorPedidos->reservar(pedidoId);  // Itens já saíram do estoque
+        }
+        
+        // Entrega nos camarins
+        for (const auto& camarim : onda.getPorCamarim()) {
+            Camarim* destino = gerenciadorCamarins->buscarPorId(camarim.first);
+            for (const auto& par : camarim.second) {
+                destino->inserirItem(par.second.itemId, par.second.nomeItem, par.second.quantidade);
+            }
+        }
+        
+        for (int pedidoId : onda.getPedidoIds()) {
+            gerenciadorPedidos->atender(pedidoId);  // Grava latência de espera
+        }
+        
+        cout << "\n[OK] Onda concluída: " << onda.getPedidoIds().size()
+             << " pedido(s) atendido(s)!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
     }
 }
 
 // ==================== Funções de Lista de Compras ====================
 
+/**
+ * @brief Aplica às listas os preços alterados no catálogo desde a última vez
+ *
+ * Só as linhas dos itens com preço alterado são visitadas
+ */
+void aplicarPrecosCatalogo() {
+    int alteradas = gerenciadorListaCompras->reprecificar(*gerenciadorItens);
+    if (alteradas > 0) {
+        cout << "\n[INFO] " << alteradas << " linha(s) reprecificada(s) pelo catálogo" << endl;
+    }
+}
+
 void exibirListasCompras() {
-    vector<ListaCompras> listas = gerenciadorListaCompras.listar();
+    aplicarPrecosCatalogo();
+    vector<ListaCompras> listas = gerenciadorListaCompras->listar();
     if (listas.empty()) {
         cout << "\nNenhuma lista de compras cadastrada.\n" << endl;
         return;
@@ -786,6 +1309,9 @@ void exibirListasCompras() {
     for (const auto& lista : listas) {
         cout << lista << endl;
     }
+    cout << fixed << setprecision(2);
+    cout << "TOTAL GERAL (" << listas.size() << " lista(s)): R$ "
+         << gerenciadorListaCompras->calcularTotalGeral() << endl;
 }
 
 void cadastrarListaCompras() {
@@ -798,7 +1324,7 @@ void cadastrarListaCompras() {
     getline(cin, descricao);
     
     try {
-        int id = gerenciadorListaCompras.criar(descricao);
+        int id = gerenciadorListaCompras->criar(descricao);
         cout << "\n[OK] Lista de compras criada com ID: " << id << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -812,7 +1338,7 @@ void removerListaCompras() {
     cin >> id;
     
     try {
-        gerenciadorListaCompras.remover(id);
+        gerenciadorListaCompras->remover(id);
         cout << "\n[OK] Lista de compras removida com sucesso!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -826,7 +1352,7 @@ void adicionarItemListaCompras() {
     cout << "ID da Lista: ";
     cin >> listaId;
     
-    ListaCompras* lista = gerenciadorListaCompras.buscarPorId(listaId);
+    ListaCompras* lista = gerenciadorListaCompras->buscarPorId(listaId);
     if (!lista) {
         cout << "\n[ERRO] Lista não encontrada!" << endl;
         return;
@@ -836,7 +1362,7 @@ void adicionarItemListaCompras() {
     cin >> itemId;
     
     // Buscar item no catálogo
-    Item* item = gerenciadorItens.buscarPorId(itemId);
+    Item* item = gerenciadorItens->buscarPorId(itemId);
     if (!item) {
         cout << "\n[ERRO] Item não encontrado no catálogo!" << endl;
         cout << "Dica: Cadastre o item no catálogo primeiro (Menu Itens)." << endl;
@@ -848,7 +1374,8 @@ void adicionarItemListaCompras() {
     cin >> quantidade;
     
     try {
-        lista->adicionarItem(item->getId(), item->getNome(), quantidade, item->getPreco());
+        lista->adicionarItem(item->getId(), item->getNome(), quantidade, item->getPreco(),
+                             gerenciadorItens->getVersaoPreco(item->getId()));
         cout << "\n[OK] Item adicionado à lista!" << endl;
     } catch (const ExcecaoBase& e) {
         cout << "\n[ERRO] " << e.what() << endl;
@@ -862,7 +1389,7 @@ void removerItemListaCompras() {
     cout << "ID da Lista: ";
     cin >> listaId;
     
-    ListaCompras* lista = gerenciadorListaCompras.buscarPorId(listaId);
+    ListaCompras* lista = gerenciadorListaCompras->buscarPorId(listaId);
     if (!lista) {
         cout << "\n[ERRO] Lista não encontrada!" << endl;
         return;
@@ -889,7 +1416,7 @@ void atualizarQuantidadeItemLista() {
     cout << "ID da Lista: ";
     cin >> listaId;
     
-    ListaCompras* lista = gerenciadorListaCompras.buscarPorId(listaId);
+    ListaCompras* lista = gerenciadorListaCompras->buscarPorId(listaId);
     if (!lista) {
         cout << "\n[ERRO] Lista não encontrada!" << endl;
         return;
@@ -912,11 +1439,13 @@ void atualizarQuantidadeItemLista() {
 void calcularTotalListaCompras() {
     int listaId;
     
+    aplicarPrecosCatalogo();
+    
     cout << "\n=== Calcular Total da Lista ===" << endl;
     cout << "ID da Lista: ";
     cin >> listaId;
     
-    ListaCompras* lista = gerenciadorListaCompras.buscarPorId(listaId);
+    ListaCompras* lista = gerenciadorListaCompras->buscarPorId(listaId);
     if (!lista) {
         cout << "\n[ERRO] Lista não encontrada!" << endl;
         return;
@@ -926,6 +1455,7 @@ void calcularTotalListaCompras() {
     cout << "\n=== TOTAL ===" << endl;
     cout << fixed << setprecision(2);
     cout << "R$ " << total << endl;
+    cout << "Todas as listas: R$ " << gerenciadorListaCompras->calcularTotalGeral() << endl;
 }
 
 void limparListaCompras() {
@@ -935,7 +1465,7 @@ void limparListaCompras() {
     cout << "ID da Lista: ";
     cin >> listaId;
     
-    ListaCompras* lista = gerenciadorListaCompras.buscarPorId(listaId);
+    ListaCompras* lista = gerenciadorListaCompras->buscarPorId(listaId);
     if (!lista) {
         cout << "\n[ERRO] Lista não encontrada!" << endl;
         return;
@@ -949,23 +1479,1070 @@ void limparListaCompras() {
     }
 }
 
+/**
+ * @brief Exibe a lista automática (sempre em dia: mantida pelos observadores)
+ */
+void exibirListaAutomatica() {
+    cout << "\n" << *listaAutomatica << endl;
+}
 
-void menuPrincipal(){
-    cout << "____Menu de Principal___" << endl;
-    cout << "1. Catálogo de Itens" << endl;
-    cout << "2. Estoque" << endl;
-    cout << "3. Camarim" << endl;
-    cout << "4. Artista" << endl;
-    cout << "5. Lista de Pedidos" << endl;
-    cout << "6. Lista de Compras" << endl;
-    cout << "0. Finalizar" << endl;
+void definirEstoqueMinimo() {
+    int itemId, minimo;
+    
+    cout << "\n=== Definir Estoque Mínimo ===" << endl;
+    cout << "ID do Item (do catálogo): ";
+    cin >> itemId;
+    cout << "Mínimo atual: " << listaAutomatica->getNecessidade(itemId).minimo << endl;
+    cout << "Novo mínimo (0 = sem mínimo): ";
+    cin >> minimo;
+    
+    try {
+        listaAutomatica->definirEstoqueMinimo(itemId, minimo);
+        cout << "\n[OK] Estoque mínimo definido!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
 }
 
-void menuSub(){
-    cout << "1. Exibir" << endl;
-    cout << "2. Cadastrar" << endl;
-    cout << "3. Remover" << endl;
-    cout << "0. Retornar" << endl;
+/**
+ * @brief Copia a lista automática para uma lista de compras comum
+ *
+ * Depois de copiada, os itens passam a contar como "em listas"
+ * e somem da lista automática
+ */
+void efetivarListaAutomatica() {
+    exibirListaAutomatica();
+    
+    const ListaCompras& gerada = listaAutomatica->getLista();
+    if (gerada.getItens().empty()) {
+        return;  // Nada a comprar
+    }
+    
+    char confirmacao;
+    cout << "Criar lista de compras com estes itens? (s/n): ";
+    cin >> confirmacao;
+    if (confirmacao != 's' && confirmacao != 'S') {
+        cout << "\n[AVISO] Lista automática não efetivada." << endl;
+        return;
+    }
+    
+    try {
+        int listaId = gerenciadorListaCompras->criar("Compra automática");
+        ListaCompras* lista = gerenciadorListaCompras->buscarPorId(listaId);
+        for (const auto& par : gerada.getItens()) {
+            const ItemCompra& item = par.second;
+            lista->adicionarItem(item.itemId, item.nomeItem, item.quantidade, item.preco, item.versaoPreco);
+        }
+        cout << "\n[OK] Lista de compras criada com ID: " << listaId << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Escolhe, dentro do orçamento do dia, o que comprar da lista automática
+ *
+ * Mínimo viável = o que pedidos e riders precisam já (sem a folga do
+ * estoque mínimo); ruptura projetada pelo consumo da última hora
+ */
+void otimizarCompraOrcamento() {
+    double orcamento;
+    int modo;
+    
+    cout << "\n=== Compra por Orçamento ===" << endl;
+    cout << "Orçamento do dia (R$): ";
+    cin >> orcamento;
+    cout << "Modo (1 = automático, 2 = exato, 3 = guloso): ";
+    cin >> modo;
+    if (modo < 1 || modo > 3) {
+        cout << "\n[ERRO] Modo inválido!" << endl;
+        return;
+    }
+    
+    map<int, double> taxas = gerenciadorCamarins->getConsumo().taxaPorItem(JanelaConsumo::UMA_HORA,
+                                                                           relogioMonotonicoNs());
+    vector<NecessidadeCompra> necessidades;
+    for (const auto& par : listaAutomatica->getLista().getItens()) {
+        int itemId = par.first;
+        NecessidadeItem necessidade = listaAutomatica->getNecessidade(itemId);
+        int imediato = necessidade.pedidos + necessidade.riders - necessidade.estoque - necessidade.emListas;
+        int minima = max(0, min(par.second.quantidade, imediato));
+        
+        auto taxa = taxas.find(itemId);
+        double horas = taxa == taxas.end() ? -1.0 : necessidade.estoque / taxa->second;
+        necessidades.push_back(NecessidadeCompra(itemId, par.second.quantidade, minima,
+                                                 necessidade.riders > 0, horas));
+    }
+    if (necessidades.empty()) {
+        cout << "\n[INFO] Nada a comprar: a lista automática está vazia." << endl;
+        return;
+    }
+    
+    try {
+        ModoOtimizacao modoOtimizacao = modo == 1 ? ModoOtimizacao::AUTOMATICO
+                                      : modo == 2 ? ModoOtimizacao::EXATO : ModoOtimizacao::GULOSO;
+        ResultadoOrcamento resultado = OtimizadorCompras::otimizar(
+            necessidades, *gerenciadorItens, llround(orcamento * 100), modoOtimizacao);
+        cout << "\n" << resultado << endl;
+        
+        if (resultado.getEscolhidas().empty()) {
+            return;
+        }
+        char confirmacao;
+        cout << "Criar lista de compras com estas escolhas? (s/n): ";
+        cin >> confirmacao;
+        if (confirmacao != 's' && confirmacao != 'S') {
+            cout << "\n[AVISO] Compra descartada." << endl;
+            return;
+        }
+        int listaId = gerenciadorListaCompras->criar("Compra do dia (orçamento)");
+        resultado.preencherLista(*gerenciadorListaCompras->buscarPorId(listaId));
+        cout << "\n[OK] Lista de compras criada com ID: " << listaId << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Junta várias listas de compras em um pedido consolidado
+ */
+void consolidarListasCompras() {
+    vector<const ListaCompras*> origens;
+    int listaId;
+    
+    aplicarPrecosCatalogo();
+    
+    cout << "\n=== Consolidar Listas de Compras ===" << endl;
+    cout << "IDs das listas (0 para terminar; só 0 = todas): ";
+    while (cin >> listaId && listaId != 0) {
+        ListaCompras* lista = gerenciadorListaCompras->buscarPorId(listaId);
+        if (!lista) {
+            cout << "\n[ERRO] Lista " << listaId << " não encontrada!" << endl;
+            return;
+        }
+        origens.push_back(lista);
+    }
+    if (origens.empty()) {
+        for (const auto& lista : gerenciadorListaCompras->getListas()) {
+            origens.push_back(&lista);
+        }
+    }
+    if (origens.empty()) {
+        cout << "\nNenhuma lista de compras cadastrada.\n" << endl;
+        return;
+    }
+    
+    CompraConsolidada compra = CompraConsolidada::consolidar(origens);
+    cout << "\n" << compra << endl;
+    if (compra.vazia()) {
+        return;
+    }
+    
+    char confirmacao;
+    cout << "Criar lista com o pedido consolidado? (s/n): ";
+    cin >> confirmacao;
+    if (confirmacao != 's' && confirmacao != 'S') {
+        return;
+    }
+    
+    try {
+        // origens aponta para dentro do vector: não usar depois de criar outra lista
+        int novaId = gerenciadorListaCompras->criar("Pedido consolidado");
+        compra.preencherLista(*gerenciadorListaCompras->buscarPorId(novaId));
+        cout << "\n[OK] Pedido consolidado criado com ID: " << novaId << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Dá entrada de uma lista de compras no estoque (uma transação)
+ */
+void receberMercadoria() {
+    int listaId;
+    
+    cout << "\n=== Receber Mercadoria ===" << endl;
+    cout << "ID da Lista: ";
+    cin >> listaId;
+    
+    ListaCompras* lista = gerenciadorListaCompras->buscarPorId(listaId);
+    if (!lista) {
+        cout << "\n[ERRO] Lista não encontrada!" << endl;
+        return;
+    }
+    if (lista->getItens().empty()) {
+        cout << "\n[INFO] Lista vazia: nada a receber." << endl;
+        return;
+    }
+    
+    cout << *lista << endl;
+    
+    // Só as linhas que chegaram diferente precisam ser digitadas
+    map<int, int> recebidos;
+    char tudoCerto;
+    cout << "Chegou tudo conforme a lista? (s/n): ";
+    cin >> tudoCerto;
+    if (tudoCerto != 's' && tudoCerto != 'S') {
+        for (const auto& par : lista->getItens()) {
+            int quantidade;
+            cout << par.second.nomeItem << " (pedido " << par.second.quantidade << "), recebido: ";
+            cin >> quantidade;
+            recebidos[par.first] = quantidade;
+        }
+    }
+    
+    try {
+        const Recebimento& recebimento = diarioRecebimentos->receber(*lista, recebidos, *estoque,
+                                                                     relogioMonotonicoNs());
+        cout << "\n" << DiarioRecebimentos::exibir(recebimento) << endl;
+        cout << "[OK] Recebimento " << recebimento.id << " lançado no estoque!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+        cout << "Nada foi lançado no estoque." << endl;
+    }
+}
+
+void exibirHistoricoRecebimentos() {
+    cout << "\n" << diarioRecebimentos->exibirHistorico() << endl;
+    if (diarioRecebimentos->getRegistros().empty()) {
+        return;
+    }
+    
+    int id;
+    cout << "ID do recebimento para detalhar (0 = nenhum): ";
+    cin >> id;
+    if (id == 0) {
+        return;
+    }
+    const Recebimento* recebimento = diarioRecebimentos->buscarPorId(id);
+    if (!recebimento) {
+        cout << "\n[ERRO] Recebimento não encontrado!" << endl;
+        return;
+    }
+    cout << "\n" << DiarioRecebimentos::exibir(*recebimento) << endl;
+}
+
+
+// ==================== Funções de Riders ====================
+
+void exibirRiders() {
+    vector<Rider> riders = gerenciadorRiders->listar();
+    if (riders.empty()) {
+        cout << "\nNenhum rider cadastrado.\n" << endl;
+        return;
+    }
+    
+    cout << "\n=== Riders ===" << endl;
+    for (const auto& rider : riders) {
+        cout << rider << endl;
+    }
+}
+
+void cadastrarRider() {
+    int artistaId;
+    string nome;
+    
+    cout << "\n=== Cadastrar Rider ===" << endl;
+    cout << "ID do Artista: ";
+    cin >> artistaId;
+    
+    if (!gerenciadorArtistas->buscarPorId(artistaId)) {
+        cout << "\n[ERRO] Artista não encontrado!" << endl;
+        return;
+    }
+    
+    limparBuffer();
+    cout << "Nome do Rider: ";
+    getline(cin, nome);
+    
+    try {
+        int id = gerenciadorRiders->cadastrar(artistaId, nome);
+        cout << "\n[OK] Rider cadastrado com ID: " << id << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void removerRider() {
+    int id;
+    cout << "\n=== Remover Rider ===" << endl;
+    cout << "Digite o ID do rider: ";
+    cin >> id;
+    
+    if (gerenciadorRiders->remover(id)) {
+        cout << "\n[OK] Rider removido com sucesso!" << endl;
+    } else {
+        cout << "\n[ERRO] Rider não encontrado!" << endl;
+    }
+}
+
+void definirItemRider() {
+    int riderId, itemId, quantidade;
+    
+    cout << "\n=== Definir Item do Rider ===" << endl;
+    cout << "ID do Rider: ";
+    cin >> riderId;
+    
+    Rider* rider = gerenciadorRiders->buscarPorId(riderId);
+    if (!rider) {
+        cout << "\n[ERRO] Rider não encontrado!" << endl;
+        return;
+    }
+    
+    cout << "ID do Item (do catálogo): ";
+    cin >> itemId;
+    
+    Item* item = gerenciadorItens->buscarPorId(itemId);
+    if (!item) {
+        cout << "\n[ERRO] Item não encontrado no catálogo!" << endl;
+        return;
+    }
+    
+    cout << "Item selecionado: " << item->getNome() << endl;
+    cout << "Quantidade por show: ";
+    cin >> quantidade;
+    
+    try {
+        rider->definirItem(item->getId(), item->getNome(), quantidade);
+        cout << "\n[OK] Item definido no rider!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void removerItemRider() {
+    int riderId, itemId;
+    
+    cout << "\n=== Remover Item do Rider ===" << endl;
+    cout << "ID do Rider: ";
+    cin >> riderId;
+    
+    Rider* rider = gerenciadorRiders->buscarPorId(riderId);
+    if (!rider) {
+        cout << "\n[ERRO] Rider não encontrado!" << endl;
+        return;
+    }
+    
+    cout << "ID do Item: ";
+    cin >> itemId;
+    
+    if (rider->removerItem(itemId)) {
+        cout << "\n[OK] Item removido do rider!" << endl;
+    } else {
+        cout << "\n[ERRO] Item não está no rider!" << endl;
+    }
+}
+
+/**
+ * @brief Aplica um rider a um camarim em uma única transação
+ * 
+ * Substitui o cadastro item por item em cadastrarItemCamarim:
+ * se faltar qualquer item no estoque, nada é retirado
+ */
+void aplicarRiderCamarim() {
+    int riderId, camarimId;
+    
+    cout << "\n=== Aplicar Rider ao Camarim ===" << endl;
+    cout << "ID do Rider: ";
+    cin >> riderId;
+    cout << "ID do Camarim: ";
+    cin >> camarimId;
+    
+    try {
+        gerenciadorRiders->aplicar(riderId, camarimId, *gerenciadorItens, *estoque, *gerenciadorCamarins);
+        cout << "\n[OK] Rider aplicado ao camarim!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Abertura de portas: abastece todos os camarins com seus riders
+ */
+void provisionarCamarins() {
+    cout << "\n=== Abastecer Todos os Camarins ===" << endl;
+    
+    try {
+        int abastecidos = gerenciadorRiders->provisionarCamarins(*gerenciadorItens, *estoque,
+                                                                *gerenciadorCamarins);
+        cout << "\n[OK] " << abastecidos << " camarim(ns) abastecido(s)!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+        cout << "Nenhum item foi retirado do estoque." << endl;
+    }
+}
+
+/**
+ * @brief Entre shows: completa cada camarim até o rider do artista
+ * 
+ * Mostra as faltas calculadas e, se confirmado, retira o total
+ * do estoque em UM lote (tudo ou nada) e entrega nos camarins
+ */
+void reporCamarins() {
+    cout << "\n=== Repor Camarins ===" << endl;
+    
+    PlanoReposicao plano = PlanoReposicao::planejar(*gerenciadorRiders, *gerenciadorCamarins);
+    cout << plano << endl;
+    
+    if (plano.vazio()) {
+        return;  // Nada a repor
+    }
+    
+    char confirmacao;
+    cout << "Retirar do estoque e repor? (s/n): ";
+    cin >> confirmacao;
+    if (confirmacao != 's' && confirmacao != 'S') {
+        cout << "\n[AVISO] Reposição descartada." << endl;
+        return;
+    }
+    
+    try {
+        int repostos = plano.executar(*gerenciadorItens, *estoque, *gerenciadorCamarins);
+        cout << "\n[OK] " << repostos << " camarim(ns) reposto(s)!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+        cout << "Nenhum item foi retirado do estoque." << endl;
+    }
+}
+
+// ==================== Funções de Fornecedores ====================
+
+void exibirFornecedores() {
+    cout << "\n" << *catalogoFornecedores << endl;
+}
+
+void cadastrarFornecedor() {
+    string nome;
+    
+    cout << "\n=== Cadastrar Fornecedor ===" << endl;
+    limparBuffer();
+    cout << "Nome: ";
+    getline(cin, nome);
+    
+    try {
+        int id = catalogoFornecedores->cadastrarFornecedor(nome);
+        cout << "\n[OK] Fornecedor cadastrado com ID: " << id << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void removerFornecedor() {
+    int id;
+    
+    cout << "\n=== Remover Fornecedor ===" << endl;
+    cout << "ID do Fornecedor: ";
+    cin >> id;
+    
+    if (catalogoFornecedores->removerFornecedor(id)) {
+        cout << "\n[OK] Fornecedor e suas ofertas removidos!" << endl;
+    } else {
+        cout << "\n[ERRO] Fornecedor não encontrado!" << endl;
+    }
+}
+
+void definirOfertaFornecedor() {
+    int fornecedorId, itemId, minimo, embalagem;
+    double preco;
+    
+    cout << "\n=== Definir Oferta ===" << endl;
+    cout << "ID do Fornecedor: ";
+    cin >> fornecedorId;
+    cout << "ID do Item (do catálogo): ";
+    cin >> itemId;
+    
+    Item* item = gerenciadorItens->buscarPorId(itemId);
+    if (!item) {
+        cout << "\n[ERRO] Item não encontrado no catálogo!" << endl;
+        return;
+    }
+    
+    cout << "Item selecionado: " << item->getNome() << endl;
+    cout << "Preço unitário (R$): ";
+    cin >> preco;
+    cout << "Quantidade mínima: ";
+    cin >> minimo;
+    cout << "Unidades por embalagem: ";
+    cin >> embalagem;
+    
+    try {
+        catalogoFornecedores->definirOferta(fornecedorId, itemId, llround(preco * 100), minimo, embalagem);
+        cout << "\n[OK] Oferta registrada!" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void removerOfertaFornecedor() {
+    int fornecedorId, itemId;
+    
+    cout << "\n=== Remover Oferta ===" << endl;
+    cout << "ID do Fornecedor: ";
+    cin >> fornecedorId;
+    cout << "ID do Item: ";
+    cin >> itemId;
+    
+    if (catalogoFornecedores->removerOferta(fornecedorId, itemId)) {
+        cout << "\n[OK] Oferta removida!" << endl;
+    } else {
+        cout << "\n[ERRO] Oferta não encontrada!" << endl;
+    }
+}
+
+/**
+ * @brief Divide uma lista de compras em pedidos por fornecedor (menor custo)
+ */
+void dividirListaPorFornecedor() {
+    int listaId;
+    
+    cout << "\n=== Dividir Lista por Fornecedor ===" << endl;
+    cout << "ID da Lista: ";
+    cin >> listaId;
+    
+    ListaCompras* lista = gerenciadorListaCompras->buscarPorId(listaId);
+    if (!lista) {
+        cout << "\n[ERRO] Lista não encontrada!" << endl;
+        return;
+    }
+    
+    cout << "\n" << catalogoFornecedores->dividir(*lista) << endl;
+}
+
+// ==================== Funções de Equipe ====================
+
+void exibirEquipe() {
+    cout << "\n=== Equipe ===" << endl;
+    cout << "Produtores: " << gerenciadorEquipe->quantidade(FuncaoEquipe::PRODUTOR)
+         << " | Runners: " << gerenciadorEquipe->quantidade(FuncaoEquipe::RUNNER)
+         << " | Seguranças: " << gerenciadorEquipe->quantidade(FuncaoEquipe::SEGURANCA) << endl;
+    cout << gerenciadorEquipe->exibir();
+}
+
+void cadastrarMembroEquipe() {
+    int funcao;
+    string nome, atributo;
+    
+    cout << "\n=== Cadastrar Membro da Equipe ===" << endl;
+    cout << "Função (1 = Produtor, 2 = Runner, 3 = Segurança): ";
+    cin >> funcao;
+    if (funcao < 1 || funcao > 3) {
+        cout << "\n[ERRO] Função inválida!" << endl;
+        return;
+    }
+    
+    cout << "Nome: ";
+    limparBuffer();
+    getline(cin, nome);
+    cout << (funcao == 1 ? "Área: " : funcao == 2 ? "Veículo: " : "Posto: ");
+    getline(cin, atributo);
+    
+    try {
+        int id;
+        if (funcao == 1) {
+            id = gerenciadorEquipe->cadastrarProdutor(nome, atributo);
+        } else if (funcao == 2) {
+            id = gerenciadorEquipe->cadastrarRunner(nome, atributo);
+        } else {
+            id = gerenciadorEquipe->cadastrarSeguranca(nome, atributo);
+        }
+        cout << "\n[OK] Membro cadastrado com ID: " << id << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void removerMembroEquipe() {
+    int id;
+    
+    cout << "\n=== Remover Membro da Equipe ===" << endl;
+    cout << "ID: ";
+    cin >> id;
+    
+    if (gerenciadorEquipe->remover(id)) {
+        cout << "\n[OK] Membro removido!" << endl;
+    } else {
+        cout << "\n[ERRO] Membro não encontrado!" << endl;
+    }
+}
+
+void buscarMembroEquipePorNome() {
+    string trecho;
+    
+    cout << "\n=== Buscar Membro por Nome ===" << endl;
+    cout << "Nome (ou parte): ";
+    limparBuffer();
+    getline(cin, trecho);
+    
+    vector<int> ids = gerenciadorEquipe->buscarPorNome(trecho);
+    if (ids.empty()) {
+        cout << "\n[INFO] Nenhum membro encontrado." << endl;
+        return;
+    }
+    
+    for (int id : ids) {
+        FuncaoEquipe funcao;
+        gerenciadorEquipe->buscarFuncao(id, funcao);
+        switch (funcao) {
+            case FuncaoEquipe::PRODUTOR:  cout << *gerenciadorEquipe->buscarProdutor(id) << endl; break;
+            case FuncaoEquipe::RUNNER:    cout << *gerenciadorEquipe->buscarRunner(id) << endl; break;
+            case FuncaoEquipe::SEGURANCA: cout << *gerenciadorEquipe->buscarSeguranca(id) << endl; break;
+        }
+    }
+}
+
+// ==================== EVENTOS ====================
+
+/**
+ * @brief Aponta os gerenciadores globais para os do evento
+ * 
+ * Os menus continuam usando gerenciadorArtistas, estoque, etc.;
+ * trocar de evento é só trocar para onde esses ponteiros apontam
+ */
+void ativarEvento(Evento* evento) {
+    eventoAtivo = evento;
+    gerenciadorArtistas = &evento->getArtistas();
+    gerenciadorItens = &evento->getItens();
+    estoque = &evento->getEstoque();
+    gerenciadorCamarins = &evento->getCamarins();
+    gerenciadorPedidos = &evento->getPedidos();
+    gerenciadorListaCompras = &evento->getListasCompras();
+    gerenciadorRiders = &evento->getRiders();
+    indiceAtribuicao = &evento->getAtribuicoes();
+    agendaCamarins = &evento->getAgenda();
+    gerenciadorEquipe = &evento->getEquipe();
+    listaAutomatica = &evento->getListaAutomatica();
+    catalogoFornecedores = &evento->getFornecedores();
+    diarioRecebimentos = &evento->getRecebimentos();
+}
+
+/**
+ * @brief Liga observadores de estoque e arquivo de pedidos a um evento
+ * 
+ * O observador captura o PRÓPRIO evento (não os ponteiros globais):
+ * a reposição de um evento só reavalia backorders dele
+ */
+void prepararEvento(Evento* evento) {
+    // Toda entrada de estoque reavalia os backorders que esperam o item
+    evento->getEstoque().definirObservadorEntrada([evento](int itemId) {
+        int concluidos = evento->getPedidos().reavaliarBackorders(itemId, evento->getEstoque(),
+                                                                  evento->getCamarins());
+        if (concluidos > 0) {
+            cout << "\n[INFO] " << concluidos << " pedido(s) em espera atendido(s) com a reposição" << endl;
+        }
+    });
+    
+    // Preço alterado no catálogo: listas só marcam o item (reprecificação preguiçosa)
+    evento->getItens().definirObservadorPreco([evento](int itemId) {
+        evento->getListasCompras().marcarPrecoAlterado(itemId);
+        evento->getListaAutomatica().reprecificarItem(itemId);
+    });
+    
+    // Lista automática: só o item que mudou é recalculado
+    evento->getEstoque().definirObservadorSaldo([evento](int itemId) {
+        evento->getListaAutomatica().definirEstoque(itemId, evento->getEstoque().obterQuantidade(itemId));
+    });
+    evento->getPedidos().definirObservadorDemanda([evento](int itemId) {
+        evento->getListaAutomatica().definirPedidos(itemId, evento->getPedidos().obterDemandaPendente(itemId));
+    });
+    evento->getListasCompras().definirObservadorQuantidade([evento](int itemId) {
+        evento->getListaAutomatica().definirEmListas(itemId, evento->getListasCompras().quantidadeEmListas(itemId));
+    });
+    evento->getCamarins().definirObservadorConteudo([evento](int camarimId, int itemId) {
+        evento->getListaAutomatica().atualizarCamarim(camarimId, itemId);
+    });
+    evento->getRiders().definirObservadorRider([evento](int artistaId, int itemId) {
+        evento->getListaAutomatica().atualizarRider(artistaId, itemId);
+    });
+    
+    // Arquivo frio de pedidos atendidos (sem ele, tudo fica em memória)
+    try {
+        evento->getPedidos().configurarArquivo(PREFIXO_ARQUIVO_PEDIDOS + to_string(evento->getId()) + ".dat",
+                                               IDADE_ARQUIVAMENTO_NS);
+        if (evento->getPedidos().arquivadosCorrompidos() > 0) {
+            cout << "[AVISO] " << evento->getPedidos().arquivadosCorrompidos()
+                 << " pedido(s) arquivado(s) corrompido(s) ficaram fora do índice" << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "[AVISO] " << e.what() << " - arquivamento desligado" << endl;
+    }
+    
+    // Diário em arquivo (sem ele, recebimentos ficam só em memória)
+    try {
+        evento->getRecebimentos().configurarArquivo(PREFIXO_DIARIO_RECEBIMENTOS + to_string(evento->getId()) + ".log");
+        for (const Recebimento& pendente : evento->getRecebimentos().getPendentes()) {
+            // Queda entre o INICIO e o CONFIRMADO: a entrada pode ou não estar no estoque
+            cout << "[AVISO] Recebimento " << pendente.id << " (lista " << pendente.listaId
+                 << ", " << pendente.entradas.size() << " item(ns)) foi interrompido - confira o estoque:";
+            for (const ItemEstoque& entrada : pendente.entradas) {
+                cout << " item " << entrada.itemId << " x" << entrada.quantidade << ";";
+            }
+            cout << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "[AVISO] " << e.what() << " - diário só em memória" << endl;
+    }
+    
+    // Alterações do evento passam a ir para o log
+    logAlteracoes.acompanhar(*evento);
+}
+
+/**
+ * @brief Cria evento já preparado (observadores, arquivo e diário)
+ * @return Evento criado
+ */
+Evento* criarEvento(const string& nome) {
+    Evento* evento = gerenciadorEventos.buscarPorId(gerenciadorEventos.criar(nome));
+    prepararEvento(evento);
+    return evento;
+}
+
+/**
+ * @brief Carrega o estado salvo, reaplica o log (ou cria o evento inicial)
+ * 
+ * Arquivo inválido é renomeado para .invalido e o sistema parte vazio
+ * (o log, feito sobre ele, não é reaplicado)
+ */
+void carregarEstado() {
+    ResumoSnapshot resumo;
+    bool estadoValido = true;
+    try {
+        if (ArquivoSnapshot::carregar(ARQUIVO_ESTADO, gerenciadorEventos, relogioMonotonicoNs(), resumo)) {
+            cout << "[OK] Estado carregado: " << resumo.eventos << " evento(s), " << resumo.registros
+                 << " registro(s)" << (resumo.mapeado ? " (arquivo mapeado em memória)" : "") << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "[AVISO] " << e.what() << endl;
+        error_code erro;
+        filesystem::rename(ARQUIVO_ESTADO, ARQUIVO_ESTADO + ".invalido", erro);
+        cout << "[AVISO] Arquivo guardado como " << ARQUIVO_ESTADO << ".invalido; partindo de um estado vazio" << endl;
+        estadoValido = false;
+    }
+    
+    // Alterações feitas depois do estado salvo (programa fechado sem salvar)
+    if (estadoValido) {
+        ResumoReproducao reproducao = LogAlteracoes::reproduzir(PREFIXO_LOG_ALTERACOES, resumo.geracaoLog,
+                                                                gerenciadorEventos, relogioMonotonicoNs());
+        if (reproducao.registros > 0) {
+            cout << "[OK] Log de alterações: " << reproducao.registros << " registro(s) reaplicado(s) de "
+                 << reproducao.arquivos << " arquivo(s)" << endl;
+        }
+        if (reproducao.bytesDescartados > 0) {
+            cout << "[AVISO] Log de alterações: " << reproducao.bytesDescartados
+                 << " byte(s) incompletos ou corrompidos descartados" << endl;
+        }
+    }
+    
+    // Geração nova, acima de todas em disco (nada é sobrescrito)
+    try {
+        logAlteracoes.abrir(PREFIXO_LOG_ALTERACOES,
+                            max(resumo.geracaoLog, LogAlteracoes::ultimaGeracao(PREFIXO_LOG_ALTERACOES)) + 1);
+    } catch (const ExcecaoBase& e) {
+        cout << "[AVISO] " << e.what() << " - alterações só em memória até salvar o estado" << endl;
+    }
+    
+    for (const auto& par : gerenciadorEventos.listar()) {
+        Evento* evento = gerenciadorEventos.buscarPorId(par.first);
+        prepararEvento(evento);
+        
+        // Observadores não estavam ligados na carga: lista automática parte dos saldos atuais
+        for (const ItemEstoque& item : evento->getEstoque().listar()) {
+            evento->getListaAutomatica().definirEstoque(item.itemId, item.quantidade);
+        }
+        for (const Item& item : evento->getItens().listar()) {
+            evento->getListaAutomatica().definirPedidos(item.getId(),
+                evento->getPedidos().obterDemandaPendente(item.getId()));
+        }
+        for (const auto& par : evento->getListasCompras().quantidadesPorItem()) {
+            evento->getListaAutomatica().definirEmListas(par.first, par.second);
+        }
+        for (const Camarim& camarim : evento->getCamarins().getCamarins()) {
+            evento->getListaAutomatica().atualizarCamarim(camarim.getId(), 0);
+        }
+    }
+    
+    if (!gerenciadorEventos.listar().empty()) {
+        ativarEvento(gerenciadorEventos.buscarPorId(gerenciadorEventos.listar().front().first));
+        return;
+    }
+    
+    // Evento inicial: sem cadastrar outros, o sistema funciona como antes
+    ativarEvento(criarEvento("Evento Principal"));
+}
+
+/**
+ * @brief Grava no log as alterações da última ação (e compacta o log se cresceu)
+ * 
+ * Chamada entre duas ações de menu: uma escrita por ação
+ */
+void confirmarAlteracoes() {
+    try {
+        logAlteracoes.confirmar(relogioMonotonicoNs());
+        if (pontoControle->necessario()) {
+            pontoControle->capturar(gerenciadorEventos, relogioMonotonicoNs());
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "[AVISO] " << e.what() << " - alterações só em memória até salvar o estado" << endl;
+    }
+    string erro = pontoControle->extrairErro();
+    if (!erro.empty()) {
+        cout << "[AVISO] Ponto de controle: " << erro << endl;
+    }
+}
+
+/**
+ * @brief Salva o estado de todos os eventos (e apaga o log já contido nele)
+ */
+void salvarEstado() {
+    try {
+        ResumoSnapshot resumo = pontoControle->capturar(gerenciadorEventos, relogioMonotonicoNs());
+        pontoControle->aguardar();  // Só informa depois do arquivo no disco
+        string erro = pontoControle->extrairErro();
+        if (!erro.empty()) {
+            cout << "\n[ERRO] " << erro << endl;
+            return;
+        }
+        cout << "\n[OK] Estado salvo em " << ARQUIVO_ESTADO << ": " << resumo.eventos << " evento(s), "
+             << resumo.registros << " registro(s), " << resumo.bytes << " bytes" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Exporta catálogo, estoque, camarins, pedidos ou listas do evento ativo
+ */
+void exportarDados() {
+    int tipo, formato;
+    string caminho;
+    
+    cout << "\n=== Exportar Dados ===" << endl;
+    cout << "1. Catálogo  2. Estoque  3. Camarins  4. Pedidos  5. Listas de Compras" << endl;
+    cout << "Dados: ";
+    cin >> tipo;
+    cout << "Formato (1=CSV, 2=JSON): ";
+    cin >> formato;
+    limparBuffer();
+    
+    if (tipo < 1 || tipo > 5 || formato < 1 || formato > 2) {
+        cout << "\n[ERRO] Opção inválida!" << endl;
+        return;
+    }
+    static const char* nomes[] = {"catalogo", "estoque", "camarins", "pedidos", "listas"};
+    string padrao = string(nomes[tipo - 1]) + "_" + to_string(eventoAtivo->getId()) + (formato == 1 ? ".csv" : ".json");
+    cout << "Arquivo (Enter = " << padrao << "): ";
+    getline(cin, caminho);
+    if (caminho.empty()) {
+        caminho = padrao;
+    }
+    
+    try {
+        lock_guard<mutex> guarda(eventoAtivo->getTrava());  // Menu de eventos não trava o ativo
+        ResumoExportacao resumo = ExportadorDados::exportar(*eventoAtivo, (TipoExportacao)(tipo - 1),
+            formato == 1 ? FormatoExportacao::CSV : FormatoExportacao::JSON, caminho);
+        cout << "\n[OK] " << resumo.registros << " registro(s) exportado(s) para " << caminho
+             << " (" << resumo.bytes << " bytes)" << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Arquivos que guardam o sistema: estado salvo, log, pedidos arquivados, diários
+ * 
+ * Índices (.idx) ficam de fora: são refeitos a partir dos pedidos arquivados
+ */
+vector<string> arquivosDoSistema() {
+    auto terminaCom = [](const string& nome, const string& fim) {
+        return nome.size() >= fim.size() && nome.compare(nome.size() - fim.size(), fim.size(), fim) == 0;
+    };
+    
+    vector<string> arquivos;
+    for (const auto& entrada : filesystem::directory_iterator(".")) {
+        if (!entrada.is_regular_file()) {
+            continue;
+        }
+        string nome = entrada.path().filename().string();
+        if (nome == ARQUIVO_ESTADO ||
+            (nome.rfind(PREFIXO_LOG_ALTERACOES, 0) == 0 && terminaCom(nome, ".log")) ||
+            (nome.rfind(PREFIXO_ARQUIVO_PEDIDOS, 0) == 0 && terminaCom(nome, ".dat")) ||
+            (nome.rfind(PREFIXO_DIARIO_RECEBIMENTOS, 0) == 0 && terminaCom(nome, ".log"))) {
+            arquivos.push_back(nome);
+        }
+    }
+    sort(arquivos.begin(), arquivos.end());
+    return arquivos;
+}
+
+/**
+ * @brief Atualiza a cópia de segurança (só segmentos alterados)
+ */
+void copiarSeguranca() {
+    cout << "\n=== Cópia de Segurança ===" << endl;
+    try {
+        pontoControle->aguardar();  // Gravação de fundo não pode apagar log no meio da cópia
+        ResumoCopia resumo = CopiaSeguranca::copiar(arquivosDoSistema(), DIRETORIO_COPIA);
+        cout << "\n[OK] Cópia em " << DIRETORIO_COPIA << "/: " << resumo.arquivos << " arquivo(s), "
+             << resumo.segmentosCopiados << " de " << resumo.segmentos << " segmento(s) gravado(s) ("
+             << resumo.bytesCopiados << " bytes)" << endl;
+        if (resumo.completa) {
+            cout << "[INFO] Sem cópia anterior válida: todos os segmentos foram gravados." << endl;
+        }
+        if (resumo.arquivosRemovidos > 0) {
+            cout << "[INFO] " << resumo.arquivosRemovidos << " arquivo(s) que não existem mais saíram da cópia." << endl;
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    } catch (const filesystem::filesystem_error& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Confere a cópia de segurança (leitura em paralelo)
+ */
+void verificarCopia() {
+    cout << "\n=== Verificar Cópia ===" << endl;
+    try {
+        int64_t inicio = relogioMonotonicoNs();
+        ResumoVerificacao resumo = CopiaSeguranca::verificar(DIRETORIO_COPIA);
+        double segundos = (relogioMonotonicoNs() - inicio) / 1e9;
+        
+        cout << "\n" << resumo.arquivos << " arquivo(s), " << resumo.segmentos << " segmento(s), "
+             << resumo.bytes << " bytes lidos em " << fixed << setprecision(2) << segundos << " s com "
+             << resumo.threads << " thread(s) (CRC-32C " << (crc32cPorHardware() ? "pelo processador" : "por tabela")
+             << ")" << endl;
+        if (resumo.falhas.empty()) {
+            cout << "[OK] Cópia íntegra." << endl;
+        } else {
+            cout << "[ERRO] " << resumo.falhas.size() << " problema(s):" << endl;
+            for (const string& falha : resumo.falhas) {
+                cout << "  - " << falha << endl;
+            }
+            
+            char resposta;
+            cout << "\nRegravar os " << resumo.danificados.size() << " arquivo(s) danificado(s) a partir dos originais? (s/n): ";
+            cin >> resposta;
+            if (resposta == 's' || resposta == 'S') {
+                pontoControle->aguardar();
+                ResumoCopia copia = CopiaSeguranca::copiar(arquivosDoSistema(), DIRETORIO_COPIA, resumo.danificados);
+                cout << "\n[OK] " << copia.segmentosCopiados << " segmento(s) regravado(s) ("
+                     << copia.bytesCopiados << " bytes)" << endl;
+            }
+        }
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    } catch (const filesystem::filesystem_error& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Lista os eventos, marcando o ativo
+ */
+void exibirEventos() {
+    cout << "\n=== Eventos ===" << endl;
+    for (const auto& evento : gerenciadorEventos.listar()) {
+        cout << (evento.first == eventoAtivo->getId() ? " * " : "   ")
+             << left << setw(5) << evento.first << evento.second << endl;
+    }
+}
+
+/**
+ * @brief Cadastra novo evento/local
+ */
+void cadastrarEvento() {
+    string nome;
+    
+    cout << "\n=== Cadastrar Evento ===" << endl;
+    cout << "Nome: ";
+    limparBuffer();
+    getline(cin, nome);
+    
+    try {
+        Evento* evento = criarEvento(nome);
+        cout << "\n[OK] Evento cadastrado com ID: " << evento->getId() << endl;
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+/**
+ * @brief Troca o evento em que os menus operam
+ */
+void selecionarEvento() {
+    int id;
+    
+    cout << "\n=== Selecionar Evento ===" << endl;
+    cout << "ID do Evento: ";
+    cin >> id;
+    
+    Evento* evento = gerenciadorEventos.buscarPorId(id);
+    if (evento == nullptr) {
+        cout << "\n[ERRO] Evento não encontrado!" << endl;
+        return;
+    }
+    ativarEvento(evento);
+    cout << "\n[OK] Evento ativo: " << evento->getNome() << endl;
+}
+
+/**
+ * @brief Remove evento (não pode ser o ativo)
+ */
+void removerEvento() {
+    int id;
+    
+    cout << "\n=== Remover Evento ===" << endl;
+    cout << "ID do Evento: ";
+    cin >> id;
+    
+    if (id == eventoAtivo->getId()) {
+        cout << "\n[ERRO] Evento ativo não pode ser removido. Selecione outro antes." << endl;
+        return;
+    }
+    logAlteracoes.esquecer(id);  // Antes de destruir: o log guarda ponteiros para ele
+    if (gerenciadorEventos.remover(id)) {
+        cout << "\n[OK] Evento removido!" << endl;
+    } else {
+        cout << "\n[ERRO] Evento não encontrado!" << endl;
+    }
+}
+
+/**
+ * @brief Relatório consolidado de todos os eventos
+ * 
+ * Cada evento é resumido em paralelo, sob a sua própria trava
+ */
+void relatorioEventos() {
+    cout << "\n=== Relatório Consolidado ===" << endl;
+    
+    try {
+        cout << GerenciadorEventos::exibirRelatorio(gerenciadorEventos.resumir());
+    } catch (const ExcecaoBase& e) {
+        cout << "\n[ERRO] " << e.what() << endl;
+    }
+}
+
+void menuPrincipal(){
+    cout << "____Menu de Principal___" << endl;
+    cout << "Evento: " << eventoAtivo->getNome() << endl;
+    cout << "1. Catálogo de Itens" << endl;
+    cout << "2. Estoque" << endl;
+    cout << "3. Camarim" << endl;
+    cout << "4. Artista" << endl;
+    cout << "5. Lista de Pedidos" << endl;
+    cout << "6. Lista de Compras" << endl;
+    cout << "7. Riders" << endl;
+    cout << "8. Eventos" << endl;
+    cout << "9. Equipe" << endl;
+    cout << "10. Fornecedores" << endl;
+    cout << "0. Finalizar" << endl;
+}
+
+void menuSub(){
+    cout << "1. Exibir" << endl;
+    cout << "2. Cadastrar" << endl;
+    cout << "3. Remover" << endl;
+    cout << "0. Retornar" << endl;
 }
 
 void menuSubItens(){
@@ -993,6 +2570,7 @@ void menuSubArtistas(){
     cout << "3. Remover" << endl;
     cout << "4. Atualizar" << endl;
     cout << "5. Buscar por Camarim" << endl;
+    cout << "6. Verificar Atribuições" << endl;
     cout << "0. Retornar" << endl;
 }
 
@@ -1004,6 +2582,11 @@ void menuSubCamarins(){
     cout << "5. Remover Item" << endl;
     cout << "6. Atualizar" << endl;
     cout << "7. Buscar por Artista" << endl;
+    cout << "8. Reservar Horário" << endl;
+    cout << "9. Agenda do Camarim" << endl;
+    cout << "10. Camarins Livres" << endl;
+    cout << "11. Cancelar Reserva" << endl;
+    cout << "12. Maiores Consumos" << endl;
     cout << "0. Retornar" << endl;
 }
 
@@ -1016,6 +2599,55 @@ void menuSubPedidos(){
     cout << "6. Marcar Atendido" << endl;
     cout << "7. Listar Pendentes" << endl;
     cout << "8. Buscar por Camarim" << endl;
+    cout << "9. Latência de Atendimento" << endl;
+    cout << "10. Planejar Onda de Separação" << endl;
+    cout << "11. Atender Parcialmente" << endl;
+    cout << "12. Buscar no Arquivo" << endl;
+    cout << "13. Arquivar Atendidos" << endl;
+    cout << "14. Arquivados por Faixa" << endl;
+    cout << "0. Retornar" << endl;
+}
+
+void menuSubRiders(){
+    cout << "1. Exibir" << endl;
+    cout << "2. Cadastrar" << endl;
+    cout << "3. Remover" << endl;
+    cout << "4. Definir Item" << endl;
+    cout << "5. Remover Item" << endl;
+    cout << "6. Aplicar a Camarim" << endl;
+    cout << "7. Abastecer Todos os Camarins" << endl;
+    cout << "8. Repor Camarins (entre shows)" << endl;
+    cout << "0. Retornar" << endl;
+}
+
+void menuSubEventos(){
+    cout << "1. Exibir" << endl;
+    cout << "2. Cadastrar" << endl;
+    cout << "3. Selecionar" << endl;
+    cout << "4. Remover" << endl;
+    cout << "5. Relatório Consolidado" << endl;
+    cout << "6. Salvar Estado" << endl;
+    cout << "7. Exportar Dados" << endl;
+    cout << "8. Cópia de Segurança" << endl;
+    cout << "9. Verificar Cópia" << endl;
+    cout << "0. Retornar" << endl;
+}
+
+void menuSubEquipe(){
+    cout << "1. Exibir" << endl;
+    cout << "2. Cadastrar" << endl;
+    cout << "3. Remover" << endl;
+    cout << "4. Buscar por Nome" << endl;
+    cout << "0. Retornar" << endl;
+}
+
+void menuSubFornecedores(){
+    cout << "1. Exibir" << endl;
+    cout << "2. Cadastrar" << endl;
+    cout << "3. Remover" << endl;
+    cout << "4. Definir Oferta" << endl;
+    cout << "5. Remover Oferta" << endl;
+    cout << "6. Dividir Lista de Compras" << endl;
     cout << "0. Retornar" << endl;
 }
 
@@ -1028,6 +2660,13 @@ void menuSubListaCompras(){
     cout << "6. Atualizar Quantidade" << endl;
     cout << "7. Calcular Total" << endl;
     cout << "8. Limpar Lista" << endl;
+    cout << "9. Lista Automática (faltas)" << endl;
+    cout << "10. Definir Estoque Mínimo" << endl;
+    cout << "11. Efetivar Lista Automática" << endl;
+    cout << "12. Compra por Orçamento" << endl;
+    cout << "13. Consolidar Listas" << endl;
+    cout << "14. Receber Mercadoria" << endl;
+    cout << "15. Histórico de Recebimentos" << endl;
     cout << "0. Retornar" << endl;
 }
 
@@ -1040,21 +2679,47 @@ int main(){
         system("chcp 65001 > nul");
     #endif
     
+    // Gravação do estado em segundo plano (vive até o fim de main)
+    PontoControle controle(ARQUIVO_ESTADO, logAlteracoes, LIMITE_LOG_BYTES);
+    pontoControle = &controle;
+    
+    // Estado da última execução + log (ou evento inicial vazio)
+    carregarEstado();
+    
     int opcao1, opcao2;
     
     do {
+        // Mantém em memória só os pedidos vivos (todos os eventos, em paralelo)
+        try {
+            int64_t agora = relogioMonotonicoNs();
+            gerenciadorEventos.paraCadaEmParalelo([agora](Evento& evento) {
+                evento.getPedidos().arquivarAtendidos(agora);
+            });
+        } catch (const ExcecaoBase& e) {
+            cout << "[AVISO] " << e.what() << endl;
+        }
+        confirmarAlteracoes();
+        
         menuPrincipal();
         cout << "\nDigite uma opção: ";
         
         cin >> opcao1;
         cout << endl;
         
+        // Menus de cadastro operam no evento ativo: trava só ele enquanto estão abertos
+        // (o menu 8 troca de evento e trava todos no relatório, então fica de fora)
+        unique_lock<mutex> travaEvento(eventoAtivo->getTrava(), defer_lock);
+        if ((opcao1 >= 1 && opcao1 <= 7) || opcao1 == 9 || opcao1 == 10) {
+            travaEvento.lock();
+        }
+        
             switch(opcao1){
                 case 1:  
                 do {
                     //Chama o submenu 1.Catálogo de Itens e aguarda interação
                     
                     cout << "Menu de Catálogo de Itens: \n";
+                    confirmarAlteracoes();
                     menuSubItens();
                     cout << "\nDigite uma opção: ";
                     cin >> opcao2;
@@ -1096,6 +2761,7 @@ int main(){
                     //Chama o submenu 2.Estoque e aguarda interação
                     
                     cout << "Menu de Estoque: \n";
+                    confirmarAlteracoes();
                     menuSubEstoque();
                     cout << "\nDigite uma opção: ";
                     cin >> opcao2;
@@ -1141,6 +2807,7 @@ int main(){
                     //Chama o submenu 2.Camarim e aguarda interação
                     
                     cout << "Menu de Camarim: \n";
+                    confirmarAlteracoes();
                     menuSubCamarins();
                     cout << "\nDigite uma opção: ";
                     cin >> opcao2;
@@ -1175,6 +2842,26 @@ int main(){
                         buscarCamarimPorArtista();
                         break;
                         
+                        case 8:
+                        reservarHorarioCamarim();
+                        break;
+                        
+                        case 9:
+                        exibirAgendaCamarim();
+                        break;
+                        
+                        case 10:
+                        buscarCamarinsLivres();
+                        break;
+                        
+                        case 11:
+                        cancelarReservaCamarim();
+                        break;
+                        
+                        case 12:
+                        exibirMaioresConsumos();
+                        break;
+                        
                         case 0: 
                         cout << "\nRetornando ao menu principal...\n" << endl;
                         break;
@@ -1190,6 +2877,7 @@ int main(){
                     //Chama o submenu 4.Artistas e aguarda interação
                     
                     cout << "Menu de Artistas: \n";
+                    confirmarAlteracoes();
                     menuSubArtistas();
                     cout << "\nDigite uma opção: ";
                     cin >> opcao2;
@@ -1216,6 +2904,10 @@ int main(){
                         buscarArtistasPorCamarim();
                         break;
                         
+                        case 6:
+                        verificarAtribuicoes();
+                        break;
+                        
                         case 0: 
                         cout << "\nRetornando ao menu principal...\n" << endl;
                         break;
@@ -1231,6 +2923,7 @@ int main(){
                     //Chama o submenu 5.Lista de Pedidos e aguarda interação
                     
                     cout << "Menu de Lista de Pedidos: \n";
+                    confirmarAlteracoes();
                     menuSubPedidos();
                     cout << "\nDigite uma opção: ";
                     cin >> opcao2;
@@ -1269,6 +2962,30 @@ int main(){
                         buscarPedidosPorCamarim();
                         break;
                         
+                        case 9:
+                        exibirLatenciaPedidos();
+                        break;
+                        
+                        case 10:
+                        planejarOndaSeparacao();
+                        break;
+                        
+                        case 11:
+                        atenderPedidoParcial();
+                        break;
+                        
+                        case 12:
+                        buscarPedidoArquivado();
+                        break;
+                        
+                        case 13:
+                        arquivarPedidosAtendidos();
+                        break;
+                        
+                        case 14:
+                        listarPedidosArquivadosFaixa();
+                        break;
+                        
                         case 0: 
                         cout << "\nRetornando ao menu principal...\n" << endl;
                         break;
@@ -1284,6 +3001,7 @@ int main(){
                     //Chama o submenu 6.Lista de Compras e aguarda interação
                     
                     cout << "Menu de Lista de Compras: \n";
+                    confirmarAlteracoes();
                     menuSubListaCompras();
                     cout << "\nDigite uma opção: ";
                     cin >> opcao2;
@@ -1322,6 +3040,144 @@ int main(){
                         limparListaCompras();
                         break;
                         
+                        case 9:
+                        exibirListaAutomatica();
+                        break;
+                        
+                        case 10:
+                        definirEstoqueMinimo();
+                        break;
+                        
+                        case 11:
+                        efetivarListaAutomatica();
+                        break;
+                        
+                        case 12:
+                        otimizarCompraOrcamento();
+                        break;
+                        
+                        case 13:
+                        consolidarListasCompras();
+                        break;
+                        
+                        case 14:
+                        receberMercadoria();
+                        break;
+                        
+                        case 15:
+                        exibirHistoricoRecebimentos();
+                        break;
+                        
+                        case 0: 
+                        cout << "\nRetornando ao menu principal...\n" << endl;
+                        break;
+                        
+                        default: cout <<"Digite uma opção válida...\n" << endl;
+                    }
+                } while (opcao2 != 0);
+                
+                break;
+                
+                case 7:  
+                do {
+                    //Chama o submenu 7.Riders e aguarda interação
+                    
+                    cout << "Menu de Riders: \n";
+                    confirmarAlteracoes();
+                    menuSubRiders();
+                    cout << "\nDigite uma opção: ";
+                    cin >> opcao2;
+                    cout << endl;
+                    
+                    switch (opcao2){
+                        case 1: 
+                        exibirRiders();
+                        break;
+                        
+                        case 2: 
+                        cadastrarRider();
+                        break;
+                        
+                        case 3: 
+                        removerRider();
+                        break;
+                        
+                        case 4:
+                        definirItemRider();
+                        break;
+                        
+                        case 5:
+                        removerItemRider();
+                        break;
+                        
+                        case 6:
+                        aplicarRiderCamarim();
+                        break;
+                        
+                        case 7:
+                        provisionarCamarins();
+                        break;
+                        
+                        case 8:
+                        reporCamarins();
+                        break;
+                        
+                        case 0: 
+                        cout << "\nRetornando ao menu principal...\n" << endl;
+                        break;
+                        
+                        default: cout <<"Digite uma opção válida...\n" << endl;
+                    }
+                } while (opcao2 != 0);
+                
+                break;
+                
+                case 8:  
+                do {
+                    cout << "Menu de Eventos: \n";
+                    confirmarAlteracoes();
+                    menuSubEventos();
+                    cout << "\nDigite uma opção: ";
+                    cin >> opcao2;
+                    cout << endl;
+                    
+                    switch (opcao2){
+                        case 1: 
+                        exibirEventos();
+                        break;
+                        
+                        case 2: 
+                        cadastrarEvento();
+                        break;
+                        
+                        case 3: 
+                        selecionarEvento();
+                        break;
+                        
+                        case 4:
+                        removerEvento();
+                        break;
+                        
+                        case 5:
+                        relatorioEventos();
+                        break;
+                        
+                        case 6:
+                        salvarEstado();
+                        break;
+                        
+                        case 7:
+                        exportarDados();
+                        break;
+                        
+                        case 8:
+                        copiarSeguranca();
+                        break;
+                        
+                        case 9:
+                        verificarCopia();
+                        break;
+                        
                         case 0: 
                         cout << "\nRetornando ao menu principal...\n" << endl;
                         break;
@@ -1332,7 +3188,91 @@ int main(){
                 
                 break;
                 
-                case 0: cout << "Finalizando programa"; break; 
+                case 9:  
+                do {
+                    cout << "Menu de Equipe: \n";
+                    confirmarAlteracoes();
+                    menuSubEquipe();
+                    cout << "\nDigite uma opção: ";
+                    cin >> opcao2;
+                    cout << endl;
+                    
+                    switch (opcao2){
+                        case 1: 
+                        exibirEquipe();
+                        break;
+                        
+                        case 2: 
+                        cadastrarMembroEquipe();
+                        break;
+                        
+                        case 3: 
+                        removerMembroEquipe();
+                        break;
+                        
+                        case 4:
+                        buscarMembroEquipePorNome();
+                        break;
+                        
+                        case 0: 
+                        cout << "\nRetornando ao menu principal...\n" << endl;
+                        break;
+                        
+                        default: cout <<"Digite uma opção válida...\n" << endl;
+                    }
+                } while (opcao2 != 0);
+                
+                break;
+                
+                case 10:  
+                do {
+                    cout << "Menu de Fornecedores: \n";
+                    confirmarAlteracoes();
+                    menuSubFornecedores();
+                    cout << "\nDigite uma opção: ";
+                    cin >> opcao2;
+                    cout << endl;
+                    
+                    switch (opcao2){
+                        case 1: 
+                        exibirFornecedores();
+                        break;
+                        
+                        case 2: 
+                        cadastrarFornecedor();
+                        break;
+                        
+                        case 3: 
+                        removerFornecedor();
+                        break;
+                        
+                        case 4:
+                        definirOfertaFornecedor();
+                        break;
+                        
+                        case 5:
+                        removerOfertaFornecedor();
+                        break;
+                        
+                        case 6:
+                        dividirListaPorFornecedor();
+                        break;
+                        
+                        case 0: 
+                        cout << "\nRetornando ao menu principal...\n" << endl;
+                        break;
+                        
+                        default: cout <<"Digite uma opção válida...\n" << endl;
+                    }
+                } while (opcao2 != 0);
+                
+                break;
+                
+                case 0:
+                salvarEstado();
+                cout << "Finalizando programa";
+                break;
+
                 default: cout <<"Digite uma opção válida...\n" << endl; // retorna ao menu principal
                 
             }
@@ -0,0 +1,186 @@
+/**
+ * @file metricas.cpp
+ * @brief Implementação dos histogramas de latência
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa gravação lock-free e consulta de percentis por janela.
+ */
+
+// Inclui header da classe
+#include "metricas.h"
+// Para steady_clock (relógio monotônico)
+#include <chrono>
+// Para stringstream (construir strings)
+#include <sstream>
+// Para formatação (fixed, setprecision)
+#include <iomanip>
+
+/**
+ * Relógio monotônico em nanossegundos
+ */
+int64_t relogioMonotonicoNs() {
+    // steady_clock nunca anda para trás (diferente de system_clock)
+    return chrono::duration_cast<chrono::nanoseconds>(
+        chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ==================== Struct PercentisLatencia ====================
+
+/**
+ * Exibe percentis em segundos com 3 casas decimais
+ */
+string PercentisLatencia::exibir() const {
+    stringstream ss;
+    if (amostras == 0) {  // Janela sem medições
+        ss << "sem amostras";
+        return ss.str();
+    }
+
+    ss << fixed << setprecision(3);
+    ss << "p50=" << p50 / 1e9 << "s "   // 1e9 ns = 1 segundo
+       << "p95=" << p95 / 1e9 << "s "
+       << "p99=" << p99 / 1e9 << "s "
+       << "(" << amostras << " amostras)";
+    return ss.str();
+}
+
+// ==================== Classe HistogramaLatencia ====================
+
+/**
+ * Construtor da janela - zera contadores
+ */
+HistogramaLatencia::Janela::Janela() : numero(-1) {
+    for (int i = 0; i < NUM_FAIXAS; i++) {
+        contagens[i].store(0, memory_order_relaxed);
+    }
+}
+
+/**
+ * Construtor - janelas já são zeradas pelo construtor de Janela
+ */
+HistogramaLatencia::HistogramaLatencia() {}
+
+/**
+ * Converte microssegundos para índice de faixa (log-linear)
+ */
+int HistogramaLatencia::indiceFaixa(uint64_t micros) {
+    if (micros < (uint64_t)SUB_FAIXAS) {
+        return (int)micros;  // Valores pequenos: uma faixa por microssegundo
+    }
+
+    // Posição do bit mais significativo (__builtin_clzll conta zeros à esquerda)
+    int msb = 63 - __builtin_clzll(micros);
+    int deslocamento = msb - BITS_SUB_FAIXA;  // Quantos bits de precisão descartar
+
+    if (deslocamento >= MAGNITUDES) {
+        return NUM_FAIXAS - 1;  // Satura na última faixa
+    }
+
+    // (micros >> deslocamento) fica em [SUB_FAIXAS, 2*SUB_FAIXAS)
+    int sub = (int)(micros >> deslocamento) - SUB_FAIXAS;
+    return (deslocamento + 1) * SUB_FAIXAS + sub;
+}
+
+/**
+ * Ponto médio de uma faixa, em microssegundos
+ */
+uint64_t HistogramaLatencia::valorFaixa(int indice) {
+    if (indice < SUB_FAIXAS) {
+        return (uint64_t)indice;  // Faixas exatas
+    }
+
+    int deslocamento = indice / SUB_FAIXAS - 1;
+    int sub = indice % SUB_FAIXAS;
+    uint64_t inferior = (uint64_t)(SUB_FAIXAS + sub) << deslocamento;
+    return inferior + ((1ULL << deslocamento) >> 1);  // Limite inferior + meia largura
+}
+
+/**
+ * Grava uma medição (lock-free)
+ */
+void HistogramaLatencia::registrar(int64_t latenciaNs, int64_t instanteNs) noexcept {
+    if (latenciaNs < 0) {
+        latenciaNs = 0;  // Proteção: relógio monotônico não deveria gerar negativos
+    }
+
+    int64_t numeroJanela = instanteNs / DURACAO_JANELA_NS;
+    Janela& janela = janelas[numeroJanela % NUM_JANELAS];
+
+    // Janela do anel pertence a um período antigo: quem vencer o CAS a recicla
+    int64_t atual = janela.numero.load(memory_order_acquire);
+    if (atual < numeroJanela) {
+        if (janela.numero.compare_exchange_strong(atual, numeroJanela,
+                                                  memory_order_acq_rel)) {
+            for (int i = 0; i < NUM_FAIXAS; i++) {
+                janela.contagens[i].store(0, memory_order_relaxed);
+            }
+        }
+    }
+
+    // HOT PATH: um único incremento atômico relaxado
+    int indice = indiceFaixa((uint64_t)latenciaNs / 1000);
+    janela.contagens[indice].fetch_add(1, memory_order_relaxed);
+}
+
+/**
+ * Calcula percentis somando as janelas do intervalo
+ */
+PercentisLatencia HistogramaLatencia::consultar(int64_t inicioNs, int64_t fimNs) const {
+    PercentisLatencia resultado;
+    if (fimNs < inicioNs) {
+        return resultado;  // Intervalo vazio
+    }
+
+    int64_t primeira = inicioNs / DURACAO_JANELA_NS;
+    int64_t ultima = fimNs / DURACAO_JANELA_NS;
+
+    // Acumula contagens das janelas do anel que caem no intervalo
+    uint64_t soma[NUM_FAIXAS] = {0};
+    for (int j = 0; j < NUM_JANELAS; j++) {
+        int64_t numero = janelas[j].numero.load(memory_order_acquire);
+        if (numero < primeira || numero > ultima) {
+            continue;  // Janela fora do intervalo (ou nunca usada)
+        }
+        for (int i = 0; i < NUM_FAIXAS; i++) {
+            uint32_t c = janelas[j].contagens[i].load(memory_order_relaxed);
+            soma[i] += c;
+            resultado.amostras += c;
+        }
+    }
+
+    if (resultado.amostras == 0) {
+        return resultado;
+    }
+
+    // Posições (1-based) de cada percentil na distribuição ordenada
+    uint64_t alvo50 = (resultado.amostras * 50 + 99) / 100;
+    uint64_t alvo95 = (resultado.amostras * 95 + 99) / 100;
+    uint64_t alvo99 = (resultado.amostras * 99 + 99) / 100;
+
+    // Percorre faixas em ordem crescente acumulando contagens
+    uint64_t acumulado = 0;
+    bool achou50 = false, achou95 = false;
+    for (int i = 0; i < NUM_FAIXAS; i++) {
+        if (soma[i] == 0) {
+            continue;
+        }
+        acumulado += soma[i];
+        int64_t valorNs = (int64_t)valorFaixa(i) * 1000;  // µs → ns
+        if (!achou50 && acumulado >= alvo50) {
+            resultado.p50 = valorNs;
+            achou50 = true;
+        }
+        if (!achou95 && acumulado >= alvo95) {
+            resultado.p95 = valorNs;
+            achou95 = true;
+        }
+        if (acumulado >= alvo99) {
+            resultado.p99 = valorNs;
+            break;  // p99 é o último percentil necessário
+        }
+    }
+
+    return resultado;
+}
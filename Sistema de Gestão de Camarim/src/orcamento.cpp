@@ -0,0 +1,336 @@
+/**
+ * @file orcamento.cpp
+ * @brief Implementação das classes ResultadoOrcamento e OtimizadorCompras
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa a mochila exata (programação dinâmica) e a aproximação gulosa.
+ */
+
+// Inclui header da classe
+#include "orcamento.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Para sort, min, max
+#include <algorithm>
+// Para gcd
+#include <numeric>
+// Para llround
+#include <cmath>
+// Para stringstream (construir strings)
+#include <sstream>
+// Para formatação (setw, left, setprecision)
+#include <iomanip>
+
+// ==================== Classe ResultadoOrcamento ====================
+
+/**
+ * Construtor - resultado vazio
+ */
+ResultadoOrcamento::ResultadoOrcamento()
+    : orcamentoCentavos(0), custoCentavos(0), valor(0.0), valorMaximo(0.0), exato(false) {}
+
+// ==================== GETTERS ====================
+
+const vector<CompraEscolhida>& ResultadoOrcamento::getEscolhidas() const { return escolhidas; }
+const vector<int>& ResultadoOrcamento::getAdiadas() const { return adiadas; }
+long long ResultadoOrcamento::getOrcamentoCentavos() const { return orcamentoCentavos; }
+long long ResultadoOrcamento::getCustoCentavos() const { return custoCentavos; }
+double ResultadoOrcamento::getValor() const { return valor; }
+double ResultadoOrcamento::getValorMaximo() const { return valorMaximo; }
+bool ResultadoOrcamento::isExato() const { return exato; }
+
+/**
+ * Copia escolhidas para lista de compras
+ */
+void ResultadoOrcamento::preencherLista(ListaCompras& lista) const {
+    for (const auto& compra : escolhidas) {
+        lista.adicionarItem(compra.itemId, compra.nomeItem, compra.quantidade, compra.precoCentavos / 100.0);
+    }
+}
+
+/**
+ * Exibe resultado formatado
+ */
+string ResultadoOrcamento::exibir() const {
+    stringstream ss;
+    ss << fixed << setprecision(2);
+    ss << "=== COMPRA DENTRO DO ORÇAMENTO (" << (exato ? "ótima" : "aproximada") << ") ===" << endl;
+    ss << "Orçamento: R$ " << orcamentoCentavos / 100.0
+       << " | Custo: R$ " << custoCentavos / 100.0
+       << " | Sobra: R$ " << (orcamentoCentavos - custoCentavos) / 100.0 << endl;
+    ss << "Valor atendido: " << setprecision(1)
+       << (valorMaximo > 0 ? 100.0 * valor / valorMaximo : 100.0) << "%" << setprecision(2) << endl;
+
+    if (escolhidas.empty()) {
+        ss << "  Nenhuma compra cabe no orçamento" << endl;
+    } else {
+        ss << left << setw(5) << "  ID" << setw(22) << "Nome"
+           << right << setw(8) << "Falta" << setw(8) << "Compra" << setw(14) << "Custo" << endl;
+        ss << "  " << string(55, '-') << endl;
+        for (const auto& compra : escolhidas) {
+            ss << left << setw(5) << "  " + to_string(compra.itemId) << setw(22) << compra.nomeItem.substr(0, 21)
+               << right << setw(8) << compra.quantidadeFaltante << setw(8) << compra.quantidade
+               << setw(5) << "R$ " << setw(9) << compra.custoCentavos / 100.0
+               << (compra.quantidade < compra.quantidadeFaltante ? "  (mínimo)" : "") << endl;
+        }
+    }
+
+    if (!adiadas.empty()) {
+        ss << "Adiados:";
+        for (int itemId : adiadas) {
+            ss << " " << itemId;
+        }
+        ss << endl;
+    }
+    return ss.str();
+}
+
+/**
+ * Sobrecarga do operador << para cout
+ */
+ostream& operator<<(ostream& os, const ResultadoOrcamento& resultado) {
+    os << resultado.exibir();
+    return os;
+}
+
+// ==================== Classe OtimizadorCompras ====================
+
+/**
+ * Peso por unidade
+ */
+double OtimizadorCompras::peso(const NecessidadeCompra& necessidade) {
+    double peso = necessidade.itemDeRider ? 3.0 : 1.0;  // Contrato de artista vem antes
+    if (necessidade.horasAteFaltar >= 0) {
+        peso *= 1.0 + 24.0 / (1.0 + necessidade.horasAteFaltar);  // Acaba em 0 h: 25×; em 1 dia: ~2×
+    }
+    return peso;
+}
+
+/**
+ * Programação dinâmica: melhor[c] = maior valor com custo reduzido <= c
+ */
+vector<int> OtimizadorCompras::resolverExato(const vector<Linha>& linhas, long long orcamento, long long divisor) {
+    size_t capacidade = (size_t)(orcamento / divisor);
+    vector<double> melhor(capacidade + 1, 0.0);
+    // escolha[i][c] = opção da linha i no ótimo com capacidade c (0 = fora, k = opção k - 1)
+    vector<vector<unsigned char>> escolha(linhas.size(), vector<unsigned char>(capacidade + 1, 0));
+
+    for (size_t i = 0; i < linhas.size(); i++) {
+        // Capacidade decrescente: cada linha usada no máximo uma vez
+        for (size_t c = capacidade + 1; c-- > 0;) {
+            double semLinha = melhor[c];  // Valor antes desta linha (base das opções de custo zero)
+            for (size_t k = 0; k < linhas[i].opcoes.size(); k++) {
+                const Opcao& opcao = linhas[i].opcoes[k];
+                size_t custo = (size_t)(opcao.custo / divisor);
+                if (custo > c) {
+                    continue;
+                }
+                double candidato = (custo == 0 ? semLinha : melhor[c - custo]) + opcao.valor;
+                if (candidato > melhor[c]) {
+                    melhor[c] = candidato;
+                    escolha[i][c] = (unsigned char)(k + 1);
+                }
+            }
+        }
+    }
+
+    // Reconstrução de trás para frente
+    vector<int> resultado(linhas.size(), -1);
+    size_t c = capacidade;
+    for (size_t i = linhas.size(); i-- > 0;) {
+        int k = (int)escolha[i][c] - 1;
+        resultado[i] = k;
+        if (k >= 0) {
+            c -= (size_t)(linhas[i].opcoes[k].custo / divisor);
+        }
+    }
+    return resultado;
+}
+
+/**
+ * Guloso por valor/custo (mínimo antes do complemento da mesma linha)
+ */
+vector<int> OtimizadorCompras::resolverGuloso(const vector<Linha>& linhas, long long orcamento) {
+    // Passo = incremento de uma linha: da opção k - 1 para a opção k
+    struct Passo {
+        size_t linha;
+        int opcao;
+        long long custo;
+        double valor;
+    };
+    vector<Passo> passos;
+    passos.reserve(linhas.size() * 2);
+    for (size_t i = 0; i < linhas.size(); i++) {
+        long long custoAnterior = 0;
+        double valorAnterior = 0.0;
+        for (size_t k = 0; k < linhas[i].opcoes.size(); k++) {
+            const Opcao& opcao = linhas[i].opcoes[k];
+            passos.push_back({i, (int)k, opcao.custo - custoAnterior, opcao.valor - valorAnterior});
+            custoAnterior = opcao.custo;
+            valorAnterior = opcao.valor;
+        }
+    }
+
+    // Maior valor por centavo primeiro (custo zero = densidade infinita)
+    sort(passos.begin(), passos.end(), [](const Passo& a, const Passo& b) {
+        if ((a.custo == 0) != (b.custo == 0)) {
+            return a.custo == 0;
+        }
+        if (a.custo != 0) {
+            // a.valor / a.custo > b.valor / b.custo, sem divisão
+            double esquerda = a.valor * (double)b.custo;
+            double direita = b.valor * (double)a.custo;
+            if (esquerda != direita) {
+                return esquerda > direita;
+            }
+        }
+        return a.opcao < b.opcao;  // Mínimo antes do complemento
+    });
+
+    vector<int> resultado(linhas.size(), -1);
+    long long restante = orcamento;
+    double valorGuloso = 0.0;
+    for (const auto& passo : passos) {
+        // Complemento só depois do mínimo da mesma linha
+        if (resultado[passo.linha] == passo.opcao - 1 && passo.custo <= restante) {
+            resultado[passo.linha] = passo.opcao;
+            restante -= passo.custo;
+            valorGuloso += passo.valor;
+        }
+    }
+
+    // Melhor escolha isolada que cabe: protege contra o caso "um item caro e valioso"
+    double melhorIsolada = 0.0;
+    size_t linhaIsolada = 0;
+    int opcaoIsolada = -1;
+    for (size_t i = 0; i < linhas.size(); i++) {
+        for (size_t k = 0; k < linhas[i].opcoes.size(); k++) {
+            const Opcao& opcao = linhas[i].opcoes[k];
+            if (opcao.custo <= orcamento && opcao.valor > melhorIsolada) {
+                melhorIsolada = opcao.valor;
+                linhaIsolada = i;
+                opcaoIsolada = (int)k;
+            }
+        }
+    }
+    if (melhorIsolada > valorGuloso) {
+        fill(resultado.begin(), resultado.end(), -1);
+        resultado[linhaIsolada] = opcaoIsolada;
+    }
+    return resultado;
+}
+
+/**
+ * Escolhe o que comprar dentro do orçamento
+ */
+ResultadoOrcamento OtimizadorCompras::otimizar(const vector<NecessidadeCompra>& necessidades,
+                                               GerenciadorItens& catalogo, long long orcamentoCentavos,
+                                               ModoOtimizacao modo) {
+    if (orcamentoCentavos < 0) {
+        throw ValidacaoException("Orçamento não pode ser negativo");
+    }
+
+    ResultadoOrcamento resultado;
+    resultado.orcamentoCentavos = orcamentoCentavos;
+
+    // 1. Monta as linhas com preço e opções
+    vector<Linha> linhas;
+    linhas.reserve(necessidades.size());
+    long long custoTotal = 0;
+    for (const auto& necessidade : necessidades) {
+        if (necessidade.quantidade <= 0) {
+            throw ValidacaoException("Quantidade do item " + to_string(necessidade.itemId) +
+                                     " deve ser maior que zero");
+        }
+        if (necessidade.quantidadeMinima < 0 || necessidade.quantidadeMinima > necessidade.quantidade) {
+            throw ValidacaoException("Quantidade mínima do item " + to_string(necessidade.itemId) +
+                                     " fora do intervalo");
+        }
+
+        Item* item = catalogo.buscarPorId(necessidade.itemId);
+        if (item == nullptr) {
+            resultado.adiadas.push_back(necessidade.itemId);  // Sem preço: não há como comprar
+            continue;
+        }
+
+        Linha linha;
+        linha.itemId = necessidade.itemId;
+        linha.nomeItem = item->getNome();
+        linha.quantidadeFaltante = necessidade.quantidade;
+        linha.precoCentavos = llround(item->getPreco() * 100);
+
+        double pesoUnidade = peso(necessidade);
+        int minima = necessidade.quantidadeMinima;
+        int folga = necessidade.quantidade - minima;
+        if (minima > 0 && folga > 0) {  // Compra parcial possível
+            linha.opcoes.push_back({minima, minima * linha.precoCentavos, pesoUnidade * 2 * minima});
+        }
+        linha.opcoes.push_back({necessidade.quantidade, necessidade.quantidade * linha.precoCentavos,
+                                pesoUnidade * (2 * minima + folga)});
+
+        resultado.valorMaximo += linha.opcoes.back().valor;
+        custoTotal += linha.opcoes.back().custo;
+        linhas.push_back(move(linha));
+    }
+
+    // 2. Resolve
+    vector<int> escolha;
+    if (custoTotal <= orcamentoCentavos) {
+        escolha.assign(linhas.size(), 0);  // Tudo cabe: compra inteira de todas
+        for (size_t i = 0; i < linhas.size(); i++) {
+            escolha[i] = (int)linhas[i].opcoes.size() - 1;
+        }
+        resultado.exato = true;
+    } else {
+        // Custos divididos pelo MDC reduzem a tabela sem perder exatidão
+        long long divisor = 0;
+        for (const auto& linha : linhas) {
+            for (const auto& opcao : linha.opcoes) {
+                divisor = gcd(divisor, opcao.custo);
+            }
+        }
+        if (divisor == 0) {
+            divisor = 1;  // Todos os custos zero
+        }
+        long long capacidade = min(orcamentoCentavos, custoTotal) / divisor;
+        bool cabeExato = (long long)linhas.size() * (capacidade + 1) <= LIMITE_CELULAS_EXATO;
+
+        if (modo == ModoOtimizacao::EXATO && !cabeExato) {
+            throw ValidacaoException("Lista grande demais para o modo exato (" + to_string(linhas.size()) +
+                                     " linhas); use o modo guloso");
+        }
+        if (modo == ModoOtimizacao::GULOSO || !cabeExato) {
+            escolha = resolverGuloso(linhas, orcamentoCentavos);
+        } else {
+            escolha = resolverExato(linhas, min(orcamentoCentavos, custoTotal), divisor);
+            resultado.exato = true;
+        }
+    }
+
+    // 3. Monta o resultado
+    for (size_t i = 0; i < linhas.size(); i++) {
+        if (escolha[i] < 0) {
+            resultado.adiadas.push_back(linhas[i].itemId);
+            continue;
+        }
+        const Opcao& opcao = linhas[i].opcoes[escolha[i]];
+        CompraEscolhida compra;
+        compra.itemId = linhas[i].itemId;
+        compra.nomeItem = linhas[i].nomeItem;
+        compra.quantidade = opcao.quantidade;
+        compra.quantidadeFaltante = linhas[i].quantidadeFaltante;
+        compra.precoCentavos = linhas[i].precoCentavos;
+        compra.custoCentavos = opcao.custo;
+        compra.valor = opcao.valor;
+        resultado.custoCentavos += opcao.custo;
+        resultado.valor += opcao.valor;
+        resultado.escolhidas.push_back(compra);
+    }
+
+    sort(resultado.escolhidas.begin(), resultado.escolhidas.end(),
+         [](const CompraEscolhida& a, const CompraEscolhida& b) { return a.itemId < b.itemId; });
+    sort(resultado.adiadas.begin(), resultado.adiadas.end());
+    return resultado;
+}
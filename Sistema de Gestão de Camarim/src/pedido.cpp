@@ -24,15 +24,18 @@
 /**
  * Construtor padrão - inicializa com valores vazios
  */
-Pedido::Pedido() : id(0), camarimId(0), nomeArtista(""), atendido(false) {}
+Pedido::Pedido() : id(0), camarimId(0), nomeArtista(""), atendido(false), prioridade(0),
+                   pedidoOrigemId(0), backorderId(0), aguardandoEstoque(false), criadoEm(0), ultimoItemEm(0), reservadoEm(0), atendidoEm(0) {}
 // atendido = false: pedido começa como PENDENTE
 
 /**
  * Construtor parametrizado - inicializa com dados fornecidos
  */
 Pedido::Pedido(int id, int camarimId, const string& nomeArtista)
-    : id(id), camarimId(camarimId), nomeArtista(nomeArtista), atendido(false) {}
+    : id(id), camarimId(camarimId), nomeArtista(nomeArtista), atendido(false), prioridade(0),
+      pedidoOrigemId(0), backorderId(0), aguardandoEstoque(false), criadoEm(relogioMonotonicoNs()), ultimoItemEm(0), reservadoEm(0), atendidoEm(0) {}
 // Pedido sempre começa como não atendido (pendente)
+// criadoEm = instante da criação (relógio monotônico)
 
 /**
  * Destrutor - libera recursos
@@ -71,6 +74,74 @@ bool Pedido::isAtendido() const {
     // Convenção: is<Nome>() para métodos que retornam bool
 }
 
+/**
+ * Retorna se os itens já foram reservados no estoque
+ */
+bool Pedido::isReservado() const {
+    return reservadoEm != 0;  // Timestamp 0 = ainda não reservado
+}
+
+/**
+ * Retorna prioridade do pedido
+ */
+int Pedido::getPrioridade() const {
+    return prioridade;
+}
+
+/**
+ * Retornam os timestamps do ciclo de vida (ns, 0 = não ocorreu)
+ */
+int64_t Pedido::getCriadoEm() const {
+    return criadoEm;
+}
+
+int64_t Pedido::getUltimoItemEm() const {
+    return ultimoItemEm;
+}
+
+int64_t Pedido::getReservadoEm() const {
+    return reservadoEm;
+}
+
+int64_t Pedido::getAtendidoEm() const {
+    return atendidoEm;
+}
+
+/**
+ * Retorna referência constante aos itens (evita cópia dos itens)
+ */
+const MapaPequeno<int, ItemPedido>& Pedido::getItens() const {
+    return itens;
+}
+
+/**
+ * Retorna pedido de origem (0 = não é backorder)
+ */
+int Pedido::getPedidoOrigemId() const {
+    return pedidoOrigemId;
+}
+
+/**
+ * Retorna backorder gerado a partir deste pedido (0 = nenhum)
+ */
+int Pedido::getBackorderId() const {
+    return backorderId;
+}
+
+/**
+ * Retorna se o pedido espera reposição do estoque
+ */
+bool Pedido::isAguardandoEstoque() const {
+    return aguardandoEstoque;
+}
+
+/**
+ * Define se o pedido espera reposição do estoque
+ */
+void Pedido::setAguardandoEstoque(bool aguardando) {
+    aguardandoEstoque = aguardando;
+}
+
 // ==================== SETTERS ====================
 
 /**
@@ -110,6 +181,16 @@ void Pedido::setAtendido(bool atendido) {
     this->atendido = atendido;  // Permite mudar de volta para pendente se necessário
 }
 
+/**
+ * Define prioridade com validação
+ */
+void Pedido::setPrioridade(int prioridade) {
+    if (prioridade < 0 || prioridade >= NUM_PRIORIDADES) {  // Apenas 0, 1 ou 2
+        throw ValidacaoException("Prioridade deve ser 0 (normal), 1 (alta) ou 2 (urgente)");
+    }
+    this->prioridade = prioridade;
+}
+
 /**
  * Adiciona item ao pedido
  */
@@ -140,6 +221,8 @@ void Pedido::adicionarItem(int itemId, const string& nomeItem, int quantidade) {
         // Item NÃO EXISTE: cria novo ItemPedido
         itens[itemId] = ItemPedido(itemId, nomeItem, quantidade);
     }
+    
+    ultimoItemEm = relogioMonotonicoNs();  // Registra transição "item adicionado"
 }
 
 /**
@@ -163,12 +246,85 @@ bool Pedido::removerItem(int itemId) {
     return true;  // Sucesso
 }
 
+/**
+ * Registra entrega parcial de um item
+ */
+void Pedido::registrarEntrega(int itemId, int quantidade) {
+    auto it = itens.find(itemId);
+    if (it == itens.end()) {
+        throw PedidoException("Item não encontrado no pedido (ID: " + to_string(itemId) + ")");
+    }
+    if (quantidade <= 0 || quantidade > it->second.quantidadePendente()) {
+        throw PedidoException("Quantidade entregue maior que a pendente");
+    }
+    it->second.quantidadeAtendida += quantidade;
+}
+
+/**
+ * Verifica se todos os itens já foram entregues
+ */
+bool Pedido::isCompleto() const {
+    for (const auto& par : itens) {
+        if (par.second.quantidadePendente() > 0) {
+            return false;  // Ainda falta entregar esta linha
+        }
+    }
+    return true;
+}
+
+/**
+ * Separa restante do pedido em um backorder
+ */
+Pedido Pedido::separarBackorder(int novoId, const map<int, int>& enviados) {
+    Pedido backorder(novoId, camarimId, nomeArtista);
+    backorder.prioridade = prioridade;
+    backorder.criadoEm = criadoEm;        // Espera conta desde o pedido original
+    backorder.pedidoOrigemId = id;        // Liga backorder → original
+    backorderId = novoId;                 // Liga original → backorder
+    
+    for (auto it = itens.begin(); it != itens.end(); ) {
+        ItemPedido& item = it->second;
+        auto enviado = enviados.find(item.itemId);
+        int qtdEnviada = (enviado == enviados.end()) ? 0 : enviado->second;
+        int restante = item.quantidadePendente() - qtdEnviada;
+        
+        if (restante > 0) {
+            // Backorder recebe apenas o que falta
+            backorder.itens[item.itemId] = ItemPedido(item.itemId, item.nomeItem, restante);
+        }
+        
+        // Original fica só com o que foi (ou já tinha sido) entregue
+        item.quantidade = item.quantidadeAtendida + qtdEnviada;
+        item.quantidadeAtendida = item.quantidade;
+        if (item.quantidade == 0) {
+            it = itens.erase(it);  // Nada enviado desta linha: sai do original
+        } else {
+            ++it;
+        }
+    }
+    
+    backorder.ultimoItemEm = relogioMonotonicoNs();
+    return backorder;
+}
+
+/**
+ * Marca itens do pedido como reservados
+ */
+void Pedido::marcarReservado() {
+    if (reservadoEm == 0) {  // Mantém o instante da PRIMEIRA reserva
+        reservadoEm = relogioMonotonicoNs();
+    }
+}
+
 /**
  * Marca pedido como atendido
  */
 void Pedido::marcarAtendido() {
     atendido = true;  // Muda status para ATENDIDO
     // Chamado após transferir itens do estoque para o camarim
+    if (atendidoEm == 0) {
+        atendidoEm = relogioMonotonicoNs();  // Registra transição "atendido"
+    }
 }
 
 /**
@@ -182,7 +338,28 @@ string Pedido::exibir() const {
     ss << "Artista: " << nomeArtista << endl;
     
     // Operador ternário: condição ? valor_se_true : valor_se_false
-    ss << "Status: " << (atendido ? "ATENDIDO" : "PENDENTE") << endl;
+    ss << "Status: " << (atendido ? "ATENDIDO" : (isReservado() ? "RESERVADO" : "PENDENTE")) << endl;
+    
+    // Ligações de backorder
+    if (pedidoOrigemId != 0) {
+        ss << "Backorder do pedido: " << pedidoOrigemId << endl;
+    }
+    if (backorderId != 0) {
+        ss << "Restante no backorder: " << backorderId << endl;
+    }
+    if (aguardandoEstoque) {
+        ss << "Aguardando reposição do estoque" << endl;
+    }
+    
+    // Prioridade em texto (0 = normal, 1 = alta, 2 = urgente)
+    const char* nomesPrioridade[] = {"Normal", "Alta", "Urgente"};
+    ss << "Prioridade: " << nomesPrioridade[prioridade] << endl;
+    
+    // Tempo de espera (criação → atendimento) quando já atendido
+    if (atendidoEm != 0 && criadoEm != 0) {
+        ss << "Espera: " << fixed << setprecision(1)
+           << (atendidoEm - criadoEm) / 1e9 << " s" << endl;
+    }
     
     ss << "\nItens:" << endl;
     
@@ -191,15 +368,16 @@ string Pedido::exibir() const {
     } else {
         // Cabeçalho da tabela
         ss << left << setw(5) << "  ID" << setw(30) << "Nome" 
-           << setw(10) << "Quantidade" << endl;
-        ss << "  " << string(42, '-') << endl;
+           << setw(12) << "Quantidade" << setw(10) << "Entregue" << endl;
+        ss << "  " << string(54, '-') << endl;
         
         // Lista todos os itens
         for (const auto& par : itens) {
             const ItemPedido& item = par.second;
             ss << left << setw(5) << "  " + to_string(item.itemId)
                << setw(30) << item.nomeItem
-               << setw(10) << item.quantidade << endl;
+               << setw(12) << item.quantidade
+               << setw(10) << item.quantidadeAtendida << endl;
         }
     }
     
@@ -219,12 +397,12 @@ ostream& operator<<(ostream& os, const Pedido& pedido) {
 /**
  * Construtor - inicializa próximo ID como 1
  */
-GerenciadorPedidos::GerenciadorPedidos() : proximoId(1) {}
+GerenciadorPedidos::GerenciadorPedidos() : proximoId(1), idadeArquivamentoNs(0), alterados(nullptr) {}
 
 /**
  * Cria novo pedido (CREATE)
  */
-int GerenciadorPedidos::criar(int camarimId, const string& nomeArtista) {
+int GerenciadorPedidos::criar(int camarimId, const string& nomeArtista, int prioridade) {
     // VALIDAÇÕES:
     if (camarimId < 0) {
         throw ValidacaoException("ID do camarim inválido");
@@ -237,14 +415,152 @@ int GerenciadorPedidos::criar(int camarimId, const string& nomeArtista) {
     // Cria pedido com ID automático
     Pedido novoPedido(proximoId, camarimId, nomeArtista);
     // Pedido começa vazio (sem itens) e pendente (não atendido)
+    novoPedido.setPrioridade(prioridade);  // Setter valida a faixa 0..2
     
     // Adiciona ao vector
     pedidos.push_back(novoPedido);
     // push_back() faz cópia do objeto
+    prepararLatencia(camarimId);
+    marcarAlterado(proximoId);
     
     return proximoId++;  // Retorna ID usado e incrementa para próximo
 }
 
+/**
+ * Cria pedido de forma idempotente
+ */
+int GerenciadorPedidos::criar(int camarimId, const string& nomeArtista, int prioridade,
+                              const string& chaveRequisicao) {
+    if (chaveRequisicao.empty()) {
+        return criar(camarimId, nomeArtista, prioridade);  // Sem chave: criação normal
+    }
+    
+    int64_t agora = relogioMonotonicoNs();
+    int idOriginal;
+    if (requisicoesCriar.buscar(chaveRequisicao, agora, idOriginal)) {
+        return idOriginal;  // REENVIO: devolve pedido já criado
+    }
+    
+    int id = criar(camarimId, nomeArtista, prioridade);
+    requisicoesCriar.registrar(chaveRequisicao, id, agora);  // Só registra após sucesso
+    return id;
+}
+
+/**
+ * Adiciona item a um pedido de forma idempotente
+ */
+bool GerenciadorPedidos::adicionarItem(int pedidoId, int itemId, const string& nomeItem,
+                                       int quantidade, const string& chaveRequisicao) {
+    int64_t agora = relogioMonotonicoNs();
+    int pedidoAnterior;
+    if (!chaveRequisicao.empty() &&
+        requisicoesAdicionar.buscar(chaveRequisicao, agora, pedidoAnterior)) {
+        if (pedidoAnterior != pedidoId) {
+            // Chave reaproveitada em outro pedido: não é reenvio, e ignorar perderia o item
+            throw PedidoException("Chave de requisição já usada no pedido " +
+                                  to_string(pedidoAnterior));
+        }
+        return false;  // REENVIO: item já foi adicionado
+    }
+    
+    Pedido* pedido = buscarPorId(pedidoId);
+    if (pedido == nullptr) {
+        throw PedidoException("Pedido com ID " + to_string(pedidoId) + " não encontrado");
+    }
+    
+    pedido->adicionarItem(itemId, nomeItem, quantidade);  // Valida e pode lançar exceção
+    marcarAlterado(pedidoId);
+    if (contaDemanda(*pedido)) {
+        ajustarDemanda(itemId, quantidade);
+    }
+    
+    if (!chaveRequisicao.empty()) {
+        requisicoesAdicionar.registrar(chaveRequisicao, pedidoId, agora);
+    }
+    return true;
+}
+
+/**
+ * Remove item de um pedido (mantém demanda pendente)
+ */
+bool GerenciadorPedidos::removerItem(int pedidoId, int itemId) {
+    Pedido* pedido = buscarPorId(pedidoId);
+    if (pedido == nullptr) {
+        throw PedidoException("Pedido com ID " + to_string(pedidoId) + " não encontrado");
+    }
+    
+    auto linha = pedido->getItens().find(itemId);
+    int pendente = linha == pedido->getItens().end() ? 0 : linha->second.quantidadePendente();
+    bool conta = contaDemanda(*pedido);
+    
+    if (!pedido->removerItem(itemId)) {  // Valida e pode lançar exceção
+        return false;
+    }
+    marcarAlterado(pedidoId);
+    if (pedido->isAguardandoEstoque()) {
+        // Backorder: linha removida não espera mais o estoque
+        auto espera = aguardandoPorItem.find(itemId);
+        if (espera != aguardandoPorItem.end()) {
+            espera->second.erase(pedidoId);
+            if (espera->second.empty()) {
+                aguardandoPorItem.erase(espera);
+            }
+        }
+    }
+    if (conta && pendente > 0) {
+        ajustarDemanda(itemId, -pendente);
+    }
+    return true;
+}
+
+/**
+ * Pedido entra na demanda pendente?
+ */
+bool GerenciadorPedidos::contaDemanda(const Pedido& pedido) {
+    return !pedido.isAtendido() && !pedido.isReservado();
+}
+
+/**
+ * Ajusta demanda de um item
+ */
+void GerenciadorPedidos::ajustarDemanda(int itemId, int delta) {
+    if (delta == 0) {
+        return;
+    }
+    int& demanda = demandaPorItem[itemId];
+    demanda += delta;
+    if (demanda <= 0) {
+        demandaPorItem.erase(itemId);  // Não guarda itens sem demanda
+    }
+    if (observadorDemanda) {
+        observadorDemanda(itemId);
+    }
+}
+
+/**
+ * Soma/retira todo o pendente de um pedido
+ */
+void GerenciadorPedidos::somarDemanda(const Pedido& pedido, int sinal) {
+    for (const auto& par : pedido.getItens()) {
+        ajustarDemanda(par.first, sinal * par.second.quantidadePendente());
+    }
+}
+
+/**
+ * Demanda pendente de um item
+ */
+int GerenciadorPedidos::obterDemandaPendente(int itemId) const {
+    auto it = demandaPorItem.find(itemId);
+    return it == demandaPorItem.end() ? 0 : it->second;
+}
+
+/**
+ * Define observador de demanda
+ */
+void GerenciadorPedidos::definirObservadorDemanda(function<void(int itemId)> observador) {
+    observadorDemanda = observador;
+}
+
 /**
  * Busca pedido por ID (READ)
  */
@@ -303,10 +619,34 @@ vector<Pedido> GerenciadorPedidos::listarPendentes() const {
     // Útil para gerenciar fila de processamento
 }
 
+/**
+ * Lista pedidos pendentes ainda não reservados (sem cópia)
+ */
+vector<const Pedido*> GerenciadorPedidos::listarAguardandoSeparacao() const {
+    vector<const Pedido*> resultado;
+    resultado.reserve(pedidos.size());  // Evita realocações
+    
+    for (const auto& pedido : pedidos) {
+        if (!pedido.isAtendido() && !pedido.isReservado() && !pedido.isAguardandoEstoque()) {
+            resultado.push_back(&pedido);  // Guarda apenas o endereço
+        }
+    }
+    return resultado;
+}
+
 /**
  * Remove pedido (DELETE)
  */
 bool GerenciadorPedidos::remover(int id) {
+    // Pedido removido não pode continuar no índice de backorders
+    Pedido* pedido = buscarPorId(id);
+    if (pedido != nullptr && pedido->isAguardandoEstoque()) {
+        desindexarEspera(*pedido);
+    }
+    if (pedido != nullptr && contaDemanda(*pedido)) {
+        somarDemanda(*pedido, -1);  // Ninguém mais espera estes itens
+    }
+    
     // PADRÃO REMOVE-ERASE:
     auto it = remove_if(pedidos.begin(), pedidos.end(),
                        [id](const Pedido& p) { return p.getId() == id; });
@@ -318,6 +658,7 @@ bool GerenciadorPedidos::remover(int id) {
     if (it != pedidos.end()) {  // Se encontrou pedido(s) a remover
         pedidos.erase(it, pedidos.end());
         // erase() remove do vector
+        marcarAlterado(id);  // Ausente na confirmação = removido
         return true;  // Sucesso
     }
     return false;  // Não encontrado
@@ -329,3 +670,371 @@ bool GerenciadorPedidos::remover(int id) {
 vector<Pedido> GerenciadorPedidos::listar() const {
     return pedidos;  // Retorna CÓPIA de todo o vector
 }
+
+/**
+ * Cria a série de latência do camarim (primeiro pedido do camarim)
+ */
+void GerenciadorPedidos::prepararLatencia(int camarimId) {
+    unique_ptr<HistogramaLatencia>& ptr = latenciaPorCamarim[camarimId];
+    if (!ptr) {
+        ptr.reset(new HistogramaLatencia());
+    }
+}
+
+/**
+ * Marca itens do pedido como reservados
+ */
+void GerenciadorPedidos::reservar(int id) {
+    Pedido* pedido = buscarPorId(id);
+    if (pedido == nullptr) {
+        throw PedidoException("Pedido com ID " + to_string(id) + " não encontrado");
+    }
+    if (pedido->isAtendido()) {
+        throw PedidoException("Pedido já foi atendido");
+    }
+    if (contaDemanda(*pedido)) {
+        somarDemanda(*pedido, -1);  // Itens já saíram do estoque para este pedido
+    }
+    pedido->marcarReservado();
+    marcarAlterado(id);
+}
+
+/**
+ * Marca pedido como atendido e grava latência
+ */
+void GerenciadorPedidos::atender(int id) {
+    Pedido* pedido = buscarPorId(id);
+    if (pedido == nullptr) {
+        throw PedidoException("Pedido com ID " + to_string(id) + " não encontrado");
+    }
+    if (pedido->isAtendido()) {
+        throw PedidoException("Pedido já foi atendido");
+    }
+    
+    if (contaDemanda(*pedido)) {
+        somarDemanda(*pedido, -1);  // O que ainda faltava deixa de ser demanda
+    }
+    pedido->marcarAtendido();  // Registra timestamp de atendimento
+    marcarAlterado(id);
+    
+    // Grava a espera nas três séries (apenas incrementos atômicos; nada é criado aqui)
+    int64_t instante = pedido->getAtendidoEm();
+    int64_t espera = instante - pedido->getCriadoEm();
+    latenciaGeral.registrar(espera, instante);
+    auto serieCamarim = latenciaPorCamarim.find(pedido->getCamarimId());  // Criada com o pedido
+    if (serieCamarim != latenciaPorCamarim.end()) {
+        serieCamarim->second->registrar(espera, instante);
+    }
+    latenciaPorPrioridade[pedido->getPrioridade()].registrar(espera, instante);
+}
+
+/**
+ * Anota pedido no log de alterações
+ */
+void GerenciadorPedidos::marcarAlterado(int id) {
+    if (alterados != nullptr) {
+        alterados->push_back(id);
+    }
+}
+
+/**
+ * Liga log de alterações
+ */
+void GerenciadorPedidos::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+}
+
+/**
+ * Coloca pedido no índice de espera de cada item pendente
+ */
+void GerenciadorPedidos::indexarEspera(Pedido& pedido) {
+    for (const auto& par : pedido.getItens()) {
+        if (par.second.quantidadePendente() > 0) {
+            aguardandoPorItem[par.first].insert(pedido.getId());
+        }
+    }
+    pedido.setAguardandoEstoque(true);
+    marcarAlterado(pedido.getId());
+}
+
+/**
+ * Retira pedido do índice de espera
+ */
+void GerenciadorPedidos::desindexarEspera(const Pedido& pedido) {
+    for (const auto& par : pedido.getItens()) {
+        auto it = aguardandoPorItem.find(par.first);
+        if (it != aguardandoPorItem.end()) {
+            it->second.erase(pedido.getId());
+            if (it->second.empty()) {
+                aguardandoPorItem.erase(it);  // Não guarda conjuntos vazios
+            }
+        }
+    }
+}
+
+/**
+ * Atende parcialmente e gera backorder do restante
+ */
+int GerenciadorPedidos::atenderParcial(int id, Estoque& estoque, GerenciadorCamarins& camarins) {
+    Pedido* pedido = buscarPorId(id);
+    if (pedido == nullptr) {
+        throw PedidoException("Pedido com ID " + to_string(id) + " não encontrado");
+    }
+    if (pedido->isAtendido()) {
+        throw PedidoException("Pedido já foi atendido");
+    }
+    if (pedido->isAguardandoEstoque()) {
+        throw PedidoException("Pedido já aguarda reposição do estoque");
+    }
+    if (pedido->getItens().empty()) {
+        throw PedidoException("Pedido não possui itens");
+    }
+    
+    Camarim* camarim = camarins.buscarPorId(pedido->getCamarimId());
+    if (camarim == nullptr) {
+        throw CamarimException("Camarim com ID " + to_string(pedido->getCamarimId()) + " não encontrado");
+    }
+    
+    // Quanto o estoque consegue cobrir de cada linha
+    map<int, int> enviados;
+    bool completo = true;
+    for (const auto& par : pedido->getItens()) {
+        int pendente = par.second.quantidadePendente();
+        int enviar = min(pendente, estoque.obterQuantidade(par.first));
+        if (enviar > 0) {
+            enviados[par.first] = enviar;
+        }
+        if (enviar < pendente) {
+            completo = false;
+        }
+    }
+    
+    // Nada disponível: o próprio pedido espera o estoque
+    if (enviados.empty()) {
+        indexarEspera(*pedido);
+        return id;
+    }
+    
+    // Saída em lote e entrega do que foi possível
+    estoque.removerLote(enviados);
+    somarDemanda(*pedido, -1);  // Pendente do original sai; o do backorder entra abaixo
+    for (const auto& par : enviados) {
+        camarim->inserirItem(par.first, pedido->getItens().at(par.first).nomeItem, par.second);
+    }
+    
+    if (completo) {
+        for (const auto& par : enviados) {
+            pedido->registrarEntrega(par.first, par.second);
+        }
+        atender(id);
+        return 0;
+    }
+    
+    // Parcial: restante vai para um backorder ligado ao original
+    int backorderId = proximoId++;
+    Pedido backorder = pedido->separarBackorder(backorderId, enviados);
+    pedidos.push_back(backorder);  // ATENÇÃO: invalida o ponteiro 'pedido'
+    marcarAlterado(backorderId);
+    
+    indexarEspera(*buscarPorId(backorderId));
+    somarDemanda(*buscarPorId(backorderId), +1);
+    atender(id);  // Original: entregue com o que havia
+    return backorderId;
+}
+
+/**
+ * Reavalia pedidos que aguardam um item
+ */
+int GerenciadorPedidos::reavaliarBackorders(int itemId, Estoque& estoque, GerenciadorCamarins& camarins) {
+    auto indice = aguardandoPorItem.find(itemId);
+    if (indice == aguardandoPorItem.end()) {
+        return 0;  // Ninguém espera este item
+    }
+    
+    // Ordem de atendimento: maior prioridade primeiro, depois o mais antigo (menor ID)
+    vector<Pedido*> fila;
+    for (int pedidoId : indice->second) {
+        Pedido* pedido = buscarPorId(pedidoId);
+        if (pedido != nullptr) {
+            fila.push_back(pedido);
+        }
+    }
+    stable_sort(fila.begin(), fila.end(), [](const Pedido* a, const Pedido* b) {
+        return a->getPrioridade() > b->getPrioridade();
+    });
+    
+    int concluidos = 0;
+    for (Pedido* pedido : fila) {
+        int disponivel = estoque.obterQuantidade(itemId);
+        if (disponivel == 0) {
+            break;  // Estoque do item acabou
+        }
+        
+        Camarim* camarim = camarins.buscarPorId(pedido->getCamarimId());
+        auto linha = pedido->getItens().find(itemId);
+        if (camarim == nullptr || linha == pedido->getItens().end()) {
+            continue;  // Camarim removido ou linha removida: fica para depois
+        }
+        
+        int enviar = min(disponivel, linha->second.quantidadePendente());
+        if (enviar > 0) {
+            estoque.removerItem(itemId, enviar);
+            camarim->inserirItem(itemId, linha->second.nomeItem, enviar);
+            pedido->registrarEntrega(itemId, enviar);
+            marcarAlterado(pedido->getId());
+            if (contaDemanda(*pedido)) {
+                ajustarDemanda(itemId, -enviar);
+            }
+        }
+        
+        if (linha->second.quantidadePendente() == 0) {
+            indice->second.erase(pedido->getId());  // Linha completa: sai do índice
+        }
+        
+        if (pedido->isCompleto()) {
+            pedido->setAguardandoEstoque(false);
+            atender(pedido->getId());
+            concluidos++;
+        }
+    }
+    
+    if (indice->second.empty()) {
+        aguardandoPorItem.erase(indice);
+    }
+    return concluidos;
+}
+
+/**
+ * Liga arquivamento em disco
+ */
+void GerenciadorPedidos::configurarArquivo(const string& caminho, int64_t idadeMinimaNs,
+                                           size_t bytesCacheIndice) {
+    if (idadeMinimaNs < 0) {
+        throw ValidacaoException("Idade mínima de arquivamento não pode ser negativa");
+    }
+    
+    arquivo.reset(new ArquivoPedidos(caminho, bytesCacheIndice));  // Lança se o arquivo não abrir
+    idadeArquivamentoNs = idadeMinimaNs;
+    
+    // IDs arquivados em execuções anteriores não podem ser reutilizados
+    if (proximoId <= arquivo->getMaiorId()) {
+        proximoId = arquivo->getMaiorId() + 1;
+    }
+}
+
+/**
+ * Move atendidos antigos para o arquivo frio
+ */
+int GerenciadorPedidos::arquivarAtendidos(int64_t agoraNs) {
+    return arquivarAtendidos(agoraNs, idadeArquivamentoNs);
+}
+
+/**
+ * Move atendidos com a idade informada para o arquivo frio
+ */
+int GerenciadorPedidos::arquivarAtendidos(int64_t agoraNs, int64_t idadeMinimaNs) {
+    if (!arquivo) {
+        return 0;  // Arquivamento não configurado
+    }
+    
+    // Seleciona atendidos há pelo menos idadeMinimaNs
+    vector<const Pedido*> frios;
+    for (const auto& pedido : pedidos) {
+        if (pedido.isAtendido() && pedido.getAtendidoEm() + idadeMinimaNs <= agoraNs) {
+            frios.push_back(&pedido);
+        }
+    }
+    if (frios.empty()) {
+        return 0;
+    }
+    
+    // Grava ANTES de remover: se o disco falhar, nada se perde
+    arquivo->anexar(frios);
+    for (const Pedido* pedido : frios) {
+        marcarAlterado(pedido->getId());  // Sai da memória (o arquivo frio guarda o pedido)
+    }
+    
+    int arquivados = (int)frios.size();
+    pedidos.erase(
+        remove_if(pedidos.begin(), pedidos.end(),
+            [agoraNs, idadeMinimaNs](const Pedido& p) {
+                return p.isAtendido() && p.getAtendidoEm() + idadeMinimaNs <= agoraNs;  // Mesmo critério de frios
+            }),
+        pedidos.end()
+    );
+    if (pedidos.capacity() > 2 * pedidos.size()) {
+        pedidos.shrink_to_fit();  // Devolve a memória só quando sobra muito (evita realocar a cada varredura)
+    }
+    return arquivados;
+}
+
+/**
+ * Busca pedido no arquivo frio
+ */
+bool GerenciadorPedidos::buscarArquivado(int id, Pedido& pedido) const {
+    if (!arquivo) {
+        return false;
+    }
+    return arquivo->buscar(id, pedido);
+}
+
+/**
+ * Percorre faixa de IDs no arquivo frio
+ */
+size_t GerenciadorPedidos::percorrerArquivados(int idInicio, int idFim,
+                                               const function<bool(const Pedido&)>& visitante) const {
+    if (!arquivo) {
+        return 0;
+    }
+    return arquivo->percorrerFaixa(idInicio, idFim, visitante);
+}
+
+/**
+ * Quantidade de pedidos arquivados
+ */
+size_t GerenciadorPedidos::quantidadeArquivados() const {
+    return arquivo ? arquivo->quantidade() : 0;
+}
+
+/**
+ * Registros do arquivo frio com CRC errado
+ */
+size_t GerenciadorPedidos::arquivadosCorrompidos() const {
+    return arquivo ? arquivo->getRegistrosCorrompidos() : 0;
+}
+
+/**
+ * Quantidade de pedidos em memória
+ */
+size_t GerenciadorPedidos::quantidadeEmMemoria() const {
+    return pedidos.size();
+}
+
+/**
+ * Percentis de espera de todos os pedidos
+ */
+PercentisLatencia GerenciadorPedidos::latenciaTotal(int64_t inicioNs, int64_t fimNs) const {
+    return latenciaGeral.consultar(inicioNs, fimNs);
+}
+
+/**
+ * Percentis de espera por camarim
+ */
+map<int, PercentisLatencia> GerenciadorPedidos::latenciaPorCamarins(int64_t inicioNs, int64_t fimNs) const {
+    map<int, PercentisLatencia> resultado;
+    for (const auto& par : latenciaPorCamarim) {
+        resultado[par.first] = par.second->consultar(inicioNs, fimNs);
+    }
+    return resultado;
+}
+
+/**
+ * Percentis de espera por prioridade
+ */
+map<int, PercentisLatencia> GerenciadorPedidos::latenciaPorPrioridades(int64_t inicioNs, int64_t fimNs) const {
+    map<int, PercentisLatencia> resultado;
+    for (int prioridade = 0; prioridade < Pedido::NUM_PRIORIDADES; prioridade++) {
+        resultado[prioridade] = latenciaPorPrioridade[prioridade].consultar(inicioNs, fimNs);
+    }
+    return resultado;
+}
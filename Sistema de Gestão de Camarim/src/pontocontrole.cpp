@@ -0,0 +1,121 @@
+/**
+ * @file pontocontrole.cpp
+ * @brief Implementação da classe PontoControle
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Captura na thread principal, gravação e limpeza do log em segundo plano.
+ */
+
+// Inclui header da classe
+#include "pontocontrole.h"
+// Inclui o log de alterações
+#include "alteracoes.h"
+// Inclui exceções personalizadas
+#include "excecoes.h"
+
+/**
+ * Construtor - a thread fica esperando trabalho
+ */
+PontoControle::PontoControle(const string& caminhoEstado, LogAlteracoes& log, uint64_t limiteBytes)
+    : caminhoEstado(caminhoEstado), log(log), limiteBytes(limiteBytes),
+      temTrabalho(false), ocupado(false), encerrando(false), geracaoCoberta(0),
+      trabalhador(&PontoControle::executar, this) {}
+
+/**
+ * Destrutor - grava o que já foi capturado antes de parar
+ */
+PontoControle::~PontoControle() {
+    {
+        lock_guard<mutex> guarda(trava);
+        encerrando = true;
+    }
+    sinal.notify_all();
+    trabalhador.join();
+}
+
+/**
+ * Grava a captura mais recente e apaga as gerações que ela cobre
+ */
+void PontoControle::executar() {
+    unique_lock<mutex> guarda(trava);
+    while (true) {
+        sinal.wait(guarda, [this] { return temTrabalho || encerrando; });
+        if (!temTrabalho) {
+            return;  // Encerrando sem nada pendente
+        }
+        string bytes = move(dados);
+        uint64_t geracao = geracaoCoberta;
+        string prefixo = prefixoLog;
+        temTrabalho = false;
+        ocupado = true;
+        guarda.unlock();
+
+        string erro;
+        try {
+            ArquivoSnapshot::gravarArquivo(bytes, caminhoEstado);
+            if (!prefixo.empty()) {
+                LogAlteracoes::apagarAte(prefixo, geracao);
+            }
+        } catch (const exception& e) {
+            erro = e.what();  // Log fica: estado anterior + log ainda recuperam tudo
+        }
+
+        guarda.lock();
+        ocupado = false;
+        if (!erro.empty()) {
+            ultimoErro = erro;
+        }
+        sinal.notify_all();
+    }
+}
+
+/**
+ * Geração aberta passou do limite?
+ */
+bool PontoControle::necessario() const {
+    return log.isGravando() && log.getBytesGeracao() >= limiteBytes;
+}
+
+/**
+ * Captura o estado entre duas ações (nada muda entre confirmar e rotacionar)
+ */
+ResumoSnapshot PontoControle::capturar(GerenciadorEventos& eventos, int64_t agoraNs) {
+    try {
+        log.confirmar(agoraNs);
+    } catch (const ExcecaoBase&) {
+        // Alterações não gravadas no log vão no estado capturado abaixo
+    }
+    ResumoSnapshot resumo;
+    string capturado = ArquivoSnapshot::serializar(eventos, agoraNs, log.getGeracao(), resumo);
+    uint64_t coberta = log.rotacionar();
+
+    {
+        lock_guard<mutex> guarda(trava);
+        dados = move(capturado);  // Substitui captura ainda não gravada
+        geracaoCoberta = coberta;
+        prefixoLog = log.getPrefixo();
+        temTrabalho = true;
+    }
+    sinal.notify_all();
+    return resumo;
+}
+
+/**
+ * Espera a fila esvaziar
+ */
+void PontoControle::aguardar() {
+    unique_lock<mutex> guarda(trava);
+    sinal.wait(guarda, [this] { return !temTrabalho && !ocupado; });
+}
+
+/**
+ * Retorna e limpa o último erro
+ */
+string PontoControle::extrairErro() {
+    lock_guard<mutex> guarda(trava);
+    string erro = ultimoErro;
+    ultimoErro.clear();
+    return erro;
+}
@@ -0,0 +1,248 @@
+/**
+ * @file recebimento.cpp
+ * @brief Implementação da classe DiarioRecebimentos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa o recebimento em lote com diário gravado antes do estoque.
+ */
+
+// Inclui header da classe
+#include "recebimento.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Para gravação do diário
+#include <fstream>
+// Para stringstream (construir strings)
+#include <sstream>
+// Para formatação (setw, left)
+#include <iomanip>
+
+/**
+ * Construtor - diário vazio
+ */
+DiarioRecebimentos::DiarioRecebimentos() : proximoId(1) {}
+
+/**
+ * Liga diário a arquivo
+ */
+void DiarioRecebimentos::configurarArquivo(const string& caminho) {
+    ofstream teste(caminho, ios::app);
+    if (!teste) {
+        throw PersistenciaException("Não foi possível abrir o diário " + caminho);
+    }
+    teste.close();
+
+    // O diário é só de acréscimo: a numeração continua depois do último INICIO,
+    // e INICIO sem CONFIRMADO/CANCELADO é recebimento interrompido
+    pendentes.clear();
+    ifstream entrada(caminho);
+    string linha;
+    while (getline(entrada, linha)) {
+        stringstream ss(linha);
+        if (linha.compare(0, 2, "  ") == 0) {
+            // Linha "  itemId quantidade" do INICIO logo acima
+            int itemId = 0, quantidade = 0;
+            if (!pendentes.empty() && ss >> itemId >> quantidade) {
+                pendentes.back().entradas.push_back(ItemEstoque(itemId, "", quantidade));
+            }
+            continue;
+        }
+        string marca;
+        int id = 0;
+        if (!(ss >> marca >> id)) {
+            continue;
+        }
+        if (marca == "INICIO") {
+            Recebimento recebimento;
+            recebimento.id = id;
+            string campo;
+            while (ss >> campo) {
+                size_t igual = campo.find('=');
+                if (igual == string::npos) {
+                    continue;
+                }
+                stringstream valor(campo.substr(igual + 1));
+                if (campo.compare(0, igual, "lista") == 0) {
+                    valor >> recebimento.listaId;
+                } else if (campo.compare(0, igual, "instante") == 0) {
+                    valor >> recebimento.instanteNs;
+                }
+            }
+            pendentes.push_back(move(recebimento));
+            if (id >= proximoId) {
+                proximoId = id + 1;
+            }
+        } else if (marca == "CONFIRMADO" || marca == "CANCELADO") {
+            for (size_t i = 0; i < pendentes.size(); i++) {
+                if (pendentes[i].id == id) {
+                    pendentes.erase(pendentes.begin() + i);
+                    break;
+                }
+            }
+        }
+    }
+    this->caminho = caminho;
+}
+
+/**
+ * Acrescenta texto ao diário
+ */
+void DiarioRecebimentos::gravar(const string& texto) const {
+    if (caminho.empty()) {
+        return;  // Diário só em memória
+    }
+    ofstream saida(caminho, ios::app);
+    if (!saida) {
+        throw PersistenciaException("Não foi possível abrir o diário " + caminho);
+    }
+    saida << texto;
+    if (!saida.flush()) {
+        throw PersistenciaException("Falha ao gravar o diário " + caminho);
+    }
+}
+
+/**
+ * Recebe lista no estoque (tudo ou nada)
+ */
+const Recebimento& DiarioRecebimentos::receber(ListaCompras& lista, const map<int, int>& recebidos,
+                                               Estoque& estoque, int64_t agoraNs) {
+    const MapaPequeno<int, ItemCompra>& itens = lista.getItens();
+
+    // 1. Validação completa
+    for (const auto& par : recebidos) {
+        if (itens.find(par.first) == itens.end()) {
+            throw ListaComprasException("Item " + to_string(par.first) + " não está na lista " +
+                                        to_string(lista.getId()));
+        }
+        if (par.second < 0) {
+            throw ValidacaoException("Quantidade recebida não pode ser negativa");
+        }
+    }
+
+    Recebimento recebimento;
+    recebimento.id = proximoId;
+    recebimento.listaId = lista.getId();
+    recebimento.instanteNs = agoraNs;
+    recebimento.entradas.reserve(itens.size());
+    for (const auto& par : itens) {
+        const ItemCompra& item = par.second;
+        auto informado = recebidos.find(item.itemId);
+        int quantidade = (informado == recebidos.end()) ? item.quantidade : informado->second;
+        if (quantidade != item.quantidade) {
+            recebimento.divergencias.push_back(
+                DivergenciaRecebimento(item.itemId, item.nomeItem, item.quantidade, quantidade));
+        }
+        if (quantidade > 0) {
+            recebimento.entradas.push_back(ItemEstoque(item.itemId, item.nomeItem, quantidade));
+        }
+    }
+
+    // 2. Diário ANTES do estoque (uma escrita para o lote inteiro)
+    stringstream inicio;
+    inicio << "INICIO " << recebimento.id << " lista=" << recebimento.listaId
+           << " instante=" << agoraNs << " linhas=" << recebimento.entradas.size() << "\n";
+    for (const auto& entrada : recebimento.entradas) {
+        inicio << "  " << entrada.itemId << " " << entrada.quantidade << "\n";
+    }
+    gravar(inicio.str());
+
+    // 3. Entrada em lote
+    try {
+        estoque.adicionarLote(recebimento.entradas);
+    } catch (const ExcecaoBase&) {
+        gravar("CANCELADO " + to_string(recebimento.id) + "\n");
+        throw;
+    }
+
+    // 4. Confirmação (o estoque já foi alterado: falha aqui não desfaz a entrada)
+    try {
+        gravar("CONFIRMADO " + to_string(recebimento.id) + "\n");
+    } catch (const PersistenciaException&) {
+        // Sem marca de confirmação o diário mostra INICIO pendente; a entrada vale
+    }
+
+    // 5. Baixa da lista: o que chegou por completo sai, o resto continua pendente
+    for (const auto& entrada : recebimento.entradas) {
+        int pedido = itens.find(entrada.itemId)->second.quantidade;
+        if (entrada.quantidade >= pedido) {
+            lista.removerItem(entrada.itemId);
+        } else {
+            lista.atualizarQuantidade(entrada.itemId, pedido - entrada.quantidade);
+        }
+    }
+
+    proximoId++;
+    registros.push_back(move(recebimento));
+    return registros.back();
+}
+
+// ==================== GETTERS ====================
+
+const vector<Recebimento>& DiarioRecebimentos::getRegistros() const {
+    return registros;
+}
+
+const vector<Recebimento>& DiarioRecebimentos::getPendentes() const {
+    return pendentes;
+}
+
+const Recebimento* DiarioRecebimentos::buscarPorId(int id) const {
+    for (const auto& recebimento : registros) {
+        if (recebimento.id == id) {
+            return &recebimento;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Exibe um recebimento
+ */
+string DiarioRecebimentos::exibir(const Recebimento& recebimento) {
+    stringstream ss;
+    int unidades = 0;
+    for (const auto& entrada : recebimento.entradas) {
+        unidades += entrada.quantidade;
+    }
+
+    ss << "=== RECEBIMENTO " << recebimento.id << " (lista " << recebimento.listaId << ") ===" << endl;
+    ss << "Itens: " << recebimento.entradas.size() << " | Unidades: " << unidades << endl;
+
+    if (recebimento.divergencias.empty()) {
+        ss << "  Sem divergências: tudo chegou como na lista" << endl;
+        return ss.str();
+    }
+
+    ss << "\nDivergências:" << endl;
+    ss << left << setw(5) << "  ID" << setw(22) << "Nome"
+       << right << setw(10) << "Esperado" << setw(10) << "Recebido" << setw(11) << "Diferença" << endl;
+    ss << "  " << string(56, '-') << endl;
+    for (const auto& divergencia : recebimento.divergencias) {
+        ss << left << setw(5) << "  " + to_string(divergencia.itemId) << setw(22) << divergencia.nomeItem.substr(0, 21)
+           << right << setw(10) << divergencia.esperado << setw(10) << divergencia.recebido
+           << setw(10) << showpos << divergencia.diferenca() << noshowpos << endl;
+    }
+    return ss.str();
+}
+
+/**
+ * Histórico resumido
+ */
+string DiarioRecebimentos::exibirHistorico() const {
+    stringstream ss;
+    ss << "=== HISTÓRICO DE RECEBIMENTOS ===" << endl;
+    if (registros.empty()) {
+        ss << "  Nenhum recebimento registrado" << endl;
+        return ss.str();
+    }
+
+    ss << left << setw(6) << "  ID" << setw(8) << "Lista"
+       << right << setw(8) << "Itens" << setw(14) << "Divergências" << endl;
+    for (const auto& recebimento : registros) {
+        ss << left << setw(6) << "  " + to_string(recebimento.id) << setw(8) << recebimento.listaId
+           << right << setw(8) << recebimento.entradas.size() << setw(14) << recebimento.divergencias.size() << endl;
+    }
+    return ss.str();
+}
@@ -0,0 +1,231 @@
+/**
+ * @file reposicao.cpp
+ * @brief Implementação da classe PlanoReposicao
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa o cálculo paralelo das faltas e a reposição em lote.
+ */
+
+// Inclui header da classe
+#include "reposicao.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Para threads do planejamento paralelo
+#include <thread>
+// Para ref (plano parcial passado à thread por referência)
+#include <functional>
+// Para min
+#include <algorithm>
+// Para stringstream (construir strings)
+#include <sstream>
+// Para formatação (setw, left)
+#include <iomanip>
+
+// Abaixo deste número de camarins por thread, criar threads custa mais que comparar
+static const size_t MIN_CAMARINS_POR_THREAD = 128;
+
+/**
+ * Construtor - plano vazio
+ */
+PlanoReposicao::PlanoReposicao() {}
+
+/**
+ * Compara camarim com rider e acumula no plano
+ */
+void PlanoReposicao::comparar(const Camarim& camarim, const Rider& rider) {
+    FaltaCamarim falta = faltasDoCamarim(camarim, rider);
+    for (const auto& linha : falta.faltas) {
+        totais[linha.first] += linha.second;
+    }
+
+    if (!falta.faltas.empty()) {
+        porCamarim.push_back(move(falta));
+    }
+}
+
+/**
+ * Faltas de um camarim (merge das duas listas ordenadas)
+ */
+FaltaCamarim PlanoReposicao::faltasDoCamarim(const Camarim& camarim, const Rider& rider) {
+    FaltaCamarim falta(camarim.getId());
+    const MapaPequeno<int, ItemCamarim>& atuais = camarim.getItens();
+    auto atual = atuais.begin();
+
+    for (const auto& linha : rider.getItens()) {
+        // Avança no camarim até o item do rider (ou além dele)
+        while (atual != atuais.end() && atual->first < linha.first) {
+            ++atual;
+        }
+        int tem = (atual != atuais.end() && atual->first == linha.first) ? atual->second.quantidade : 0;
+        int faltam = linha.second.quantidade - tem;
+        if (faltam > 0) {
+            falta.faltas.emplace_back(linha.first, faltam);
+        }
+    }
+    return falta;
+}
+
+/**
+ * Funde plano parcial (as faltas são movidas, não copiadas)
+ */
+void PlanoReposicao::mesclar(PlanoReposicao& outro) {
+    porCamarim.insert(porCamarim.end(), make_move_iterator(outro.porCamarim.begin()),
+                      make_move_iterator(outro.porCamarim.end()));
+    for (const auto& par : outro.totais) {
+        totais[par.first] += par.second;
+    }
+}
+
+/**
+ * Planeja a reposição (redução paralela)
+ */
+PlanoReposicao PlanoReposicao::planejar(const GerenciadorRiders& riders, const GerenciadorCamarins& camarins) {
+    unordered_map<int, const Rider*> riderPorArtista = riders.indicePorArtista();  // Só leitura nas threads
+    const vector<Camarim>& lista = camarins.getCamarins();
+
+    // Compara uma fatia [inicio, fim) dos camarins
+    auto compararFatia = [&riderPorArtista, &lista](PlanoReposicao& plano, size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++) {
+            const Camarim& camarim = lista[i];
+            if (camarim.getArtistaId() == 0) {
+                continue;  // Camarim sem artista não tem alvo
+            }
+            auto it = riderPorArtista.find(camarim.getArtistaId());
+            if (it != riderPorArtista.end()) {
+                plano.comparar(camarim, *it->second);
+            }
+        }
+    };
+
+    size_t numThreads = thread::hardware_concurrency();
+    if (numThreads == 0) {
+        numThreads = 1;  // hardware_concurrency() pode retornar 0 se desconhecido
+    }
+    numThreads = min(numThreads, lista.size() / MIN_CAMARINS_POR_THREAD);
+
+    // Poucos camarins: compara na thread atual
+    if (numThreads <= 1) {
+        PlanoReposicao plano;
+        compararFatia(plano, 0, lista.size());
+        return plano;
+    }
+
+    // MAP: cada thread preenche seu plano parcial
+    vector<PlanoReposicao> parciais(numThreads);
+    vector<thread> threads;
+    size_t fatia = (lista.size() + numThreads - 1) / numThreads;
+
+    for (size_t t = 0; t < numThreads; t++) {
+        size_t inicio = min(lista.size(), t * fatia);
+        size_t fim = min(lista.size(), inicio + fatia);
+        threads.emplace_back(compararFatia, ref(parciais[t]), inicio, fim);
+    }
+
+    for (auto& th : threads) {
+        th.join();  // Aguarda todas as fatias
+    }
+
+    // REDUCE: funde em ordem (camarins saem na ordem do gerenciador)
+    PlanoReposicao plano = move(parciais[0]);
+    for (size_t t = 1; t < numThreads; t++) {
+        plano.mesclar(parciais[t]);
+    }
+    return plano;
+}
+
+// ==================== GETTERS ====================
+
+const vector<FaltaCamarim>& PlanoReposicao::getPorCamarim() const {
+    return porCamarim;
+}
+
+const map<int, int>& PlanoReposicao::getTotais() const {
+    return totais;
+}
+
+bool PlanoReposicao::vazio() const {
+    return totais.empty();
+}
+
+/**
+ * Executa o plano (tudo ou nada)
+ */
+int PlanoReposicao::executar(GerenciadorItens& catalogo, Estoque& estoque,
+                             GerenciadorCamarins& camarins) const {
+    if (vazio()) {
+        return 0;
+    }
+
+    // 1. Validação completa ANTES de mexer no estoque
+    vector<Camarim*> destinos;
+    destinos.reserve(porCamarim.size());
+    for (const auto& falta : porCamarim) {
+        Camarim* camarim = camarins.buscarPorId(falta.camarimId);
+        if (camarim == nullptr) {
+            throw CamarimException("Camarim com ID " + to_string(falta.camarimId) + " não encontrado");
+        }
+        destinos.push_back(camarim);
+    }
+
+    map<int, string> nomes;  // Nome atual no catálogo (uma busca por item distinto)
+    for (const auto& par : totais) {
+        Item* item = catalogo.buscarPorId(par.first);
+        if (item == nullptr) {
+            throw ItemException("Item ID " + to_string(par.first) +
+                                " de um rider não existe mais no catálogo");
+        }
+        nomes[par.first] = item->getNome();
+    }
+
+    // 2. UMA saída em lote para todos os camarins
+    estoque.removerLote(totais);
+
+    // 3. Entrega
+    for (size_t i = 0; i < porCamarim.size(); i++) {
+        for (const auto& linha : porCamarim[i].faltas) {
+            destinos[i]->inserirItem(linha.first, nomes[linha.first], linha.second);
+        }
+    }
+    return (int)porCamarim.size();
+}
+
+/**
+ * Exibe o plano formatado
+ */
+string PlanoReposicao::exibir() const {
+    stringstream ss;
+    ss << "=== PLANO DE REPOSIÇÃO ===" << endl;
+    ss << "Camarins a repor: " << porCamarim.size() << endl;
+
+    if (totais.empty()) {
+        ss << "  Todos os camarins estão conforme o rider" << endl;
+        return ss.str();
+    }
+
+    ss << "\nRetirar do estoque:" << endl;
+    ss << left << setw(10) << "  Item" << setw(10) << "Quantidade" << endl;
+    ss << "  " << string(18, '-') << endl;
+    for (const auto& par : totais) {
+        ss << left << setw(10) << "  " + to_string(par.first) << setw(10) << par.second << endl;
+    }
+
+    ss << "\nFaltas por camarim:" << endl;
+    for (const auto& falta : porCamarim) {
+        ss << "  Camarim " << falta.camarimId << ":";
+        for (const auto& linha : falta.faltas) {
+            ss << " item " << linha.first << " x" << linha.second << ";";
+        }
+        ss << endl;
+    }
+    return ss.str();
+}
+
+/**
+ * Sobrecarga do operador << para cout
+ */
+ostream& operator<<(ostream& os, const PlanoReposicao& plano) {
+    os << plano.exibir();
+    return os;
+}
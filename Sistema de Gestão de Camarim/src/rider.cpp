@@ -0,0 +1,415 @@
+/**
+ * @file rider.cpp
+ * @brief Implementação das classes Rider e GerenciadorRiders
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa riders e o abastecimento de camarins em lote.
+ */
+
+// Inclui header da classe
+#include "rider.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Para remove_if
+#include <algorithm>
+// Para stringstream (construir strings)
+#include <sstream>
+// Para formatação (setw, left)
+#include <iomanip>
+
+// ==================== Classe Rider ====================
+
+/**
+ * Construtor padrão
+ */
+Rider::Rider() : id(0), artistaId(0), nome(""), observador(nullptr), alterados(nullptr) {}
+
+/**
+ * Construtor parametrizado
+ */
+Rider::Rider(int id, int artistaId, const string& nome)
+    : id(id), artistaId(artistaId), nome(nome), observador(nullptr), alterados(nullptr) {}
+
+/**
+ * Construtor de cópia - cópia avulsa (não fica ligada ao gerenciador)
+ */
+Rider::Rider(const Rider& outro)
+    : id(outro.id), artistaId(outro.artistaId), nome(outro.nome), itens(outro.itens),
+      observador(nullptr), alterados(nullptr) {}
+
+/**
+ * Construtor de movimento - leva a ligação
+ */
+Rider::Rider(Rider&& outro) noexcept
+    : id(outro.id), artistaId(outro.artistaId), nome(move(outro.nome)), itens(move(outro.itens)),
+      observador(outro.observador), alterados(outro.alterados) {
+    outro.observador = nullptr;
+    outro.alterados = nullptr;
+}
+
+/**
+ * Atribuição por cópia - mantém a ligação deste rider
+ */
+Rider& Rider::operator=(const Rider& outro) {
+    if (this != &outro) {
+        id = outro.id;
+        artistaId = outro.artistaId;
+        nome = outro.nome;
+        itens = outro.itens;
+        avisarObservador(0);  // Rider inteiro substituído (também anota no log)
+    }
+    return *this;
+}
+
+/**
+ * Atribuição por movimento - assume a ligação do outro
+ */
+Rider& Rider::operator=(Rider&& outro) noexcept {
+    if (this != &outro) {
+        id = outro.id;
+        artistaId = outro.artistaId;
+        nome = move(outro.nome);
+        itens = move(outro.itens);
+        observador = outro.observador;
+        alterados = outro.alterados;
+        outro.observador = nullptr;
+        outro.alterados = nullptr;
+    }
+    return *this;
+}
+
+// ==================== GETTERS ====================
+
+int Rider::getId() const {
+    return id;
+}
+
+int Rider::getArtistaId() const {
+    return artistaId;
+}
+
+string Rider::getNome() const {
+    return nome;
+}
+
+const MapaPequeno<int, ItemRider>& Rider::getItens() const {
+    return itens;
+}
+
+// ==================== SETTERS ====================
+
+void Rider::setNome(const string& nome) {
+    if (nome.empty()) {
+        throw ValidacaoException("Nome do rider não pode ser vazio");
+    }
+    this->nome = nome;
+    if (alterados != nullptr) {
+        alterados->push_back(id);
+    }
+}
+
+/**
+ * Define quantidade exigida de um item (substitui)
+ */
+void Rider::definirItem(int itemId, const string& nomeItem, int quantidade) {
+    if (quantidade <= 0) {
+        throw ValidacaoException("Quantidade do rider deve ser maior que zero");
+    }
+    itens[itemId] = ItemRider(itemId, nomeItem, quantidade);
+    avisarObservador(itemId);
+}
+
+/**
+ * Remove item do rider
+ */
+bool Rider::removerItem(int itemId) {
+    if (itens.erase(itemId) == 0) {
+        return false;
+    }
+    avisarObservador(itemId);
+    return true;
+}
+
+/**
+ * Liga ao observador do gerenciador
+ */
+void Rider::ligarObservador(const function<void(int, int)>* observador) {
+    this->observador = observador;
+}
+
+/**
+ * Avisa o observador do gerenciador
+ */
+void Rider::avisarObservador(int itemId) {
+    if (alterados != nullptr) {
+        alterados->push_back(id);  // Todo aviso é uma alteração do rider
+    }
+    if (observador != nullptr && *observador) {
+        (*observador)(artistaId, itemId);
+    }
+}
+
+/**
+ * Liga ao log de alterações do gerenciador
+ */
+void Rider::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+}
+
+/**
+ * Converte itens para o formato de Estoque::removerLote
+ */
+map<int, int> Rider::quantidadesPorItem() const {
+    map<int, int> quantidades;
+    for (const auto& par : itens) {
+        quantidades[par.first] = par.second.quantidade;
+    }
+    return quantidades;
+}
+
+/**
+ * Exibe rider formatado
+ */
+string Rider::exibir() const {
+    stringstream ss;
+    ss << "=== RIDER ===" << endl;
+    ss << "ID: " << id << endl;
+    ss << "Nome: " << nome << endl;
+    ss << "Artista ID: " << artistaId << endl;
+
+    if (itens.empty()) {
+        ss << "  Nenhum item no rider" << endl;
+        return ss.str();
+    }
+
+    ss << "\nItens exigidos:" << endl;
+    ss << left << setw(5) << "  ID" << setw(30) << "Nome"
+       << setw(10) << "Quantidade" << endl;
+    ss << "  " << string(42, '-') << endl;
+    for (const auto& par : itens) {
+        const ItemRider& item = par.second;
+        ss << left << setw(5) << "  " + to_string(item.itemId)
+           << setw(30) << item.nomeItem
+           << setw(10) << item.quantidade << endl;
+    }
+
+    return ss.str();
+}
+
+/**
+ * Sobrecarga do operador << para cout
+ */
+ostream& operator<<(ostream& os, const Rider& rider) {
+    os << rider.exibir();
+    return os;
+}
+
+// ==================== Classe GerenciadorRiders ====================
+
+/**
+ * Construtor - inicializa próximo ID como 1
+ */
+GerenciadorRiders::GerenciadorRiders() : proximoId(1), alterados(nullptr) {}
+
+/**
+ * Cadastra rider vazio (CREATE)
+ */
+int GerenciadorRiders::cadastrar(int artistaId, const string& nome) {
+    if (artistaId <= 0) {
+        throw ValidacaoException("Rider precisa de um artista");
+    }
+    if (nome.empty()) {
+        throw ValidacaoException("Nome do rider não pode ser vazio");
+    }
+
+    riders.push_back(Rider(proximoId, artistaId, nome));
+    riders.back().ligarObservador(&observadorRider);
+    riders.back().ligarAlteracoes(alterados);
+    if (alterados != nullptr) {
+        alterados->push_back(proximoId);
+    }
+    if (observadorRider) {
+        observadorRider(artistaId, 0);  // Rider novo (vazio) passa a ser o vigente
+    }
+    return proximoId++;
+}
+
+/**
+ * Busca rider por ID (READ)
+ */
+Rider* GerenciadorRiders::buscarPorId(int id) {
+    for (auto& rider : riders) {
+        if (rider.getId() == id) {
+            return &rider;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Rider vigente do artista (último cadastrado)
+ */
+Rider* GerenciadorRiders::buscarPorArtista(int artistaId) {
+    Rider* vigente = nullptr;
+    for (auto& rider : riders) {
+        if (rider.getArtistaId() == artistaId) {
+            vigente = &rider;  // IDs crescem: o último encontrado é o mais recente
+        }
+    }
+    return vigente;
+}
+
+/**
+ * Remove rider (DELETE)
+ */
+bool GerenciadorRiders::remover(int id) {
+    Rider* removido = buscarPorId(id);
+    if (removido == nullptr) {
+        return false;
+    }
+    int artistaId = removido->getArtistaId();  // Lido antes: remove_if deixa o fim sem valor definido
+    riders.erase(remove_if(riders.begin(), riders.end(),
+                           [id](const Rider& r) { return r.getId() == id; }),
+                 riders.end());
+    if (alterados != nullptr) {
+        alterados->push_back(id);  // Ausente na confirmação = removido
+    }
+    if (observadorRider) {
+        observadorRider(artistaId, 0);  // O vigente pode ter voltado a ser um anterior
+    }
+    return true;
+}
+
+/**
+ * Lista todos os riders (READ ALL)
+ */
+vector<Rider> GerenciadorRiders::listar() const {
+    return riders;
+}
+
+/**
+ * Índice artista → rider vigente
+ */
+unordered_map<int, const Rider*> GerenciadorRiders::indicePorArtista() const {
+    unordered_map<int, const Rider*> indice;
+    indice.reserve(riders.size());
+    for (const auto& rider : riders) {
+        indice[rider.getArtistaId()] = &rider;  // Último cadastrado vence
+    }
+    return indice;
+}
+
+/**
+ * Valida itens do rider no catálogo
+ */
+void GerenciadorRiders::validarCatalogo(const Rider& rider, GerenciadorItens& catalogo) {
+    for (const auto& par : rider.getItens()) {
+        if (catalogo.buscarPorId(par.first) == nullptr) {
+            throw ItemException("Item " + par.second.nomeItem + " (ID: " + to_string(par.first) +
+                                ") do rider não existe mais no catálogo");
+        }
+    }
+}
+
+/**
+ * Aplica rider a um camarim (transação em lote)
+ */
+void GerenciadorRiders::aplicar(int riderId, int camarimId, GerenciadorItens& catalogo,
+                                Estoque& estoque, GerenciadorCamarins& camarins) {
+    Rider* rider = buscarPorId(riderId);
+    if (rider == nullptr) {
+        throw ValidacaoException("Rider com ID " + to_string(riderId) + " não encontrado");
+    }
+    if (rider->getItens().empty()) {
+        throw ValidacaoException("Rider não possui itens");
+    }
+
+    Camarim* camarim = camarins.buscarPorId(camarimId);
+    if (camarim == nullptr) {
+        throw CamarimException("Camarim com ID " + to_string(camarimId) + " não encontrado");
+    }
+
+    // 1. Validação completa ANTES de mexer no estoque
+    validarCatalogo(*rider, catalogo);
+
+    // 2. Saída em lote: tudo ou nada
+    estoque.removerLote(rider->quantidadesPorItem());
+
+    // 3. Entrega no camarim (nome atual do catálogo)
+    for (const auto& par : rider->getItens()) {
+        camarim->inserirItem(par.first, catalogo.buscarPorId(par.first)->getNome(),
+                             par.second.quantidade);
+    }
+}
+
+/**
+ * Abastece todos os camarins (uma saída em lote para todos)
+ */
+int GerenciadorRiders::provisionarCamarins(GerenciadorItens& catalogo, Estoque& estoque,
+                                           GerenciadorCamarins& camarins) {
+    // Índice artista → rider vigente (montado uma vez, consulta O(1))
+    unordered_map<int, const Rider*> riderPorArtista = indicePorArtista();
+
+    // Camarins que serão abastecidos e demanda total
+    vector<pair<int, const Rider*>> entregas;  // (camarimId, rider)
+    map<int, int> demanda;                      // itemId → soma de todos os camarins
+    for (const auto& camarim : camarins.getCamarins()) {  // Só leitura: sem cópia
+        auto it = riderPorArtista.find(camarim.getArtistaId());
+        if (camarim.getArtistaId() == 0 || it == riderPorArtista.end() ||
+            it->second->getItens().empty()) {
+            continue;  // Sem artista ou sem rider: nada a abastecer
+        }
+        entregas.emplace_back(camarim.getId(), it->second);
+        for (const auto& par : it->second->getItens()) {
+            demanda[par.first] += par.second.quantidade;
+        }
+    }
+
+    if (entregas.empty()) {
+        return 0;
+    }
+
+    // Validação por item distinto (não por linha de camarim)
+    map<int, string> nomes;  // Nome atual no catálogo
+    for (const auto& par : demanda) {
+        Item* item = catalogo.buscarPorId(par.first);
+        if (item == nullptr) {
+            throw ItemException("Item ID " + to_string(par.first) +
+                                " de um rider não existe mais no catálogo");
+        }
+        nomes[par.first] = item->getNome();
+    }
+
+    // UMA saída em lote para a abertura de portas inteira (tudo ou nada)
+    estoque.removerLote(demanda);
+
+    for (const auto& entrega : entregas) {
+        Camarim* camarim = camarins.buscarPorId(entrega.first);
+        for (const auto& par : entrega.second->getItens()) {
+            camarim->inserirItem(par.first, nomes[par.first], par.second.quantidade);
+        }
+    }
+    return (int)entregas.size();
+}
+
+/**
+ * Define o observador e liga os riders já cadastrados
+ */
+void GerenciadorRiders::definirObservadorRider(function<void(int artistaId, int itemId)> observador) {
+    observadorRider = observador;
+    for (auto& rider : riders) {
+        rider.ligarObservador(&observadorRider);
+    }
+}
+
+/**
+ * Liga log de alterações ao gerenciador e aos riders já cadastrados
+ */
+void GerenciadorRiders::ligarAlteracoes(vector<int>* alterados) {
+    this->alterados = alterados;
+    for (auto& rider : riders) {
+        rider.ligarAlteracoes(alterados);
+    }
+}
@@ -0,0 +1,205 @@
+/**
+ * @file separacao.cpp
+ * @brief Implementação da classe OndaSeparacao
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa a consolidação de pedidos com redução paralela.
+ */
+
+// Inclui header da classe
+#include "separacao.h"
+// Para threads da redução paralela
+#include <thread>
+// Para min
+#include <algorithm>
+// Para stringstream (construir strings)
+#include <sstream>
+// Para formatação (setw, left)
+#include <iomanip>
+
+// Abaixo deste número de pedidos, criar threads custa mais que consolidar
+static const size_t MIN_PEDIDOS_POR_THREAD = 256;
+
+/**
+ * Construtor - onda vazia
+ */
+OndaSeparacao::OndaSeparacao() {}
+
+/**
+ * Soma um pedido aos totais
+ */
+void OndaSeparacao::acumular(const Pedido& pedido) {
+    if (pedido.getItens().empty()) {
+        return;  // Pedido sem itens: nada a separar
+    }
+    
+    pedidoIds.push_back(pedido.getId());
+    map<int, ItemPedido>& entrega = porCamarim[pedido.getCamarimId()];
+
+    for (const auto& par : pedido.getItens()) {
+        const ItemPedido& item = par.second;
+
+        // Total geral do item (o que o runner retira do estoque)
+        ItemPedido& total = totais[item.itemId];
+        total.itemId = item.itemId;
+        total.nomeItem = item.nomeItem;
+        total.quantidade += item.quantidade;
+
+        // Parte deste camarim (onde o runner entrega)
+        ItemPedido& parte = entrega[item.itemId];
+        parte.itemId = item.itemId;
+        parte.nomeItem = item.nomeItem;
+        parte.quantidade += item.quantidade;
+    }
+}
+
+/**
+ * Funde uma onda parcial nesta
+ */
+void OndaSeparacao::mesclar(const OndaSeparacao& outra) {
+    pedidoIds.insert(pedidoIds.end(), outra.pedidoIds.begin(), outra.pedidoIds.end());
+
+    for (const auto& par : outra.totais) {
+        ItemPedido& total = totais[par.first];
+        total.itemId = par.second.itemId;
+        total.nomeItem = par.second.nomeItem;
+        total.quantidade += par.second.quantidade;
+    }
+
+    for (const auto& camarim : outra.porCamarim) {
+        map<int, ItemPedido>& entrega = porCamarim[camarim.first];
+        for (const auto& par : camarim.second) {
+            ItemPedido& parte = entrega[par.first];
+            parte.itemId = par.second.itemId;
+            parte.nomeItem = par.second.nomeItem;
+            parte.quantidade += par.second.quantidade;
+        }
+    }
+}
+
+/**
+ * Planeja onda de separação (redução paralela)
+ */
+OndaSeparacao OndaSeparacao::planejar(const vector<const Pedido*>& pedidos) {
+    size_t numThreads = thread::hardware_concurrency();
+    if (numThreads == 0) {
+        numThreads = 1;  // hardware_concurrency() pode retornar 0 se desconhecido
+    }
+    numThreads = min(numThreads, pedidos.size() / MIN_PEDIDOS_POR_THREAD);
+
+    // Conjunto pequeno: consolida na thread atual
+    if (numThreads <= 1) {
+        OndaSeparacao onda;
+        for (const Pedido* pedido : pedidos) {
+            onda.acumular(*pedido);
+        }
+        return onda;
+    }
+
+    // MAP: cada thread consolida uma fatia contígua em sua onda parcial
+    vector<OndaSeparacao> parciais(numThreads);
+    vector<thread> threads;
+    size_t fatia = (pedidos.size() + numThreads - 1) / numThreads;
+
+    for (size_t t = 0; t < numThreads; t++) {
+        size_t inicio = t * fatia;
+        size_t fim = min(pedidos.size(), inicio + fatia);
+
+        threads.emplace_back([&pedidos, &parciais, t, inicio, fim]() {
+            for (size_t i = inicio; i < fim; i++) {
+                parciais[t].acumular(*pedidos[i]);  // Cada thread escreve só na sua parcial
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();  // Aguarda todas as fatias
+    }
+
+    // REDUCE: funde as parciais em ordem (preserva ordem dos pedidos)
+    OndaSeparacao onda = move(parciais[0]);
+    for (size_t t = 1; t < numThreads; t++) {
+        onda.mesclar(parciais[t]);
+    }
+    return onda;
+}
+
+// ==================== GETTERS ====================
+
+const vector<int>& OndaSeparacao::getPedidoIds() const {
+    return pedidoIds;
+}
+
+const map<int, ItemPedido>& OndaSeparacao::getTotais() const {
+    return totais;
+}
+
+const map<int, map<int, ItemPedido>>& OndaSeparacao::getPorCamarim() const {
+    return porCamarim;
+}
+
+bool OndaSeparacao::vazia() const {
+    return totais.empty();
+}
+
+/**
+ * Converte totais para o formato de Estoque::removerLote
+ */
+map<int, int> OndaSeparacao::quantidadesPorItem() const {
+    map<int, int> quantidades;
+    for (const auto& par : totais) {
+        quantidades[par.first] = par.second.quantidade;
+    }
+    return quantidades;
+}
+
+/**
+ * Exibe a onda formatada
+ */
+string OndaSeparacao::exibir() const {
+    stringstream ss;
+    ss << "=== ONDA DE SEPARAÇÃO ===" << endl;
+    ss << "Pedidos consolidados: " << pedidoIds.size() << endl;
+
+    if (totais.empty()) {
+        ss << "  Nenhum item a separar" << endl;
+        return ss.str();
+    }
+
+    // Retirada no estoque (uma linha por item)
+    ss << "\nRetirar do estoque:" << endl;
+    ss << left << setw(5) << "  ID" << setw(30) << "Nome"
+       << setw(10) << "Quantidade" << endl;
+    ss << "  " << string(42, '-') << endl;
+    for (const auto& par : totais) {
+        const ItemPedido& item = par.second;
+        ss << left << setw(5) << "  " + to_string(item.itemId)
+           << setw(30) << item.nomeItem
+           << setw(10) << item.quantidade << endl;
+    }
+
+    // Entrega por camarim
+    ss << "\nEntregar nos camarins:" << endl;
+    for (const auto& camarim : porCamarim) {
+        if (camarim.second.empty()) {
+            continue;  // Pedidos sem itens não geram entrega
+        }
+        ss << "  Camarim " << camarim.first << ":" << endl;
+        for (const auto& par : camarim.second) {
+            ss << "    " << left << setw(30) << par.second.nomeItem
+               << par.second.quantidade << endl;
+        }
+    }
+
+    return ss.str();
+}
+
+/**
+ * Sobrecarga do operador << para cout
+ */
+ostream& operator<<(ostream& os, const OndaSeparacao& onda) {
+    os << onda.exibir();
+    return os;
+}
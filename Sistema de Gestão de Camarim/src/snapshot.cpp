@@ -0,0 +1,1003 @@
+/**
+ * @file snapshot.cpp
+ * @brief Implementação da classe ArquivoSnapshot
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Implementa o formato de seções fixas e a leitura por mapeamento em memória.
+ */
+
+// Inclui header da classe
+#include "snapshot.h"
+// Inclui todos os gerenciadores de um evento
+#include "evento.h"
+// Inclui exceções customizadas
+#include "excecoes.h"
+// Inclui o CRC-32C do conteúdo
+#include "checksum.h"
+// Para gravação do arquivo
+#include <fstream>
+// Para rename (troca atômica do arquivo)
+#include <filesystem>
+// Para memcpy (registros lidos sem cast de ponteiro)
+#include <cstring>
+// Para limites das seções
+#include <limits>
+
+#ifndef _WIN32
+// Mapeamento em memória (POSIX)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// ==================== FORMATO ====================
+
+// Identificação do formato no início do arquivo
+static const char ASSINATURA[4] = {'C', 'M', 'P', 'S'};
+static const uint32_t VERSAO_FORMATO = 2;       // 2: CRC-32C do conteúdo no cabeçalho
+static const uint32_t VERSAO_SEM_CRC = 1;       // Ainda carregada (sem conferir CRC)
+static const uint32_t MARCA_ORDEM_BYTES = 0x01020304;  // Lida diferente em máquina de outra ordem
+
+/**
+ * Tipos de seção (valores fazem parte do formato: não renumerar)
+ */
+enum TipoSecao : uint32_t {
+    SECAO_EVENTOS = 1,
+    SECAO_ITENS,
+    SECAO_ARTISTAS,
+    SECAO_CAMARINS,
+    SECAO_CAMARIM_ITENS,
+    SECAO_ESTOQUE,
+    SECAO_PEDIDOS,
+    SECAO_PEDIDO_ITENS,
+    SECAO_LISTAS,
+    SECAO_LISTA_ITENS,
+    SECAO_RIDERS,
+    SECAO_RIDER_ITENS,
+    SECAO_EQUIPE,
+    SECAO_RESERVAS,
+    SECAO_FORNECEDORES,
+    SECAO_OFERTAS,
+    SECAO_MINIMOS,
+    SECAO_TEXTO
+};
+
+// Seções gravadas para cada evento (de SECAO_ITENS a SECAO_MINIMOS)
+static const uint32_t SECOES_POR_EVENTO = SECAO_MINIMOS - SECAO_ITENS + 1;
+
+/**
+ * Cabeçalho - 64 bytes
+ */
+struct CabecalhoSnapshot {
+    char assinatura[4];
+    uint32_t versao;
+    uint32_t ordemBytes;
+    uint32_t numSecoes;
+    uint64_t tamanhoArquivo;
+    int64_t instanteNs;        // Relógio monotônico na gravação
+    int32_t proximoEventoId;
+    uint32_t crcConteudo;      // CRC-32C de tudo depois do cabeçalho
+    uint64_t geracaoLog;       // Log de alterações até esta geração já está no estado
+    uint32_t reservaFim[4];
+};
+
+/**
+ * Entrada da tabela de seções - 32 bytes
+ */
+struct EntradaSecao {
+    uint32_t tipo;
+    int32_t eventoId;          // 0 = seção global
+    uint64_t deslocamento;     // Posição no arquivo (múltiplo de 8)
+    uint64_t quantidade;       // Número de registros
+    uint32_t tamanhoRegistro;  // Bytes por registro (conferido na carga)
+    uint32_t reserva;
+};
+
+/**
+ * Texto = posição e tamanho na área de texto
+ */
+struct TextoSnapshot {
+    uint64_t deslocamento;
+    uint32_t tamanho;
+    uint32_t reserva;
+};
+
+// ==================== REGISTROS ====================
+// Só campos de tamanho fixo, sem preenchimento implícito (static_assert abaixo)
+
+struct RegistroEvento {
+    int32_t id;
+    int32_t proximoItem;
+    int32_t proximoArtista;
+    int32_t proximoCamarim;
+    int32_t proximoPedido;
+    int32_t proximoLista;
+    int32_t proximoRider;
+    int32_t proximoEquipe;
+    int32_t proximoReserva;
+    int32_t proximoFornecedor;
+    TextoSnapshot nome;
+};
+
+struct RegistroItem {
+    int32_t id;
+    int32_t reserva;
+    double preco;
+    TextoSnapshot nome;
+};
+
+struct RegistroArtista {
+    int32_t id;
+    int32_t camarimId;
+    TextoSnapshot nome;
+};
+
+struct RegistroCamarim {   // Também usado para riders (dono = artistaId)
+    int32_t id;
+    int32_t dono;
+    uint32_t numItens;
+    uint32_t reserva;
+    TextoSnapshot nome;
+};
+
+struct RegistroQuantidade {  // Itens de camarim, estoque, rider e pedido
+    int32_t itemId;
+    int32_t quantidade;
+    int32_t atendida;          // Só pedidos (quantidade já entregue)
+    int32_t reserva;
+    TextoSnapshot nome;
+};
+
+struct RegistroPedido {
+    int32_t id;
+    int32_t camarimId;
+    int32_t prioridade;
+    int32_t flags;             // 1 = atendido, 2 = aguardando estoque
+    int32_t pedidoOrigemId;
+    int32_t backorderId;
+    int64_t criadoEm;
+    int64_t ultimoItemEm;
+    int64_t reservadoEm;
+    int64_t atendidoEm;
+    uint32_t numItens;
+    uint32_t reserva;
+    TextoSnapshot nomeArtista;
+};
+
+struct RegistroLista {
+    int32_t id;
+    uint32_t numItens;
+    TextoSnapshot descricao;
+};
+
+struct RegistroLinhaCompra {
+    int32_t itemId;
+    int32_t quantidade;
+    double preco;
+    int32_t acompanhaCatalogo;  // 1 = versão de preço do catálogo (refeita na carga)
+    int32_t reserva;
+    TextoSnapshot nome;
+};
+
+struct RegistroMembro {
+    int32_t id;
+    int32_t funcao;             // FuncaoEquipe
+    TextoSnapshot nome;
+    TextoSnapshot atributo;     // Área, veículo ou posto
+};
+
+struct RegistroReserva {
+    int32_t id;
+    int32_t camarimId;
+    int32_t artistaId;
+    int32_t inicio;
+    int32_t fim;
+    int32_t reserva;
+};
+
+struct RegistroFornecedor {
+    int32_t id;
+    int32_t reserva;
+    TextoSnapshot nome;
+};
+
+struct RegistroOferta {
+    int32_t fornecedorId;
+    int32_t itemId;
+    int64_t precoCentavos;
+    int32_t quantidadeMinima;
+    int32_t tamanhoEmbalagem;
+};
+
+struct RegistroMinimo {
+    int32_t itemId;
+    int32_t minimo;
+};
+
+// O formato depende destes tamanhos: mudar um registro exige nova versão
+static_assert(sizeof(CabecalhoSnapshot) == 64, "cabeçalho do snapshot mudou de tamanho");
+static_assert(sizeof(EntradaSecao) == 32, "entrada de seção mudou de tamanho");
+static_assert(sizeof(RegistroEvento) == 56, "registro de evento mudou de tamanho");
+static_assert(sizeof(RegistroItem) == 32, "registro de item mudou de tamanho");
+static_assert(sizeof(RegistroPedido) == 80, "registro de pedido mudou de tamanho");
+static_assert(sizeof(RegistroLinhaCompra) == 40, "registro de linha de compra mudou de tamanho");
+static_assert(sizeof(RegistroMembro) == 40, "registro de membro mudou de tamanho");
+
+/**
+ * Tamanho esperado do registro de cada tipo (0 = tipo desconhecido)
+ */
+static uint32_t tamanhoRegistro(uint32_t tipo) {
+    switch (tipo) {
+        case SECAO_EVENTOS:        return sizeof(RegistroEvento);
+        case SECAO_ITENS:          return sizeof(RegistroItem);
+        case SECAO_ARTISTAS:       return sizeof(RegistroArtista);
+        case SECAO_CAMARINS:       return sizeof(RegistroCamarim);
+        case SECAO_CAMARIM_ITENS:  return sizeof(RegistroQuantidade);
+        case SECAO_ESTOQUE:        return sizeof(RegistroQuantidade);
+        case SECAO_PEDIDOS:        return sizeof(RegistroPedido);
+        case SECAO_PEDIDO_ITENS:   return sizeof(RegistroQuantidade);
+        case SECAO_LISTAS:         return sizeof(RegistroLista);
+        case SECAO_LISTA_ITENS:    return sizeof(RegistroLinhaCompra);
+        case SECAO_RIDERS:         return sizeof(RegistroCamarim);
+        case SECAO_RIDER_ITENS:    return sizeof(RegistroQuantidade);
+        case SECAO_EQUIPE:         return sizeof(RegistroMembro);
+        case SECAO_RESERVAS:       return sizeof(RegistroReserva);
+        case SECAO_FORNECEDORES:   return sizeof(RegistroFornecedor);
+        case SECAO_OFERTAS:        return sizeof(RegistroOferta);
+        case SECAO_MINIMOS:        return sizeof(RegistroMinimo);
+        case SECAO_TEXTO:          return 1;
+        default:                   return 0;
+    }
+}
+
+// ==================== ESCRITA ====================
+
+/**
+ * Monta o arquivo inteiro em memória (uma única escrita no disco)
+ */
+struct EscritorSnapshot {
+    string dados;                  // Cabeçalho + tabela + seções
+    string texto;                  // Área de texto (vai para o fim)
+    vector<EntradaSecao> secoes;   // Tabela, na ordem das seções
+    size_t registros;
+
+    EscritorSnapshot() : registros(0) {}
+
+    void alinhar() {
+        dados.append((8 - dados.size() % 8) % 8, '\0');
+    }
+
+    void abrirSecao(uint32_t tipo, int32_t eventoId) {
+        alinhar();
+        EntradaSecao secao = {};
+        secao.tipo = tipo;
+        secao.eventoId = eventoId;
+        secao.deslocamento = dados.size();
+        secao.tamanhoRegistro = tamanhoRegistro(tipo);
+        secoes.push_back(secao);
+    }
+
+    template<typename T>
+    void anexar(const T& registro) {
+        dados.append(reinterpret_cast<const char*>(&registro), sizeof(T));
+        secoes.back().quantidade++;
+        registros++;
+    }
+
+    TextoSnapshot guardar(const string& valor) {
+        TextoSnapshot ref = {};
+        ref.deslocamento = texto.size();
+        ref.tamanho = (uint32_t)valor.size();
+        texto.append(valor);
+        return ref;
+    }
+};
+
+/**
+ * Grava as seções de um evento (a ordem das seções é a do enum)
+ */
+void ArquivoSnapshot::gravarEvento(Evento& evento, EscritorSnapshot& escritor) {
+    int32_t eventoId = evento.getId();
+
+    // Linhas que acompanham o catálogo saem com o preço atual (versão é refeita na carga)
+    evento.getListasCompras().reprecificar(evento.getItens());
+
+    escritor.abrirSecao(SECAO_ITENS, eventoId);
+    for (const Item& item : evento.getItens().itens) {
+        RegistroItem registro = {};
+        registro.id = item.getId();
+        registro.preco = item.getPreco();
+        registro.nome = escritor.guardar(item.getNome());
+        escritor.anexar(registro);
+    }
+
+    escritor.abrirSecao(SECAO_ARTISTAS, eventoId);
+    for (const Artista& artista : evento.getArtistas().artistas) {
+        RegistroArtista registro = {};
+        registro.id = artista.getId();
+        registro.camarimId = artista.getCamarimId();
+        registro.nome = escritor.guardar(artista.getNome());
+        escritor.anexar(registro);
+    }
+
+    const vector<Camarim>& camarins = evento.getCamarins().camarins;
+    escritor.abrirSecao(SECAO_CAMARINS, eventoId);
+    for (const Camarim& camarim : camarins) {
+        RegistroCamarim registro = {};
+        registro.id = camarim.getId();
+        registro.dono = camarim.getArtistaId();
+        registro.numItens = (uint32_t)camarim.getItens().size();
+        registro.nome = escritor.guardar(camarim.getNome());
+        escritor.anexar(registro);
+    }
+    escritor.abrirSecao(SECAO_CAMARIM_ITENS, eventoId);
+    for (const Camarim& camarim : camarins) {
+        for (const auto& par : camarim.getItens()) {
+            RegistroQuantidade registro = {};
+            registro.itemId = par.second.itemId;
+            registro.quantidade = par.second.quantidade;
+            registro.nome = escritor.guardar(par.second.nomeItem);
+            escritor.anexar(registro);
+        }
+    }
+
+    escritor.abrirSecao(SECAO_ESTOQUE, eventoId);
+    for (const ItemEstoque& item : evento.getEstoque().listar()) {
+        RegistroQuantidade registro = {};
+        registro.itemId = item.itemId;
+        registro.quantidade = item.quantidade;
+        registro.nome = escritor.guardar(item.nomeItem);
+        escritor.anexar(registro);
+    }
+
+    const vector<Pedido>& pedidos = evento.getPedidos().pedidos;
+    escritor.abrirSecao(SECAO_PEDIDOS, eventoId);
+    for (const Pedido& pedido : pedidos) {
+        RegistroPedido registro = {};
+        registro.id = pedido.id;
+        registro.camarimId = pedido.camarimId;
+        registro.prioridade = pedido.prioridade;
+        registro.flags = (pedido.atendido ? 1 : 0) | (pedido.aguardandoEstoque ? 2 : 0);
+        registro.pedidoOrigemId = pedido.pedidoOrigemId;
+        registro.backorderId = pedido.backorderId;
+        registro.criadoEm = pedido.criadoEm;
+        registro.ultimoItemEm = pedido.ultimoItemEm;
+        registro.reservadoEm = pedido.reservadoEm;
+        registro.atendidoEm = pedido.atendidoEm;
+        registro.numItens = (uint32_t)pedido.itens.size();
+        registro.nomeArtista = escritor.guardar(pedido.nomeArtista);
+        escritor.anexar(registro);
+    }
+    escritor.abrirSecao(SECAO_PEDIDO_ITENS, eventoId);
+    for (const Pedido& pedido : pedidos) {
+        for (const auto& par : pedido.itens) {
+            RegistroQuantidade registro = {};
+            registro.itemId = par.second.itemId;
+            registro.quantidade = par.second.quantidade;
+            registro.atendida = par.second.quantidadeAtendida;
+            registro.nome = escritor.guardar(par.second.nomeItem);
+            escritor.anexar(registro);
+        }
+    }
+
+    const vector<ListaCompras>& listas = evento.getListasCompras().listas;
+    escritor.abrirSecao(SECAO_LISTAS, eventoId);
+    for (const ListaCompras& lista : listas) {
+        RegistroLista registro = {};
+        registro.id = lista.getId();
+        registro.numItens = (uint32_t)lista.getItens().size();
+        registro.descricao = escritor.guardar(lista.getDescricao());
+        escritor.anexar(registro);
+    }
+    escritor.abrirSecao(SECAO_LISTA_ITENS, eventoId);
+    for (const ListaCompras& lista : listas) {
+        for (const auto& par : lista.getItens()) {
+            RegistroLinhaCompra registro = {};
+            registro.itemId = par.second.itemId;
+            registro.quantidade = par.second.quantidade;
+            registro.preco = par.second.preco;
+            registro.acompanhaCatalogo = par.second.versaoPreco != 0 ? 1 : 0;
+            registro.nome = escritor.guardar(par.second.nomeItem);
+            escritor.anexar(registro);
+        }
+    }
+
+    const vector<Rider>& riders = evento.getRiders().riders;
+    escritor.abrirSecao(SECAO_RIDERS, eventoId);
+    for (const Rider& rider : riders) {
+        RegistroCamarim registro = {};
+        registro.id = rider.getId();
+        registro.dono = rider.getArtistaId();
+        registro.numItens = (uint32_t)rider.getItens().size();
+        registro.nome = escritor.guardar(rider.getNome());
+        escritor.anexar(registro);
+    }
+    escritor.abrirSecao(SECAO_RIDER_ITENS, eventoId);
+    for (const Rider& rider : riders) {
+        for (const auto& par : rider.getItens()) {
+            RegistroQuantidade registro = {};
+            registro.itemId = par.second.itemId;
+            registro.quantidade = par.second.quantidade;
+            registro.nome = escritor.guardar(par.second.nomeItem);
+            escritor.anexar(registro);
+        }
+    }
+
+    const GerenciadorEquipe& equipe = evento.getEquipe();
+    escritor.abrirSecao(SECAO_EQUIPE, eventoId);
+    auto gravarMembro = [&escritor](int id, FuncaoEquipe funcao, const string& nome, const string& atributo) {
+        RegistroMembro registro = {};
+        registro.id = id;
+        registro.funcao = (int32_t)funcao;
+        registro.nome = escritor.guardar(nome);
+        registro.atributo = escritor.guardar(atributo);
+        escritor.anexar(registro);
+    };
+    for (const Produtor& produtor : equipe.produtores) {
+        gravarMembro(produtor.getId(), FuncaoEquipe::PRODUTOR, produtor.getNome(), produtor.getArea());
+    }
+    for (const Runner& runner : equipe.runners) {
+        gravarMembro(runner.getId(), FuncaoEquipe::RUNNER, runner.getNome(), runner.getVeiculo());
+    }
+    for (const Seguranca& seguranca : equipe.segurancas) {
+        gravarMembro(seguranca.getId(), FuncaoEquipe::SEGURANCA, seguranca.getNome(), seguranca.getPosto());
+    }
+
+    escritor.abrirSecao(SECAO_RESERVAS, eventoId);
+    for (const auto& par : evento.getAgenda().porId) {
+        const Reserva& reserva = par.second;
+        RegistroReserva registro = {};
+        registro.id = reserva.id;
+        registro.camarimId = reserva.camarimId;
+        registro.artistaId = reserva.artistaId;
+        registro.inicio = reserva.inicio;
+        registro.fim = reserva.fim;
+        escritor.anexar(registro);
+    }
+
+    const CatalogoFornecedores& fornecedores = evento.getFornecedores();
+    escritor.abrirSecao(SECAO_FORNECEDORES, eventoId);
+    for (const auto& par : fornecedores.fornecedores) {
+        RegistroFornecedor registro = {};
+        registro.id = par.first;
+        registro.nome = escritor.guardar(par.second);
+        escritor.anexar(registro);
+    }
+    escritor.abrirSecao(SECAO_OFERTAS, eventoId);
+    for (const auto& par : fornecedores.ofertasPorItem) {
+        for (const OfertaFornecedor& oferta : par.second) {
+            RegistroOferta registro = {};
+            registro.fornecedorId = oferta.fornecedorId;
+            registro.itemId = oferta.itemId;
+            registro.precoCentavos = oferta.precoCentavos;
+            registro.quantidadeMinima = oferta.quantidadeMinima;
+            registro.tamanhoEmbalagem = oferta.tamanhoEmbalagem;
+            escritor.anexar(registro);
+        }
+    }
+
+    // Estoque mínimo é o único dado digitado da lista automática (o resto é derivado)
+    escritor.abrirSecao(SECAO_MINIMOS, eventoId);
+    for (const Item& item : evento.getItens().itens) {
+        int minimo = evento.getListaAutomatica().getNecessidade(item.getId()).minimo;
+        if (minimo > 0) {
+            RegistroMinimo registro = {};
+            registro.itemId = item.getId();
+            registro.minimo = minimo;
+            escritor.anexar(registro);
+        }
+    }
+}
+
+/**
+ * Monta o arquivo inteiro em memória
+ */
+string ArquivoSnapshot::serializar(GerenciadorEventos& eventos, int64_t agoraNs, uint64_t geracaoLog,
+                                   ResumoSnapshot& resumo) {
+    EscritorSnapshot escritor;
+    uint32_t numSecoes = 2 + SECOES_POR_EVENTO * (uint32_t)eventos.eventos.size();
+
+    // Cabeçalho e tabela são preenchidos no fim (tamanho já conhecido)
+    escritor.dados.assign(sizeof(CabecalhoSnapshot) + numSecoes * sizeof(EntradaSecao), '\0');
+
+    escritor.abrirSecao(SECAO_EVENTOS, 0);
+    for (const auto& par : eventos.eventos) {
+        Evento& evento = *par.second;
+        RegistroEvento registro = {};
+        registro.id = evento.getId();
+        registro.proximoItem = evento.getItens().proximoId;
+        registro.proximoArtista = evento.getArtistas().proximoId;
+        registro.proximoCamarim = evento.getCamarins().proximoId;
+        registro.proximoPedido = evento.getPedidos().proximoId;
+        registro.proximoLista = evento.getListasCompras().proximoId;
+        registro.proximoRider = evento.getRiders().proximoId;
+        registro.proximoEquipe = evento.getEquipe().proximoId;
+        registro.proximoReserva = evento.getAgenda().proximoId;
+        registro.proximoFornecedor = evento.getFornecedores().proximoId;
+        registro.nome = escritor.guardar(evento.getNome());
+        escritor.anexar(registro);
+    }
+
+    for (const auto& par : eventos.eventos) {
+        gravarEvento(*par.second, escritor);
+    }
+
+    escritor.abrirSecao(SECAO_TEXTO, 0);
+    escritor.secoes.back().quantidade = escritor.texto.size();
+    escritor.dados.append(escritor.texto);
+
+    CabecalhoSnapshot cabecalho = {};
+    memcpy(cabecalho.assinatura, ASSINATURA, sizeof(ASSINATURA));
+    cabecalho.versao = VERSAO_FORMATO;
+    cabecalho.ordemBytes = MARCA_ORDEM_BYTES;
+    cabecalho.numSecoes = numSecoes;
+    cabecalho.tamanhoArquivo = escritor.dados.size();
+    cabecalho.instanteNs = agoraNs;
+    cabecalho.proximoEventoId = eventos.proximoId;
+    cabecalho.geracaoLog = geracaoLog;
+    memcpy(&escritor.dados[sizeof(cabecalho)], escritor.secoes.data(), numSecoes * sizeof(EntradaSecao));
+    cabecalho.crcConteudo = crc32c(escritor.dados.data() + sizeof(cabecalho), escritor.dados.size() - sizeof(cabecalho));
+    memcpy(&escritor.dados[0], &cabecalho, sizeof(cabecalho));
+
+    resumo.eventos = eventos.eventos.size();
+    resumo.registros = escritor.registros;
+    resumo.bytes = escritor.dados.size();
+    resumo.geracaoLog = geracaoLog;
+    return move(escritor.dados);
+}
+
+/**
+ * Grava bytes montados (arquivo temporário + rename)
+ */
+void ArquivoSnapshot::gravarArquivo(const string& dados, const string& caminho) {
+    // Temporário + rename: queda no meio da gravação não estraga o estado anterior
+    string temporario = caminho + ".tmp";
+    {
+        ofstream saida(temporario, ios::binary | ios::trunc);
+        if (!saida.is_open()) {
+            throw PersistenciaException("Não foi possível criar " + temporario);
+        }
+        saida.write(dados.data(), (streamsize)dados.size());
+        if (!saida.flush()) {
+            throw PersistenciaException("Falha ao gravar o estado em " + temporario);
+        }
+    }
+    error_code erro;
+    filesystem::rename(temporario, caminho, erro);
+    if (erro) {
+        throw PersistenciaException("Não foi possível substituir " + caminho + ": " + erro.message());
+    }
+}
+
+/**
+ * Grava todos os eventos
+ */
+ResumoSnapshot ArquivoSnapshot::gravar(GerenciadorEventos& eventos, const string& caminho, int64_t agoraNs,
+                                       uint64_t geracaoLog) {
+    ResumoSnapshot resumo;
+    gravarArquivo(serializar(eventos, agoraNs, geracaoLog, resumo), caminho);
+    return resumo;
+}
+
+// ==================== LEITURA ====================
+
+/**
+ * Arquivo inteiro acessível como bytes: mmap no POSIX, buffer no Windows
+ */
+class MapaArquivo {
+private:
+    const char* base;
+    size_t tamanho;
+    bool mapeado;
+    string buffer;  // Usado só quando não há mmap
+
+public:
+    explicit MapaArquivo(const string& caminho) : base(nullptr), tamanho(0), mapeado(false) {
+#ifndef _WIN32
+        int fd = open(caminho.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw PersistenciaException("Não foi possível abrir " + caminho);
+        }
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* mapa = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapa != MAP_FAILED) {
+                madvise(mapa, (size_t)info.st_size, MADV_SEQUENTIAL);  // Leitura do início ao fim
+                base = static_cast<const char*>(mapa);
+                tamanho = (size_t)info.st_size;
+                mapeado = true;
+            }
+        }
+        close(fd);  // O mapeamento continua válido sem o descritor
+        if (mapeado) {
+            return;
+        }
+#endif
+        ifstream entrada(caminho, ios::binary);
+        if (!entrada.is_open()) {
+            throw PersistenciaException("Não foi possível abrir " + caminho);
+        }
+        buffer.assign((istreambuf_iterator<char>(entrada)), istreambuf_iterator<char>());
+        base = buffer.data();
+        tamanho = buffer.size();
+    }
+
+    ~MapaArquivo() {
+#ifndef _WIN32
+        if (mapeado) {
+            munmap(const_cast<char*>(base), tamanho);
+        }
+#endif
+    }
+
+    MapaArquivo(const MapaArquivo&) = delete;
+    MapaArquivo& operator=(const MapaArquivo&) = delete;
+
+    const char* dados() const { return base; }
+    size_t getTamanho() const { return tamanho; }
+    bool isMapeado() const { return mapeado; }
+};
+
+/**
+ * Acesso validado às seções de um arquivo já conferido
+ */
+struct LeitorSnapshot {
+    const char* base;
+    const char* texto;
+    uint64_t tamanhoTexto;
+    map<pair<int32_t, uint32_t>, EntradaSecao> secoes;  // (eventoId, tipo) → seção
+
+    const EntradaSecao& secao(int32_t eventoId, uint32_t tipo) const {
+        auto it = secoes.find(make_pair(eventoId, tipo));
+        if (it == secoes.end()) {
+            throw PersistenciaException("Seção " + to_string(tipo) + " do evento " +
+                                        to_string(eventoId) + " ausente");
+        }
+        return it->second;
+    }
+
+    template<typename T>
+    T registro(const EntradaSecao& secao, uint64_t indice) const {
+        T valor;
+        memcpy(&valor, base + secao.deslocamento + indice * sizeof(T), sizeof(T));
+        return valor;
+    }
+
+    string lerTexto(const TextoSnapshot& ref) const {
+        if (ref.deslocamento > tamanhoTexto || ref.tamanho > tamanhoTexto - ref.deslocamento) {
+            throw PersistenciaException("Texto fora da área de texto");
+        }
+        return string(texto + ref.deslocamento, ref.tamanho);
+    }
+};
+
+/**
+ * Percorre os filhos de uma seção, na ordem dos pais
+ */
+class CursorFilhos {
+private:
+    const LeitorSnapshot& leitor;
+    const EntradaSecao& secao;
+    uint64_t proximo;
+
+public:
+    CursorFilhos(const LeitorSnapshot& leitor, const EntradaSecao& secao)
+        : leitor(leitor), secao(secao), proximo(0) {}
+
+    template<typename T>
+    void paraCada(uint32_t quantidade, const function<void(const T&)>& acao) {
+        if (quantidade > secao.quantidade - proximo) {
+            throw PersistenciaException("Seção " + to_string(secao.tipo) + " com menos filhos que o indicado");
+        }
+        for (uint32_t i = 0; i < quantidade; i++) {
+            acao(leitor.registro<T>(secao, proximo++));
+        }
+    }
+
+    void conferirFim() const {
+        if (proximo != secao.quantidade) {
+            throw PersistenciaException("Seção " + to_string(secao.tipo) + " com filhos sem pai");
+        }
+    }
+};
+
+/**
+ * Instante salvo trazido para o relógio atual (0 = não ocorreu)
+ */
+static int64_t ajustarInstante(int64_t instante, int64_t deslocamentoNs) {
+    if (instante == 0) {
+        return 0;
+    }
+    int64_t ajustado = instante + deslocamentoNs;
+    return ajustado == 0 ? 1 : ajustado;  // 0 significaria "não ocorreu"
+}
+
+/**
+ * Restaura um evento (gerenciadores vazios, sem observadores ligados)
+ */
+void ArquivoSnapshot::restaurarEvento(Evento& evento, const RegistroEvento& registro,
+                                      const LeitorSnapshot& leitor, int64_t deslocamentoNs) {
+    int32_t eventoId = registro.id;
+
+    // Catálogo: versões de preço recomeçam (listas são religadas abaixo)
+    GerenciadorItens& itens = evento.getItens();
+    const EntradaSecao& secaoItens = leitor.secao(eventoId, SECAO_ITENS);
+    itens.itens.reserve(secaoItens.quantidade);
+    for (uint64_t i = 0; i < secaoItens.quantidade; i++) {
+        RegistroItem item = leitor.registro<RegistroItem>(secaoItens, i);
+        itens.itens.push_back(Item(item.id, leitor.lerTexto(item.nome), item.preco));
+        itens.versoesPreco.emplace_hint(itens.versoesPreco.end(), item.id, ++itens.ultimaVersaoPreco);
+    }
+    itens.proximoId = registro.proximoItem;
+
+    GerenciadorArtistas& artistas = evento.getArtistas();
+    const EntradaSecao& secaoArtistas = leitor.secao(eventoId, SECAO_ARTISTAS);
+    artistas.artistas.reserve(secaoArtistas.quantidade);
+    for (uint64_t i = 0; i < secaoArtistas.quantidade; i++) {
+        RegistroArtista artista = leitor.registro<RegistroArtista>(secaoArtistas, i);
+        artistas.artistas.push_back(Artista(artista.id, leitor.lerTexto(artista.nome), artista.camarimId));
+    }
+    artistas.proximoId = registro.proximoArtista;
+
+    GerenciadorCamarins& camarins = evento.getCamarins();
+    const EntradaSecao& secaoCamarins = leitor.secao(eventoId, SECAO_CAMARINS);
+    CursorFilhos itensCamarim(leitor, leitor.secao(eventoId, SECAO_CAMARIM_ITENS));
+    camarins.camarins.reserve(secaoCamarins.quantidade);
+    for (uint64_t i = 0; i < secaoCamarins.quantidade; i++) {
+        RegistroCamarim camarim = leitor.registro<RegistroCamarim>(secaoCamarins, i);
+        Camarim novo(camarim.id, leitor.lerTexto(camarim.nome), camarim.dono);
+        itensCamarim.paraCada<RegistroQuantidade>(camarim.numItens, [&](const RegistroQuantidade& item) {
+            novo.inserirItem(item.itemId, leitor.lerTexto(item.nome), item.quantidade);
+        });
+        camarins.camarins.push_back(move(novo));
+    }
+    itensCamarim.conferirFim();
+    camarins.proximoId = registro.proximoCamarim;
+    evento.getAtribuicoes().reconstruir(artistas, camarins);
+
+    const EntradaSecao& secaoEstoque = leitor.secao(eventoId, SECAO_ESTOQUE);
+    for (uint64_t i = 0; i < secaoEstoque.quantidade; i++) {
+        RegistroQuantidade item = leitor.registro<RegistroQuantidade>(secaoEstoque, i);
+        evento.getEstoque().adicionarItem(item.itemId, leitor.lerTexto(item.nome), item.quantidade);
+    }
+
+    // Pedidos: índices de espera e demanda pendente são refeitos
+    GerenciadorPedidos& pedidos = evento.getPedidos();
+    const EntradaSecao& secaoPedidos = leitor.secao(eventoId, SECAO_PEDIDOS);
+    CursorFilhos itensPedido(leitor, leitor.secao(eventoId, SECAO_PEDIDO_ITENS));
+    pedidos.pedidos.reserve(secaoPedidos.quantidade);
+    for (uint64_t i = 0; i < secaoPedidos.quantidade; i++) {
+        RegistroPedido salvo = leitor.registro<RegistroPedido>(secaoPedidos, i);
+        Pedido pedido(salvo.id, salvo.camarimId, leitor.lerTexto(salvo.nomeArtista));
+        pedido.prioridade = salvo.prioridade;
+        pedido.atendido = (salvo.flags & 1) != 0;
+        pedido.aguardandoEstoque = (salvo.flags & 2) != 0;
+        pedido.pedidoOrigemId = salvo.pedidoOrigemId;
+        pedido.backorderId = salvo.backorderId;
+        pedido.criadoEm = ajustarInstante(salvo.criadoEm, deslocamentoNs);
+        pedido.ultimoItemEm = ajustarInstante(salvo.ultimoItemEm, deslocamentoNs);
+        pedido.reservadoEm = ajustarInstante(salvo.reservadoEm, deslocamentoNs);
+        pedido.atendidoEm = ajustarInstante(salvo.atendidoEm, deslocamentoNs);
+        itensPedido.paraCada<RegistroQuantidade>(salvo.numItens, [&](const RegistroQuantidade& item) {
+            ItemPedido linha(item.itemId, leitor.lerTexto(item.nome), item.quantidade);
+            linha.quantidadeAtendida = item.atendida;
+            pedido.itens[item.itemId] = linha;
+        });
+        pedidos.pedidos.push_back(move(pedido));
+    }
+    itensPedido.conferirFim();
+    for (Pedido& pedido : pedidos.pedidos) {
+        pedidos.prepararLatencia(pedido.camarimId);
+        if (pedido.aguardandoEstoque) {
+            pedidos.indexarEspera(pedido);
+        }
+        if (GerenciadorPedidos::contaDemanda(pedido)) {
+            pedidos.somarDemanda(pedido, 1);
+        }
+    }
+    pedidos.proximoId = registro.proximoPedido;
+
+    // Listas: religadas ao total geral, ao índice e ao total por item do gerenciador
+    GerenciadorListaCompras& listas = evento.getListasCompras();
+    const EntradaSecao& secaoListas = leitor.secao(eventoId, SECAO_LISTAS);
+    CursorFilhos itensLista(leitor, leitor.secao(eventoId, SECAO_LISTA_ITENS));
+    listas.listas.reserve(secaoListas.quantidade);
+    for (uint64_t i = 0; i < secaoListas.quantidade; i++) {
+        RegistroLista lista = leitor.registro<RegistroLista>(secaoListas, i);
+        listas.listas.push_back(ListaCompras(lista.id, leitor.lerTexto(lista.descricao)));
+        ListaCompras& nova = listas.listas.back();
+        nova.ligarTotalGeral(&listas.totalGeralCentavos);
+        nova.ligarIndice(&listas.listasPorItem);
+        nova.ligarQuantidades(&listas.quantidadesItens, &listas.observadorQuantidade);
+        itensLista.paraCada<RegistroLinhaCompra>(lista.numItens, [&](const RegistroLinhaCompra& item) {
+            long long versao = item.acompanhaCatalogo ? itens.getVersaoPreco(item.itemId) : 0;
+            nova.adicionarItem(item.itemId, leitor.lerTexto(item.nome), item.quantidade, item.preco, versao);
+        });
+    }
+    itensLista.conferirFim();
+    listas.proximoId = registro.proximoLista;
+
+    GerenciadorRiders& riders = evento.getRiders();
+    const EntradaSecao& secaoRiders = leitor.secao(eventoId, SECAO_RIDERS);
+    CursorFilhos itensRider(leitor, leitor.secao(eventoId, SECAO_RIDER_ITENS));
+    riders.riders.reserve(secaoRiders.quantidade);
+    for (uint64_t i = 0; i < secaoRiders.quantidade; i++) {
+        RegistroCamarim rider = leitor.registro<RegistroCamarim>(secaoRiders, i);
+        Rider novo(rider.id, rider.dono, leitor.lerTexto(rider.nome));
+        itensRider.paraCada<RegistroQuantidade>(rider.numItens, [&](const RegistroQuantidade& item) {
+            novo.definirItem(item.itemId, leitor.lerTexto(item.nome), item.quantidade);
+        });
+        riders.riders.push_back(move(novo));
+    }
+    itensRider.conferirFim();
+    riders.proximoId = registro.proximoRider;
+
+    GerenciadorEquipe& equipe = evento.getEquipe();
+    const EntradaSecao& secaoEquipe = leitor.secao(eventoId, SECAO_EQUIPE);
+    for (uint64_t i = 0; i < secaoEquipe.quantidade; i++) {
+        RegistroMembro membro = leitor.registro<RegistroMembro>(secaoEquipe, i);
+        string nome = leitor.lerTexto(membro.nome);
+        string atributo = leitor.lerTexto(membro.atributo);
+        switch ((FuncaoEquipe)membro.funcao) {
+            case FuncaoEquipe::PRODUTOR:
+                equipe.indiceProdutores[membro.id] = equipe.produtores.size();
+                equipe.produtores.emplace_back(membro.id, nome, atributo);
+                break;
+            case FuncaoEquipe::RUNNER:
+                equipe.indiceRunners[membro.id] = equipe.runners.size();
+                equipe.runners.emplace_back(membro.id, nome, atributo);
+                break;
+            case FuncaoEquipe::SEGURANCA:
+                equipe.indiceSegurancas[membro.id] = equipe.segurancas.size();
+                equipe.segurancas.emplace_back(membro.id, nome, atributo);
+                break;
+            default:
+                throw PersistenciaException("Função de equipe desconhecida: " + to_string(membro.funcao));
+        }
+        equipe.funcaoPorId[membro.id] = (FuncaoEquipe)membro.funcao;
+    }
+    equipe.proximoId = registro.proximoEquipe;
+
+    AgendaCamarins& agenda = evento.getAgenda();
+    const EntradaSecao& secaoReservas = leitor.secao(eventoId, SECAO_RESERVAS);
+    for (uint64_t i = 0; i < secaoReservas.quantidade; i++) {
+        RegistroReserva salva = leitor.registro<RegistroReserva>(secaoReservas, i);
+        Reserva reserva(salva.id, salva.camarimId, salva.artistaId, salva.inicio, salva.fim);
+        agenda.porCamarim[reserva.camarimId][reserva.inicio] = reserva;
+        agenda.porArtista[reserva.artistaId][reserva.inicio] = reserva;
+        agenda.porId[reserva.id] = reserva;
+    }
+    agenda.proximoId = registro.proximoReserva;
+
+    CatalogoFornecedores& fornecedores = evento.getFornecedores();
+    const EntradaSecao& secaoFornecedores = leitor.secao(eventoId, SECAO_FORNECEDORES);
+    for (uint64_t i = 0; i < secaoFornecedores.quantidade; i++) {
+        RegistroFornecedor fornecedor = leitor.registro<RegistroFornecedor>(secaoFornecedores, i);
+        fornecedores.fornecedores[fornecedor.id] = leitor.lerTexto(fornecedor.nome);
+    }
+    fornecedores.proximoId = registro.proximoFornecedor;
+    const EntradaSecao& secaoOfertas = leitor.secao(eventoId, SECAO_OFERTAS);
+    for (uint64_t i = 0; i < secaoOfertas.quantidade; i++) {
+        RegistroOferta oferta = leitor.registro<RegistroOferta>(secaoOfertas, i);
+        fornecedores.definirOferta(oferta.fornecedorId, oferta.itemId, oferta.precoCentavos,
+                                   oferta.quantidadeMinima, oferta.tamanhoEmbalagem);
+    }
+
+    const EntradaSecao& secaoMinimos = leitor.secao(eventoId, SECAO_MINIMOS);
+    for (uint64_t i = 0; i < secaoMinimos.quantidade; i++) {
+        RegistroMinimo minimo = leitor.registro<RegistroMinimo>(secaoMinimos, i);
+        evento.getListaAutomatica().definirEstoqueMinimo(minimo.itemId, minimo.minimo);
+    }
+}
+
+/**
+ * Carrega o estado (tudo validado antes de criar qualquer evento)
+ */
+bool ArquivoSnapshot::carregar(const string& caminho, GerenciadorEventos& eventos, int64_t agoraNs,
+                               ResumoSnapshot& resumo) {
+    error_code erro;
+    if (!filesystem::exists(caminho, erro)) {
+        return false;  // Primeira execução: nada salvo ainda
+    }
+    if (!eventos.eventos.empty()) {
+        throw PersistenciaException("O estado só pode ser carregado em um sistema vazio");
+    }
+
+    MapaArquivo arquivo(caminho);
+    const char* base = arquivo.dados();
+    uint64_t tamanho = arquivo.getTamanho();
+
+    // 1. Cabeçalho
+    CabecalhoSnapshot cabecalho;
+    if (tamanho < sizeof(cabecalho)) {
+        throw PersistenciaException("Arquivo " + caminho + " pequeno demais para um estado salvo");
+    }
+    memcpy(&cabecalho, base, sizeof(cabecalho));
+    if (memcmp(cabecalho.assinatura, ASSINATURA, sizeof(ASSINATURA)) != 0) {
+        throw PersistenciaException("Arquivo " + caminho + " não é um estado salvo");
+    }
+    if (cabecalho.ordemBytes != MARCA_ORDEM_BYTES) {
+        throw PersistenciaException("Estado salvo em máquina com outra ordem de bytes");
+    }
+    if (cabecalho.versao != VERSAO_FORMATO && cabecalho.versao != VERSAO_SEM_CRC) {
+        throw PersistenciaException("Versão de formato desconhecida em " + caminho + ": " +
+                                    to_string(cabecalho.versao));
+    }
+    if (cabecalho.tamanhoArquivo != tamanho) {
+        throw PersistenciaException("Arquivo " + caminho + " truncado ou com sobra de bytes");
+    }
+    if (cabecalho.versao != VERSAO_SEM_CRC &&
+        cabecalho.crcConteudo != crc32c(base + sizeof(cabecalho), tamanho - sizeof(cabecalho))) {
+        throw PersistenciaException("Arquivo " + caminho + " corrompido (CRC do conteúdo não confere)");
+    }
+    if (cabecalho.numSecoes > (tamanho - sizeof(cabecalho)) / sizeof(EntradaSecao)) {
+        throw PersistenciaException("Tabela de seções maior que o arquivo");
+    }
+
+    // 2. Tabela de seções: limites, alinhamento e tamanho dos registros
+    LeitorSnapshot leitor;
+    leitor.base = base;
+    const EntradaSecao* secaoEventos = nullptr;
+    const EntradaSecao* secaoTexto = nullptr;
+    vector<EntradaSecao> tabela(cabecalho.numSecoes);
+    memcpy(tabela.data(), base + sizeof(cabecalho), tabela.size() * sizeof(EntradaSecao));
+    for (const EntradaSecao& secao : tabela) {
+        uint32_t esperado = tamanhoRegistro(secao.tipo);
+        if (esperado == 0 || secao.tamanhoRegistro != esperado) {
+            throw PersistenciaException("Seção de tipo " + to_string(secao.tipo) + " desconhecida ou de outro tamanho");
+        }
+        if (secao.deslocamento % 8 != 0 || secao.deslocamento > tamanho ||
+            secao.quantidade > (tamanho - secao.deslocamento) / esperado) {
+            throw PersistenciaException("Seção de tipo " + to_string(secao.tipo) + " fora do arquivo");
+        }
+        if (!leitor.secoes.emplace(make_pair(secao.eventoId, secao.tipo), secao).second) {
+            throw PersistenciaException("Seção de tipo " + to_string(secao.tipo) + " repetida");
+        }
+        if (secao.tipo == SECAO_EVENTOS) {
+            secaoEventos = &leitor.secoes.at(make_pair(secao.eventoId, secao.tipo));
+        } else if (secao.tipo == SECAO_TEXTO) {
+            secaoTexto = &leitor.secoes.at(make_pair(secao.eventoId, secao.tipo));
+        }
+    }
+    if (secaoEventos == nullptr || secaoTexto == nullptr) {
+        throw PersistenciaException("Estado salvo sem seção de eventos ou de texto");
+    }
+    leitor.texto = base + secaoTexto->deslocamento;
+    leitor.tamanhoTexto = secaoTexto->quantidade;
+
+    // 3. Eventos: qualquer falha desfaz tudo (o gerenciador volta vazio)
+    int64_t deslocamentoNs = agoraNs - cabecalho.instanteNs;
+    try {
+        for (uint64_t i = 0; i < secaoEventos->quantidade; i++) {
+            RegistroEvento registro = leitor.registro<RegistroEvento>(*secaoEventos, i);
+            if (registro.id <= 0 || eventos.eventos.count(registro.id)) {
+                throw PersistenciaException("ID de evento inválido ou repetido: " + to_string(registro.id));
+            }
+            Evento* evento = new Evento(registro.id, leitor.lerTexto(registro.nome));
+            eventos.eventos[registro.id] = unique_ptr<Evento>(evento);
+            restaurarEvento(*evento, registro, leitor, deslocamentoNs);
+            resumo.registros += 1;
+        }
+    } catch (const ExcecaoBase& e) {
+        eventos.eventos.clear();
+        throw PersistenciaException(string("Estado salvo inválido: ") + e.what());
+    } catch (...) {
+        eventos.eventos.clear();
+        throw;
+    }
+    eventos.proximoId = cabecalho.proximoEventoId;
+
+    resumo.eventos = eventos.eventos.size();
+    for (const EntradaSecao& secao : tabela) {
+        if (secao.tipo != SECAO_TEXTO && secao.tipo != SECAO_EVENTOS) {
+            resumo.registros += secao.quantidade;
+        }
+    }
+    resumo.bytes = tamanho;
+    resumo.mapeado = arquivo.isMapeado();
+    resumo.geracaoLog = cabecalho.geracaoLog;
+    return true;
+}
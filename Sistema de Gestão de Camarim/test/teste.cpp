@@ -0,0 +1,61 @@
+/**
+ * @file teste.cpp
+ * @brief Executável de testes: roda os casos registrados com CASO_TESTE
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Uso: bin/test [filtro] - sem filtro roda todos os casos.
+ * Código de saída 0 = todos passaram.
+ */
+
+// Inclui o registro de casos
+#include "teste.h"
+// Para saída dos resultados
+#include <iostream>
+// Para os diretórios temporários
+#include <filesystem>
+
+/**
+ * Lista única de casos (criada no primeiro registro)
+ */
+vector<CasoTeste>& casosTeste() {
+    static vector<CasoTeste> casos;
+    return casos;
+}
+
+/**
+ * Diretório temporário vazio para um caso
+ */
+string diretorioTeste(const string& nome) {
+    filesystem::path caminho = filesystem::temp_directory_path() / ("camarim_teste_" + nome);
+    filesystem::remove_all(caminho);
+    filesystem::create_directories(caminho);
+    return caminho.string() + "/";
+}
+
+int main(int argc, char* argv[]) {
+    string filtro = argc > 1 ? argv[1] : "";
+    int executados = 0;
+    int falhas = 0;
+
+    for (const CasoTeste& caso : casosTeste()) {
+        if (caso.nome.find(filtro) == string::npos) {
+            continue;
+        }
+        executados++;
+        try {
+            caso.funcao();
+            cout << "[OK] " << caso.nome << endl;
+        } catch (const FalhaTeste& e) {
+            falhas++;
+            cout << "[ERRO] " << caso.nome << " - " << e.what() << endl;
+        } catch (const exception& e) {  // ExcecaoBase e da biblioteca padrão
+            falhas++;
+            cout << "[ERRO] " << caso.nome << " - exceção: " << e.what() << endl;
+        }
+    }
+
+    cout << "\n" << executados - falhas << "/" << executados << " caso(s) passaram" << endl;
+    return falhas == 0 ? 0 : 1;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file teste.h
+ * @brief Casos de teste do alvo "make test" (compilados com -DTESTE)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ *
+ * Cada arquivo de test/ registra seus casos com CASO_TESTE(nome); o executável
+ * bin/test roda todos (ou só os que contêm o filtro passado em ARGS).
+ * Os casos que mexem em disco trabalham em um diretório temporário próprio.
+ */
+
+// Proteção contra inclusão múltipla
+#ifndef TESTE_H  // Se TESTE_H não foi definido
+#define TESTE_H  // Define TESTE_H
+
+// Bibliotecas necessárias
+#include <string>     // Para nomes e mensagens
+#include <vector>     // Para a lista de casos
+#include <stdexcept>  // Para runtime_error (falha de verificação)
+
+using namespace std;  // Namespace padrão
+
+/**
+ * @struct CasoTeste
+ * @brief Caso registrado (nome + função)
+ */
+struct CasoTeste {
+    string nome;
+    void (*funcao)();
+};  // Fim da struct CasoTeste
+
+/**
+ * @brief Casos registrados por todos os arquivos de test/
+ */
+vector<CasoTeste>& casosTeste();
+
+/**
+ * @struct RegistroTeste
+ * @brief Registra um caso na inicialização estática (usado por CASO_TESTE)
+ */
+struct RegistroTeste {
+    RegistroTeste(const char* nome, void (*funcao)()) {
+        casosTeste().push_back(CasoTeste{nome, funcao});
+    }
+};  // Fim da struct RegistroTeste
+
+/**
+ * @class FalhaTeste
+ * @brief Verificação que não passou (arquivo, linha e expressão)
+ */
+class FalhaTeste : public runtime_error {
+public:
+    explicit FalhaTeste(const string& mensagem) : runtime_error(mensagem) {}
+};  // Fim da classe FalhaTeste
+
+/**
+ * @brief Cria (vazio) um diretório temporário para o caso
+ * @return Caminho do diretório, terminado em '/'
+ */
+string diretorioTeste(const string& nome);
+
+// Declara e registra um caso: CASO_TESTE(nome) { ... }
+#define CASO_TESTE(nome)                                       \
+    static void nome();                                        \
+    static RegistroTeste registro_##nome(#nome, nome);         \
+    static void nome()
+
+// Interrompe o caso se a condição for falsa
+#define VERIFICAR(condicao)                                                                  \
+    do {                                                                                     \
+        if (!(condicao)) {                                                                   \
+            throw FalhaTeste(string(__FILE__) + ":" + to_string(__LINE__) + ": " #condicao); \
+        }                                                                                    \
+    } while (0)
+
+#endif // TESTE_H
+// Fim do include guard
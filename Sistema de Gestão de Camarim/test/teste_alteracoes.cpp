@@ -0,0 +1,133 @@
+/**
+ * @file teste_alteracoes.cpp
+ * @brief Casos de teste do log de alterações (reprodução depois de queda)
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o registro de casos
+#include "teste.h"
+// Inclui o log e os eventos
+#include "alteracoes.h"
+#include "evento.h"
+// Para cortar e alterar os arquivos das gerações
+#include <filesystem>
+#include <fstream>
+
+/**
+ * Troca um byte do arquivo (simula dano no disco)
+ */
+static void inverterByte(const string& caminho, uint64_t posicao) {
+    fstream arquivo(caminho, ios::in | ios::out | ios::binary);
+    arquivo.seekg((streamoff)posicao);
+    char byte = 0;
+    arquivo.get(byte);
+    arquivo.seekp((streamoff)posicao);
+    arquivo.put((char)(byte ^ 0x5A));
+}
+
+/**
+ * Queda no meio da escrita: o último quadro ficou pela metade
+ */
+CASO_TESTE(logQuadroRasgadoNoFinal) {
+    string prefixo = diretorioTeste("log_rasgado") + "alteracoes_";
+    GerenciadorEventos eventos;
+    Evento& evento = *eventos.buscarPorId(eventos.criar("Festival"));
+    LogAlteracoes log;
+    log.abrir(prefixo, 1);
+    log.acompanhar(evento);
+
+    int itemId = evento.getItens().cadastrar("Água", 2.5);
+    int artistaId = evento.getArtistas().cadastrar("Ana");
+    int riderId = evento.getRiders().cadastrar(artistaId, "Turnê");
+    evento.getRiders().buscarPorId(riderId)->definirItem(itemId, "Água", 6);
+    size_t registros = log.confirmar(1);
+    uint64_t inteiros = log.getBytesGeracao();
+
+    evento.getAgenda().reservar(1, artistaId, 0, 60);  // Um quadro só
+    VERIFICAR(log.confirmar(2) == 1);
+    uint64_t tamanho = log.getBytesGeracao();
+    filesystem::resize_file(prefixo + "1.log", tamanho - 5);
+
+    GerenciadorEventos carregados;
+    ResumoReproducao resumo = LogAlteracoes::reproduzir(prefixo, 0, carregados, 3);
+    VERIFICAR(resumo.arquivos == 1);
+    VERIFICAR(resumo.registros == registros);
+    VERIFICAR(resumo.bytesDescartados == tamanho - 5 - inteiros);
+
+    Evento* reaplicado = carregados.buscarPorId(evento.getId());
+    VERIFICAR(reaplicado != nullptr);
+    VERIFICAR(reaplicado->getItens().buscarPorId(itemId) != nullptr);
+    Rider* rider = reaplicado->getRiders().buscarPorId(riderId);
+    VERIFICAR(rider != nullptr && rider->getItens().find(itemId)->second.quantidade == 6);
+    VERIFICAR(reaplicado->getAgenda().quantidade() == 0);  // Quadro rasgado não é aplicado
+}
+
+/**
+ * Quadro corrompido encerra a sua geração, mas não as seguintes
+ */
+CASO_TESTE(logQuadroCorrompidoNaoAfetaGeracaoSeguinte) {
+    string prefixo = diretorioTeste("log_corrompido") + "alteracoes_";
+    GerenciadorEventos eventos;
+    Evento& evento = *eventos.buscarPorId(eventos.criar("Festival"));
+    LogAlteracoes log;
+    log.abrir(prefixo, 1);
+    log.acompanhar(evento);
+
+    int produtorId = evento.getEquipe().cadastrarProdutor("Paula", "Palco");
+    log.confirmar(1);
+    uint64_t antesDoDano = log.getBytesGeracao();
+    int fornecedorId = evento.getFornecedores().cadastrarFornecedor("Distribuidora");
+    evento.getFornecedores().definirOferta(fornecedorId, 1, 300, 6, 6);
+    log.confirmar(2);
+    uint64_t fechada = log.rotacionar();
+    VERIFICAR(fechada == 1);
+
+    evento.getListaAutomatica().definirEstoqueMinimo(evento.getItens().cadastrar("Gelo", 8.0), 12);
+    log.confirmar(3);
+
+    inverterByte(prefixo + "1.log", antesDoDano + 20);  // Corpo do quadro do fornecedor
+
+    GerenciadorEventos carregados;
+    ResumoReproducao resumo = LogAlteracoes::reproduzir(prefixo, 0, carregados, 4);
+    VERIFICAR(resumo.arquivos == 2);
+    VERIFICAR(resumo.maiorGeracao == 2);
+    VERIFICAR(resumo.bytesDescartados > 0);
+
+    Evento* reaplicado = carregados.buscarPorId(evento.getId());
+    VERIFICAR(reaplicado != nullptr);
+    FuncaoEquipe funcao;
+    VERIFICAR(reaplicado->getEquipe().buscarFuncao(produtorId, funcao) && funcao == FuncaoEquipe::PRODUTOR);
+    VERIFICAR(reaplicado->getFornecedores().getFornecedores().empty());
+    VERIFICAR(reaplicado->getItens().listar().size() == 1);
+    int geloId = reaplicado->getItens().listar().front().getId();
+    VERIFICAR(reaplicado->getListaAutomatica().getNecessidade(geloId).minimo == 12);
+}
+
+/**
+ * Cópias de listar() são avulsas: mexer nelas não vai para o log; mexer
+ * no camarim e no rider do gerenciador vai
+ */
+CASO_TESTE(logIgnoraCopiasDeListar) {
+    string prefixo = diretorioTeste("log_copias") + "alteracoes_";
+    GerenciadorEventos eventos;
+    Evento& evento = *eventos.buscarPorId(eventos.criar("Festival"));
+    LogAlteracoes log;
+    log.abrir(prefixo, 1);
+    log.acompanhar(evento);
+
+    int camarimId = evento.getCamarins().cadastrar("Camarim A");
+    int riderId = evento.getRiders().cadastrar(evento.getArtistas().cadastrar("Ana"), "Turnê");
+    log.confirmar(1);
+
+    Camarim copiaCamarim = evento.getCamarins().listar().front();
+    copiaCamarim.inserirItem(1, "Água", 6);
+    Rider copiaRider = evento.getRiders().listar().front();
+    copiaRider.definirItem(1, "Água", 6);
+    VERIFICAR(log.confirmar(2) == 0);
+
+    evento.getCamarins().buscarPorId(camarimId)->inserirItem(1, "Água", 6);
+    evento.getRiders().buscarPorId(riderId)->definirItem(1, "Água", 6);
+    VERIFICAR(log.confirmar(3) == 2);
+}
@@ -0,0 +1,160 @@
+/**
+ * @file teste_arquivo.cpp
+ * @brief Casos de teste do arquivo frio de pedidos e do seu índice
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o registro de casos
+#include "teste.h"
+// Inclui o arquivo, o índice e os pedidos
+#include "arquivo.h"
+#include "arvoreb.h"
+#include "pedido.h"
+#include "checksum.h"
+#include "excecoes.h"
+// Para ler, alterar e cortar o arquivo de dados
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+/**
+ * Arquivo com os pedidos 1..quantidade, um lote por pedido
+ */
+static void arquivarPedidos(const string& caminho, int quantidade) {
+    ArquivoPedidos arquivo(caminho);
+    for (int id = 1; id <= quantidade; id++) {
+        Pedido pedido(id, 1, "Artista " + to_string(id));
+        arquivo.anexar({&pedido});
+    }
+}
+
+static string lerArquivo(const string& caminho) {
+    ifstream entrada(caminho, ios::binary);
+    return string((istreambuf_iterator<char>(entrada)), istreambuf_iterator<char>());
+}
+
+static void gravarArquivo(const string& caminho, const string& dados) {
+    ofstream saida(caminho, ios::binary | ios::trunc);
+    saida << dados;
+}
+
+/**
+ * Queda no meio de sincronizar(): o índice ficou "em alteração" com
+ * entradas que não existem nos dados e é refeito a partir do arquivo
+ */
+CASO_TESTE(indiceRefeitoAposSincronizarInterrompido) {
+    string caminho = diretorioTeste("indice_interrompido") + "pedidos.dat";
+    arquivarPedidos(caminho, 300);
+
+    {
+        ArvoreBMais indice(caminho + ".idx", ArquivoPedidos::CACHE_INDICE_PADRAO);
+        indice.inserir(5, 999999);     // Posição que não é de registro nenhum
+        indice.inserir(1000, 123456);  // Pedido que nunca foi gravado
+    }  // Sem sincronizar: cabeçalho do índice continua "em alteração"
+
+    bool recusado = false;
+    try {
+        ArvoreBMais indice(caminho + ".idx", ArquivoPedidos::CACHE_INDICE_PADRAO);
+    } catch (const PersistenciaException&) {
+        recusado = true;
+    }
+    VERIFICAR(recusado);
+
+    ArquivoPedidos arquivo(caminho);
+    VERIFICAR(arquivo.quantidade() == 300);
+    VERIFICAR(!arquivo.contem(1000));
+    VERIFICAR(arquivo.getMaiorId() == 300);
+    Pedido pedido;
+    VERIFICAR(arquivo.buscar(5, pedido) && pedido.getNomeArtista() == "Artista 5");
+    VERIFICAR(arquivo.buscar(300, pedido) && pedido.getNomeArtista() == "Artista 300");
+    VERIFICAR(arquivo.getRegistrosCorrompidos() == 0);
+}
+
+/**
+ * Registro íntegro pelo CRC mas com ID ilegível no meio: fica fora do
+ * índice e os registros depois dele continuam no arquivo
+ */
+CASO_TESTE(registroIlegivelNoMeioNaoCortaOsSeguintes) {
+    string caminho = diretorioTeste("registro_ilegivel") + "pedidos.dat";
+    arquivarPedidos(caminho, 3);
+    filesystem::remove(caminho + ".idx");
+
+    // Registro do pedido 2: conteúdo trocado por um ID que não termina, CRC refeito
+    string dados = lerArquivo(caminho);
+    size_t posicao = 5 + 1 + (uint8_t)dados[5];  // Cabeçalho + registro 1 (tamanho em 1 byte)
+    size_t tamanho = (uint8_t)dados[posicao];
+    VERIFICAR(tamanho < 128);
+    char* registro = &dados[posicao + 1];
+    for (size_t i = 0; i < tamanho - 4; i++) {
+        registro[i] = (char)0xFF;
+    }
+    uint32_t crc = crc32c(registro, tamanho - 4);
+    for (int i = 0; i < 4; i++) {
+        registro[tamanho - 4 + i] = (char)((crc >> (8 * i)) & 0xFF);
+    }
+    gravarArquivo(caminho, dados);
+
+    ArquivoPedidos arquivo(caminho);
+    VERIFICAR(arquivo.getRegistrosCorrompidos() == 1);
+    VERIFICAR(arquivo.contem(1) && !arquivo.contem(2) && arquivo.contem(3));
+    VERIFICAR(arquivo.getTamanhoBytes() == dados.size());
+    VERIFICAR(filesystem::file_size(caminho) == dados.size());
+}
+
+/**
+ * Gravação interrompida no último registro: só o final incompleto sai
+ */
+CASO_TESTE(registroIncompletoNoFinalEhCortado) {
+    string caminho = diretorioTeste("registro_incompleto") + "pedidos.dat";
+    arquivarPedidos(caminho, 3);
+    uint64_t inteiro = filesystem::file_size(caminho);
+
+    string dados = lerArquivo(caminho);
+    dados.push_back((char)40);         // Tamanho de um registro de 40 bytes...
+    dados.append(string(10, '\x01'));  // ...do qual só 10 chegaram ao disco
+    gravarArquivo(caminho, dados);
+
+    ArquivoPedidos arquivo(caminho);
+    VERIFICAR(arquivo.quantidade() == 3);
+    VERIFICAR(arquivo.getRegistrosCorrompidos() == 0);
+    VERIFICAR(arquivo.getTamanhoBytes() == inteiro);
+    VERIFICAR(filesystem::file_size(caminho) == inteiro);
+}
+
+/**
+ * Byte de tamanho estragado no meio (maior: passa do fim do arquivo; menor:
+ * cai dentro do registro): os registros seguintes continuam no arquivo e
+ * no índice, inclusive depois de reabrir e de acrescentar outros
+ */
+CASO_TESTE(tamanhoEstragadoNoMeioNaoCortaOsSeguintes) {
+    for (int menor = 0; menor <= 1; menor++) {
+        string caminho = diretorioTeste("tamanho_estragado") + "pedidos.dat";
+        arquivarPedidos(caminho, 3);
+        filesystem::remove(caminho + ".idx");
+
+        string dados = lerArquivo(caminho);
+        size_t posicao = 5 + 1 + (uint8_t)dados[5];  // Tamanho do registro do pedido 2
+        VERIFICAR((uint8_t)dados[posicao] < 128);
+        dados[posicao] = menor ? (char)((uint8_t)dados[posicao] - 3) : (char)0x7F;
+        gravarArquivo(caminho, dados);
+
+        {
+            ArquivoPedidos arquivo(caminho);
+            VERIFICAR(arquivo.getRegistrosCorrompidos() == 1);
+            VERIFICAR(arquivo.contem(1) && !arquivo.contem(2) && arquivo.contem(3));
+            VERIFICAR(filesystem::file_size(caminho) == dados.size());
+            Pedido pedido(4, 1, "Artista 4");
+            arquivo.anexar({&pedido});
+        }
+
+        filesystem::remove(caminho + ".idx");  // Índice refeito desde o início
+        ArquivoPedidos arquivo(caminho);
+        VERIFICAR(arquivo.getRegistrosCorrompidos() == 1);
+        VERIFICAR(arquivo.quantidade() == 3);
+        Pedido pedido;
+        VERIFICAR(arquivo.buscar(3, pedido) && pedido.getNomeArtista() == "Artista 3");
+        VERIFICAR(arquivo.buscar(4, pedido) && pedido.getNomeArtista() == "Artista 4");
+    }
+}
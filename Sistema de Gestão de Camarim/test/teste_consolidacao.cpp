@@ -0,0 +1,79 @@
+/**
+ * @file teste_consolidacao.cpp
+ * @brief Casos de teste da consolidação de listas de compras
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o registro de casos
+#include "teste.h"
+// Inclui a consolidação e as listas
+#include "consolidacao.h"
+#include "listacompras.h"
+// Para os casos aleatórios (semente fixa: falha reproduzível)
+#include <random>
+#include <algorithm>
+#include <numeric>
+
+/**
+ * Mesmo resultado, linha por linha (inclusive a ordem das origens)
+ */
+static bool mesmaConsolidacao(const CompraConsolidada& a, const CompraConsolidada& b) {
+    if (a.getListaIds() != b.getListaIds() || a.getTotalCentavos() != b.getTotalCentavos() ||
+        a.getLinhas().size() != b.getLinhas().size()) {
+        return false;
+    }
+    for (const auto& par : a.getLinhas()) {
+        auto outra = b.getLinhas().find(par.first);
+        if (outra == b.getLinhas().end()) {
+            return false;
+        }
+        const LinhaConsolidada& x = par.second;
+        const LinhaConsolidada& y = outra->second;
+        if (x.itemId != y.itemId || x.nomeItem != y.nomeItem || x.quantidade != y.quantidade ||
+            x.precoCentavos != y.precoCentavos || x.subtotalCentavos != y.subtotalCentavos ||
+            x.precosDivergentes != y.precosDivergentes || x.origens != y.origens) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Redução paralela (fatias + fusão) igual à soma sequencial na thread
+ * atual, com listas de tamanhos e preços variados
+ */
+CASO_TESTE(consolidacaoParalelaIgualSequencial) {
+    mt19937 gerador(20250043);
+    auto sortear = [&gerador](int minimo, int maximo) {
+        return uniform_int_distribution<int>(minimo, maximo)(gerador);
+    };
+    vector<int> ids(3000);
+    iota(ids.begin(), ids.end(), 1);
+
+    for (int caso = 0; caso < 6; caso++) {
+        vector<ListaCompras> listas;
+        int numListas = sortear(10, 60);
+        listas.reserve(numListas);
+        for (int l = 0; l < numListas; l++) {
+            listas.emplace_back(l + 1, "Lista " + to_string(l + 1));
+            shuffle(ids.begin(), ids.end(), gerador);
+            int linhas = sortear(0, 9) == 0 ? 0 : sortear(1, 1500);  // Algumas vazias
+            for (int i = 0; i < linhas; i++) {
+                int itemId = ids[i] % 900 + 1;  // Itens repetidos entre listas
+                double preco = (100 + 25 * sortear(0, 2) + itemId % 7) / 100.0;  // Às vezes diverge
+                listas.back().adicionarItem(itemId, "Item " + to_string(itemId), sortear(1, 20), preco);
+            }
+        }
+        vector<const ListaCompras*> origens;
+        for (const ListaCompras& lista : listas) {
+            origens.push_back(&lista);
+        }
+
+        CompraConsolidada sequencial = CompraConsolidada::consolidar(origens, 1);
+        for (unsigned threads : {2u, 3u, 4u, 7u}) {
+            VERIFICAR(mesmaConsolidacao(sequencial, CompraConsolidada::consolidar(origens, threads)));
+        }
+    }
+}
@@ -0,0 +1,97 @@
+/**
+ * @file teste_copia.cpp
+ * @brief Casos de teste da cópia de segurança incremental e da verificação
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o registro de casos
+#include "teste.h"
+// Inclui a cópia de segurança
+#include "copia.h"
+// Para trocar de diretório e alterar arquivos
+#include <filesystem>
+#include <fstream>
+
+/**
+ * Troca o diretório atual enquanto existir (copiar() usa nomes relativos)
+ */
+class DiretorioAtual {
+private:
+    filesystem::path anterior;
+
+public:
+    explicit DiretorioAtual(const string& diretorio) : anterior(filesystem::current_path()) {
+        filesystem::current_path(diretorio);
+    }
+    ~DiretorioAtual() {
+        filesystem::current_path(anterior);
+    }
+};  // Fim da classe DiretorioAtual
+
+/**
+ * Arquivo com bytes previsíveis (diferentes em cada posição)
+ */
+static void criarArquivo(const string& nome, size_t tamanho) {
+    string dados(tamanho, '\0');
+    for (size_t i = 0; i < tamanho; i++) {
+        dados[i] = (char)(i * 31 + i / 4096);
+    }
+    ofstream saida(nome, ios::binary | ios::trunc);
+    saida << dados;
+}
+
+/**
+ * Reescreve um byte no lugar (tamanho do arquivo não muda)
+ */
+static void alterarByte(const string& caminho, uint64_t posicao) {
+    fstream arquivo(caminho, ios::in | ios::out | ios::binary);
+    arquivo.seekg((streamoff)posicao);
+    char byte = 0;
+    arquivo.get(byte);
+    arquivo.seekp((streamoff)posicao);
+    arquivo.put((char)~byte);
+}
+
+/**
+ * Cópia incremental grava só o segmento alterado; a verificação acusa um
+ * byte trocado na própria cópia, e regravar o arquivo danificado a conserta
+ */
+CASO_TESTE(copiaIncrementalEVerificacaoDeByteTrocado) {
+    DiretorioAtual diretorio(diretorioTeste("copia"));
+    const uint64_t MB = 1 << 20;
+    criarArquivo("estado.snap", 3 * MB + 100);  // 4 segmentos
+    criarArquivo("pedidos.dat", 1000);          // 1 segmento
+    vector<string> arquivos = {"estado.snap", "pedidos.dat"};
+
+    ResumoCopia primeira = CopiaSeguranca::copiar(arquivos, "copia");
+    VERIFICAR(primeira.completa);
+    VERIFICAR(primeira.arquivos == 2);
+    VERIFICAR(primeira.segmentos == 5);
+    VERIFICAR(primeira.segmentosCopiados == 5);
+
+    // Um byte no segundo segmento muda na origem (data de modificação também)
+    alterarByte("estado.snap", MB + 10);
+    filesystem::last_write_time("estado.snap",
+                                filesystem::last_write_time("estado.snap") + chrono::seconds(2));
+
+    ResumoCopia segunda = CopiaSeguranca::copiar(arquivos, "copia");
+    VERIFICAR(!segunda.completa);
+    VERIFICAR(segunda.arquivosAlterados == 1);
+    VERIFICAR(segunda.segmentosCopiados == 1);
+    VERIFICAR(segunda.bytesCopiados == MB);
+    VERIFICAR(CopiaSeguranca::verificar("copia", 2).falhas.empty());
+
+    // Dano na cópia (a origem não muda): só a verificação encontra
+    alterarByte("copia/estado.snap", 3 * MB + 50);
+    ResumoVerificacao verificacao = CopiaSeguranca::verificar("copia", 2);
+    VERIFICAR(verificacao.arquivos == 2);
+    VERIFICAR(verificacao.segmentos == 5);
+    VERIFICAR(verificacao.falhas.size() == 1);
+    VERIFICAR(verificacao.danificados == vector<string>{"estado.snap"});
+
+    ResumoCopia reparo = CopiaSeguranca::copiar(arquivos, "copia", verificacao.danificados);
+    VERIFICAR(reparo.arquivosAlterados == 1);
+    VERIFICAR(CopiaSeguranca::verificar("copia", 2).falhas.empty());
+}
@@ -0,0 +1,124 @@
+/**
+ * @file teste_fornecedor.cpp
+ * @brief Casos de teste da divisão de listas entre fornecedores
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o registro de casos
+#include "teste.h"
+// Inclui o catálogo de fornecedores e a lista
+#include "fornecedor.h"
+#include "listacompras.h"
+// Para os casos aleatórios (semente fixa: falha reproduzível)
+#include <random>
+#include <climits>
+
+/**
+ * Menor custo por força bruta: cada oferta compra 0 ou uma quantidade
+ * válida (mínimo + embalagens) até a primeira que sozinha cobre o pedido
+ */
+static long long menorCustoForcaBruta(const vector<OfertaFornecedor>& ofertas, size_t oferta, int falta) {
+    if (falta <= 0) {
+        return 0;
+    }
+    if (oferta == ofertas.size()) {
+        return LLONG_MAX;  // Não cobre
+    }
+    long long melhor = menorCustoForcaBruta(ofertas, oferta + 1, falta);
+    const OfertaFornecedor& atual = ofertas[oferta];
+    for (int quantidade = atual.menorCompra(); ; quantidade += atual.tamanhoEmbalagem) {
+        long long resto = menorCustoForcaBruta(ofertas, oferta + 1, falta - quantidade);
+        if (resto != LLONG_MAX) {
+            melhor = min(melhor, quantidade * atual.precoCentavos + resto);
+        }
+        if (quantidade >= falta) {
+            break;
+        }
+    }
+    return melhor;
+}
+
+/**
+ * Confere a divisão contra a força bruta, item a item
+ */
+static void conferirDivisao(CatalogoFornecedores& catalogo, const ListaCompras& lista) {
+    DivisaoCompras divisao = catalogo.dividir(lista);
+
+    long long esperado = 0;
+    size_t semOferta = 0;
+    map<int, int> compradoPorItem;
+    long long somaSubtotais = 0;
+    for (const auto& pedido : divisao.getPorFornecedor()) {
+        for (const CompraFornecedor& compra : pedido.second) {
+            // Quantidade válida para a oferta deste fornecedor
+            const OfertaFornecedor* oferta = nullptr;
+            for (const OfertaFornecedor& candidata : catalogo.ofertasDoItem(compra.itemId)) {
+                if (candidata.fornecedorId == pedido.first) {
+                    oferta = &candidata;
+                }
+            }
+            VERIFICAR(oferta != nullptr);
+            VERIFICAR(compra.quantidade >= oferta->menorCompra());
+            VERIFICAR(compra.quantidade % oferta->tamanhoEmbalagem == 0);
+            VERIFICAR(compra.subtotalCentavos == compra.quantidade * oferta->precoCentavos);
+            compradoPorItem[compra.itemId] += compra.quantidade;
+            somaSubtotais += compra.subtotalCentavos;
+        }
+    }
+
+    for (const auto& par : lista.getItens()) {
+        const vector<OfertaFornecedor>& ofertas = catalogo.ofertasDoItem(par.first);
+        if (ofertas.empty()) {
+            semOferta++;
+            continue;
+        }
+        esperado += menorCustoForcaBruta(ofertas, 0, par.second.quantidade);
+        VERIFICAR(compradoPorItem[par.first] >= par.second.quantidade);
+    }
+    VERIFICAR(divisao.getSemOferta().size() == semOferta);
+    VERIFICAR(divisao.getTotalCentavos() == esperado);
+    VERIFICAR(somaSubtotais == esperado);
+}
+
+/**
+ * Divisão (e nova divisão depois de mudar um preço, usando o cache) contra
+ * força bruta em catálogos aleatórios pequenos
+ */
+CASO_TESTE(divisaoFornecedoresIgualForcaBruta) {
+    mt19937 gerador(20250042);
+    auto sortear = [&gerador](int minimo, int maximo) {
+        return uniform_int_distribution<int>(minimo, maximo)(gerador);
+    };
+
+    for (int caso = 0; caso < 3000; caso++) {
+        CatalogoFornecedores catalogo;
+        int fornecedores = sortear(1, 3);
+        int itens = sortear(1, 4);
+        for (int f = 0; f < fornecedores; f++) {
+            int fornecedorId = catalogo.cadastrarFornecedor("Fornecedor " + to_string(f));
+            for (int itemId = 1; itemId <= itens; itemId++) {
+                if (sortear(0, 9) < 7) {
+                    catalogo.definirOferta(fornecedorId, itemId, sortear(0, 500), sortear(1, 12), sortear(1, 6));
+                }
+            }
+        }
+
+        ListaCompras lista(1, "Compra");
+        for (int itemId = 1; itemId <= itens; itemId++) {
+            lista.adicionarItem(itemId, "Item " + to_string(itemId), sortear(1, 30), 1.0);
+        }
+        conferirDivisao(catalogo, lista);
+
+        // Um preço muda: só o item afetado é replanejado
+        int itemId = sortear(1, itens);
+        const vector<OfertaFornecedor>& ofertas = catalogo.ofertasDoItem(itemId);
+        if (!ofertas.empty()) {
+            OfertaFornecedor oferta = ofertas[sortear(0, (int)ofertas.size() - 1)];
+            catalogo.definirOferta(oferta.fornecedorId, itemId, sortear(0, 500),
+                                   oferta.quantidadeMinima, oferta.tamanhoEmbalagem);
+        }
+        conferirDivisao(catalogo, lista);
+    }
+}
@@ -0,0 +1,81 @@
+/**
+ * @file teste_orcamento.cpp
+ * @brief Casos de teste do otimizador de compras com orçamento
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o registro de casos
+#include "teste.h"
+// Inclui o otimizador e o catálogo
+#include "orcamento.h"
+#include "item.h"
+// Para os casos aleatórios (semente fixa: falha reproduzível)
+#include <random>
+#include <cmath>
+
+/**
+ * Melhor valor por força bruta: cada linha fica de fora, compra o mínimo
+ * ou compra tudo (3^n combinações)
+ */
+static double melhorValorForcaBruta(const vector<NecessidadeCompra>& necessidades,
+                                    const vector<long long>& precos, size_t linha,
+                                    long long restante) {
+    if (linha == necessidades.size()) {
+        return 0.0;
+    }
+    const NecessidadeCompra& necessidade = necessidades[linha];
+    double peso = OtimizadorCompras::peso(necessidade);
+    int minima = necessidade.quantidadeMinima;
+    int folga = necessidade.quantidade - minima;
+
+    double melhor = melhorValorForcaBruta(necessidades, precos, linha + 1, restante);
+    if (minima > 0 && folga > 0 && minima * precos[linha] <= restante) {
+        melhor = max(melhor, peso * 2 * minima +
+                     melhorValorForcaBruta(necessidades, precos, linha + 1, restante - minima * precos[linha]));
+    }
+    long long custoInteira = necessidade.quantidade * precos[linha];
+    if (custoInteira <= restante) {
+        melhor = max(melhor, peso * (2 * minima + folga) +
+                     melhorValorForcaBruta(necessidades, precos, linha + 1, restante - custoInteira));
+    }
+    return melhor;
+}
+
+/**
+ * Modo exato contra força bruta em listas aleatórias pequenas
+ */
+CASO_TESTE(orcamentoExatoIgualForcaBruta) {
+    mt19937 gerador(20250041);
+    auto sortear = [&gerador](int minimo, int maximo) {
+        return uniform_int_distribution<int>(minimo, maximo)(gerador);
+    };
+
+    for (int caso = 0; caso < 1000; caso++) {
+        GerenciadorItens catalogo;
+        vector<NecessidadeCompra> necessidades;
+        vector<long long> precos;
+        long long custoTotal = 0;
+        int linhas = sortear(1, 7);
+        for (int i = 0; i < linhas; i++) {
+            long long centavos = sortear(0, 9) == 0 ? 0 : sortear(1, 600);
+            int itemId = catalogo.cadastrar("Item " + to_string(i), centavos / 100.0);
+            int quantidade = sortear(1, 12);
+            double horas = sortear(0, 2) == 0 ? -1.0 : sortear(0, 72) / 2.0;
+            necessidades.push_back(NecessidadeCompra(itemId, quantidade, sortear(0, quantidade),
+                                                     sortear(0, 3) == 0, horas));
+            precos.push_back(centavos);
+            custoTotal += quantidade * centavos;
+        }
+        long long orcamento = sortear(0, (int)custoTotal);
+
+        ResultadoOrcamento resultado = OtimizadorCompras::otimizar(necessidades, catalogo, orcamento,
+                                                                   ModoOtimizacao::EXATO);
+        double esperado = melhorValorForcaBruta(necessidades, precos, 0, orcamento);
+        VERIFICAR(resultado.isExato());
+        VERIFICAR(resultado.getCustoCentavos() <= orcamento);
+        VERIFICAR(fabs(resultado.getValor() - esperado) <= 1e-9 * max(1.0, esperado));
+        VERIFICAR(resultado.getEscolhidas().size() + resultado.getAdiadas().size() == necessidades.size());
+    }
+}
@@ -0,0 +1,49 @@
+/**
+ * @file teste_recebimento.cpp
+ * @brief Casos de teste do diário de recebimentos
+ * @authors Fábio Augusto Vieira de Sales Vila
+ *          Jerônimo Rafael Bezerra Filho
+ *          Yuri Wendel do Nascimento
+ */
+
+// Inclui o registro de casos
+#include "teste.h"
+// Inclui o diário, a lista e o estoque
+#include "recebimento.h"
+// Para acrescentar ao diário um recebimento interrompido
+#include <fstream>
+
+/**
+ * Queda entre INICIO e CONFIRMADO: o recebimento aparece como pendente ao
+ * religar o diário; os confirmados e cancelados não aparecem
+ */
+CASO_TESTE(recebimentoInterrompidoFicaPendente) {
+    string caminho = diretorioTeste("recebimento_pendente") + "recebimentos.log";
+    Estoque estoque;
+    ListaCompras lista(7, "Bebidas");
+    lista.adicionarItem(1, "Água", 10, 2.5);
+    lista.adicionarItem(2, "Gelo", 4, 8.0);
+
+    DiarioRecebimentos diario;
+    diario.configurarArquivo(caminho);
+    VERIFICAR(diario.getPendentes().empty());
+    VERIFICAR(diario.receber(lista, {}, estoque, 100).id == 1);
+
+    {
+        ofstream saida(caminho, ios::app);
+        saida << "INICIO 2 lista=8 instante=200 linhas=2\n  1 6\n  2 3\n";  // Sem desfecho
+        saida << "INICIO 3 lista=9 instante=300 linhas=1\n  1 1\nCANCELADO 3\n";
+    }
+
+    DiarioRecebimentos religado;
+    religado.configurarArquivo(caminho);
+    const vector<Recebimento>& pendentes = religado.getPendentes();
+    VERIFICAR(pendentes.size() == 1);
+    VERIFICAR(pendentes[0].id == 2 && pendentes[0].listaId == 8 && pendentes[0].instanteNs == 200);
+    VERIFICAR(pendentes[0].entradas.size() == 2);
+    VERIFICAR(pendentes[0].entradas[1].itemId == 2 && pendentes[0].entradas[1].quantidade == 3);
+
+    ListaCompras outra(10, "Frutas");
+    outra.adicionarItem(3, "Uva", 2, 12.0);
+    VERIFICAR(religado.receber(outra, {}, estoque, 400).id == 4);  // Numeração continua
+}